@@ -0,0 +1,204 @@
+/*!
+ * \file   benchmarks/Benchmark.cxx
+ * \brief  This file implements the `BenchmarkSuite` class.
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright Copyright (C) 2006-2025 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <cmath>
+#include <regex>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <numeric>
+#include <iostream>
+#include <algorithm>
+#include <string_view>
+#include "TFEL/Raise.hxx"
+#include "TFEL/Config/GetTFELVersion.h"
+#include "Benchmark.hxx"
+
+namespace tfel::benchmarks {
+
+  static std::string escapeJSONString(std::string_view s) {
+    auto r = std::string{};
+    for (const auto c : s) {
+      if ((c == '"') || (c == '\\')) {
+        r += '\\';
+      }
+      r += c;
+    }
+    return r;
+  }  // end of escapeJSONString
+
+  static std::size_t convertToSize(std::string_view o, std::string_view v) {
+    const auto s = std::string{v};
+    auto p = std::size_t{};
+    auto r = 0ul;
+    try {
+      r = std::stoul(s, &p);
+    } catch (...) {
+      p = 0;
+    }
+    raise_if((p != s.size()) || (r == 0),
+             "BenchmarkSuite::execute: invalid value '" + s +
+                 "' for option '" + std::string{o} + "'");
+    return static_cast<std::size_t>(r);
+  }  // end of convertToSize
+
+  BenchmarkSuite::BenchmarkSuite(std::string n)
+      : name(std::move(n)) {}  // end of BenchmarkSuite
+
+  void BenchmarkSuite::add(std::string n, Benchmark b) {
+    const auto p = std::find_if(
+        this->benchmarks.begin(), this->benchmarks.end(),
+        [&n](const std::pair<std::string, Benchmark>& e) {
+          return e.first == n;
+        });
+    raise_if(p != this->benchmarks.end(),
+             "BenchmarkSuite::add: benchmark '" + n + "' already registred");
+    this->benchmarks.emplace_back(std::move(n), std::move(b));
+  }  // end of add
+
+  BenchmarkResult BenchmarkSuite::run(const std::string& n,
+                                      const Benchmark& b) const {
+    using clock = std::chrono::steady_clock;
+    for (std::size_t i = 0; i != this->warmup; ++i) {
+      b(this->operations);
+    }
+    auto times = std::vector<double>{};
+    times.reserve(this->repetitions);
+    for (std::size_t i = 0; i != this->repetitions; ++i) {
+      const auto start = clock::now();
+      b(this->operations);
+      const auto end = clock::now();
+      const auto d = std::chrono::duration<double, std::nano>(end - start);
+      times.push_back(d.count() / static_cast<double>(this->operations));
+    }
+    std::sort(times.begin(), times.end());
+    auto r = BenchmarkResult{};
+    r.name = n;
+    r.repetitions = this->repetitions;
+    r.operations = this->operations;
+    const auto nt = times.size();
+    r.min = times.front();
+    r.max = times.back();
+    r.median = (nt % 2 == 1) ? times[nt / 2]
+                             : (times[nt / 2 - 1] + times[nt / 2]) / 2;
+    r.mean = std::accumulate(times.begin(), times.end(), 0.) /
+             static_cast<double>(nt);
+    auto v = 0.;
+    for (const auto t : times) {
+      v += (t - r.mean) * (t - r.mean);
+    }
+    r.stddev = std::sqrt(v / static_cast<double>(nt));
+    return r;
+  }  // end of run
+
+  void BenchmarkSuite::writeJSON(
+      const std::string& f, const std::vector<BenchmarkResult>& results) const {
+    auto out = std::ofstream{f};
+    raise_if(!out, "BenchmarkSuite::writeJSON: can't open file '" + f + "'");
+    out.precision(8);
+    out << "{\n"
+        << "  \"suite\": \"" << escapeJSONString(this->name) << "\",\n"
+        << "  \"tfel_version\": \"" << escapeJSONString(getTFELVersion())
+        << "\",\n";
+#ifdef __VERSION__
+    out << "  \"compiler\": \"" << escapeJSONString(__VERSION__) << "\",\n";
+#endif /* __VERSION__ */
+    out << "  \"unit\": \"ns\",\n"
+        << "  \"benchmarks\": [";
+    for (auto p = results.begin(); p != results.end(); ++p) {
+      out << (p == results.begin() ? "\n" : ",\n")  //
+          << "    {\"name\": \"" << escapeJSONString(p->name) << "\", "
+          << "\"repetitions\": " << p->repetitions << ", "
+          << "\"operations\": " << p->operations << ", "
+          << "\"min\": " << p->min << ", "
+          << "\"max\": " << p->max << ", "
+          << "\"mean\": " << p->mean << ", "
+          << "\"median\": " << p->median << ", "
+          << "\"stddev\": " << p->stddev << "}";
+    }
+    out << "\n  ]\n"
+        << "}\n";
+    raise_if(!out, "BenchmarkSuite::writeJSON: error while writing file '" +
+                       f + "'");
+  }  // end of writeJSON
+
+  int BenchmarkSuite::execute(const int argc, const char* const* const argv) {
+    auto filter = std::string{};
+    auto json = std::string{};
+    auto list = false;
+    try {
+      for (int i = 1; i != argc; ++i) {
+        const auto a = std::string_view{argv[i]};
+        const auto pe = a.find('=');
+        const auto o = a.substr(0, pe);
+        const auto v = pe == std::string_view::npos ? std::string_view{}
+                                                    : a.substr(pe + 1);
+        if (o == "--repetitions") {
+          this->repetitions = convertToSize(o, v);
+        } else if (o == "--warmup") {
+          this->warmup = v == "0" ? 0 : convertToSize(o, v);
+        } else if (o == "--operations") {
+          this->operations = convertToSize(o, v);
+        } else if (o == "--filter") {
+          filter = std::string{v};
+        } else if (o == "--json") {
+          raise_if(v.empty(), "BenchmarkSuite::execute: no file name given");
+          json = std::string{v};
+        } else if (a == "--list") {
+          list = true;
+        } else if ((a == "--help") || (a == "-h")) {
+          std::cout << "usage: " << argv[0] << " [options]\n"
+                    << "--repetitions=<n>: number of repetitions\n"
+                    << "--warmup=<n>: number of warm-up runs\n"
+                    << "--operations=<n>: number of operations per run\n"
+                    << "--filter=<regex>: select the benchmarks to be run\n"
+                    << "--json=<file>: write the results in a JSON file\n"
+                    << "--list: list the benchmarks\n";
+          return EXIT_SUCCESS;
+        } else {
+          raise("BenchmarkSuite::execute: invalid option '" +
+                std::string{a} + "'");
+        }
+      }
+      const auto r = std::regex{filter.empty() ? ".*" : filter};
+      auto results = std::vector<BenchmarkResult>{};
+      for (const auto& [n, b] : this->benchmarks) {
+        if (!std::regex_search(n, r)) {
+          continue;
+        }
+        if (list) {
+          std::cout << n << '\n';
+          continue;
+        }
+        results.push_back(this->run(n, b));
+        const auto& br = results.back();
+        std::cout << std::left << std::setw(64) << n << std::right
+                  << std::fixed << std::setprecision(2)  //
+                  << " median: " << std::setw(10) << br.median << " ns"
+                  << " min: " << std::setw(10) << br.min << " ns"
+                  << " stddev: " << std::setw(8) << br.stddev << " ns\n";
+      }
+      if ((!list) && (!json.empty())) {
+        this->writeJSON(json, results);
+      }
+    } catch (std::exception& e) {
+      std::cerr << e.what() << '\n';
+      return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+  }  // end of execute
+
+  BenchmarkSuite::~BenchmarkSuite() = default;
+
+}  // end of namespace tfel::benchmarks
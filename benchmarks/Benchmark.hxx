@@ -0,0 +1,128 @@
+/*!
+ * \file   benchmarks/Benchmark.hxx
+ * \brief  This file declares a minimal harness for micro-benchmarks.
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright Copyright (C) 2006-2025 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_BENCHMARKS_BENCHMARK_HXX
+#define LIB_TFEL_BENCHMARKS_BENCHMARK_HXX
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <functional>
+
+namespace tfel::benchmarks {
+
+  /*!
+   * \brief prevent the compiler from optimizing away the computation of a
+   * value.
+   * \param[in] v: value
+   */
+  template <typename T>
+  inline void doNotOptimize(const T& v) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "g"(&v) : "memory");
+#else
+    auto* volatile p = static_cast<const void*>(&v);
+    static_cast<void>(p);
+#endif
+  }  // end of doNotOptimize
+
+  //! \brief statistics on the timings of a benchmark
+  struct BenchmarkResult {
+    //! \brief name of the benchmark
+    std::string name;
+    //! \brief number of repetitions
+    std::size_t repetitions = 0;
+    //! \brief number of elementary operations per repetition
+    std::size_t operations = 0;
+    //! \brief minimum time, in nanoseconds, of an elementary operation
+    double min = 0;
+    //! \brief maximum time, in nanoseconds, of an elementary operation
+    double max = 0;
+    //! \brief mean time, in nanoseconds, of an elementary operation
+    double mean = 0;
+    //! \brief median time, in nanoseconds, of an elementary operation
+    double median = 0;
+    //! \brief standard deviation of the time of an elementary operation
+    double stddev = 0;
+  };  // end of struct BenchmarkResult
+
+  /*!
+   * \brief a set of micro-benchmarks.
+   *
+   * A benchmark is a function performing `n` elementary operations. Each
+   * benchmark is run a few times to warm up the caches and the branch
+   * predictors, then repeated. The time of an elementary operation is
+   * reported through its minimum, maximum, mean, median and standard
+   * deviation over the repetitions.
+   *
+   * The `execute` method handles the following command line options:
+   *
+   * - `--repetitions=<n>`: number of repetitions (11 by default).
+   * - `--warmup=<n>`: number of warm-up runs (2 by default).
+   * - `--operations=<n>`: number of elementary operations per run (10000
+   *   by default).
+   * - `--filter=<regex>`: only run the benchmarks whose name matches the
+   *   given regular expression.
+   * - `--json=<file>`: write the results in the given file using the
+   *   `JSON` format.
+   * - `--list`: list the benchmarks.
+   */
+  struct BenchmarkSuite {
+    //! \brief a benchmark
+    using Benchmark = std::function<void(const std::size_t)>;
+    /*!
+     * \brief constructor
+     * \param[in] n: name of the suite
+     */
+    BenchmarkSuite(std::string);
+    /*!
+     * \brief add a new benchmark
+     * \param[in] n: name of the benchmark
+     * \param[in] b: benchmark
+     */
+    void add(std::string, Benchmark);
+    /*!
+     * \brief run the benchmarks
+     * \return EXIT_SUCCESS on success, EXIT_FAILURE otherwise
+     * \param[in] argc: number of arguments
+     * \param[in] argv: arguments
+     */
+    int execute(const int, const char* const* const);
+    //! \brief destructor
+    ~BenchmarkSuite();
+
+   private:
+    /*!
+     * \brief run a benchmark
+     * \param[in] n: name of the benchmark
+     * \param[in] b: benchmark
+     */
+    BenchmarkResult run(const std::string&, const Benchmark&) const;
+    //! \brief write the results in the JSON format
+    void writeJSON(const std::string&,
+                   const std::vector<BenchmarkResult>&) const;
+    //! \brief name of the suite
+    const std::string name;
+    //! \brief registred benchmarks
+    std::vector<std::pair<std::string, Benchmark>> benchmarks;
+    //! \brief number of warm-up runs
+    std::size_t warmup = 2;
+    //! \brief number of repetitions
+    std::size_t repetitions = 11;
+    //! \brief number of elementary operations per run
+    std::size_t operations = 10000;
+  };  // end of struct BenchmarkSuite
+
+}  // end of namespace tfel::benchmarks
+
+#endif /* LIB_TFEL_BENCHMARKS_BENCHMARK_HXX */
@@ -0,0 +1,188 @@
+/*!
+ * \file   benchmarks/MaterialBenchmarks.cxx
+ * \brief  This program measures the performances of some kernels of the
+ * `TFEL/Material` library: logarithmic strain framework, yield criteria
+ * and computation of stiffness tensors.
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright Copyright (C) 2006-2025 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <cmath>
+#include <vector>
+#include <string>
+#include <cstdlib>
+#include "TFEL/Math/stensor.hxx"
+#include "TFEL/Math/tensor.hxx"
+#include "TFEL/Math/st2tost2.hxx"
+#include "TFEL/Material/ModellingHypothesis.hxx"
+#include "TFEL/Material/StiffnessTensor.hxx"
+#include "TFEL/Material/LogarithmicStrainHandler.hxx"
+#include "TFEL/Material/Hosford1972YieldCriterion.hxx"
+#include "TFEL/Material/Barlat2004YieldCriterion.hxx"
+#include "Benchmark.hxx"
+
+namespace tfel::benchmarks {
+
+  //! \brief number of inputs on which the kernels are evaluated
+  constexpr std::size_t number_of_inputs = 64;
+
+  /*!
+   * \return a benchmark evaluating a kernel on a set of inputs
+   * \param[in] inputs: inputs
+   * \param[in] f: kernel
+   */
+  template <typename Input, typename Kernel>
+  static BenchmarkSuite::Benchmark makeBenchmark(std::vector<Input> inputs,
+                                                 const Kernel& f) {
+    return [inputs = std::move(inputs), f](const std::size_t n) {
+      const auto ni = inputs.size();
+      for (std::size_t i = 0; i != n; ++i) {
+        doNotOptimize(f(inputs[i % ni]));
+      }
+    };
+  }  // end of makeBenchmark
+
+  //! \return a set of stress tensors
+  template <typename real>
+  static std::vector<tfel::math::stensor<3u, real>> makeStresses() {
+    auto r = std::vector<tfel::math::stensor<3u, real>>(number_of_inputs);
+    for (std::size_t i = 0; i != number_of_inputs; ++i) {
+      for (unsigned short k = 0; k != 6; ++k) {
+        r[i][k] = static_cast<real>(100 * std::sin(1. + 7. * i + 3. * k));
+      }
+    }
+    return r;
+  }  // end of makeStresses
+
+  //! \return a set of deformation gradients
+  template <typename real>
+  static std::vector<tfel::math::tensor<3u, real>>
+  makeDeformationGradients() {
+    auto r = std::vector<tfel::math::tensor<3u, real>>(number_of_inputs);
+    for (std::size_t i = 0; i != number_of_inputs; ++i) {
+      r[i] = tfel::math::tensor<3u, real>::Id();
+      for (unsigned short k = 0; k != 9; ++k) {
+        r[i][k] += static_cast<real>(0.1 * std::sin(2. + 5. * i + 3. * k));
+      }
+    }
+    return r;
+  }  // end of makeDeformationGradients
+
+  template <typename real>
+  static void addLogarithmicStrainHandlerBenchmarks(BenchmarkSuite& s,
+                                                    const std::string& t) {
+    using namespace tfel::math;
+    using namespace tfel::material;
+    using LSHandler = LogarithmicStrainHandler<3u, real>;
+    const auto F = makeDeformationGradients<real>();
+    s.add("LogarithmicStrainHandler/getHenckyLogarithmicStrain/" + t,
+          makeBenchmark(F, [](const tensor<3u, real>& v) {
+            const auto h = LSHandler(LSHandler::LAGRANGIAN, v);
+            return h.getHenckyLogarithmicStrain();
+          }));
+    s.add("LogarithmicStrainHandler/convertToSecondPiolaKirchhoffStress/" + t,
+          makeBenchmark(F, [](const tensor<3u, real>& v) {
+            const auto h = LSHandler(LSHandler::LAGRANGIAN, v);
+            const auto e = h.getHenckyLogarithmicStrain();
+            return h.convertToSecondPiolaKirchhoffStress(e);
+          }));
+    s.add("LogarithmicStrainHandler/convertToCauchyStress/" + t,
+          makeBenchmark(F, [](const tensor<3u, real>& v) {
+            const auto h = LSHandler(LSHandler::EULERIAN, v);
+            const auto e = h.getHenckyLogarithmicStrain();
+            return h.convertToCauchyStress(e);
+          }));
+  }  // end of addLogarithmicStrainHandlerBenchmarks
+
+  template <typename real>
+  static void addYieldCriteriaBenchmarks(BenchmarkSuite& s,
+                                         const std::string& t) {
+    using namespace tfel::math;
+    using namespace tfel::material;
+    const auto stresses = makeStresses<real>();
+    const auto a = real(8);
+    const auto seps = real(1e-4);
+    const auto l1 = makeBarlatLinearTransformation<3u, real>(
+        -0.069888, 0.936408, 0.079143, 1.003060, 0.524741, 1.363180, 1.023770,
+        1.069060, 0.954322);
+    const auto l2 = makeBarlatLinearTransformation<3u, real>(
+        -0.981171, 0.476741, 0.575316, 0.866827, 1.145010, -0.079294,
+        1.051660, 1.147100, 1.404620);
+    s.add("Hosford1972/computeHosfordStress/" + t,
+          makeBenchmark(stresses, [a, seps](const stensor<3u, real>& v) {
+            return computeHosfordStress(v, a, seps);
+          }));
+    s.add("Hosford1972/computeHosfordStressNormal/" + t,
+          makeBenchmark(stresses, [a, seps](const stensor<3u, real>& v) {
+            return computeHosfordStressNormal(v, a, seps);
+          }));
+    s.add("Hosford1972/computeHosfordStressSecondDerivative/" + t,
+          makeBenchmark(stresses, [a, seps](const stensor<3u, real>& v) {
+            return computeHosfordStressSecondDerivative(v, a, seps);
+          }));
+    s.add("Barlat2004/computeBarlatStress/" + t,
+          makeBenchmark(stresses,
+                        [l1, l2, a, seps](const stensor<3u, real>& v) {
+                          return computeBarlatStress(v, l1, l2, a, seps);
+                        }));
+    s.add("Barlat2004/computeBarlatStressNormal/" + t,
+          makeBenchmark(stresses,
+                        [l1, l2, a, seps](const stensor<3u, real>& v) {
+                          return computeBarlatStressNormal(v, l1, l2, a, seps);
+                        }));
+    s.add("Barlat2004/computeBarlatStressSecondDerivative/" + t,
+          makeBenchmark(stresses, [l1, l2, a,
+                                   seps](const stensor<3u, real>& v) {
+            return computeBarlatStressSecondDerivative(v, l1, l2, a, seps);
+          }));
+  }  // end of addYieldCriteriaBenchmarks
+
+  template <typename real>
+  static void addStiffnessTensorBenchmarks(BenchmarkSuite& s,
+                                           const std::string& t) {
+    using namespace tfel::math;
+    using namespace tfel::material;
+    constexpr auto H = ModellingHypothesis::TRIDIMENSIONAL;
+    constexpr auto u = StiffnessTensorAlterationCharacteristic::UNALTERED;
+    auto moduli = std::vector<real>(number_of_inputs);
+    for (std::size_t i = 0; i != number_of_inputs; ++i) {
+      moduli[i] = static_cast<real>(150e9 * (1 + 0.1 * std::sin(1. + i)));
+    }
+    s.add("StiffnessTensor/computeIsotropicStiffnessTensor/" + t,
+          makeBenchmark(moduli, [](const real E) {
+            auto D = st2tost2<3u, real>{};
+            computeIsotropicStiffnessTensor<H, u>(D, E, real(0.3));
+            return D;
+          }));
+    s.add("StiffnessTensor/computeOrthotropicStiffnessTensor/" + t,
+          makeBenchmark(moduli, [](const real E) {
+            auto D = st2tost2<3u, real>{};
+            computeOrthotropicStiffnessTensor<H, u>(
+                D, E, E / 2, E / 3, real(0.3), real(0.2), real(0.25), E / 4,
+                E / 5, E / 6);
+            return D;
+          }));
+  }  // end of addStiffnessTensorBenchmarks
+
+  template <typename real>
+  static void addBenchmarks(BenchmarkSuite& s, const std::string& t) {
+    addLogarithmicStrainHandlerBenchmarks<real>(s, t);
+    addYieldCriteriaBenchmarks<real>(s, t);
+    addStiffnessTensorBenchmarks<real>(s, t);
+  }  // end of addBenchmarks
+
+}  // end of namespace tfel::benchmarks
+
+int main(const int argc, const char* const* const argv) {
+  using namespace tfel::benchmarks;
+  auto s = BenchmarkSuite{"TFELMaterial"};
+  addBenchmarks<float>(s, "float");
+  addBenchmarks<double>(s, "double");
+  return s.execute(argc, argv);
+}  // end of main
@@ -0,0 +1,238 @@
+/*!
+ * \file   benchmarks/MathBenchmarks.cxx
+ * \brief  This program measures the performances of some kernels of the
+ * `TFEL/Math` library: operations on tiny tensors, resolution of tiny
+ * linear systems and eigen solvers.
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright Copyright (C) 2006-2025 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <cmath>
+#include <vector>
+#include <string>
+#include <cstdlib>
+#include "TFEL/Math/tvector.hxx"
+#include "TFEL/Math/tmatrix.hxx"
+#include "TFEL/Math/stensor.hxx"
+#include "TFEL/Math/tensor.hxx"
+#include "TFEL/Math/st2tost2.hxx"
+#include "TFEL/Math/TinyMatrixSolve.hxx"
+#include "TFEL/Math/Stensor/BatchedSymmetricEigenSolver.hxx"
+#include "Benchmark.hxx"
+
+namespace tfel::benchmarks {
+
+  //! \brief number of inputs on which the kernels are evaluated
+  constexpr std::size_t number_of_inputs = 64;
+
+  /*!
+   * \return a benchmark evaluating a kernel on a set of inputs
+   * \param[in] inputs: inputs
+   * \param[in] f: kernel
+   */
+  template <typename Input, typename Kernel>
+  static BenchmarkSuite::Benchmark makeBenchmark(std::vector<Input> inputs,
+                                                 const Kernel& f) {
+    return [inputs = std::move(inputs), f](const std::size_t n) {
+      const auto ni = inputs.size();
+      for (std::size_t i = 0; i != n; ++i) {
+        doNotOptimize(f(inputs[i % ni]));
+      }
+    };
+  }  // end of makeBenchmark
+
+  //! \return a set of symmetric tensors
+  template <typename real>
+  static std::vector<tfel::math::stensor<3u, real>> makeStensors() {
+    auto r = std::vector<tfel::math::stensor<3u, real>>(number_of_inputs);
+    for (std::size_t i = 0; i != number_of_inputs; ++i) {
+      for (unsigned short k = 0; k != 6; ++k) {
+        r[i][k] = static_cast<real>(100 * std::sin(1. + 7. * i + 3. * k));
+      }
+    }
+    return r;
+  }  // end of makeStensors
+
+  //! \return a set of non symmetric tensors close to the identity
+  template <typename real>
+  static std::vector<tfel::math::tensor<3u, real>> makeTensors() {
+    auto r = std::vector<tfel::math::tensor<3u, real>>(number_of_inputs);
+    for (std::size_t i = 0; i != number_of_inputs; ++i) {
+      r[i] = tfel::math::tensor<3u, real>::Id();
+      for (unsigned short k = 0; k != 9; ++k) {
+        r[i][k] += static_cast<real>(0.1 * std::sin(2. + 5. * i + 3. * k));
+      }
+    }
+    return r;
+  }  // end of makeTensors
+
+  //! \return a set of diagonally dominant matrices
+  template <unsigned short N, typename real>
+  static std::vector<tfel::math::tmatrix<N, N, real>> makeMatrices() {
+    auto r = std::vector<tfel::math::tmatrix<N, N, real>>(number_of_inputs);
+    for (std::size_t i = 0; i != number_of_inputs; ++i) {
+      for (unsigned short k = 0; k != N; ++k) {
+        for (unsigned short l = 0; l != N; ++l) {
+          r[i](k, l) = static_cast<real>(std::sin(1. + 3. * i + 5. * k + l));
+        }
+        r[i](k, k) += N;
+      }
+    }
+    return r;
+  }  // end of makeMatrices
+
+  template <typename real>
+  static void addTinyTensorsBenchmarks(BenchmarkSuite& s,
+                                       const std::string& t) {
+    using namespace tfel::math;
+    const auto stensors = makeStensors<real>();
+    const auto tensors = makeTensors<real>();
+    const auto D = [] {
+      const auto l = real(150);
+      const auto m = real(75);
+      return l * st2tost2<3u, real>::IxI() + 2 * m * st2tost2<3u, real>::Id();
+    }();
+    s.add("stensor/linear_combination/" + t,
+          makeBenchmark(stensors, [](const stensor<3u, real>& v) {
+            return eval(2 * v + v / 3);
+          }));
+    s.add("stensor/deviator/" + t,
+          makeBenchmark(stensors, [](const stensor<3u, real>& v) {
+            return deviator(v);
+          }));
+    s.add("stensor/sigmaeq/" + t,
+          makeBenchmark(stensors, [](const stensor<3u, real>& v) {
+            return sigmaeq(v);
+          }));
+    s.add("stensor/square/" + t,
+          makeBenchmark(stensors, [](const stensor<3u, real>& v) {
+            return square(v);
+          }));
+    s.add("stensor/det/" + t,
+          makeBenchmark(stensors, [](const stensor<3u, real>& v) {
+            return det(v);
+          }));
+    s.add("st2tost2/stensor_product/" + t,
+          makeBenchmark(stensors, [D](const stensor<3u, real>& v) {
+            return eval(D * v);
+          }));
+    s.add("tensor/det/" + t,
+          makeBenchmark(tensors, [](const tensor<3u, real>& F) {
+            return det(F);
+          }));
+    s.add("tensor/invert/" + t,
+          makeBenchmark(tensors, [](const tensor<3u, real>& F) {
+            return invert(F);
+          }));
+    s.add("tensor/computeGreenLagrangeTensor/" + t,
+          makeBenchmark(tensors, [](const tensor<3u, real>& F) {
+            return computeGreenLagrangeTensor(F);
+          }));
+  }  // end of addTinyTensorsBenchmarks
+
+  template <unsigned short N, typename real>
+  static void addTinyMatrixSolveBenchmark(BenchmarkSuite& s,
+                                          const std::string& t) {
+    using namespace tfel::math;
+    auto b = tvector<N, real>{};
+    for (unsigned short k = 0; k != N; ++k) {
+      b(k) = static_cast<real>(k + 1);
+    }
+    s.add("TinyMatrixSolve/" + std::to_string(N) + "/" + t,
+          makeBenchmark(makeMatrices<N, real>(),
+                        [b](const tmatrix<N, N, real>& m) {
+                          auto mc = m;
+                          auto x = b;
+                          TinyMatrixSolve<N, real, false>::exe(mc, x);
+                          return x;
+                        }));
+  }  // end of addTinyMatrixSolveBenchmark
+
+  template <tfel::math::stensor_common::EigenSolver es, typename real>
+  static void addEigenSolverBenchmarks(BenchmarkSuite& s,
+                                       const std::string& n,
+                                       const std::string& t) {
+    using namespace tfel::math;
+    const auto stensors = makeStensors<real>();
+    s.add("stensor/computeEigenValues/" + n + "/" + t,
+          makeBenchmark(stensors, [](const stensor<3u, real>& v) {
+            return v.template computeEigenValues<es>();
+          }));
+    s.add("stensor/computeEigenVectors/" + n + "/" + t,
+          makeBenchmark(stensors, [](const stensor<3u, real>& v) {
+            auto vp = tvector<3u, real>{};
+            auto m = tmatrix<3u, 3u, real>{};
+            v.template computeEigenVectors<es>(vp, m);
+            return m;
+          }));
+  }  // end of addEigenSolverBenchmarks
+
+  template <typename real>
+  static void addBatchedEigenSolverBenchmark(BenchmarkSuite& s,
+                                             const std::string& t) {
+    using namespace tfel::math;
+    using Solver = BatchedSymmetricEigenSolver<3u, real>;
+    // one elementary operation is the treatment of one tensor. The
+    // tensors are only gathered when the number of operations changes,
+    // i.e. during the warm-up.
+    s.add("BatchedSymmetricEigenSolver/computeEigenVectors/" + t,
+          [v = std::vector<real>{}, vp = std::vector<real>{},
+           m = std::vector<real>{}](const std::size_t n) mutable {
+            if (v.size() != 6 * n) {
+              const auto stensors = makeStensors<real>();
+              v.resize(6 * n);
+              vp.resize(3 * n);
+              m.resize(9 * n);
+              for (std::size_t i = 0; i != n; ++i) {
+                for (unsigned short k = 0; k != 6; ++k) {
+                  v[i + k * n] = stensors[i % number_of_inputs][k];
+                }
+              }
+            }
+            Solver::computeEigenVectors(vp.data(), n, m.data(), n, v.data(), n,
+                                        n);
+            doNotOptimize(m.data()[0]);
+          });
+  }  // end of addBatchedEigenSolverBenchmark
+
+  template <typename real>
+  static void addBenchmarks(BenchmarkSuite& s, const std::string& t) {
+    using namespace tfel::math;
+    addTinyTensorsBenchmarks<real>(s, t);
+    addTinyMatrixSolveBenchmark<3u, real>(s, t);
+    addTinyMatrixSolveBenchmark<6u, real>(s, t);
+    addTinyMatrixSolveBenchmark<12u, real>(s, t);
+    addEigenSolverBenchmarks<stensor_common::TFELEIGENSOLVER, real>(
+        s, "TFELEIGENSOLVER", t);
+    addEigenSolverBenchmarks<stensor_common::FSESANALYTICALEIGENSOLVER, real>(
+        s, "FSESANALYTICALEIGENSOLVER", t);
+    addEigenSolverBenchmarks<stensor_common::FSESJACOBIEIGENSOLVER, real>(
+        s, "FSESJACOBIEIGENSOLVER", t);
+    addEigenSolverBenchmarks<stensor_common::FSESQLEIGENSOLVER, real>(
+        s, "FSESQLEIGENSOLVER", t);
+    addEigenSolverBenchmarks<stensor_common::FSESCUPPENEIGENSOLVER, real>(
+        s, "FSESCUPPENEIGENSOLVER", t);
+    addEigenSolverBenchmarks<stensor_common::FSESHYBRIDEIGENSOLVER, real>(
+        s, "FSESHYBRIDEIGENSOLVER", t);
+    addEigenSolverBenchmarks<stensor_common::GTESYMMETRICQREIGENSOLVER, real>(
+        s, "GTESYMMETRICQREIGENSOLVER", t);
+    addEigenSolverBenchmarks<stensor_common::HARARIEIGENSOLVER, real>(
+        s, "HARARIEIGENSOLVER", t);
+    addBatchedEigenSolverBenchmark<real>(s, t);
+  }  // end of addBenchmarks
+
+}  // end of namespace tfel::benchmarks
+
+int main(const int argc, const char* const* const argv) {
+  using namespace tfel::benchmarks;
+  auto s = BenchmarkSuite{"TFELMath"};
+  addBenchmarks<float>(s, "float");
+  addBenchmarks<double>(s, "double");
+  return s.execute(argc, argv);
+}  // end of main
@@ -0,0 +1,87 @@
+/*!
+ * \file   benchmarks/MathParserBenchmarks.cxx
+ * \brief  This program compares the evaluation of formulae by walking the
+ * expression tree, by executing the bytecode and by the batch evaluation.
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright Copyright (C) 2006-2025 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <memory>
+#include <vector>
+#include <string>
+#include <cstdlib>
+#include "TFEL/Math/Evaluator.hxx"
+#include "Benchmark.hxx"
+
+namespace tfel::benchmarks {
+
+  //! \brief values of the variables
+  struct EvaluatorInputs {
+    std::vector<double> x;
+    std::vector<double> y;
+    std::vector<double> z;
+    std::vector<double> r;
+    //! \brief resize the inputs
+    void resize(const std::size_t n) {
+      if (this->x.size() == n) {
+        return;
+      }
+      this->x.resize(n);
+      this->y.resize(n);
+      this->z.resize(n);
+      this->r.resize(n);
+      for (std::size_t i = 0; i != n; ++i) {
+        const auto t = static_cast<double>(i) / static_cast<double>(n);
+        this->x[i] = t;
+        this->y[i] = 1 - t;
+        this->z[i] = 0.5 + t * t;
+      }
+    }  // end of resize
+  };   // end of EvaluatorInputs
+
+  static void addEvaluatorBenchmarks(BenchmarkSuite& s) {
+    using tfel::math::Evaluator;
+    const auto formulae = std::vector<std::string>{
+        "x+y*z", "2*x**2-3*y+4*z**3", "exp(-x)*cos(y)+exp(-x)*sin(z)",
+        "1.e-3*exp(-(x+273.15)/300)*(1+y)**3.5*z/(1+z)",
+        "x<0.5 ? exp(x) : cos(x)*sin(y)"};
+    auto inputs = std::make_shared<EvaluatorInputs>();
+    for (const auto& f : formulae) {
+      auto e = std::make_shared<Evaluator>(
+          std::vector<std::string>{"x", "y", "z"}, f);
+      auto evaluate = [e, inputs](const std::size_t n, const bool b) {
+        inputs->resize(n);
+        for (std::size_t i = 0; i != n; ++i) {
+          e->setVariableValue(std::size_t{0}, inputs->x[i]);
+          e->setVariableValue(std::size_t{1}, inputs->y[i]);
+          e->setVariableValue(std::size_t{2}, inputs->z[i]);
+          inputs->r[i] = b ? e->getValue() : e->getValueFromExpressionTree();
+        }
+        doNotOptimize(inputs->r.data()[0]);
+      };
+      s.add("Evaluator/tree/" + f,
+            [evaluate](const std::size_t n) { evaluate(n, false); });
+      s.add("Evaluator/bytecode/" + f,
+            [evaluate](const std::size_t n) { evaluate(n, true); });
+      s.add("Evaluator/batch/" + f, [e, inputs](const std::size_t n) {
+        inputs->resize(n);
+        e->getValues(inputs->r, {inputs->x, inputs->y, inputs->z});
+        doNotOptimize(inputs->r.data()[0]);
+      });
+    }
+  }  // end of addEvaluatorBenchmarks
+
+}  // end of namespace tfel::benchmarks
+
+int main(const int argc, const char* const* const argv) {
+  using namespace tfel::benchmarks;
+  auto s = BenchmarkSuite{"TFELMathParser"};
+  addEvaluatorBenchmarks(s);
+  return s.execute(argc, argv);
+}  // end of main
@@ -0,0 +1,100 @@
+/*!
+ * \file   benchmarks/SystemBenchmarks.cxx
+ * \brief  This program measures the overhead of the `ThreadPool` class
+ * for many small tasks, added one by one or through the `parallel_for`
+ * method.
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright Copyright (C) 2006-2025 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <memory>
+#include <thread>
+#include <vector>
+#include <cstdlib>
+#include <algorithm>
+#include "TFEL/System/ThreadPool.hxx"
+#include "Benchmark.hxx"
+
+namespace tfel::benchmarks {
+
+  //! \brief a simple alias
+  using size_type = tfel::system::ThreadPool::size_type;
+
+  //! \brief elementary operation
+  static void update(std::vector<double>& values,
+                     const size_type b,
+                     const size_type e) {
+    for (auto i = b; i != e; ++i) {
+      values[i] *= 1.0001;
+    }
+  }  // end of update
+
+  static void addThreadPoolBenchmarks(BenchmarkSuite& s) {
+    using tfel::system::ThreadPool;
+    const auto nthreads = static_cast<size_type>(
+        std::max(std::thread::hardware_concurrency(), 1u));
+    auto pool = std::make_shared<ThreadPool>(nthreads);
+    auto values = std::make_shared<std::vector<double>>();
+    // one task per index
+    s.add("ThreadPool/addTask", [pool, values](const std::size_t n) {
+      values->assign(n, 1);
+      for (size_type i = 0; i != n; ++i) {
+        static_cast<void>(
+            pool->addTask([values, i] { update(*values, i, i + 1); }));
+      }
+      pool->wait();
+      doNotOptimize(values->data()[0]);
+    });
+    // tasks added by the workers
+    s.add("ThreadPool/addTaskFromWorkers",
+          [pool, values, nthreads](const std::size_t n) {
+            values->assign(n, 1);
+            const auto nb = nthreads + 1;
+            for (size_type b = 0; b != nb; ++b) {
+              static_cast<void>(pool->addTask([pool, values, b, n, nb] {
+                for (auto i = (n * b) / nb; i != (n * (b + 1)) / nb; ++i) {
+                  static_cast<void>(pool->addTask(
+                      [values, i] { update(*values, i, i + 1); }));
+                }
+              }));
+            }
+            pool->wait();
+            doNotOptimize(values->data()[0]);
+          });
+    // parallel_for with one index per chunk
+    s.add("ThreadPool/parallel_for/grain1",
+          [pool, values](const std::size_t n) {
+            values->assign(n, 1);
+            pool->parallel_for(
+                0, n,
+                [&values](const size_type b, const size_type e) {
+                  update(*values, b, e);
+                },
+                1);
+            doNotOptimize(values->data()[0]);
+          });
+    // parallel_for with the default grain size
+    s.add("ThreadPool/parallel_for", [pool, values](const std::size_t n) {
+      values->assign(n, 1);
+      pool->parallel_for(0, n,
+                         [&values](const size_type b, const size_type e) {
+                           update(*values, b, e);
+                         });
+      doNotOptimize(values->data()[0]);
+    });
+  }  // end of addThreadPoolBenchmarks
+
+}  // end of namespace tfel::benchmarks
+
+int main(const int argc, const char* const* const argv) {
+  using namespace tfel::benchmarks;
+  auto s = BenchmarkSuite{"TFELSystem"};
+  addThreadPoolBenchmarks(s);
+  return s.execute(argc, argv);
+}  // end of main
@@ -0,0 +1,75 @@
+#!/usr/bin/env python3
+# \file   benchmarks/compare-benchmarks.py
+# \brief  compare the results of two runs of the micro-benchmarks
+# \author Thomas Helfer
+# \date   18/10/2026
+#
+# usage: compare-benchmarks.py [--threshold=<percent>] \
+#                              [--statistic=<median|min|mean>] \
+#                              reference.json results.json
+#
+# For each benchmark found in both files, the relative variation of the
+# chosen statistic is printed. Variations greater than the threshold
+# (5% by default) are flagged. The script exits with a non zero status
+# if at least one regression is detected.
+
+import sys
+import json
+import argparse
+
+
+def load(f):
+    with open(f) as input_file:
+        d = json.load(input_file)
+    return d, {b['name']: b for b in d['benchmarks']}
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='compare the results of two runs of the micro-benchmarks')
+    parser.add_argument('reference', help='reference results')
+    parser.add_argument('results', help='new results')
+    parser.add_argument('--threshold', type=float, default=5.,
+                        help='relative variation, in percent, above which '
+                        'a benchmark is considered as regressed or improved')
+    parser.add_argument('--statistic', default='median',
+                        choices=['median', 'min', 'mean'],
+                        help='statistic compared')
+    args = parser.parse_args()
+    d1, r1 = load(args.reference)
+    d2, r2 = load(args.results)
+    if d1.get('suite') != d2.get('suite'):
+        print('warning: comparing results of different suites '
+              '(' + str(d1.get('suite')) + ' and ' + str(d2.get('suite')) +
+              ')')
+    names = [n for n in r1 if n in r2]
+    w = max([len(n) for n in names] + [len('benchmark')])
+    print('{:<{w}} {:>12} {:>12} {:>9}'.format('benchmark', 'reference',
+                                              'new', 'variation', w=w))
+    nregressions = 0
+    for n in names:
+        t1 = r1[n][args.statistic]
+        t2 = r2[n][args.statistic]
+        v = 100 * (t2 - t1) / t1 if t1 > 0 else 0.
+        status = ''
+        if v > args.threshold:
+            status = 'regression'
+            nregressions += 1
+        elif v < -args.threshold:
+            status = 'improvement'
+        print('{:<{w}} {:>12.2f} {:>12.2f} {:>+8.1f}% {}'.format(
+            n, t1, t2, v, status, w=w))
+    for n in r1:
+        if n not in r2:
+            print('benchmark \'' + n + '\' is missing in the new results')
+    for n in r2:
+        if n not in r1:
+            print('benchmark \'' + n + '\' is new')
+    if nregressions != 0:
+        print(str(nregressions) + ' regression(s) detected')
+        return 1
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
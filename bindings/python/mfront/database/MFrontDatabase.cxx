@@ -76,11 +76,13 @@ MFrontDatabase_analyseDirectory(
     const std::string& d,
     const bool ignore_errors,
     const std::optional<std::string> library_prefix,
-    const std::optional<std::string> library_suffix) {
+    const std::optional<std::string> library_suffix,
+    const std::size_t number_of_threads) {
   const auto opts = mfront::MFrontDatabase::AnalyseDirectoryOptions{
       .ignore_errors = ignore_errors,
       .library_prefix = library_prefix,
-      .library_suffix = library_suffix};
+      .library_suffix = library_suffix,
+      .number_of_threads = number_of_threads};
   return db.analyseDirectory(d, opts);
 }  // end of MFrontDatabase_analyseDirectory
 
@@ -90,11 +92,13 @@ MFrontDatabase_analyseDirectories(
     const std::vector<std::string>& directories,
     const bool ignore_errors,
     const std::optional<std::string> library_prefix,
-    const std::optional<std::string> library_suffix) {
+    const std::optional<std::string> library_suffix,
+    const std::size_t number_of_threads) {
   const auto opts = mfront::MFrontDatabase::AnalyseDirectoryOptions{
       .ignore_errors = ignore_errors,
       .library_prefix = library_prefix,
-      .library_suffix = library_suffix};
+      .library_suffix = library_suffix,
+      .number_of_threads = number_of_threads};
   return db.analyseDirectories(directories, opts);
 }  // end of MFrontDatabase_analyseDirectories
 
@@ -104,11 +108,13 @@ MFrontDatabase_analyseDirectoriesListedInEnvironmentVariable(
     const std::string& e,
     const bool ignore_errors,
     const std::optional<std::string> library_prefix,
-    const std::optional<std::string> library_suffix) {
+    const std::optional<std::string> library_suffix,
+    const std::size_t number_of_threads) {
   const auto opts = mfront::MFrontDatabase::AnalyseDirectoryOptions{
       .ignore_errors = ignore_errors,
       .library_prefix = library_prefix,
-      .library_suffix = library_suffix};
+      .library_suffix = library_suffix,
+      .number_of_threads = number_of_threads};
   return db.analyseDirectoriesListedInEnvironmentVariable(e, opts);
 }  // end of MFrontDatabase_analyseDirectoriesListedInEnvironmentVariable
 
@@ -129,7 +135,9 @@ PYBIND11_MODULE(_mfront_database, m) {
       .def_readonly("library", &MFrontDatabase::EntryPoint::library)
       .def_readonly("name", &MFrontDatabase::EntryPoint::name)
       .def_readonly("source", &MFrontDatabase::EntryPoint::source)
-      .def_readonly("source", &MFrontDatabase::EntryPoint::type);
+      .def_readonly("material", &MFrontDatabase::EntryPoint::material)
+      .def_readonly("interface", &MFrontDatabase::EntryPoint::interface)
+      .def_readonly("type", &MFrontDatabase::EntryPoint::type);
 
   pybind11::class_<
       MFrontDatabase::AnalyseDirectoryResults::LibraryAnalysisFailureReport>(
@@ -152,17 +160,26 @@ PYBIND11_MODULE(_mfront_database, m) {
   pybind11::class_<MFrontDatabase>(m, "MFrontDatabase")
       .def(pybind11::init<>())
       .def("analyseLibrary", &MFrontDatabase::analyseLibrary)
-      .def("analyseLibraries", &MFrontDatabase::analyseLibraries)
+      .def("analyseLibraries",
+           pybind11::overload_cast<const std::vector<std::string>&>(
+               &MFrontDatabase::analyseLibraries))
+      .def("analyseLibraries",
+           pybind11::overload_cast<const std::vector<std::string>&,
+                                   const std::size_t>(
+               &MFrontDatabase::analyseLibraries),
+           "libraries"_a, "number_of_threads"_a)
       .def("analyseDirectory", pybind11::overload_cast<const std::string&>(
                                    &MFrontDatabase::analyseDirectory))
       .def("analyseDirectory", MFrontDatabase_analyseDirectory, "directory"_a,
            "ignore_errors"_a = false,
            "library_prefix"_a = std::optional<std::string>{},
-           "library_suffix"_a = std::optional<std::string>{})
+           "library_suffix"_a = std::optional<std::string>{},
+           "number_of_threads"_a = std::size_t{1})
       .def("analyseDirectories", MFrontDatabase_analyseDirectories,
            "directories"_a, "ignore_errors"_a = false,
            "library_prefix"_a = std::optional<std::string>{},
-           "library_suffix"_a = std::optional<std::string>{})
+           "library_suffix"_a = std::optional<std::string>{},
+           "number_of_threads"_a = std::size_t{1})
       .def("analyseDirectories",
            pybind11::overload_cast<const std::vector<std::string>&>(
                &MFrontDatabase::analyseDirectories))
@@ -170,7 +187,8 @@ PYBIND11_MODULE(_mfront_database, m) {
            MFrontDatabase_analyseDirectoriesListedInEnvironmentVariable,
            "directories"_a, "ignore_errors"_a = false,
            "library_prefix"_a = std::optional<std::string>{},
-           "library_suffix"_a = std::optional<std::string>{})
+           "library_suffix"_a = std::optional<std::string>{},
+           "number_of_threads"_a = std::size_t{1})
       .def("analyseDirectoriesListedInEnvironmentVariable",
            pybind11::overload_cast<const std::string&>(
                &MFrontDatabase::analyseDirectoriesListedInEnvironmentVariable))
@@ -180,6 +198,8 @@ PYBIND11_MODULE(_mfront_database, m) {
            "material"_a = std::optional<std::string>{},
            "interface"_a = std::optional<std::string>{},
            "regular_expression_syntax"_a = std::optional<std::string>{})
+      .def("loadIndex", &MFrontDatabase::loadIndex)
+      .def("saveIndex", &MFrontDatabase::saveIndex)
       .def("getEntryPoints",
            static_cast<const std::vector<MFrontDatabase::EntryPoint>& (
                MFrontDatabase::*)() const>(&MFrontDatabase::getEntryPoints));
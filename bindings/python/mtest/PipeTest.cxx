@@ -190,6 +190,13 @@ void declarePipeTest(pybind11::module_& m) {
              mtest::PipeTest::FailurePolicy::FREEZESTATEUNTILENDOFCOMPUTATION)
       .value("FreezeState",
              mtest::PipeTest::FailurePolicy::FREEZESTATEUNTILENDOFCOMPUTATION);
+  pybind11::enum_<mtest::PipeTest::LinearSolver>(m, "PipeTestLinearSolver")
+      .value("DENSELINEARSOLVER",
+             mtest::PipeTest::LinearSolver::DENSELINEARSOLVER)
+      .value("BANDEDLINEARSOLVER",
+             mtest::PipeTest::LinearSolver::BANDEDLINEARSOLVER)
+      .value("Dense", mtest::PipeTest::LinearSolver::DENSELINEARSOLVER)
+      .value("Banded", mtest::PipeTest::LinearSolver::BANDEDLINEARSOLVER);
   pybind11::class_<PipeTest, SingleStructureScheme>(m, "PipeTest")
       .def(pybind11::init<>())
       .def("setInnerRadius", &PipeTest::setInnerRadius)
@@ -328,6 +335,11 @@ void declarePipeTest(pybind11::module_& m) {
            "add a failure criterion.")
       .def("setFailurePolicy", &PipeTest::setFailurePolicy,
            "set the failure policy.")
+      .def("setLinearSolver", &PipeTest::setLinearSolver,
+           "set the linear solver used to solve the equilibrium equations.")
+      .def("setNumberOfThreads", &PipeTest::setNumberOfThreads,
+           "set the number of threads used to integrate the behaviour over "
+           "the elements.")
       .def("addOxidationModel", &PipeTest::addOxidationModel, "library"_a,
            "model"_a, "boundary"_a, "add an oxidation model.");
 }
@@ -247,6 +247,10 @@ void declareSchemeBase(pybind11::module_& m) {
            "This method specify the number of digits used to print "
            "the results in the output file.\n"
            "* The parameter (uint) is the number of digits wanted.")
+      .def("setOutputFileFormat", &SchemeBase::setOutputFileFormat,
+           "This method specify the format of the output file.\n"
+           "* The parameter (string) is either 'text' (default) or "
+           "'binary'. Binary files can be read by the 'TextData' class.")
       .def("printOutput", &SchemeBase::printOutput)
       .def("printOutput", &SchemeBase_printOutput)
       .def("setResidualFileName", &SchemeBase::setResidualFileName,
@@ -14,6 +14,7 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 #include "TFEL/System/ExternalLibraryManager.hxx"
+#include "TFEL/System/ExternalBehaviourDescription.hxx"
 
 void declareExternalLibraryManager(pybind11::module_&);
 
@@ -22,6 +23,21 @@ static void ELM_loadLibrary(tfel::system::ExternalLibraryManager& elm,
   elm.loadLibrary(n);
 }
 
+static tfel::system::ExternalMaterialKnowledgeDescription ELM_describe(
+    tfel::system::ExternalLibraryManager& elm,
+    const std::string& l,
+    const std::string& f) {
+  return *(elm.describe(l, f));
+}
+
+static tfel::system::ExternalBehaviourDescription ELM_describe2(
+    tfel::system::ExternalLibraryManager& elm,
+    const std::string& l,
+    const std::string& f,
+    const std::string& h) {
+  return *(elm.describe(l, f, h));
+}
+
 static void ELM_setUShortParameter(tfel::system::ExternalLibraryManager& elm,
                                    const std::string& l,
                                    const std::string& n,
@@ -167,6 +183,12 @@ void declareExternalLibraryManager(pybind11::module_& m) {
            "- 1: behaviour\n"
            "- 2: model")
       .def("getInterface", &ELM::getInterface)
+      .def("describe", ELM_describe,
+           "return the description of an entry point. This description "
+           "is cached")
+      .def("describe", ELM_describe2,
+           "return the description of a behaviour for the given modelling "
+           "hypothesis. This description is cached")
       .def("setUShortParameter", ELM_setUShortParameter)
       .def("setIntParameter", ELM_setIntParameter)
       .def("setDoubleParameter", ELM_setDoubleParameter)
@@ -26,6 +26,10 @@ void declareTextData(pybind11::module_& m) {
   pybind11::class_<TextData>(m, "TextData")
       .def(pybind11::init<std::string>())
       .def(pybind11::init<std::string, std::string>())
-      .def("getColumn", getColumn);
+      .def(pybind11::init<std::string, std::string, unsigned short>())
+      .def("getColumn", getColumn)
+      .def("findColumn", &TextData::findColumn)
+      .def("getLegends", &TextData::getLegends)
+      .def("getNumberOfLines", &TextData::getNumberOfLines);
 
 }  // end of declaretvector
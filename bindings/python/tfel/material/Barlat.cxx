@@ -14,6 +14,7 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 #include "TFEL/Material/Barlat2004YieldCriterion.hxx"
+#include "VectorizedFunctions.hxx"
 
 template <unsigned short N>
 static tfel::math::st2tost2<N, double> makeBarlatLinearTransformation(
@@ -39,6 +40,28 @@ static double computeBarlatStress(const tfel::math::stensor<N, double>& s,
   return tfel::material::computeBarlatStress(s, l1, l2, a, e);
 }  // end of computeBarlatStress
 
+template <unsigned short N>
+static pybind11::array_t<double> computeBarlatStresses(
+    const tfel::python::DoubleArray& s,
+    const tfel::math::st2tost2<N, double>& l1,
+    const tfel::math::st2tost2<N, double>& l2,
+    const double a,
+    const double e,
+    const std::size_t nthreads) {
+  tfel::python::checkArray("computeBarlatStress", s, 2,
+                           tfel::math::StensorDimeToSize<N>::value);
+  auto r = pybind11::array_t<double>(s.shape(0));
+  auto* const values = r.mutable_data();
+  tfel::python::forEachStensor<N>(
+      s,
+      [values, &l1, &l2, a, e](const std::size_t i,
+                               const tfel::math::stensor<N, double>& sig) {
+        values[i] = tfel::material::computeBarlatStress(sig, l1, l2, a, e);
+      },
+      nthreads);
+  return r;
+}  // end of computeBarlatStresses
+
 void declareBarlat(pybind11::module_&);
 
 void declareBarlat(pybind11::module_& m) {
@@ -51,4 +74,19 @@ void declareBarlat(pybind11::module_& m) {
   m.def("computeBarlatStress", &computeBarlatStress<1u>);
   m.def("computeBarlatStress", &computeBarlatStress<2u>);
   m.def("computeBarlatStress", &computeBarlatStress<3u>);
+  const char* const doc =
+      "compute the Barlat equivalent stress of an array of stress "
+      "tensors stored as a `n x 3`, `n x 4` or `n x 6` array";
+  m.def("computeBarlatStress", &computeBarlatStresses<1u>, doc,
+        pybind11::arg("s"), pybind11::arg("l1"), pybind11::arg("l2"),
+        pybind11::arg("a"), pybind11::arg("e"),
+        pybind11::arg("number_of_threads") = std::size_t{1});
+  m.def("computeBarlatStress", &computeBarlatStresses<2u>, doc,
+        pybind11::arg("s"), pybind11::arg("l1"), pybind11::arg("l2"),
+        pybind11::arg("a"), pybind11::arg("e"),
+        pybind11::arg("number_of_threads") = std::size_t{1});
+  m.def("computeBarlatStress", &computeBarlatStresses<3u>, doc,
+        pybind11::arg("s"), pybind11::arg("l1"), pybind11::arg("l2"),
+        pybind11::arg("a"), pybind11::arg("e"),
+        pybind11::arg("number_of_threads") = std::size_t{1});
 }
@@ -11,10 +11,76 @@
  * project under specific licensing conditions.
  */
 
+#include <vector>
+#include <algorithm>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 #include "TFEL/Material/IsotropicEshelbyTensor.hxx"
 #include "TFEL/Material/AnisotropicEshelbyTensor.hxx"
+#include "VectorizedFunctions.hxx"
+
+/*!
+ * \return a `n x 6 x 6` array
+ * \param[in] n: number of tensors
+ */
+static pybind11::array_t<double> makeSt2tost2Array(const pybind11::ssize_t n) {
+  return pybind11::array_t<double>(std::vector<pybind11::ssize_t>{n, 6, 6});
+}  // end of makeSt2tost2Array
+
+static pybind11::array_t<double> computeSphereHillTensors(
+    const tfel::python::DoubleArray& young,
+    const tfel::python::DoubleArray& nu,
+    const std::size_t nthreads) {
+  using namespace tfel::material::homogenization::elasticity;
+  tfel::python::checkArray("computeSphereHillTensor", young, 1);
+  tfel::python::checkArray("computeSphereHillTensor", nu, 1);
+  tfel::python::checkNumberOfRows("computeSphereHillTensor", young, nu);
+  auto r = makeSt2tost2Array(young.shape(0));
+  auto* const values = r.mutable_data();
+  const auto* const pE = young.data();
+  const auto* const pnu = nu.data();
+  tfel::python::vectorize(
+      static_cast<std::size_t>(young.shape(0)),
+      [values, pE, pnu](const std::size_t i) {
+        const auto P =
+            computeSphereHillPolarisationTensor<double>(pE[i], pnu[i]);
+        std::copy(P.begin(), P.end(), values + 36 * i);
+      },
+      nthreads);
+  return r;
+}  // end of computeSphereHillTensors
+
+static pybind11::array_t<double> computeHillTensors(
+    const double young,
+    const double nu,
+    const tfel::python::DoubleArray& n_a,
+    const double a,
+    const tfel::python::DoubleArray& n_b,
+    const double b,
+    const double c,
+    const std::size_t nthreads) {
+  using namespace tfel::material::homogenization::elasticity;
+  tfel::python::checkArray("computeHillTensor", n_a, 2, 3);
+  tfel::python::checkArray("computeHillTensor", n_b, 2, 3);
+  tfel::python::checkNumberOfRows("computeHillTensor", n_a, n_b);
+  auto r = makeSt2tost2Array(n_a.shape(0));
+  auto* const values = r.mutable_data();
+  const auto* const pa = n_a.data();
+  const auto* const pb = n_b.data();
+  tfel::python::vectorize(
+      static_cast<std::size_t>(n_a.shape(0)),
+      [values, pa, pb, young, nu, a, b, c](const std::size_t i) {
+        const auto na = tfel::math::tvector<3u, double>{
+            pa[3 * i], pa[3 * i + 1], pa[3 * i + 2]};
+        const auto nb = tfel::math::tvector<3u, double>{
+            pb[3 * i], pb[3 * i + 1], pb[3 * i + 2]};
+        const auto P = computeHillPolarisationTensor<double>(young, nu, na,
+                                                             a, nb, b, c);
+        std::copy(P.begin(), P.end(), values + 36 * i);
+      },
+      nthreads);
+  return r;
+}  // end of computeHillTensors
 
 void declareHillTensors(pybind11::module_&);
 
@@ -57,6 +123,21 @@ void declareHillTensors(pybind11::module_& m) {
     return homogenization::elasticity::computeHillPolarisationTensor<double>(
         IM, n_a, a, n_b, b, c);
   });
+  m.def("computeSphereHillTensor", computeSphereHillTensors,
+        "compute the Hill tensors of spheres embedded in isotropic "
+        "matrices whose Young moduli and Poisson ratios are given by two "
+        "arrays. The result is a `n x 6 x 6` array",
+        pybind11::arg("young"), pybind11::arg("nu"),
+        pybind11::arg("number_of_threads") = std::size_t{1});
+  m.def("computeHillTensor", computeHillTensors,
+        "compute the Hill tensors of ellipsoids embedded in an isotropic "
+        "matrix for an array of orientations. The directions `n_a` and "
+        "`n_b` are given as `n x 3` arrays. The result is a `n x 6 x 6` "
+        "array",
+        pybind11::arg("young"), pybind11::arg("nu"), pybind11::arg("n_a"),
+        pybind11::arg("a"), pybind11::arg("n_b"), pybind11::arg("b"),
+        pybind11::arg("c"),
+        pybind11::arg("number_of_threads") = std::size_t{1});
   m.def(
       "computeAnisotropicHillTensor",
       [](const tfel::math::st2tost2<3u, double>& C0,
@@ -15,6 +15,7 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 #include "TFEL/Material/Hosford1972YieldCriterion.hxx"
+#include "VectorizedFunctions.hxx"
 
 template <unsigned short N>
 static double computeHosfordStress(const tfel::math::stensor<N, double>& s,
@@ -23,10 +24,51 @@ static double computeHosfordStress(const tfel::math::stensor<N, double>& s,
   return tfel::material::computeHosfordStress(s, a, e);
 }  // end of computeHosfordStress
 
+template <unsigned short N>
+static pybind11::array_t<double> computeHosfordStresses(
+    const tfel::python::DoubleArray& s,
+    const double a,
+    const double e,
+    const std::size_t nthreads) {
+  auto r = pybind11::array_t<double>(s.shape(0));
+  auto* const values = r.mutable_data();
+  tfel::python::forEachStensor<N>(
+      s,
+      [values, a, e](const std::size_t i,
+                     const tfel::math::stensor<N, double>& sig) {
+        values[i] = tfel::material::computeHosfordStress(sig, a, e);
+      },
+      nthreads);
+  return r;
+}  // end of computeHosfordStresses
+
+static pybind11::array_t<double> computeHosfordStresses(
+    const tfel::python::DoubleArray& s,
+    const double a,
+    const double e,
+    const std::size_t nthreads) {
+  const auto N = tfel::python::getStensorArraySpaceDimension(
+      "computeHosfordStress", s);
+  if (N == 1u) {
+    return computeHosfordStresses<1u>(s, a, e, nthreads);
+  } else if (N == 2u) {
+    return computeHosfordStresses<2u>(s, a, e, nthreads);
+  }
+  return computeHosfordStresses<3u>(s, a, e, nthreads);
+}  // end of computeHosfordStresses
+
 void declareHosford(pybind11::module_&);
 
 void declareHosford(pybind11::module_& m) {
   m.def("computeHosfordStress", &computeHosfordStress<1u>);
   m.def("computeHosfordStress", &computeHosfordStress<2u>);
   m.def("computeHosfordStress", &computeHosfordStress<3u>);
+  pybind11::array_t<double> (*f)(const tfel::python::DoubleArray&,
+                                 const double, const double,
+                                 const std::size_t) = computeHosfordStresses;
+  m.def("computeHosfordStress", f,
+        "compute the Hosford equivalent stress of an array of stress "
+        "tensors stored as a `n x 3`, `n x 4` or `n x 6` array",
+        pybind11::arg("s"), pybind11::arg("a"), pybind11::arg("e"),
+        pybind11::arg("number_of_threads") = std::size_t{1});
 }
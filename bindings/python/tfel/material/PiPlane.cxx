@@ -12,9 +12,11 @@
  * project under specific licensing conditions.
  */
 
+#include <vector>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 #include "TFEL/Material/PiPlane.hxx"
+#include "VectorizedFunctions.hxx"
 
 template <unsigned short N>
 static std::tuple<double, double> projectOnPiPlane(
@@ -22,6 +24,61 @@ static std::tuple<double, double> projectOnPiPlane(
   return tfel::material::projectOnPiPlane(s);
 }  // end of projectOnPiPlane
 
+template <unsigned short N>
+static pybind11::array_t<double> projectArrayOnPiPlane(
+    const tfel::python::DoubleArray& s, const std::size_t nthreads) {
+  auto r = pybind11::array_t<double>(
+      std::vector<pybind11::ssize_t>{s.shape(0), 2});
+  auto* const values = r.mutable_data();
+  tfel::python::forEachStensor<N>(
+      s,
+      [values](const std::size_t i, const tfel::math::stensor<N, double>& sig) {
+        const auto [x, y] = tfel::material::projectOnPiPlane(sig);
+        values[2 * i] = x;
+        values[2 * i + 1] = y;
+      },
+      nthreads);
+  return r;
+}  // end of projectArrayOnPiPlane
+
+static pybind11::array_t<double> projectArrayOnPiPlane(
+    const tfel::python::DoubleArray& s, const std::size_t nthreads) {
+  // an array of eigenvalues is treated as an array of 1D stress tensors
+  const auto N =
+      tfel::python::getStensorArraySpaceDimension("projectOnPiPlane", s);
+  if (N == 1u) {
+    return projectArrayOnPiPlane<1u>(s, nthreads);
+  } else if (N == 2u) {
+    return projectArrayOnPiPlane<2u>(s, nthreads);
+  }
+  return projectArrayOnPiPlane<3u>(s, nthreads);
+}  // end of projectArrayOnPiPlane
+
+static pybind11::array_t<double> buildArrayFromPiPlane(
+    const tfel::python::DoubleArray& x,
+    const tfel::python::DoubleArray& y,
+    const std::size_t nthreads) {
+  tfel::python::checkArray("buildFromPiPlane", x, 1);
+  tfel::python::checkArray("buildFromPiPlane", y, 1);
+  tfel::python::checkNumberOfRows("buildFromPiPlane", x, y);
+  auto r = pybind11::array_t<double>(
+      std::vector<pybind11::ssize_t>{x.shape(0), 3});
+  auto* const values = r.mutable_data();
+  const auto* const px = x.data();
+  const auto* const py = y.data();
+  tfel::python::vectorize(
+      static_cast<std::size_t>(x.shape(0)),
+      [values, px, py](const std::size_t i) {
+        const auto [s0, s1, s2] =
+            tfel::material::buildFromPiPlane(px[i], py[i]);
+        values[3 * i] = s0;
+        values[3 * i + 1] = s1;
+        values[3 * i + 2] = s2;
+      },
+      nthreads);
+  return r;
+}  // end of buildArrayFromPiPlane
+
 void declarePiPlane(pybind11::module_&);
 
 void declarePiPlane(pybind11::module_& m) {
@@ -40,4 +97,18 @@ void declarePiPlane(pybind11::module_& m) {
         "project a 2D stress tensor on the pi-plane");
   m.def("projectOnPiPlane", projectOnPiPlane<3u>,
         "project a 3D stress tensor on the pi-plane");
+  pybind11::array_t<double> (*p2)(const tfel::python::DoubleArray&,
+                                  const std::size_t) = projectArrayOnPiPlane;
+  m.def("projectOnPiPlane", p2,
+        "project an array of stress tensors, stored as a `n x 3`, `n x 4` "
+        "or `n x 6` array, on the pi-plane. An array of eigenvalues can "
+        "also be given as a `n x 3` array. The result is a `n x 2` array",
+        pybind11::arg("s"),
+        pybind11::arg("number_of_threads") = std::size_t{1});
+  m.def("buildFromPiPlane", buildArrayFromPiPlane,
+        "return a `n x 3` array containing the eigenvalues "
+        "of the stresses corresponding to the given "
+        "points in the pi-plane",
+        pybind11::arg("x"), pybind11::arg("y"),
+        pybind11::arg("number_of_threads") = std::size_t{1});
 }
@@ -0,0 +1,166 @@
+/*!
+ * \file   bindings/python/tfel/material/VectorizedFunctions.hxx
+ * \brief  This file declares some helper functions used to evaluate a
+ * function on each row of a `NumPy` array.
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright Copyright (C) 2006-2025 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_PYTHON_MATERIAL_VECTORIZEDFUNCTIONS_HXX
+#define LIB_TFEL_PYTHON_MATERIAL_VECTORIZEDFUNCTIONS_HXX
+
+#include <string>
+#include <thread>
+#include <cstddef>
+#include <algorithm>
+#include <pybind11/pybind11.h>
+#include <pybind11/numpy.h>
+#include "TFEL/Raise.hxx"
+#include "TFEL/Math/stensor.hxx"
+#include "TFEL/System/ThreadPool.hxx"
+
+namespace tfel::python {
+
+  /*!
+   * \brief a simple alias to a contiguous array of doubles. Arrays of other
+   * types or non contiguous arrays are converted.
+   */
+  using DoubleArray =
+      pybind11::array_t<double,
+                        pybind11::array::c_style | pybind11::array::forcecast>;
+
+  /*!
+   * \brief check that the given array has the expected number of dimensions
+   * and, for arrays of rank 2, the expected number of columns.
+   * \param[in] m: calling function
+   * \param[in] a: array
+   * \param[in] r: expected rank (1 or 2)
+   * \param[in] c: expected number of columns (arrays of rank 2 only)
+   */
+  inline void checkArray(const char* const m,
+                         const DoubleArray& a,
+                         const pybind11::ssize_t r,
+                         const pybind11::ssize_t c = 0) {
+    if (a.ndim() != r) {
+      tfel::raise(std::string{m} + ": expected an array of rank " +
+                  std::to_string(r) + ", got an array of rank " +
+                  std::to_string(a.ndim()));
+    }
+    if ((r == 2) && (a.shape(1) != c)) {
+      tfel::raise(std::string{m} + ": expected an array with " +
+                  std::to_string(c) + " columns, got an array with " +
+                  std::to_string(a.shape(1)) + " columns");
+    }
+  }  // end of checkArray
+
+  /*!
+   * \brief check that the given arrays have the same number of rows
+   * \param[in] m: calling function
+   * \param[in] a: first array
+   * \param[in] b: second array
+   */
+  inline void checkNumberOfRows(const char* const m,
+                                const DoubleArray& a,
+                                const DoubleArray& b) {
+    if (a.shape(0) != b.shape(0)) {
+      tfel::raise(std::string{m} + ": unmatched number of rows (" +
+                  std::to_string(a.shape(0)) + " vs " +
+                  std::to_string(b.shape(0)) + ")");
+    }
+  }  // end of checkNumberOfRows
+
+  /*!
+   * \return the space dimension associated with an array of symmetric
+   * tensors, i.e. a `n x 3` (1D), a `n x 4` (2D) or a `n x 6` (3D) array.
+   * \param[in] m: calling function
+   * \param[in] s: array of symmetric tensors
+   */
+  inline unsigned short getStensorArraySpaceDimension(const char* const m,
+                                                      const DoubleArray& s) {
+    if (s.ndim() != 2) {
+      tfel::raise(std::string{m} + ": expected an array of rank 2, " +
+                  "got an array of rank " + std::to_string(s.ndim()));
+    }
+    if (s.shape(1) == 3) {
+      return 1u;
+    } else if (s.shape(1) == 4) {
+      return 2u;
+    } else if (s.shape(1) != 6) {
+      tfel::raise(std::string{m} +
+                  ": invalid number of columns for an array of symmetric "
+                  "tensors (expected 3, 4 or 6, got " +
+                  std::to_string(s.shape(1)) + ")");
+    }
+    return 3u;
+  }  // end of getStensorArraySpaceDimension
+
+  /*!
+   * \brief call the given function for each index in `[0, n[`.
+   *
+   * The global interpreter lock is released during the evaluation, so the
+   * function must not manipulate `python` objects. Results shall be
+   * written through raw pointers to memory areas allocated beforehand.
+   *
+   * \param[in] n: number of evaluations
+   * \param[in] f: function
+   * \param[in] nthreads: number of threads. If null, the number of
+   * threads is given by the hardware concurrency.
+   */
+  template <typename F>
+  void vectorize(const std::size_t n, const F& f, const std::size_t nthreads) {
+    const auto nt = std::min(
+        nthreads == 0
+            ? std::max(static_cast<std::size_t>(std::thread::hardware_concurrency()),
+                       std::size_t{1})
+            : nthreads,
+        std::max(n, std::size_t{1}));
+    pybind11::gil_scoped_release release;
+    if (nt == 1) {
+      for (std::size_t i = 0; i != n; ++i) {
+        f(i);
+      }
+      return;
+    }
+    // the calling thread also treats some chunks
+    auto pool = tfel::system::ThreadPool{nt - 1};
+    pool.parallel_for(0, n, [&f](const std::size_t b, const std::size_t e) {
+      for (auto i = b; i != e; ++i) {
+        f(i);
+      }
+    });
+  }  // end of vectorize
+
+  /*!
+   * \brief call the given function for each symmetric tensor stored in the
+   * given array. The function is called with the index of the tensor and
+   * the tensor.
+   * \tparam N: space dimension
+   * \param[in] s: array of symmetric tensors
+   * \param[in] f: function
+   * \param[in] nthreads: number of threads
+   */
+  template <unsigned short N, typename F>
+  void forEachStensor(const DoubleArray& s,
+                      const F& f,
+                      const std::size_t nthreads) {
+    constexpr auto size = tfel::math::StensorDimeToSize<N>::value;
+    const auto* const values = s.data();
+    vectorize(
+        static_cast<std::size_t>(s.shape(0)),
+        [values, &f](const std::size_t i) {
+          auto v = tfel::math::stensor<N, double>{};
+          std::copy(values + i * size, values + (i + 1) * size, v.begin());
+          f(i, v);
+        },
+        nthreads);
+  }  // end of forEachStensor
+
+}  // end of namespace tfel::python
+
+#endif /* LIB_TFEL_PYTHON_MATERIAL_VECTORIZEDFUNCTIONS_HXX */
@@ -15,9 +15,12 @@
 #ifndef LIB_TFEL_MATERIAL_ANISOTROPICESHELBYTENSOR_HXX
 #define LIB_TFEL_MATERIAL_ANISOTROPICESHELBYTENSOR_HXX
 
+#include <array>
+#include <vector>
+#include <cstddef>
+#include <stdexcept>
 #include "TFEL/Math/st2tost2.hxx"
 #include "TFEL/Material/StiffnessTensor.hxx"
-#include <stdexcept>
 
 namespace tfel::material::homogenization::elasticity {
 
@@ -204,6 +207,220 @@ namespace tfel::material::homogenization::elasticity {
           const types::length<StressType>&,
           const std::size_t max_it = 12);
 
+  /*!
+   * \brief a fixed-order quadrature rule used to compute the Hill tensor
+   * of an ellipse or an ellipsoid embedded in an anisotropic matrix.
+   *
+   * Contrary to the functions taking the maximal number of iterations of
+   * the adaptive integration as last argument, the functions using a
+   * quadrature object evaluate the integrand once per direction and
+   * compute all the components of the Hill tensor in a single sweep over
+   * the directions. The directions are treated by blocks so that the
+   * computation of the acoustic tensors and of their inverses can be
+   * vectorised by the compiler.
+   *
+   * The integral is written over the unit sphere (or the unit circle) of
+   * the directions \f$\zeta\f$ of the wave vectors. The shape of the
+   * inclusion only appears through the weight
+   * \f$a\,b\,c/\left\|\Lambda\,\zeta\right\|^{3}\f$ (resp.
+   * \f$a\,b/\left\|\Lambda\,\zeta\right\|^{2}\f$ in 2D), where
+   * \f$\Lambda\f$ is the diagonal matrix of the semi-axes. This weight is
+   * sharply peaked for elongated or flat inclusions: the Gauss-Legendre
+   * points are clustered around the peak by a \f$\sinh\f$ mapping whose
+   * width is given by the aspect ratio of the inclusion, and the
+   * azimuthal points are mapped to account for the ratio of the two
+   * remaining semi-axes.
+   *
+   * With the default order, the relative accuracy is close to the machine
+   * precision for aspect ratios up to \f$50\f$ and is about
+   * \f$10^{-5}\f$ for an ellipsoid whose semi-axes are \f$100\f$,
+   * \f$10\f$ and \f$1\f$.
+   *
+   * \tparam real: numeric type
+   */
+  template <typename real>
+  struct AnisotropicHillTensorQuadrature {
+    //! \brief default order of the quadrature
+    static constexpr std::size_t defaultOrder = 32;
+    /*!
+     * \brief constructor
+     * \param[in] n: order of the quadrature, i.e. the number of
+     * Gauss-Legendre points. The number of directions is \f$2\,n\f$ in 2D
+     * and \f$2\,n^{2}\f$ in 3D.
+     */
+    explicit AnisotropicHillTensorQuadrature(const std::size_t = defaultOrder);
+    //! \return the order of the quadrature
+    [[nodiscard]] std::size_t getOrder() const noexcept;
+    //! \brief Gauss-Legendre points on \f$[0,1]\f$
+    std::vector<real> points;
+    //! \brief Gauss-Legendre weights on \f$[0,1]\f$
+    std::vector<real> weights;
+    //! \brief cosines of the \f$2\,n\f$ uniformly distributed azimuths
+    std::vector<real> cos_psi;
+    //! \brief sines of the \f$2\,n\f$ uniformly distributed azimuths
+    std::vector<real> sin_psi;
+  };  // end of struct AnisotropicHillTensorQuadrature
+
+  /*!
+   * This function builds the Hill tensor of a general 2d ellipse embedded
+   * in an ANISOTROPIC matrix using a fixed-order quadrature.
+   * The function returns the Hill tensor in the GLOBAL basis.
+   * \return an object of type st2tost2<2u,types::compliance<StressType>>
+   * \tparam StressType: type of the elastic constants
+   * \param[in] C: stiffness tensor of the matrix
+   * \param [in] n_a: direction of the principal axis whose length is \f$a\f$
+   * \param [in] a: length of semi-axis relative to the direction \f$n_a\f$
+   * \param [in] b: length of semi-axis relative to the other direction
+   * \param[in] q: quadrature
+   */
+  template <tfel::math::ScalarConcept StressType>
+  requires(tfel::math::checkUnitCompatibility<
+           tfel::math::unit::Stress,
+           StressType>()) tfel::math::
+      st2tost2<2u, types::compliance<StressType>> computePlaneStrainAnisotropicHillTensor(
+          const tfel::math::st2tost2<2u, StressType>&,
+          const tfel::math::tvector<2u, types::real<StressType>>&,
+          const types::length<StressType>&,
+          const types::length<StressType>&,
+          const AnisotropicHillTensorQuadrature<tfel::math::base_type<StressType>>&);
+
+  /*!
+   * This function builds the Eshelby tensor of a general 2d ellipse
+   * embedded in an ANISOTROPIC matrix using a fixed-order quadrature.
+   * The function returns the Eshelby tensor in the global basis
+   * \return an object of type st2tost2<2u,real>
+   * \tparam StressType: type of the elastic constants
+   * \param[in] C: stiffness tensor of the matrix
+   * \param [in] n_a: direction of the principal axis whose length is \f$a\f$
+   * \param [in] a: length of semi-axis relative to the direction \f$n_a\f$
+   * \param [in] b: length of semi-axis relative to the other direction
+   * \param[in] q: quadrature
+   */
+  template <tfel::math::ScalarConcept StressType>
+  requires(tfel::math::checkUnitCompatibility<
+           tfel::math::unit::Stress,
+           StressType>()) tfel::math::
+      st2tost2<2u, types::real<StressType>> computePlaneStrainAnisotropicEshelbyTensor(
+          const tfel::math::st2tost2<2u, StressType>&,
+          const tfel::math::tvector<2u, types::real<StressType>>&,
+          const types::length<StressType>&,
+          const types::length<StressType>&,
+          const AnisotropicHillTensorQuadrature<tfel::math::base_type<StressType>>&);
+
+  /*!
+   * This function builds the Hill tensor of a general ellipsoid embedded in
+   * an ANISOTROPIC matrix using a fixed-order quadrature. The function
+   * returns the Hill tensor in the global basis
+   * \return an object of type st2tost2<3u,types::compliance<StressType>>
+   * \tparam StressType: type of the elastic constants
+   * \param[in] C: stiffness tensor of the matrix in the global basis
+   * \param [in] n_a: direction of the principal axis whose length is \f$a\f$
+   * \param [in] a: length of semi-axis relative to the direction \f$n_a\f$
+   * \param [in] n_b: direction of the principal axis whose length is \f$b\f$
+   * \param [in] b: length of semi-axis relative to the direction \f$n_b\f$
+   * \param [in] c: length of the remaining semi-axis
+   * \param[in] q: quadrature
+   */
+  template <tfel::math::ScalarConcept StressType>
+  requires(tfel::math::checkUnitCompatibility<
+           tfel::math::unit::Stress,
+           StressType>()) tfel::math::
+      st2tost2<3u, types::compliance<StressType>> computeAnisotropicHillTensor(
+          const tfel::math::st2tost2<3u, StressType>&,
+          const tfel::math::tvector<3u, types::real<StressType>>&,
+          const types::length<StressType>&,
+          const tfel::math::tvector<3u, types::real<StressType>>&,
+          const types::length<StressType>&,
+          const types::length<StressType>&,
+          const AnisotropicHillTensorQuadrature<tfel::math::base_type<StressType>>&);
+
+  /*!
+   * This function builds the Eshelby tensor of a general ellipsoid embedded
+   * in an ANISOTROPIC matrix using a fixed-order quadrature. The function
+   * returns the Eshelby tensor in the global basis
+   * \return an object of type st2tost2<3u,real>
+   * \tparam StressType: type of the elastic constants
+   * \param[in] C: stiffness tensor of the matrix in the global basis
+   * \param [in] n_a: direction of the principal axis whose length is \f$a\f$
+   * \param [in] a: length of semi-axis relative to the direction \f$n_a\f$
+   * \param [in] n_b: direction of the principal axis whose length is \f$b\f$
+   * \param [in] b: length of semi-axis relative to the direction \f$n_b\f$
+   * \param [in] c: length of the remaining semi-axis
+   * \param[in] q: quadrature
+   */
+  template <tfel::math::ScalarConcept StressType>
+  requires(tfel::math::checkUnitCompatibility<tfel::math::unit::Stress,
+                                              StressType>())
+      tfel::math::
+          st2tost2<3u, types::real<StressType>> computeAnisotropicEshelbyTensor(
+              const tfel::math::st2tost2<3u, StressType>&,
+              const tfel::math::tvector<3u, types::real<StressType>>&,
+              const types::length<StressType>&,
+              const tfel::math::tvector<3u, types::real<StressType>>&,
+              const types::length<StressType>&,
+              const types::length<StressType>&,
+              const AnisotropicHillTensorQuadrature<tfel::math::base_type<StressType>>&);
+
+  /*!
+   * This function builds the strain localisation tensor of a general
+   * ellipsoid embedded in an ANISOTROPIC matrix using a fixed-order
+   * quadrature. See the overload taking the maximal number of iterations
+   * of the adaptive integration for details.
+   * \return an object of type st2tost2<3u,real>, which is the fourth-order
+   * localisation tensor \f$A\f$ in the GLOBAL BASIS
+   * \tparam StressType: type of the elastic constants related to the matrix
+   * and the ellipsoid
+   * \param[in] C_0_glob: stiffness tensor of the matrix in the GLOBAL basis
+   * \param[in] C_i_loc: stiffness tensor of the inclusion in the LOCAL
+   * basis, which is the basis (n_a,n_b,n_c)
+   * \param [in] n_a: direction of the principal axis whose length is \f$a\f$
+   * \param [in] a: length of semi-axis relative to the direction \f$n_a\f$
+   * \param [in] n_b: direction of the principal axis whose length is \f$b\f$
+   * \param [in] b: length of semi-axis relative to the direction \f$n_b\f$
+   * \param [in] c: length of the remaining semi-axis
+   * \param[in] q: quadrature
+   */
+  template <tfel::math::ScalarConcept StressType>
+  requires(tfel::math::checkUnitCompatibility<
+           tfel::math::unit::Stress,
+           StressType>()) tfel::math::
+      st2tost2<3u, types::real<StressType>> computeAnisotropicLocalisationTensor(
+          const tfel::math::st2tost2<3u, StressType>&,
+          const tfel::math::st2tost2<3u, StressType>&,
+          const tfel::math::tvector<3u, types::real<StressType>>&,
+          const types::length<StressType>&,
+          const tfel::math::tvector<3u, types::real<StressType>>&,
+          const types::length<StressType>&,
+          const types::length<StressType>&,
+          const AnisotropicHillTensorQuadrature<tfel::math::base_type<StressType>>&);
+
+  /*!
+   * This function builds the strain localisation tensor of a general 2d
+   * ellipse embedded in an ANISOTROPIC matrix using a fixed-order
+   * quadrature.
+   * \return an object of type st2tost2<2u,real>, which is the fourth-order
+   * localisation tensor \f$A\f$ in the GLOBAL BASIS
+   * \tparam StressType: type of the elastic constants
+   * \param[in] C_0_glob: stiffness tensor of the matrix in the GLOBAL basis
+   * \param[in] C_i_loc: stiffness tensor of the inclusion in the LOCAL basis,
+   * which is the basis related to \f$n_a\f$
+   * \param [in] n_a: direction of the principal axis whose length is \f$a\f$
+   * \param [in] a: length of semi-axis relative to the direction \f$n_a\f$
+   * \param [in] b: length of semi-axis relative to the other direction
+   * \param[in] q: quadrature
+   */
+  template <tfel::math::ScalarConcept StressType>
+  requires(tfel::math::checkUnitCompatibility<
+           tfel::math::unit::Stress,
+           StressType>()) tfel::math::
+      st2tost2<2u, types::real<StressType>> computePlaneStrainAnisotropicLocalisationTensor(
+          const tfel::math::st2tost2<2u, StressType>&,
+          const tfel::math::st2tost2<2u, StressType>&,
+          const tfel::math::tvector<2u, types::real<StressType>>&,
+          const types::length<StressType>&,
+          const types::length<StressType>&,
+          const AnisotropicHillTensorQuadrature<tfel::math::base_type<StressType>>&);
+
   /*!
    * struct for dispatching computeAnisotropicLocalisationTensor over the
    * dimension \tparam N: dimension \tparam StressType: type of the elastic
@@ -240,6 +457,147 @@ namespace tfel::material::homogenization::elasticity {
           const std::array<types::length<StressType>, N>&,
           const std::size_t max_it = 12);
 
+  /*!
+   * A function computeAnisotropicLocalisationTensor for dimensions 2 and 3
+   * using a fixed-order quadrature.
+   * \tparam N: dimension
+   * \tparam StressType: type of the elastic constants related to the matrix
+   * and the ellipsoid
+   * \param[in] C_0_glob: stiffness tensor of the matrix in the GLOBAL basis
+   * \param[in] C_i_loc: stiffness tensor of the inclusion in the LOCAL
+   * basis, which is the basis given by (\f$n_a\f$,\f$n_b\f$) (\f$n_b\f$ is
+   * useless in 2d).
+   * \param [in] n_a: direction of the principal axis relative to first
+   * semi-length
+   * \param [in] n_b: direction of the principal axis relative to second
+   * semi-length
+   * \param [in] semiLengths: array of lengths of the N semi-axes.
+   * \param[in] q: quadrature
+   */
+  template <unsigned short int N, tfel::math::ScalarConcept StressType>
+  requires(tfel::math::checkUnitCompatibility<
+           tfel::math::unit::Stress,
+           StressType>()) tfel::math::
+      st2tost2<N, types::real<StressType>> computeGeneralAnisotropicLocalisationTensor(
+          const tfel::math::st2tost2<N, StressType>&,
+          const tfel::math::st2tost2<N, StressType>&,
+          const tfel::math::tvector<N, types::real<StressType>>&,
+          const tfel::math::tvector<N, types::real<StressType>>&,
+          const std::array<types::length<StressType>, N>&,
+          const AnisotropicHillTensorQuadrature<tfel::math::base_type<StressType>>&);
+
+  /*!
+   * \brief a cache of Hill tensors of ellipses or ellipsoids embedded in an
+   * anisotropic matrix.
+   *
+   * The Hill tensors are computed using a fixed-order quadrature and
+   * stored with the stiffness of the matrix, the orientation and the
+   * aspect ratios of the inclusion. A new computation is only performed
+   * if those data differ from the ones of all the stored entries. Only the
+   * aspect ratios are considered since the Hill tensor does not depend on
+   * the size of the inclusion.
+   *
+   * This is typically useful for polycrystals whose grains share the same
+   * shape and orientation, or when the same microstructure is homogenized
+   * many times with the same matrix stiffness.
+   *
+   * When the maximal number of entries is reached, the oldest entry is
+   * replaced.
+   *
+   * \note the cache is not thread-safe.
+   * \tparam N: dimension
+   * \tparam StressType: type of the elastic constants
+   */
+  template <unsigned short int N, tfel::math::ScalarConcept StressType>
+  requires(tfel::math::checkUnitCompatibility<
+           tfel::math::unit::Stress,
+           StressType>()) struct AnisotropicHillTensorCache {
+    //! \brief a simple alias
+    using real = types::real<StressType>;
+    //! \brief a simple alias
+    using LengthType = types::length<StressType>;
+    //! \brief a simple alias
+    using compliance = types::compliance<StressType>;
+    //! \brief numeric type used by the quadrature
+    using value_type = tfel::math::base_type<StressType>;
+    //! \brief default maximal number of entries
+    static constexpr std::size_t defaultCapacity = 64;
+    /*!
+     * \brief constructor
+     * \param[in] o: order of the quadrature
+     * \param[in] c: maximal number of entries
+     */
+    explicit AnisotropicHillTensorCache(
+        const std::size_t =
+            AnisotropicHillTensorQuadrature<value_type>::defaultOrder,
+        const std::size_t = defaultCapacity);
+    /*!
+     * \return the Hill tensor in the GLOBAL basis
+     * \param[in] C: stiffness tensor of the matrix in the GLOBAL basis
+     * \param[in] n_a: direction of the principal axis relative to the first
+     * semi-length
+     * \param[in] n_b: direction of the principal axis relative to the second
+     * semi-length (useless in 2d)
+     * \param[in] semiLengths: lengths of the semi-axes
+     */
+    [[nodiscard]] tfel::math::st2tost2<N, compliance> getHillTensor(
+        const tfel::math::st2tost2<N, StressType>&,
+        const tfel::math::tvector<N, real>&,
+        const tfel::math::tvector<N, real>&,
+        const std::array<LengthType, N>&);
+    /*!
+     * \return the strain localisation tensor in the GLOBAL basis
+     * \param[in] C_0_glob: stiffness tensor of the matrix in the GLOBAL
+     * basis
+     * \param[in] C_i_loc: stiffness tensor of the inclusion in the LOCAL
+     * basis
+     * \param[in] n_a: direction of the principal axis relative to the first
+     * semi-length
+     * \param[in] n_b: direction of the principal axis relative to the second
+     * semi-length (useless in 2d)
+     * \param[in] semiLengths: lengths of the semi-axes
+     */
+    [[nodiscard]] tfel::math::st2tost2<N, real> getLocalisationTensor(
+        const tfel::math::st2tost2<N, StressType>&,
+        const tfel::math::st2tost2<N, StressType>&,
+        const tfel::math::tvector<N, real>&,
+        const tfel::math::tvector<N, real>&,
+        const std::array<LengthType, N>&);
+    //! \return the quadrature used to compute the Hill tensors
+    [[nodiscard]] const AnisotropicHillTensorQuadrature<value_type>&
+    getQuadrature() const noexcept;
+    //! \return the number of stored entries
+    [[nodiscard]] std::size_t size() const noexcept;
+    //! \return the number of requests satisfied by a stored entry
+    [[nodiscard]] std::size_t getNumberOfHits() const noexcept;
+    //! \brief remove all the entries
+    void clear() noexcept;
+
+   private:
+    //! \brief number of values identifying an entry
+    static constexpr std::size_t key_size =
+        tfel::math::StensorDimeToSize<N>::value *
+            tfel::math::StensorDimeToSize<N>::value +
+        3 * N;
+    //! \brief an entry of the cache
+    struct Entry {
+      //! \brief stiffness of the matrix, orientation and aspect ratios
+      std::array<value_type, key_size> key;
+      //! \brief Hill tensor in the global basis
+      tfel::math::st2tost2<N, compliance> P;
+    };
+    //! \brief quadrature
+    AnisotropicHillTensorQuadrature<value_type> quadrature;
+    //! \brief stored entries
+    std::vector<Entry> entries;
+    //! \brief maximal number of entries
+    std::size_t capacity;
+    //! \brief index of the next entry to be replaced
+    std::size_t next = 0;
+    //! \brief number of hits
+    std::size_t hits = 0;
+  };  // end of struct AnisotropicHillTensorCache
+
 }  // namespace tfel::material::homogenization::elasticity
 
 #include "TFEL/Material/AnisotropicEshelbyTensor.ixx"
@@ -16,7 +16,9 @@
 
 #include <cmath>
 #include <numbers>
+#include <algorithm>
 #include <stdexcept>
+#include "TFEL/Raise.hxx"
 #include "TFEL/Math/General/Abs.hxx"
 
 namespace tfel::material::homogenization::elasticity {
@@ -145,8 +147,488 @@ namespace tfel::material::homogenization::elasticity {
       return Mijkl * std::sin(theta) / 4 / pi;
     }
 
+    /*!
+     * \brief integrate the Hill tensor over a set of directions, all the
+     * components being computed in a single sweep.
+     *
+     * The directions are stored in blocks. For each block, the acoustic
+     * tensors and their inverses are computed in separate loops over the
+     * directions of the block which can be vectorised by the compiler.
+     *
+     * \tparam N: space dimension
+     * \tparam real: numeric type
+     */
+    template <unsigned short int N, typename real>
+    struct HillTensorIntegrator {
+      //! \brief number of symmetric pairs of indices
+      static constexpr std::size_t np = N * (N + 1) / 2;
+      //! \brief number of directions of a block
+      static constexpr std::size_t bsize = 64;
+      /*!
+       * \brief constructor
+       * \param[in] C: stiffness tensor, without units, in the basis in
+       * which the directions are expressed
+       */
+      explicit HillTensorIntegrator(const tfel::math::st2tost2<N, real>& C) {
+        // the acoustic tensor is written A_ik = K[(ik)][(jl)] z_j z_l,
+        // the sum being restricted to j <= l
+        for (std::size_t p = 0; p != np; ++p) {
+          const auto i = pi[p];
+          const auto k = pj[p];
+          for (std::size_t r = 0; r != np; ++r) {
+            const auto j = pi[r];
+            const auto l = pj[r];
+            this->K[p][r] = tfel::math::getComponent(C, i, j, k, l);
+            if (j != l) {
+              this->K[p][r] += tfel::math::getComponent(C, i, l, k, j);
+            }
+          }
+        }
+      }
+      /*!
+       * \brief add a direction
+       * \param[in] z: direction
+       * \param[in] w: weight
+       */
+      void add(const std::array<real, N>& z, const real w) {
+        for (std::size_t i = 0; i != N; ++i) {
+          this->zb[i][this->nb] = z[i];
+        }
+        this->wb[this->nb] = w;
+        if (++(this->nb) == bsize) {
+          this->treatBlock();
+        }
+      }
+      //! \return the Hill tensor
+      tfel::math::st2tost2<N, real> getHillTensor() {
+        this->treatBlock();
+        auto P = tfel::math::st2tost2<N, real>(real(0));
+        for (unsigned short i = 0; i != N; ++i) {
+          for (unsigned short j = i; j != N; ++j) {
+            for (unsigned short k = 0; k != N; ++k) {
+              for (unsigned short l = k; l != N; ++l) {
+                const auto v = (this->H[pair(j, k)][pair(i, l)] +
+                                this->H[pair(i, k)][pair(j, l)] +
+                                this->H[pair(j, l)][pair(i, k)] +
+                                this->H[pair(i, l)][pair(j, k)]) /
+                               4;
+                tfel::math::setComponent<real>(P, i, j, k, l, v);
+              }
+            }
+          }
+        }
+        return P;
+      }
+
+     private:
+      //! \brief first index of the symmetric pairs
+      static constexpr std::array<unsigned short, np> pi = [] {
+        if constexpr (N == 2) {
+          return std::array<unsigned short, np>{0, 1, 0};
+        } else {
+          return std::array<unsigned short, np>{0, 1, 2, 0, 0, 1};
+        }
+      }();
+      //! \brief second index of the symmetric pairs
+      static constexpr std::array<unsigned short, np> pj = [] {
+        if constexpr (N == 2) {
+          return std::array<unsigned short, np>{0, 1, 1};
+        } else {
+          return std::array<unsigned short, np>{0, 1, 2, 1, 2, 2};
+        }
+      }();
+      //! \return the index of the symmetric pair (i,j)
+      static constexpr std::size_t pair(const unsigned short i,
+                                        const unsigned short j) {
+        if (i == j) {
+          return i;
+        }
+        return N + i + j - 1;
+      }
+      //! \brief treat the directions of the current block
+      void treatBlock() {
+        const auto n = this->nb;
+        if (n == 0) {
+          return;
+        }
+        // products of the components of the directions
+        std::array<std::array<real, bsize>, np> zz;
+        for (std::size_t r = 0; r != np; ++r) {
+          const auto& zi = this->zb[pi[r]];
+          const auto& zj = this->zb[pj[r]];
+          for (std::size_t q = 0; q != n; ++q) {
+            zz[r][q] = zi[q] * zj[q];
+          }
+        }
+        // acoustic tensors
+        std::array<std::array<real, bsize>, np> A;
+        for (std::size_t p = 0; p != np; ++p) {
+          for (std::size_t q = 0; q != n; ++q) {
+            A[p][q] = real(0);
+          }
+          for (std::size_t r = 0; r != np; ++r) {
+            const auto Kpr = this->K[p][r];
+            for (std::size_t q = 0; q != n; ++q) {
+              A[p][q] += Kpr * zz[r][q];
+            }
+          }
+        }
+        // inverses of the acoustic tensors, multiplied by the weights
+        std::array<std::array<real, bsize>, np> B;
+        if constexpr (N == 2) {
+          for (std::size_t q = 0; q != n; ++q) {
+            const auto iw =
+                this->wb[q] / (A[0][q] * A[1][q] - A[2][q] * A[2][q]);
+            B[0][q] = A[1][q] * iw;
+            B[1][q] = A[0][q] * iw;
+            B[2][q] = -A[2][q] * iw;
+          }
+        } else {
+          for (std::size_t q = 0; q != n; ++q) {
+            const auto a00 = A[0][q];
+            const auto a11 = A[1][q];
+            const auto a22 = A[2][q];
+            const auto a01 = A[3][q];
+            const auto a02 = A[4][q];
+            const auto a12 = A[5][q];
+            const auto b00 = a11 * a22 - a12 * a12;
+            const auto b11 = a00 * a22 - a02 * a02;
+            const auto b22 = a00 * a11 - a01 * a01;
+            const auto b01 = a02 * a12 - a01 * a22;
+            const auto b02 = a01 * a12 - a02 * a11;
+            const auto b12 = a01 * a02 - a00 * a12;
+            const auto iw = this->wb[q] / (a00 * b00 + a01 * b01 + a02 * b02);
+            B[0][q] = b00 * iw;
+            B[1][q] = b11 * iw;
+            B[2][q] = b22 * iw;
+            B[3][q] = b01 * iw;
+            B[4][q] = b02 * iw;
+            B[5][q] = b12 * iw;
+          }
+        }
+        // accumulation
+        for (std::size_t p = 0; p != np; ++p) {
+          for (std::size_t r = 0; r != np; ++r) {
+            auto v = real(0);
+            for (std::size_t q = 0; q != n; ++q) {
+              v += B[p][q] * zz[r][q];
+            }
+            this->H[p][r] += v;
+          }
+        }
+        this->nb = 0;
+      }
+      //! \brief matrix used to compute the acoustic tensors
+      std::array<std::array<real, np>, np> K;
+      //! \brief accumulated values of w A^{-1}_{(ik)} z_j z_l
+      std::array<std::array<real, np>, np> H = {};
+      //! \brief components of the directions of the current block
+      std::array<std::array<real, bsize>, N> zb;
+      //! \brief weights of the directions of the current block
+      std::array<real, bsize> wb;
+      //! \brief number of directions in the current block
+      std::size_t nb = 0;
+    };  // end of struct HillTensorIntegrator
+
+    /*!
+     * \return the Hill tensor of an ellipse in its local basis
+     * \param[in] C: stiffness tensor, without units, in the local basis
+     * \param[in] L: semi-axes, without units
+     * \param[in] q: quadrature
+     */
+    template <typename real>
+    tfel::math::st2tost2<2u, real> computeLocalAnisotropicHillTensor(
+        const tfel::math::st2tost2<2u, real>& C,
+        const std::array<real, 2u>& L,
+        const AnisotropicHillTensorQuadrature<real>& q) {
+      const real pi = std::numbers::pi_v<tfel::math::base_type<real>>;
+      // the weight a b / |L z|^2 is peaked around the direction of the
+      // smallest semi-axis
+      const auto is = L[0] < L[1] ? 0 : 1;
+      const auto il = 1 - is;
+      const auto eps = L[is] / L[il];
+      const auto kappa = std::asinh(pi / (2 * eps));
+      auto integrator = HillTensorIntegrator<2u, real>(C);
+      for (std::size_t i = 0; i != q.getOrder(); ++i) {
+        const auto e = eps * std::sinh(kappa * q.points[i]);
+        const auto de = eps * kappa * std::cosh(kappa * q.points[i]);
+        const auto ce = std::cos(e);
+        const auto se = std::sin(e);
+        auto z = std::array<real, 2u>{};
+        z[is] = ce;
+        z[il] = se;
+        const auto d = L[is] * L[is] * ce * ce + L[il] * L[il] * se * se;
+        const auto w = q.weights[i] * de * L[0] * L[1] / (d * pi);
+        integrator.add(z, w);
+        z[il] = -se;
+        integrator.add(z, w);
+      }
+      return integrator.getHillTensor();
+    }  // end of computeLocalAnisotropicHillTensor
+
+    /*!
+     * \return the Hill tensor of an ellipsoid in its local basis
+     * \param[in] C: stiffness tensor, without units, in the local basis
+     * \param[in] L: semi-axes, without units
+     * \param[in] q: quadrature
+     */
+    template <typename real>
+    tfel::math::st2tost2<3u, real> computeLocalAnisotropicHillTensor(
+        const tfel::math::st2tost2<3u, real>& C,
+        const std::array<real, 3u>& L,
+        const AnisotropicHillTensorQuadrature<real>& q) {
+      const real pi = std::numbers::pi_v<tfel::math::base_type<real>>;
+      // semi-axes sorted by decreasing lengths
+      auto idx = std::array<unsigned short, 3u>{0, 1, 2};
+      std::sort(idx.begin(), idx.end(), [&L](const unsigned short i,
+                                             const unsigned short j) {
+        return L[i] > L[j];
+      });
+      // The weight a b c / |L z|^3 is peaked around the direction of the
+      // smallest semi-axis for flat inclusions, and around the plane
+      // orthogonal to the largest semi-axis for elongated inclusions. The
+      // polar axis is chosen accordingly and the polar angle is clustered
+      // around the peak.
+      const auto elongated = L[idx[0]] * L[idx[2]] > L[idx[1]] * L[idx[1]];
+      const auto ip = elongated ? idx[0] : idx[2];
+      const auto i1 = elongated ? idx[1] : idx[0];
+      const auto i2 = elongated ? idx[2] : idx[1];
+      const auto eps =
+          elongated ? L[idx[1]] / L[idx[0]] : L[idx[2]] / L[idx[1]];
+      const auto kappa = std::asinh(pi / (2 * eps));
+      const auto L1 = L[i1];
+      const auto L2 = L[i2];
+      const auto nphi = q.cos_psi.size();
+      // the factor 2 comes from the central symmetry of the integrand, the
+      // polar angle being restricted to [0, pi/2]
+      const auto w0 = L[0] * L[1] * L[2] / static_cast<real>(nphi);
+      auto integrator = HillTensorIntegrator<3u, real>(C);
+      auto z = std::array<real, 3u>{};
+      for (std::size_t i = 0; i != q.getOrder(); ++i) {
+        const auto e = eps * std::sinh(kappa * q.points[i]);
+        const auto de = eps * kappa * std::cosh(kappa * q.points[i]);
+        const auto theta = elongated ? pi / 2 - e : e;
+        const auto ct = std::cos(theta);
+        const auto st = std::sin(theta);
+        const auto wt = w0 * q.weights[i] * de * st;
+        for (std::size_t k = 0; k != nphi; ++k) {
+          // mapping of the azimuth: tan(phi) = (L1/L2) tan(psi)
+          const auto cp = q.cos_psi[k];
+          const auto sp = q.sin_psi[k];
+          const auto D = L2 * L2 * cp * cp + L1 * L1 * sp * sp;
+          const auto sD = std::sqrt(D);
+          z[i1] = st * L2 * cp / sD;
+          z[i2] = st * L1 * sp / sD;
+          z[ip] = ct;
+          const auto d = L[0] * L[0] * z[0] * z[0] +  //
+                         L[1] * L[1] * z[1] * z[1] +  //
+                         L[2] * L[2] * z[2] * z[2];
+          integrator.add(z, wt * L1 * L2 / (D * d * std::sqrt(d)));
+        }
+      }
+      return integrator.getHillTensor();
+    }  // end of computeLocalAnisotropicHillTensor
+
+    /*!
+     * \return the rotation matrix from the global basis to the local basis
+     * of an ellipse
+     * \param[in] n_a: direction of the first axis
+     */
+    template <typename real>
+    tfel::math::rotation_matrix<tfel::math::base_type<real>>
+    getAnisotropicHillTensorRotationMatrix(
+        const tfel::math::tvector<2u, real>& n_a) {
+      using value_type = tfel::math::base_type<real>;
+      using tfel::math::base_type_cast;
+      if (tfel::math::ieee754::fpclassify(norm(n_a)) == FP_ZERO) {
+        tfel::reportContractViolation("n_a is null");
+      }
+      const auto n_a_ = n_a / norm(n_a);
+      const auto c = value_type(base_type_cast(n_a_[0]));
+      const auto s = value_type(base_type_cast(n_a_[1]));
+      return {c,  -s, value_type(0),  //
+              s,  c,  value_type(0),  //
+              value_type(0), value_type(0), value_type(1)};
+    }  // end of getAnisotropicHillTensorRotationMatrix
+
+    /*!
+     * \return the rotation matrix from the global basis to the local basis
+     * of an ellipsoid
+     * \param[in] n_a: direction of the first axis
+     * \param[in] n_b: direction of the second axis
+     */
+    template <typename real>
+    tfel::math::rotation_matrix<tfel::math::base_type<real>>
+    getAnisotropicHillTensorRotationMatrix(
+        const tfel::math::tvector<3u, real>& n_a,
+        const tfel::math::tvector<3u, real>& n_b) {
+      using value_type = tfel::math::base_type<real>;
+      using tfel::math::base_type_cast;
+      if (not(tfel::math::ieee754::fpclassify(
+                  tfel::math::VectorVectorDotProduct::exe<
+                      real, tfel::math::tvector<3u, real>,
+                      tfel::math::tvector<3u, real>>(n_a, n_b)) == FP_ZERO)) {
+        tfel::reportContractViolation("n_a and n_b not normals");
+      }
+      if (tfel::math::ieee754::fpclassify(norm(n_a)) == FP_ZERO) {
+        tfel::reportContractViolation("n_a is null");
+      }
+      if (tfel::math::ieee754::fpclassify(norm(n_b)) == FP_ZERO) {
+        tfel::reportContractViolation("n_b is null");
+      }
+      const auto n_a_ = n_a / norm(n_a);
+      const auto n_b_ = n_b / norm(n_b);
+      const auto n_c_ = tfel::math::cross_product<real>(n_a_, n_b_);
+      auto r = tfel::math::rotation_matrix<value_type>{};
+      for (unsigned short i = 0; i != 3; ++i) {
+        r(i, 0) = value_type(base_type_cast(n_a_[i]));
+        r(i, 1) = value_type(base_type_cast(n_b_[i]));
+        r(i, 2) = value_type(base_type_cast(n_c_[i]));
+      }
+      return r;
+    }  // end of getAnisotropicHillTensorRotationMatrix
+
+    /*!
+     * \return the Hill tensor in the global basis
+     * \param[in] C: stiffness tensor of the matrix in the global basis
+     * \param[in] r_glob_loc: rotation matrix from the global basis to the
+     * local basis
+     * \param[in] L: semi-axes
+     * \param[in] q: quadrature
+     */
+    template <unsigned short int N, tfel::math::ScalarConcept StressType>
+    tfel::math::st2tost2<N, types::compliance<StressType>>
+    computeAnisotropicHillTensor(
+        const tfel::math::st2tost2<N, StressType>& C,
+        const tfel::math::rotation_matrix<tfel::math::base_type<StressType>>&
+            r_glob_loc,
+        const std::array<types::length<StressType>, N>& L,
+        const AnisotropicHillTensorQuadrature<tfel::math::base_type<StressType>>&
+            q) {
+      using value_type = tfel::math::base_type<StressType>;
+      using LengthType = types::length<StressType>;
+      using compliance = types::compliance<StressType>;
+      using tfel::math::base_type_cast;
+      constexpr auto ssize = tfel::math::StensorDimeToSize<N>::value;
+      for (const auto& l : L) {
+        if (not(l > LengthType{0})) {
+          tfel::reportContractViolation("invalid semi-axis");
+        }
+      }
+      const auto lmax = base_type_cast(*(std::max_element(L.begin(), L.end())));
+      auto L_ = std::array<value_type, N>{};
+      for (std::size_t i = 0; i != N; ++i) {
+        L_[i] = base_type_cast(L[i]) / lmax;
+      }
+      auto C_ = tfel::math::st2tost2<N, value_type>{};
+      for (std::size_t i = 0; i != ssize; ++i) {
+        for (std::size_t j = 0; j != ssize; ++j) {
+          C_(i, j) = base_type_cast(C(i, j));
+        }
+      }
+      const auto P_ = tfel::math::change_basis(
+          computeLocalAnisotropicHillTensor<value_type>(
+              tfel::math::change_basis(C_, r_glob_loc), L_, q),
+          transpose(r_glob_loc));
+      auto P = tfel::math::st2tost2<N, compliance>{};
+      for (std::size_t i = 0; i != ssize; ++i) {
+        for (std::size_t j = 0; j != ssize; ++j) {
+          P(i, j) = compliance(P_(i, j));
+        }
+      }
+      return P;
+    }  // end of computeAnisotropicHillTensor
+
+    /*!
+     * \return the localisation tensor in the global basis
+     * \param[in] P_0_glob: Hill tensor in the global basis
+     * \param[in] C_0_glob: stiffness tensor of the matrix in the global basis
+     * \param[in] C_i_loc: stiffness tensor of the inclusion in the local
+     * basis
+     * \param[in] r_glob_loc: rotation matrix from the global basis to the
+     * local basis
+     */
+    template <unsigned short int N, tfel::math::ScalarConcept StressType>
+    tfel::math::st2tost2<N, types::real<StressType>>
+    computeAnisotropicLocalisationTensor(
+        const tfel::math::st2tost2<N, types::compliance<StressType>>& P_0_glob,
+        const tfel::math::st2tost2<N, StressType>& C_0_glob,
+        const tfel::math::st2tost2<N, StressType>& C_i_loc,
+        const tfel::math::rotation_matrix<tfel::math::base_type<StressType>>&
+            r_glob_loc) {
+      using real = types::real<StressType>;
+      using value_type = tfel::math::base_type<StressType>;
+      using namespace tfel::math;
+      constexpr auto ssize = StensorDimeToSize<N>::value;
+      auto C_i_loc_ = st2tost2<N, value_type>{};
+      for (std::size_t i = 0; i != ssize; ++i) {
+        for (std::size_t j = 0; j != ssize; ++j) {
+          C_i_loc_(i, j) = base_type_cast(C_i_loc(i, j));
+        }
+      }
+      const auto C_i_glob_ = change_basis(C_i_loc_, transpose(r_glob_loc));
+      auto C = st2tost2<N, StressType>{};
+      for (std::size_t i = 0; i != ssize; ++i) {
+        for (std::size_t j = 0; j != ssize; ++j) {
+          C(i, j) = StressType(C_i_glob_(i, j)) - C_0_glob(i, j);
+        }
+      }
+      return invert(st2tost2<N, real>::Id() + P_0_glob * C);
+    }  // end of computeAnisotropicLocalisationTensor
+
   }  // end of namespace internals
 
+  template <typename real>
+  AnisotropicHillTensorQuadrature<real>::AnisotropicHillTensorQuadrature(
+      const std::size_t n)
+      : points(n), weights(n), cos_psi(2 * n), sin_psi(2 * n) {
+    tfel::raise_if(n == 0,
+                   "AnisotropicHillTensorQuadrature::"
+                   "AnisotropicHillTensorQuadrature: invalid order");
+    const real pi = std::numbers::pi_v<tfel::math::base_type<real>>;
+    const auto ld = [n](const real x) {
+      // values of the Legendre polynomial of degree n and of its derivative
+      auto p0 = real(1);
+      auto p1 = x;
+      for (std::size_t k = 2; k <= n; ++k) {
+        const auto rk = static_cast<real>(k);
+        const auto p2 = ((2 * rk - 1) * x * p1 - (rk - 1) * p0) / rk;
+        p0 = p1;
+        p1 = p2;
+      }
+      const auto dp1 = static_cast<real>(n) * (x * p1 - p0) / (x * x - 1);
+      return std::array<real, 2u>{p1, dp1};
+    };
+    // Gauss-Legendre points on [-1,1], computed by Newton iterations
+    const auto rn = static_cast<real>(n);
+    for (std::size_t i = 0; i != n; ++i) {
+      auto x = std::cos(pi * (static_cast<real>(i) + real(3) / 4) /
+                        (rn + real(1) / 2));
+      for (std::size_t it = 0; it != 100; ++it) {
+        const auto [p, dp] = ld(x);
+        const auto dx = p / dp;
+        x -= dx;
+        if (std::abs(dx) < 2 * std::numeric_limits<real>::epsilon()) {
+          break;
+        }
+      }
+      const auto dp = ld(x)[1];
+      this->points[n - 1 - i] = (x + 1) / 2;
+      this->weights[n - 1 - i] = 1 / ((1 - x * x) * dp * dp);
+    }
+    for (std::size_t k = 0; k != 2 * n; ++k) {
+      const auto psi = pi * static_cast<real>(k) / rn;
+      this->cos_psi[k] = std::cos(psi);
+      this->sin_psi[k] = std::sin(psi);
+    }
+  }  // end of AnisotropicHillTensorQuadrature
+
+  template <typename real>
+  std::size_t AnisotropicHillTensorQuadrature<real>::getOrder()
+      const noexcept {
+    return this->points.size();
+  }  // end of getOrder
+
   template <tfel::math::ScalarConcept StressType>
   requires(tfel::math::checkUnitCompatibility<
            tfel::math::unit::Stress,
@@ -364,6 +846,116 @@ namespace tfel::material::homogenization::elasticity {
     return A;
   }  // end of computePlaneStrainAnisotropicLocalisationTensor
 
+  template <tfel::math::ScalarConcept StressType>
+  requires(tfel::math::checkUnitCompatibility<
+           tfel::math::unit::Stress,
+           StressType>()) tfel::math::
+      st2tost2<2u, types::compliance<StressType>> computePlaneStrainAnisotropicHillTensor(
+          const tfel::math::st2tost2<2u, StressType>& C,
+          const tfel::math::tvector<2u, types::real<StressType>>& n_a,
+          const types::length<StressType>& a,
+          const types::length<StressType>& b,
+          const AnisotropicHillTensorQuadrature<tfel::math::base_type<StressType>>& q) {
+    using LengthType = types::length<StressType>;
+    const auto r_glob_loc =
+        internals::getAnisotropicHillTensorRotationMatrix(n_a);
+    return internals::computeAnisotropicHillTensor<2u, StressType>(
+        C, r_glob_loc, std::array<LengthType, 2u>{a, b}, q);
+  }  // end of computePlaneStrainAnisotropicHillTensor
+
+  template <tfel::math::ScalarConcept StressType>
+  requires(tfel::math::checkUnitCompatibility<
+           tfel::math::unit::Stress,
+           StressType>()) tfel::math::
+      st2tost2<2u, types::real<StressType>> computePlaneStrainAnisotropicEshelbyTensor(
+          const tfel::math::st2tost2<2u, StressType>& C,
+          const tfel::math::tvector<2u, types::real<StressType>>& n_a,
+          const types::length<StressType>& a,
+          const types::length<StressType>& b,
+          const AnisotropicHillTensorQuadrature<tfel::math::base_type<StressType>>& q) {
+    return computePlaneStrainAnisotropicHillTensor<StressType>(C, n_a, a, b,
+                                                               q) *
+           C;
+  }  // end of computePlaneStrainAnisotropicEshelbyTensor
+
+  template <tfel::math::ScalarConcept StressType>
+  requires(tfel::math::checkUnitCompatibility<
+           tfel::math::unit::Stress,
+           StressType>()) tfel::math::
+      st2tost2<3u, types::compliance<StressType>> computeAnisotropicHillTensor(
+          const tfel::math::st2tost2<3u, StressType>& C,
+          const tfel::math::tvector<3u, types::real<StressType>>& n_a,
+          const types::length<StressType>& a,
+          const tfel::math::tvector<3u, types::real<StressType>>& n_b,
+          const types::length<StressType>& b,
+          const types::length<StressType>& c,
+          const AnisotropicHillTensorQuadrature<tfel::math::base_type<StressType>>& q) {
+    using LengthType = types::length<StressType>;
+    const auto r_glob_loc =
+        internals::getAnisotropicHillTensorRotationMatrix(n_a, n_b);
+    return internals::computeAnisotropicHillTensor<3u, StressType>(
+        C, r_glob_loc, std::array<LengthType, 3u>{a, b, c}, q);
+  }  // end of computeAnisotropicHillTensor
+
+  template <tfel::math::ScalarConcept StressType>
+  requires(tfel::math::checkUnitCompatibility<tfel::math::unit::Stress,
+                                              StressType>())
+      tfel::math::
+          st2tost2<3u, types::real<StressType>> computeAnisotropicEshelbyTensor(
+              const tfel::math::st2tost2<3u, StressType>& C,
+              const tfel::math::tvector<3u, types::real<StressType>>& n_a,
+              const types::length<StressType>& a,
+              const tfel::math::tvector<3u, types::real<StressType>>& n_b,
+              const types::length<StressType>& b,
+              const types::length<StressType>& c,
+              const AnisotropicHillTensorQuadrature<tfel::math::base_type<StressType>>&
+                  q) {
+    return computeAnisotropicHillTensor<StressType>(C, n_a, a, n_b, b, c, q) *
+           C;
+  }  // end of computeAnisotropicEshelbyTensor
+
+  template <tfel::math::ScalarConcept StressType>
+  requires(tfel::math::checkUnitCompatibility<
+           tfel::math::unit::Stress,
+           StressType>()) tfel::math::
+      st2tost2<3u, types::real<StressType>> computeAnisotropicLocalisationTensor(
+          const tfel::math::st2tost2<3u, StressType>& C_0_glob,
+          const tfel::math::st2tost2<3u, StressType>& C_i_loc,
+          const tfel::math::tvector<3u, types::real<StressType>>& n_a,
+          const types::length<StressType>& a,
+          const tfel::math::tvector<3u, types::real<StressType>>& n_b,
+          const types::length<StressType>& b,
+          const types::length<StressType>& c,
+          const AnisotropicHillTensorQuadrature<tfel::math::base_type<StressType>>& q) {
+    using LengthType = types::length<StressType>;
+    const auto r_glob_loc =
+        internals::getAnisotropicHillTensorRotationMatrix(n_a, n_b);
+    const auto P_0_glob = internals::computeAnisotropicHillTensor<3u, StressType>(
+        C_0_glob, r_glob_loc, std::array<LengthType, 3u>{a, b, c}, q);
+    return internals::computeAnisotropicLocalisationTensor<3u, StressType>(
+        P_0_glob, C_0_glob, C_i_loc, r_glob_loc);
+  }  // end of computeAnisotropicLocalisationTensor
+
+  template <tfel::math::ScalarConcept StressType>
+  requires(tfel::math::checkUnitCompatibility<
+           tfel::math::unit::Stress,
+           StressType>()) tfel::math::
+      st2tost2<2u, types::real<StressType>> computePlaneStrainAnisotropicLocalisationTensor(
+          const tfel::math::st2tost2<2u, StressType>& C_0_glob,
+          const tfel::math::st2tost2<2u, StressType>& C_i_loc,
+          const tfel::math::tvector<2u, types::real<StressType>>& n_a,
+          const types::length<StressType>& a,
+          const types::length<StressType>& b,
+          const AnisotropicHillTensorQuadrature<tfel::math::base_type<StressType>>& q) {
+    using LengthType = types::length<StressType>;
+    const auto r_glob_loc =
+        internals::getAnisotropicHillTensorRotationMatrix(n_a);
+    const auto P_0_glob = internals::computeAnisotropicHillTensor<2u, StressType>(
+        C_0_glob, r_glob_loc, std::array<LengthType, 2u>{a, b}, q);
+    return internals::computeAnisotropicLocalisationTensor<2u, StressType>(
+        P_0_glob, C_0_glob, C_i_loc, r_glob_loc);
+  }  // end of computePlaneStrainAnisotropicLocalisationTensor
+
   template <tfel::math::ScalarConcept StressType>
   requires(tfel::math::checkUnitCompatibility<
            tfel::math::unit::Stress,
@@ -377,6 +969,15 @@ namespace tfel::material::homogenization::elasticity {
       return computePlaneStrainAnisotropicLocalisationTensor<StressType>(
           C_0_glob, C_i_loc, n_a, semiLengths[0], semiLengths[1], max_it);
     }
+    static tfel::math::st2tost2<2u, types::real<StressType>> exe(
+        const tfel::math::st2tost2<2u, StressType>& C_0_glob,
+        const tfel::math::st2tost2<2u, StressType>& C_i_loc,
+        const tfel::math::tvector<2u, types::real<StressType>>& n_a,
+        const std::array<types::length<StressType>, 2u>& semiLengths,
+        const AnisotropicHillTensorQuadrature<tfel::math::base_type<StressType>>& q) {
+      return computePlaneStrainAnisotropicLocalisationTensor<StressType>(
+          C_0_glob, C_i_loc, n_a, semiLengths[0], semiLengths[1], q);
+    }
   };  // end of AnisotropicLocalisationTensor<2u, StressType>
 
   template <tfel::math::ScalarConcept StressType>
@@ -394,6 +995,17 @@ namespace tfel::material::homogenization::elasticity {
           C_0_glob, C_i_loc, n_a, semiLengths[0], n_b, semiLengths[1],
           semiLengths[2], max_it);
     }
+    static tfel::math::st2tost2<3u, types::real<StressType>> exe(
+        const tfel::math::st2tost2<3u, StressType>& C_0_glob,
+        const tfel::math::st2tost2<3u, StressType>& C_i_loc,
+        const tfel::math::tvector<3u, types::real<StressType>>& n_a,
+        const tfel::math::tvector<3u, types::real<StressType>>& n_b,
+        const std::array<types::length<StressType>, 3u>& semiLengths,
+        const AnisotropicHillTensorQuadrature<tfel::math::base_type<StressType>>& q) {
+      return computeAnisotropicLocalisationTensor<StressType>(
+          C_0_glob, C_i_loc, n_a, semiLengths[0], n_b, semiLengths[1],
+          semiLengths[2], q);
+    }
   };  // end of AnisotropicLocalisationTensor<3u, StressType>
 
   template <unsigned short int N, tfel::math::ScalarConcept StressType>
@@ -411,6 +1023,155 @@ namespace tfel::material::homogenization::elasticity {
         C_0_glob, C_i_loc, n_a, n_b, semiLengths, max_it);
   }
 
+  template <unsigned short int N, tfel::math::ScalarConcept StressType>
+  requires(tfel::math::checkUnitCompatibility<
+           tfel::math::unit::Stress,
+           StressType>()) tfel::math::
+      st2tost2<N, types::real<StressType>> computeGeneralAnisotropicLocalisationTensor(
+          const tfel::math::st2tost2<N, StressType>& C_0_glob,
+          const tfel::math::st2tost2<N, StressType>& C_i_loc,
+          const tfel::math::tvector<N, types::real<StressType>>& n_a,
+          const tfel::math::tvector<N, types::real<StressType>>& n_b,
+          const std::array<types::length<StressType>, N>& semiLengths,
+          const AnisotropicHillTensorQuadrature<tfel::math::base_type<StressType>>& q) {
+    if constexpr (N == 2) {
+      static_cast<void>(n_b);
+      return AnisotropicLocalisationTensor<2u, StressType>::exe(
+          C_0_glob, C_i_loc, n_a, semiLengths, q);
+    } else {
+      return AnisotropicLocalisationTensor<3u, StressType>::exe(
+          C_0_glob, C_i_loc, n_a, n_b, semiLengths, q);
+    }
+  }  // end of computeGeneralAnisotropicLocalisationTensor
+
+  template <unsigned short int N, tfel::math::ScalarConcept StressType>
+  requires(tfel::math::checkUnitCompatibility<tfel::math::unit::Stress,
+                                              StressType>())
+      AnisotropicHillTensorCache<N, StressType>::AnisotropicHillTensorCache(
+          const std::size_t o, const std::size_t c)
+      : quadrature(o), capacity(c) {
+    tfel::raise_if(this->capacity == 0,
+                   "AnisotropicHillTensorCache::AnisotropicHillTensorCache: "
+                   "invalid capacity");
+    this->entries.reserve(this->capacity);
+  }  // end of AnisotropicHillTensorCache
+
+  template <unsigned short int N, tfel::math::ScalarConcept StressType>
+  requires(tfel::math::checkUnitCompatibility<tfel::math::unit::Stress,
+                                              StressType>())
+  auto AnisotropicHillTensorCache<N, StressType>::getHillTensor(
+      const tfel::math::st2tost2<N, StressType>& C,
+      const tfel::math::tvector<N, real>& n_a,
+      const tfel::math::tvector<N, real>& n_b,
+      const std::array<LengthType, N>& L)
+      -> tfel::math::st2tost2<N, compliance> {
+    using tfel::math::base_type_cast;
+    constexpr auto ssize = tfel::math::StensorDimeToSize<N>::value;
+    const auto r_glob_loc = [&n_a, &n_b] {
+      if constexpr (N == 2) {
+        static_cast<void>(n_b);
+        return internals::getAnisotropicHillTensorRotationMatrix(n_a);
+      } else {
+        return internals::getAnisotropicHillTensorRotationMatrix(n_a, n_b);
+      }
+    }();
+    // building the key. The orientation is described by the first two
+    // columns of the rotation matrix and the shape by the aspect ratios.
+    auto key = std::array<value_type, key_size>{};
+    auto pk = key.begin();
+    for (std::size_t i = 0; i != ssize; ++i) {
+      for (std::size_t j = 0; j != ssize; ++j) {
+        *pk = base_type_cast(C(i, j));
+        ++pk;
+      }
+    }
+    for (unsigned short i = 0; i != N; ++i) {
+      for (unsigned short j = 0; j != 2; ++j) {
+        *pk = r_glob_loc(i, j);
+        ++pk;
+      }
+    }
+    const auto lmax = base_type_cast(*(std::max_element(L.begin(), L.end())));
+    for (const auto& l : L) {
+      *pk = base_type_cast(l) / lmax;
+      ++pk;
+    }
+    for (const auto& e : this->entries) {
+      const auto same = std::equal(
+          key.begin(), key.end(), e.key.begin(),
+          [](const value_type a, const value_type b) {
+            return tfel::math::ieee754::fpclassify(a - b) == FP_ZERO;
+          });
+      if (same) {
+        ++(this->hits);
+        return e.P;
+      }
+    }
+    const auto P = internals::computeAnisotropicHillTensor<N, StressType>(
+        C, r_glob_loc, L, this->quadrature);
+    if (this->entries.size() < this->capacity) {
+      this->entries.push_back(Entry{key, P});
+    } else {
+      this->entries[this->next] = Entry{key, P};
+      this->next = (this->next + 1) % this->capacity;
+    }
+    return P;
+  }  // end of getHillTensor
+
+  template <unsigned short int N, tfel::math::ScalarConcept StressType>
+  requires(tfel::math::checkUnitCompatibility<tfel::math::unit::Stress,
+                                              StressType>())
+  auto AnisotropicHillTensorCache<N, StressType>::getLocalisationTensor(
+      const tfel::math::st2tost2<N, StressType>& C_0_glob,
+      const tfel::math::st2tost2<N, StressType>& C_i_loc,
+      const tfel::math::tvector<N, real>& n_a,
+      const tfel::math::tvector<N, real>& n_b,
+      const std::array<LengthType, N>& L) -> tfel::math::st2tost2<N, real> {
+    const auto P_0_glob = this->getHillTensor(C_0_glob, n_a, n_b, L);
+    const auto r_glob_loc = [&n_a, &n_b] {
+      if constexpr (N == 2) {
+        static_cast<void>(n_b);
+        return internals::getAnisotropicHillTensorRotationMatrix(n_a);
+      } else {
+        return internals::getAnisotropicHillTensorRotationMatrix(n_a, n_b);
+      }
+    }();
+    return internals::computeAnisotropicLocalisationTensor<N, StressType>(
+        P_0_glob, C_0_glob, C_i_loc, r_glob_loc);
+  }  // end of getLocalisationTensor
+
+  template <unsigned short int N, tfel::math::ScalarConcept StressType>
+  requires(tfel::math::checkUnitCompatibility<tfel::math::unit::Stress,
+                                              StressType>())
+  auto AnisotropicHillTensorCache<N, StressType>::getQuadrature() const noexcept
+      -> const AnisotropicHillTensorQuadrature<value_type>& {
+    return this->quadrature;
+  }  // end of getQuadrature
+
+  template <unsigned short int N, tfel::math::ScalarConcept StressType>
+  requires(tfel::math::checkUnitCompatibility<tfel::math::unit::Stress,
+                                              StressType>())
+  std::size_t AnisotropicHillTensorCache<N, StressType>::size() const noexcept {
+    return this->entries.size();
+  }  // end of size
+
+  template <unsigned short int N, tfel::math::ScalarConcept StressType>
+  requires(tfel::math::checkUnitCompatibility<tfel::math::unit::Stress,
+                                              StressType>())
+  std::size_t AnisotropicHillTensorCache<N, StressType>::getNumberOfHits()
+      const noexcept {
+    return this->hits;
+  }  // end of getNumberOfHits
+
+  template <unsigned short int N, tfel::math::ScalarConcept StressType>
+  requires(tfel::math::checkUnitCompatibility<tfel::math::unit::Stress,
+                                              StressType>())
+  void AnisotropicHillTensorCache<N, StressType>::clear() noexcept {
+    this->entries.clear();
+    this->next = 0;
+    this->hits = 0;
+  }  // end of clear
+
 }  // namespace tfel::material::homogenization::elasticity
 
 #endif /* LIB_TFEL_MATERIAL_ANISOTROPICESHELBYTENSOR_IXX */
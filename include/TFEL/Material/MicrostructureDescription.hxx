@@ -178,6 +178,19 @@ namespace tfel::material::homogenization::elasticity {
         int max_iter_anisotropic_integration = 12) = 0;
     [[nodiscard]] virtual tfel::math::st2tost2<N, real> computeMeanLocalisator(
         const IsotropicModuli<StressType>& IM0) = 0;
+    /*!
+     * \return the mean localisator of the distribution in an anisotropic
+     * matrix, the Hill tensors being computed with a fixed-order quadrature
+     * and stored in the given cache. By default, the adaptive integration
+     * is used.
+     * \param[in] C0: stiffness tensor of the matrix
+     * \param[in] cache: cache of Hill tensors
+     */
+    [[nodiscard]] virtual tfel::math::st2tost2<N, real> computeMeanLocalisator(
+        const tfel::math::st2tost2<N, StressType>& C0,
+        AnisotropicHillTensorCache<N, StressType>&) {
+      return this->computeMeanLocalisator(C0);
+    }
     virtual ~InclusionDistribution() = default;
   };
 
@@ -220,6 +233,17 @@ namespace tfel::material::homogenization::elasticity {
           max_iter_anisotropic_integration);
     }
 
+    [[nodiscard]] tfel::math::st2tost2<3u, real> computeMeanLocalisator(
+        const tfel::math::st2tost2<3u, StressType>& C0,
+        AnisotropicHillTensorCache<3u, StressType>& cache) override {
+      const tfel::math::tvector<3u, real> n_a = {1., 0., 0.};
+      const tfel::math::tvector<3u, real> n_b = {0., 1., 0.};
+      const auto semiL =
+          std::array<LengthType, 3u>{LengthType(1), LengthType(1), LengthType(1)};
+      return cache.getLocalisationTensor(C0, this->getElasticityOfPhase(), n_a,
+                                         n_b, semiL);
+    }
+
     [[nodiscard]] tfel::math::st2tost2<3u, real> computeMeanLocalisator(
         const IsotropicModuli<StressType>& IM0) override {
       auto Ci = this->getElasticityOfPhase();
@@ -247,6 +271,7 @@ namespace tfel::material::homogenization::elasticity {
       : public InclusionDistribution<3u, StressType> {
     using real = tfel::types::real<StressType>;
     using LengthType = tfel::types::length<StressType>;
+    using InclusionDistribution<3u, StressType>::computeMeanLocalisator;
 
     IsotropicDistribution(const Ellipsoid<LengthType>& ell,
                           real frac,
@@ -297,6 +322,7 @@ namespace tfel::material::homogenization::elasticity {
       : public InclusionDistribution<3u, StressType> {
     using real = tfel::types::real<StressType>;
     using LengthType = tfel::types::length<StressType>;
+    using InclusionDistribution<3u, StressType>::computeMeanLocalisator;
 
     tfel::math::tvector<3u, real> n;
     unsigned short int index;
@@ -462,6 +488,14 @@ namespace tfel::material::homogenization::elasticity {
           C0, Ci, n_a_i, n_b_i, semiL, max_iter_anisotropic_integration);
     }
 
+    [[nodiscard]] tfel::math::st2tost2<3u, real> computeMeanLocalisator(
+        const tfel::math::st2tost2<3u, StressType>& C0,
+        AnisotropicHillTensorCache<3u, StressType>& cache) override {
+      return cache.getLocalisationTensor(C0, this->getElasticityOfPhase(),
+                                         this->n_a, this->n_b,
+                                         (this->inclusion).semiLengths);
+    }
+
     [[nodiscard]] tfel::math::st2tost2<3u, real> computeMeanLocalisator(
         const IsotropicModuli<StressType>& IM0) override {
       auto Ci = this->getElasticityOfPhase();
@@ -485,6 +519,7 @@ namespace tfel::material::homogenization::elasticity {
       : public InclusionDistribution<3u, StressType> {
     using real = tfel::types::real<StressType>;
     using LengthType = tfel::types::length<StressType>;
+    using InclusionDistribution<3u, StressType>::computeMeanLocalisator;
 
     tfel::math::stensor<3u, real> A2;
     tfel::math::st2tost2<3u, real> A4;
@@ -71,6 +71,26 @@ namespace tfel::material::homogenization::elasticity {
           int max_iter_anisotropic_integration = 12,
           const std::vector<tfel::math::stensor<N, StressType>>& = {});
 
+  /*!
+   * Here is the Dilute scheme which returns an object of
+   * type HomogenizationScheme from a ParticulateMicrostructure. For an
+   * anisotropic matrix, the Hill tensors are computed using a fixed-order
+   * quadrature and stored in the given cache.
+   * \tparam unsigned short int: dimension
+   * \tparam StressType: type of the elastic constants related to
+   * the inclusion
+   * \return an object of type HomogenizationScheme
+   * \param[in] micro: ParticulateMicrostructure
+   * \param[in] cache: cache of Hill tensors
+   */
+  template <unsigned short int N, tfel::math::ScalarConcept StressType>
+  requires(tfel::math::checkUnitCompatibility<tfel::math::unit::Stress,
+                                              StressType>())
+      HomogenizationScheme<N, StressType> computeDilute(
+          ParticulateMicrostructure<N, StressType>&,
+          AnisotropicHillTensorCache<N, StressType>&,
+          const std::vector<tfel::math::stensor<N, StressType>>& = {});
+
   /*!
    * Here is the MoriTanaka scheme which returns an object of
    * type HomogenizationScheme from a ParticulateMicrostructure.
@@ -87,6 +107,24 @@ namespace tfel::material::homogenization::elasticity {
           int max_iter_anisotropic_integration = 12,
           const std::vector<tfel::math::stensor<N, StressType>>& = {});
 
+  /*!
+   * Here is the MoriTanaka scheme which returns an object of
+   * type HomogenizationScheme from a ParticulateMicrostructure. For an
+   * anisotropic matrix, the Hill tensors are computed using a fixed-order
+   * quadrature and stored in the given cache.
+   * \tparam unsigned short int: dimension
+   * \tparam StressType: type of the elastic constants related to
+   * the inclusion
+   * \return an object of type HomogenizationScheme
+   */
+  template <unsigned short int N, tfel::math::ScalarConcept StressType>
+  requires(tfel::math::checkUnitCompatibility<tfel::math::unit::Stress,
+                                              StressType>())
+      HomogenizationScheme<N, StressType> computeMoriTanaka(
+          ParticulateMicrostructure<N, StressType>&,
+          AnisotropicHillTensorCache<N, StressType>&,
+          const std::vector<tfel::math::stensor<N, StressType>>& = {});
+
   /*!
    * Here is the Self-consistent scheme which returns an object of
    * type HomogenizationScheme from a ParticulateMicrostructure.
@@ -106,6 +144,29 @@ namespace tfel::material::homogenization::elasticity {
           int max_iter_anisotropic_integration = 8,
           const std::vector<tfel::math::stensor<N, StressType>>& = {});
 
+  /*!
+   * Here is the Self-consistent scheme which returns an object of
+   * type HomogenizationScheme from a ParticulateMicrostructure. If the
+   * `isotropic` argument is false, the Hill tensors are computed using a
+   * fixed-order quadrature and stored in the given cache. Since the
+   * stiffness of the reference medium changes at each iteration, the cache
+   * is mostly useful when the same microstructure is homogenized several
+   * times or when several phases share the same shape and orientation.
+   * \tparam unsigned short int: dimension
+   * \tparam StressType: type of the elastic constants related to
+   * the inclusion
+   * \return an object of type HomogenizationScheme
+   */
+  template <unsigned short int N, tfel::math::ScalarConcept StressType>
+  requires(tfel::math::checkUnitCompatibility<tfel::math::unit::Stress,
+                                              StressType>())
+      HomogenizationScheme<N, StressType> computeSelfConsistent(
+          ParticulateMicrostructure<N, StressType>&,
+          const tfel::types::real<StressType>&,
+          bool isotropic,
+          AnisotropicHillTensorCache<N, StressType>&,
+          const std::vector<tfel::math::stensor<N, StressType>>& = {});
+
 }  // end of namespace tfel::material::homogenization::elasticity
 
 #include "TFEL/Material/MicrostructureLinearHomogenization.ixx"
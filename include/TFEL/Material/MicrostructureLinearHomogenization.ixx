@@ -42,7 +42,203 @@ namespace tfel::material::homogenization::elasticity {
       }
       return polarisations_;
     };
-  }  // namespace internals
+
+    template <unsigned short int N,
+              tfel::math::ScalarConcept StressType,
+              typename AnisotropicLocalisatorType>
+    requires(tfel::math::checkUnitCompatibility<tfel::math::unit::Stress,
+                                                StressType>())
+        HomogenizationScheme<N, StressType> computeDilute(
+            ParticulateMicrostructure<N, StressType>& micro,
+            const AnisotropicLocalisatorType& computeAnisotropicLocalisator,
+            const std::vector<tfel::math::stensor<N, StressType>>&
+                polarisations) {
+      using real = tfel::types::real<StressType>;
+      const auto np = micro.getNumberOfPhases();
+      const auto polarisations_ =
+          internals::initialize_polarisation<N, StressType>(polarisations, np);
+
+      const auto C0 = micro.getMatrixElasticity();
+      KGModuli<StressType> KG0(StressType(0), StressType(0));
+      if (micro.isIsotropicMatrix()) {
+        KG0 = computeKGModuli<StressType>(C0);
+      }
+      const auto tau0 = polarisations_[0];
+
+      auto Chom = C0;
+      auto tau_eff = tau0;
+
+      std::vector<tfel::math::st2tost2<N, real>> localisators = {
+          tfel::math::st2tost2<N, real>::Id()};
+
+      for (std::size_t i = 0; i < np - 1; i++) {
+        auto phasei = micro.getInclusionPhase(i);
+        auto Ci = (*phasei).getElasticityOfPhase();
+        auto fi = (*phasei).fraction;
+        auto taui = polarisations_[i + 1];
+        tfel::math::st2tost2<N, real> Ai;
+        if (micro.isIsotropicMatrix()) {
+          Ai = (*phasei).computeMeanLocalisator(KG0);
+        } else {
+          Ai = computeAnisotropicLocalisator(*phasei, C0);
+        }
+        Chom += fi * (Ci - C0) * Ai;
+        tau_eff += fi * tfel::math::transpose(Ai) * (taui - tau0);
+        localisators.push_back(Ai);
+      }
+      HomogenizationScheme<N, StressType> h_s = {
+          .homogenized_stiffness = Chom,
+          .effective_polarisation = tau_eff,
+          .mean_strain_localisation_tensors = localisators};
+
+      return h_s;
+    };
+
+    template <unsigned short int N,
+              tfel::math::ScalarConcept StressType,
+              typename AnisotropicLocalisatorType>
+    requires(tfel::math::checkUnitCompatibility<tfel::math::unit::Stress,
+                                                StressType>())
+        HomogenizationScheme<N, StressType> computeMoriTanaka(
+            ParticulateMicrostructure<N, StressType>& micro,
+            const AnisotropicLocalisatorType& computeAnisotropicLocalisator,
+            const std::vector<tfel::math::stensor<N, StressType>>&
+                polarisations) {
+      using real = tfel::types::real<StressType>;
+
+      const auto np = micro.getNumberOfPhases();
+      const auto polarisations_ =
+          internals::initialize_polarisation<N, StressType>(polarisations, np);
+
+      const auto C0 = micro.getMatrixElasticity();
+      KGModuli<StressType> KG0(StressType(0), StressType(0));
+      if (micro.isIsotropicMatrix()) {
+        KG0 = computeKGModuli<StressType>(C0);
+      }
+      const auto tau0 = polarisations_[0];
+      const auto f0 = micro.getMatrixFraction();
+      auto Chom = C0;
+      auto tau_eff = tau0;
+      std::vector<tfel::math::st2tost2<N, real>> localisators = {};
+      tfel::math::st2tost2<N, real> A0 = f0 * tfel::math::st2tost2<N, real>::Id();
+      for (std::size_t i = 0; i < np - 1; i++) {
+        auto phasei = micro.getInclusionPhase(i);
+        auto fi = (*phasei).fraction;
+        tfel::math::st2tost2<N, real> Ai;
+        if (micro.isIsotropicMatrix()) {
+          Ai = (*phasei).computeMeanLocalisator(KG0);
+        } else {
+          Ai = computeAnisotropicLocalisator(*phasei, C0);
+        }
+        localisators.push_back(Ai);
+        A0 += fi * Ai;
+      }
+      A0 = invert(A0);
+      localisators.insert(localisators.begin(), A0);
+      for (std::size_t i = 0; i < np - 1; i++) {
+        auto phasei = micro.getInclusionPhase(i);
+        auto Ci = (*phasei).getElasticityOfPhase();
+        auto fi = (*phasei).fraction;
+        auto taui = polarisations_[i + 1];
+        localisators[i + 1] = localisators[i + 1] * A0;
+        auto Ai = localisators[i + 1];
+        Chom += fi * (Ci - C0) * Ai;
+        tau_eff += fi * transpose(Ai) * (taui - tau0);
+      }
+      HomogenizationScheme<N, StressType> h_s = {
+          .homogenized_stiffness = Chom,
+          .effective_polarisation = tau_eff,
+          .mean_strain_localisation_tensors = localisators};
+
+      return h_s;
+    };
+
+    template <unsigned short int N,
+              tfel::math::ScalarConcept StressType,
+              typename AnisotropicLocalisatorType>
+    requires(tfel::math::checkUnitCompatibility<tfel::math::unit::Stress,
+                                                StressType>())
+        HomogenizationScheme<N, StressType> computeSelfConsistent(
+            ParticulateMicrostructure<N, StressType>& micro,
+            const tfel::types::real<StressType>& tolerance,
+            bool isotropic,
+            const AnisotropicLocalisatorType& computeAnisotropicLocalisator,
+            const std::vector<tfel::math::stensor<N, StressType>>&
+                polarisations) {
+      using real = tfel::types::real<StressType>;
+
+      const auto np = micro.getNumberOfPhases();
+      const auto f0 = micro.getMatrixFraction();
+      const auto C0 = micro.getMatrixElasticity();
+
+      const auto polarisations_ =
+          internals::initialize_polarisation<N, StressType>(polarisations, np);
+      auto tau_eff = tfel::math::stensor<N, StressType>::zero();
+      std::vector<tfel::math::st2tost2<N, real>> localisators = {};
+      auto Chom = C0;
+      auto Chom_ = C0;
+      real rel_err = tolerance + 1;
+
+      while (rel_err > tolerance) {
+        std::vector<tfel::math::st2tost2<N, real>> localisators_try = {};
+        tfel::math::st2tost2<N, real> A0 =
+            f0 * tfel::math::st2tost2<N, real>::Id();
+        for (std::size_t i = 0; i < np - 1; i++) {
+          auto phasei = micro.getInclusionPhase(i);
+          auto fi = (*phasei).fraction;
+          tfel::math::st2tost2<N, real> Ai;
+          if (isotropic) {
+            auto KGhom = computeKGModuli<StressType>(Chom);
+            Ai = (*phasei).computeMeanLocalisator(KGhom);
+          } else {
+            Ai = computeAnisotropicLocalisator(*phasei, Chom);
+          }
+          localisators_try.push_back(Ai);
+          A0 += fi * Ai;
+        }
+        A0 = invert(A0);
+        localisators_try.insert(localisators_try.begin(), A0);
+        tfel::math::st2tost2<N, StressType> Ch = f0 * C0 * A0;
+        for (std::size_t i = 0; i < np - 1; i++) {
+          auto phasei = micro.getInclusionPhase(i);
+          auto Ci = (*phasei).getElasticityOfPhase();
+          auto fi = (*phasei).fraction;
+          localisators_try[i + 1] = localisators_try[i + 1] * A0;
+          auto Ai = localisators_try[i + 1];
+          Ch += fi * Ci * Ai;
+        }
+        auto size = tfel::math::StensorDimeToSize<N>::value;
+        for (std::size_t i = 0; i < size; i++)
+          for (std::size_t j = 0; j < size; j++) {
+            Chom_(i, j) = Chom(i, j);
+            Chom(i, j) = Ch(i, j);
+          }
+        rel_err = relative_error(Chom, Chom_);
+        if (rel_err <= tolerance) {
+          for (std::size_t i = 0; i < np; i++) {
+            auto Ai = localisators_try[i];
+            localisators.push_back(Ai);
+          }
+        }
+      }
+      const auto A0 = localisators[0];
+      const auto tau0 = polarisations_[0];
+      tau_eff += f0 * transpose(A0) * tau0;
+      for (std::size_t i = 0; i < np - 1; i++) {
+        auto taui = polarisations_[i + 1];
+        auto phasei = micro.getInclusionPhase(i);
+        auto fi = (*phasei).fraction;
+        auto Ai = localisators[i + 1];
+        tau_eff += fi * transpose(Ai) * taui;
+      }
+      HomogenizationScheme<N, StressType> h_s = {
+          .homogenized_stiffness = Chom,
+          .effective_polarisation = tau_eff,
+          .mean_strain_localisation_tensors = localisators};
+      return h_s;
+    }
+
+  }  // end of namespace internals
 
   template <unsigned short int N, tfel::math::ScalarConcept StressType>
   requires(tfel::math::checkUnitCompatibility<tfel::math::unit::Stress,
@@ -52,47 +248,33 @@ namespace tfel::material::homogenization::elasticity {
           int max_iter_anisotropic_integration,
           const std::vector<tfel::math::stensor<N, StressType>>&
               polarisations) {
-    using real = tfel::types::real<StressType>;
-    const auto np = micro.getNumberOfPhases();
-    const auto polarisations_ =
-        internals::initialize_polarisation<N, StressType>(polarisations, np);
-
-    const auto C0 = micro.getMatrixElasticity();
-    KGModuli<StressType> KG0(StressType(0), StressType(0));
-    if (micro.isIsotropicMatrix()) {
-      KG0 = computeKGModuli<StressType>(C0);
-    }
-    const auto tau0 = polarisations_[0];
-
-    auto Chom = C0;
-    auto tau_eff = tau0;
-
-    std::vector<tfel::math::st2tost2<N, real>> localisators = {
-        tfel::math::st2tost2<N, real>::Id()};
+    return internals::computeDilute<N, StressType>(
+        micro,
+        [max_iter_anisotropic_integration](
+            InclusionDistribution<N, StressType>& d,
+            const tfel::math::st2tost2<N, StressType>& C0) {
+          return d.computeMeanLocalisator(C0,
+                                          max_iter_anisotropic_integration);
+        },
+        polarisations);
+  }  // end of computeDilute
 
-    for (std::size_t i = 0; i < np - 1; i++) {
-      auto phasei = micro.getInclusionPhase(i);
-      auto Ci = (*phasei).getElasticityOfPhase();
-      auto fi = (*phasei).fraction;
-      auto taui = polarisations_[i + 1];
-      tfel::math::st2tost2<N, real> Ai;
-      if (micro.isIsotropicMatrix()) {
-        Ai = (*phasei).computeMeanLocalisator(KG0);
-      } else {
-        Ai = (*phasei).computeMeanLocalisator(C0,
-                                              max_iter_anisotropic_integration);
-      }
-      Chom += fi * (Ci - C0) * Ai;
-      tau_eff += fi * tfel::math::transpose(Ai) * (taui - tau0);
-      localisators.push_back(Ai);
-    }
-    HomogenizationScheme<N, StressType> h_s = {
-        .homogenized_stiffness = Chom,
-        .effective_polarisation = tau_eff,
-        .mean_strain_localisation_tensors = localisators};
-
-    return h_s;
-  };
+  template <unsigned short int N, tfel::math::ScalarConcept StressType>
+  requires(tfel::math::checkUnitCompatibility<tfel::math::unit::Stress,
+                                              StressType>())
+      HomogenizationScheme<N, StressType> computeDilute(
+          ParticulateMicrostructure<N, StressType>& micro,
+          AnisotropicHillTensorCache<N, StressType>& cache,
+          const std::vector<tfel::math::stensor<N, StressType>>&
+              polarisations) {
+    return internals::computeDilute<N, StressType>(
+        micro,
+        [&cache](InclusionDistribution<N, StressType>& d,
+                 const tfel::math::st2tost2<N, StressType>& C0) {
+          return d.computeMeanLocalisator(C0, cache);
+        },
+        polarisations);
+  }  // end of computeDilute
 
   template <unsigned short int N, tfel::math::ScalarConcept StressType>
   requires(tfel::math::checkUnitCompatibility<tfel::math::unit::Stress,
@@ -102,55 +284,33 @@ namespace tfel::material::homogenization::elasticity {
           int max_iter_anisotropic_integration,
           const std::vector<tfel::math::stensor<N, StressType>>&
               polarisations) {
-    using real = tfel::types::real<StressType>;
-
-    const auto np = micro.getNumberOfPhases();
-    const auto polarisations_ =
-        internals::initialize_polarisation<N, StressType>(polarisations, np);
+    return internals::computeMoriTanaka<N, StressType>(
+        micro,
+        [max_iter_anisotropic_integration](
+            InclusionDistribution<N, StressType>& d,
+            const tfel::math::st2tost2<N, StressType>& C0) {
+          return d.computeMeanLocalisator(C0,
+                                          max_iter_anisotropic_integration);
+        },
+        polarisations);
+  }  // end of computeMoriTanaka
 
-    const auto C0 = micro.getMatrixElasticity();
-    KGModuli<StressType> KG0(StressType(0), StressType(0));
-    if (micro.isIsotropicMatrix()) {
-      KG0 = computeKGModuli<StressType>(C0);
-    }
-    const auto tau0 = polarisations_[0];
-    const auto f0 = micro.getMatrixFraction();
-    auto Chom = C0;
-    auto tau_eff = tau0;
-    std::vector<tfel::math::st2tost2<N, real>> localisators = {};
-    tfel::math::st2tost2<N, real> A0 = f0 * tfel::math::st2tost2<N, real>::Id();
-    for (std::size_t i = 0; i < np - 1; i++) {
-      auto phasei = micro.getInclusionPhase(i);
-      auto fi = (*phasei).fraction;
-      tfel::math::st2tost2<N, real> Ai;
-      if (micro.isIsotropicMatrix()) {
-        Ai = (*phasei).computeMeanLocalisator(KG0);
-      } else {
-        Ai = (*phasei).computeMeanLocalisator(C0,
-                                              max_iter_anisotropic_integration);
-      }
-      localisators.push_back(Ai);
-      A0 += fi * Ai;
-    }
-    A0 = invert(A0);
-    localisators.insert(localisators.begin(), A0);
-    for (std::size_t i = 0; i < np - 1; i++) {
-      auto phasei = micro.getInclusionPhase(i);
-      auto Ci = (*phasei).getElasticityOfPhase();
-      auto fi = (*phasei).fraction;
-      auto taui = polarisations_[i + 1];
-      localisators[i + 1] = localisators[i + 1] * A0;
-      auto Ai = localisators[i + 1];
-      Chom += fi * (Ci - C0) * Ai;
-      tau_eff += fi * transpose(Ai) * (taui - tau0);
-    }
-    HomogenizationScheme<N, StressType> h_s = {
-        .homogenized_stiffness = Chom,
-        .effective_polarisation = tau_eff,
-        .mean_strain_localisation_tensors = localisators};
-
-    return h_s;
-  };
+  template <unsigned short int N, tfel::math::ScalarConcept StressType>
+  requires(tfel::math::checkUnitCompatibility<tfel::math::unit::Stress,
+                                              StressType>())
+      HomogenizationScheme<N, StressType> computeMoriTanaka(
+          ParticulateMicrostructure<N, StressType>& micro,
+          AnisotropicHillTensorCache<N, StressType>& cache,
+          const std::vector<tfel::math::stensor<N, StressType>>&
+              polarisations) {
+    return internals::computeMoriTanaka<N, StressType>(
+        micro,
+        [&cache](InclusionDistribution<N, StressType>& d,
+                 const tfel::math::st2tost2<N, StressType>& C0) {
+          return d.computeMeanLocalisator(C0, cache);
+        },
+        polarisations);
+  }  // end of computeMoriTanaka
 
   template <unsigned short int N, tfel::math::ScalarConcept StressType>
   requires(tfel::math::checkUnitCompatibility<tfel::math::unit::Stress,
@@ -162,79 +322,35 @@ namespace tfel::material::homogenization::elasticity {
           int max_iter_anisotropic_integration,
           const std::vector<tfel::math::stensor<N, StressType>>&
               polarisations) {
-    using real = tfel::types::real<StressType>;
-
-    const auto np = micro.getNumberOfPhases();
-    const auto f0 = micro.getMatrixFraction();
-    const auto C0 = micro.getMatrixElasticity();
-
-    const auto polarisations_ =
-        internals::initialize_polarisation<N, StressType>(polarisations, np);
-    auto tau_eff = tfel::math::stensor<N, StressType>::zero();
-    std::vector<tfel::math::st2tost2<N, real>> localisators = {};
-    auto Chom = C0;
-    auto Chom_ = C0;
-    real rel_err = tolerance + 1;
-
-    while (rel_err > tolerance) {
-      std::vector<tfel::math::st2tost2<N, real>> localisators_try = {};
-      tfel::math::st2tost2<N, real> A0 =
-          f0 * tfel::math::st2tost2<N, real>::Id();
-      for (std::size_t i = 0; i < np - 1; i++) {
-        auto phasei = micro.getInclusionPhase(i);
-        auto fi = (*phasei).fraction;
-        tfel::math::st2tost2<N, real> Ai;
-        if (isotropic) {
-          auto KGhom = computeKGModuli<StressType>(Chom);
-          Ai = (*phasei).computeMeanLocalisator(KGhom);
-        } else {
-          Ai = (*phasei).computeMeanLocalisator(
-              Chom, max_iter_anisotropic_integration);
-        }
-        localisators_try.push_back(Ai);
-        A0 += fi * Ai;
-      }
-      A0 = invert(A0);
-      localisators_try.insert(localisators_try.begin(), A0);
-      tfel::math::st2tost2<N, StressType> Ch = f0 * C0 * A0;
-      for (std::size_t i = 0; i < np - 1; i++) {
-        auto phasei = micro.getInclusionPhase(i);
-        auto Ci = (*phasei).getElasticityOfPhase();
-        auto fi = (*phasei).fraction;
-        localisators_try[i + 1] = localisators_try[i + 1] * A0;
-        auto Ai = localisators_try[i + 1];
-        Ch += fi * Ci * Ai;
-      }
-      auto size = tfel::math::StensorDimeToSize<N>::value;
-      for (std::size_t i = 0; i < size; i++)
-        for (std::size_t j = 0; j < size; j++) {
-          Chom_(i, j) = Chom(i, j);
-          Chom(i, j) = Ch(i, j);
-        }
-      rel_err = relative_error(Chom, Chom_);
-      if (rel_err <= tolerance) {
-        for (std::size_t i = 0; i < np; i++) {
-          auto Ai = localisators_try[i];
-          localisators.push_back(Ai);
-        }
-      }
-    }
-    const auto A0 = localisators[0];
-    const auto tau0 = polarisations_[0];
-    tau_eff += f0 * transpose(A0) * tau0;
-    for (std::size_t i = 0; i < np - 1; i++) {
-      auto taui = polarisations_[i + 1];
-      auto phasei = micro.getInclusionPhase(i);
-      auto fi = (*phasei).fraction;
-      auto Ai = localisators[i + 1];
-      tau_eff += fi * transpose(Ai) * taui;
-    }
-    HomogenizationScheme<N, StressType> h_s = {
-        .homogenized_stiffness = Chom,
-        .effective_polarisation = tau_eff,
-        .mean_strain_localisation_tensors = localisators};
-    return h_s;
-  }
+    return internals::computeSelfConsistent<N, StressType>(
+        micro, tolerance, isotropic,
+        [max_iter_anisotropic_integration](
+            InclusionDistribution<N, StressType>& d,
+            const tfel::math::st2tost2<N, StressType>& C0) {
+          return d.computeMeanLocalisator(C0,
+                                          max_iter_anisotropic_integration);
+        },
+        polarisations);
+  }  // end of computeSelfConsistent
+
+  template <unsigned short int N, tfel::math::ScalarConcept StressType>
+  requires(tfel::math::checkUnitCompatibility<tfel::math::unit::Stress,
+                                              StressType>())
+      HomogenizationScheme<N, StressType> computeSelfConsistent(
+          ParticulateMicrostructure<N, StressType>& micro,
+          const tfel::types::real<StressType>& tolerance,
+          bool isotropic,
+          AnisotropicHillTensorCache<N, StressType>& cache,
+          const std::vector<tfel::math::stensor<N, StressType>>&
+              polarisations) {
+    return internals::computeSelfConsistent<N, StressType>(
+        micro, tolerance, isotropic,
+        [&cache](InclusionDistribution<N, StressType>& d,
+                 const tfel::math::st2tost2<N, StressType>& C0) {
+          return d.computeMeanLocalisator(C0, cache);
+        },
+        polarisations);
+  }  // end of computeSelfConsistent
 
 }  // end of namespace tfel::material::homogenization::elasticity
 
@@ -0,0 +1,227 @@
+/*!
+ * \file   include/TFEL/Math/BorderedBandedLUSolve.hxx
+ * \brief  This file declares the `BorderedBandedLUSolve` class.
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright Copyright (C) 2006-2025 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_BORDEREDBANDEDLUSOLVE_HXX
+#define LIB_TFEL_MATH_BORDEREDBANDEDLUSOLVE_HXX
+
+#include <cmath>
+#include <utility>
+#include <algorithm>
+#include "TFEL/Config/TFELConfig.hxx"
+#include "TFEL/Math/vector.hxx"
+#include "TFEL/Math/LU/LUDecomp.hxx"
+#include "TFEL/Math/LU/LUException.hxx"
+#include "TFEL/Math/LU/BorderedBandedMatrix.hxx"
+
+namespace tfel::math {
+
+  /*!
+   * \brief This structure contains static methods for solving linear systems
+   * whose matrix is a bordered banded matrix.
+   *
+   * The banded part \f$A\f$ is decomposed using a LU decomposition with
+   * partial pivoting, following the `dgbtf2` routine of the `LAPACK`
+   * library. The border is then treated by computing the LU decomposition of
+   * the Schur complement \f$D-C\,A^{-1}\,B\f$.
+   *
+   * The cost of the decomposition is of order \f$n\,k_{l}\,(k_{l}+k_{u})\f$
+   * plus \f$n\,m\,(2\,k_{l}+k_{u}+m)\f$, instead of \f$(n+m)^{3}\f$ for a
+   * dense LU decomposition.
+   *
+   * \note the banded part must be invertible.
+   */
+  struct BorderedBandedLUSolve {
+    /*!
+     * \brief compute the LU decomposition of the matrix and solve the linear
+     * system
+     * \param[in,out] m: matrix, replaced by its decomposition
+     * \param[in,out] b: right hand side, replaced by the solution
+     */
+    template <typename ValueType, typename VectorType>
+    static void exe(BorderedBandedMatrix<ValueType>& m, VectorType& b) {
+      BorderedBandedLUSolve::decompose(m);
+      BorderedBandedLUSolve::back_substitute(m, b);
+    }  // end of exe
+    /*!
+     * \brief compute the LU decomposition of the matrix in place
+     * \param[in,out] m: matrix
+     */
+    template <typename ValueType>
+    static void decompose(BorderedBandedMatrix<ValueType>& m) {
+      using size_type = typename BorderedBandedMatrix<ValueType>::size_type;
+      const auto n = m.n;
+      const auto kl = m.kl;
+      const auto ku = m.ku;
+      if (m.getNbRows() == 0) {
+        throw(LUInvalidMatrixSize());
+      }
+      // decomposition of the banded part
+      auto ju = size_type{};
+      for (size_type j = 0; j != n; ++j) {
+        const auto km = std::min(kl, n - 1 - j);
+        // search of the pivot
+        auto jp = size_type{};
+        auto amax = std::abs(m.band(j, j));
+        for (size_type i = 1; i <= km; ++i) {
+          const auto a = std::abs(m.band(j + i, j));
+          if (a > amax) {
+            amax = a;
+            jp = i;
+          }
+        }
+        m.pivots[j] = j + jp;
+        if (!(amax > 0)) {
+          throw(LUNullPivot());
+        }
+        ju = std::max(ju, std::min(j + ku + jp, n - 1));
+        if (jp != 0) {
+          for (size_type c = j; c <= ju; ++c) {
+            std::swap(m.band(j + jp, c), m.band(j, c));
+          }
+        }
+        if (km > 0) {
+          const auto ipiv = 1 / m.band(j, j);
+          for (size_type i = 1; i <= km; ++i) {
+            m.band(j + i, j) *= ipiv;
+          }
+          for (size_type c = j + 1; c <= ju; ++c) {
+            const auto t = m.band(j, c);
+            for (size_type i = 1; i <= km; ++i) {
+              m.band(j + i, c) -= m.band(j + i, j) * t;
+            }
+          }
+        }
+      }
+      if (m.m == 0) {
+        return;
+      }
+      // B is replaced by the inverse of A times B
+      for (size_type k = 0; k != m.m; ++k) {
+        auto* const x = m.B.data() + n * k;
+        BorderedBandedLUSolve::band_solve(
+            m, [x](const size_type i) -> ValueType& { return x[i]; });
+      }
+      // D is replaced by the Schur complement D - C A^{-1} B
+      for (size_type i = 0; i != m.m; ++i) {
+        for (size_type j = 0; j != m.m; ++j) {
+          auto v = ValueType(0);
+          for (size_type k = 0; k != n; ++k) {
+            v += m.C[k + n * i] * m.B[k + n * j];
+          }
+          m.D(i, j) -= v;
+        }
+      }
+      m.p.reset();
+      LUDecomp<true>::exe(m.D, m.p);
+    }  // end of decompose
+    /*!
+     * \brief solve the linear system using the decomposition computed by the
+     * `decompose` method.
+     * \param[in] m: decomposition of the matrix
+     * \param[in,out] b: right hand side, replaced by the solution
+     */
+    template <typename ValueType, typename VectorType>
+    static void back_substitute(const BorderedBandedMatrix<ValueType>& m,
+                                VectorType& b) {
+      using size_type = typename BorderedBandedMatrix<ValueType>::size_type;
+      const auto n = m.n;
+      if (m.getNbRows() != b.size()) {
+        throw(LUUnmatchedSize());
+      }
+      BorderedBandedLUSolve::band_solve(
+          m, [&b](const size_type i) -> ValueType& { return b[i]; });
+      if (m.m == 0) {
+        return;
+      }
+      auto x2 = vector<ValueType>(m.m);
+      auto tmp = vector<ValueType>(m.m);
+      for (size_type i = 0; i != m.m; ++i) {
+        x2[i] = b[n + i];
+        for (size_type k = 0; k != n; ++k) {
+          x2[i] -= m.C[k + n * i] * b[k];
+        }
+      }
+      // solve the system associated with the Schur complement. This
+      // follows `LUSolve::back_substitute`
+      for (size_type i = 0; i != m.m; ++i) {
+        const auto pi = m.p(i);
+        tmp[pi] = x2[pi];
+        for (size_type j = 0; j != i; ++j) {
+          tmp[pi] -= m.D(pi, j) * tmp[m.p(j)];
+        }
+        tmp[pi] /= m.D(pi, i);
+      }
+      for (size_type i = m.m; i != 0; --i) {
+        const auto pi = m.p(i - 1);
+        auto v = tmp[pi];
+        for (size_type j = i; j != m.m; ++j) {
+          v -= m.D(pi, j) * x2[j];
+        }
+        x2[i - 1] = v;
+      }
+      for (size_type i = 0; i != m.m; ++i) {
+        b[n + i] = x2[i];
+      }
+      for (size_type j = 0; j != m.m; ++j) {
+        const auto* const y = m.B.data() + n * j;
+        for (size_type k = 0; k != n; ++k) {
+          b[k] -= y[k] * x2[j];
+        }
+      }
+    }  // end of back_substitute
+
+   private:
+    /*!
+     * \brief solve a linear system associated with the banded part using
+     * its decomposition.
+     * \param[in] m: decomposition of the matrix
+     * \param[in,out] x: functor giving access to the right hand side, which
+     * is replaced by the solution
+     */
+    template <typename ValueType, typename AccessorType>
+    static void band_solve(const BorderedBandedMatrix<ValueType>& m,
+                           const AccessorType& x) {
+      using size_type = typename BorderedBandedMatrix<ValueType>::size_type;
+      const auto n = m.n;
+      const auto kv = m.kl + m.ku;
+      if (n == 0) {
+        return;
+      }
+      // forward substitution
+      for (size_type j = 0; j != n; ++j) {
+        const auto l = m.pivots[j];
+        if (l != j) {
+          std::swap(x(l), x(j));
+        }
+        const auto km = std::min(m.kl, n - 1 - j);
+        const auto t = x(j);
+        for (size_type i = 1; i <= km; ++i) {
+          x(j + i) -= m.band(j + i, j) * t;
+        }
+      }
+      // backward substitution
+      for (size_type j = n; j != 0; --j) {
+        const auto c = j - 1;
+        x(c) /= m.band(c, c);
+        const auto t = x(c);
+        const auto ib = (c > kv) ? c - kv : size_type(0);
+        for (size_type i = ib; i != c; ++i) {
+          x(i) -= m.band(i, c) * t;
+        }
+      }
+    }  // end of band_solve
+  };   // end of struct BorderedBandedLUSolve
+
+}  // end of namespace tfel::math
+
+#endif /* LIB_TFEL_MATH_BORDEREDBANDEDLUSOLVE_HXX */
@@ -17,12 +17,14 @@
 
 #include <map>
 #include <memory>
+#include <span>
 #include <vector>
 #include <string>
 #include <functional>
 
 #include "TFEL/Config/TFELConfig.hxx"
 #include "TFEL/Math/Parser/Expr.hxx"
+#include "TFEL/Math/Parser/Bytecode.hxx"
 #include "TFEL/Math/Parser/EvaluatorBase.hxx"
 #include "TFEL/Math/Parser/ExternalFunction.hxx"
 #include "TFEL/Math/Parser/ExternalFunctionManager.hxx"
@@ -186,6 +188,37 @@ namespace tfel::math {
      * have been set with the `setVariableValue` method.
      */
     [[nodiscard]] double getValue(const std::map<std::string, double>&);
+    /*!
+     * \brief evaluate the formula by walking the expression tree rather than
+     * using the bytecode. This method is mostly meant for testing and
+     * benchmarking purposes.
+     * \return the result of the evaluation
+     * \note variables values shall have been set with the
+     * `setVariableValue` method.
+     */
+    [[nodiscard]] double getValueFromExpressionTree() const;
+    /*!
+     * \brief evaluate the formula for many values of the variables
+     * \param[out] r: results
+     * \param[in] v: values of the variables. `v[i]` gives the values of the
+     * variable at position `i`. All those values must have the same size
+     * than the results.
+     * \note if the formula can't be vectorized, the variables are set to the
+     * values associated with each evaluation. Thus, at the end of this
+     * method, the values of the variables may be the ones associated with
+     * the last evaluation.
+     */
+    void getValues(std::span<double>,
+                   const std::vector<std::span<const double>>&) override;
+    /*!
+     * \brief evaluate the formula for many values of the variables
+     * \param[out] r: results
+     * \param[in] v: values of the variables, sorted by names. All those
+     * values must have the same size than the results.
+     * \note see the notes of the previous method.
+     */
+    void getValues(std::span<double>,
+                   const std::map<std::string, std::span<const double>>&);
     /*!
      * \brief evaluate the formula
      * \return the result of the evaluation
@@ -247,6 +280,8 @@ namespace tfel::math {
     TFEL_VISIBILITY_LOCAL static bool isNumber(const std::string&);
     //! \brief clear the object
     TFEL_VISIBILITY_LOCAL void clear();
+    //! \brief compile the expression in bytecode
+    TFEL_VISIBILITY_LOCAL void compile();
     TFEL_VISIBILITY_LOCAL void treatDiff(
         std::vector<std::string>::const_iterator&,
         const std::vector<std::string>::const_iterator,
@@ -355,6 +390,11 @@ namespace tfel::math {
      * formula to be evaluated
      */
     ExprPtr expr;
+    /*!
+     * \brief bytecode used to evaluate the expression. The bytecode must
+     * be updated each time the expression is modified.
+     */
+    tfel::math::parser::Bytecode bytecode;
     //! \brief a pointer to externally defined functions
     std::shared_ptr<tfel::math::parser::ExternalFunctionManager> manager;
   };  // end of struct Evaluator
@@ -0,0 +1,777 @@
+/*!
+ * \file   include/TFEL/Math/General/Dual.hxx
+ * \brief  This file declares the `Dual` class, a scalar type used to
+ * implement the forward mode of automatic differentiation.
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright Copyright (C) 2006-2025 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_DUAL_HXX
+#define LIB_TFEL_MATH_DUAL_HXX
+
+#include <cmath>
+#include <array>
+#include <limits>
+#include <compare>
+#include <concepts>
+#include <type_traits>
+#include "TFEL/Config/TFELConfig.hxx"
+#include "TFEL/TypeTraits/IsScalar.hxx"
+#include "TFEL/TypeTraits/IsReal.hxx"
+#include "TFEL/TypeTraits/IsFundamentalNumericType.hxx"
+#include "TFEL/TypeTraits/IsAssignableTo.hxx"
+#include "TFEL/TypeTraits/BaseType.hxx"
+#include "TFEL/TypeTraits/AbsType.hxx"
+#include "TFEL/Math/Forward/General.hxx"
+#include "TFEL/Math/General/IEEE754.hxx"
+#include "TFEL/Math/General/BasicOperations.hxx"
+#include "TFEL/Math/General/UnaryResultType.hxx"
+#include "TFEL/Math/power.hxx"
+
+namespace tfel::math {
+
+  //! \brief forward declaration
+  template <typename ValueType, unsigned short N>
+  struct Dual;
+
+  namespace internals {
+
+    //! \brief a concept satisfied by the four basic arithmetic operations
+    template <typename Op>
+    concept DualArithmeticOperationConcept =
+        std::same_as<Op, OpPlus> || std::same_as<Op, OpMinus> ||
+        std::same_as<Op, OpMult> || std::same_as<Op, OpDiv>;
+
+    /*!
+     * \return the result of the function whose value at `x` is `f` and
+     * whose derivative at `x` is `df`.
+     * \param[in] x: argument
+     * \param[in] f: value of the function
+     * \param[in] df: derivative of the function
+     */
+    template <typename ValueType, unsigned short N>
+    TFEL_HOST_DEVICE constexpr Dual<ValueType, N> applyChainRule(
+        const Dual<ValueType, N>& x,
+        const ValueType f,
+        const ValueType df) noexcept {
+      auto r = Dual<ValueType, N>{f};
+      for (unsigned short i = 0; i != N; ++i) {
+        r.getDerivative(i) = df * x.getDerivative(i);
+      }
+      return r;
+    }  // end of applyChainRule
+
+    /*!
+     * \brief variant of `applyChainRule` for functions whose derivative
+     * is infinite at zero, such as the square root. At zero, the
+     * derivatives are taken null, which is the convention used by most
+     * analytical jacobians, for example for the derivative of the von
+     * Mises stress of a null stress.
+     * \param[in] x: argument
+     * \param[in] f: value of the function
+     * \param[in] df: derivative of the function
+     */
+    template <typename ValueType, unsigned short N>
+    TFEL_HOST_DEVICE constexpr Dual<ValueType, N> applyChainRuleAtRoot(
+        const Dual<ValueType, N>& x,
+        const ValueType f,
+        const ValueType df) noexcept {
+      if (tfel::math::ieee754::fpclassify(x.getValue()) == FP_ZERO) {
+        return Dual<ValueType, N>{f};
+      }
+      return applyChainRule(x, f, df);
+    }  // end of applyChainRuleAtRoot
+
+  }  // end of namespace internals
+
+  /*!
+   * \brief a dual number, i.e. a value and its derivatives with respect
+   * to `N` independent variables.
+   *
+   * Dual numbers are scalars which can be used as the numeric type of
+   * all the mathematical objects of `TFEL/Math` (`tvector`, `tmatrix`,
+   * `stensor`, etc.). The derivatives are propagated through all
+   * operations using the chain rule, which implements the forward mode
+   * of automatic differentiation: evaluating a function on dual numbers
+   * seeded by the independent variables gives both the value of the
+   * function and its exact derivatives in a single pass.
+   *
+   * \tparam ValueType: floating point type
+   * \tparam N: number of independent variables
+   */
+  template <typename ValueType, unsigned short N>
+  struct Dual {
+    static_assert(std::is_floating_point_v<ValueType>,
+                  "the value type must be a floating point type");
+    static_assert(N != 0, "invalid number of independent variables");
+    //! \brief a simple alias
+    using value_type = ValueType;
+    //! \brief number of independent variables
+    static constexpr unsigned short number_of_variables = N;
+    //! \brief default constructor, initializing the value to zero
+    TFEL_HOST_DEVICE constexpr Dual() noexcept
+        : value(ValueType(0)), derivatives{} {}
+    /*!
+     * \brief constructor from a constant value. All the derivatives are
+     * null.
+     * \param[in] v: value
+     */
+    template <StandardArithmeticTypeConcept ValueType2>
+    TFEL_HOST_DEVICE constexpr Dual(const ValueType2 v) noexcept
+        : value(static_cast<ValueType>(v)), derivatives{} {}
+    /*!
+     * \brief constructor of the `i`-th independent variable: the
+     * derivative with respect to this variable is equal to one, all the
+     * other derivatives are null.
+     * \param[in] v: value
+     * \param[in] i: index of the independent variable
+     */
+    TFEL_HOST_DEVICE constexpr Dual(const ValueType v,
+                                    const unsigned short i) noexcept
+        : value(v), derivatives{} {
+      this->derivatives[i] = ValueType(1);
+    }
+    //! \brief copy constructor
+    TFEL_HOST_DEVICE constexpr Dual(const Dual&) noexcept = default;
+    //! \brief move constructor
+    TFEL_HOST_DEVICE constexpr Dual(Dual&&) noexcept = default;
+    //! \brief standard assignement
+    TFEL_HOST_DEVICE constexpr Dual& operator=(const Dual&) noexcept =
+        default;
+    //! \brief move assignement
+    TFEL_HOST_DEVICE constexpr Dual& operator=(Dual&&) noexcept = default;
+    //! \brief assignement from a constant value
+    template <StandardArithmeticTypeConcept ValueType2>
+    TFEL_HOST_DEVICE constexpr Dual& operator=(const ValueType2 v) noexcept {
+      this->value = static_cast<ValueType>(v);
+      this->derivatives.fill(ValueType(0));
+      return *this;
+    }
+    //! \return the value
+    TFEL_HOST_DEVICE constexpr ValueType& getValue() noexcept {
+      return this->value;
+    }
+    //! \return the value
+    TFEL_HOST_DEVICE constexpr const ValueType& getValue() const noexcept {
+      return this->value;
+    }
+    /*!
+     * \return the derivative with respect to the `i`-th independent
+     * variable
+     * \param[in] i: index of the independent variable
+     */
+    TFEL_HOST_DEVICE constexpr ValueType& getDerivative(
+        const unsigned short i) noexcept {
+      return this->derivatives[i];
+    }
+    /*!
+     * \return the derivative with respect to the `i`-th independent
+     * variable
+     * \param[in] i: index of the independent variable
+     */
+    TFEL_HOST_DEVICE constexpr const ValueType& getDerivative(
+        const unsigned short i) const noexcept {
+      return this->derivatives[i];
+    }
+    //! \return the derivatives
+    TFEL_HOST_DEVICE constexpr std::array<ValueType, N>&
+    getDerivatives() noexcept {
+      return this->derivatives;
+    }
+    //! \return the derivatives
+    TFEL_HOST_DEVICE constexpr const std::array<ValueType, N>&
+    getDerivatives() const noexcept {
+      return this->derivatives;
+    }
+    //! \brief add a dual number
+    TFEL_HOST_DEVICE constexpr Dual& operator+=(const Dual& b) noexcept {
+      this->value += b.value;
+      for (unsigned short i = 0; i != N; ++i) {
+        this->derivatives[i] += b.derivatives[i];
+      }
+      return *this;
+    }
+    //! \brief substract a dual number
+    TFEL_HOST_DEVICE constexpr Dual& operator-=(const Dual& b) noexcept {
+      this->value -= b.value;
+      for (unsigned short i = 0; i != N; ++i) {
+        this->derivatives[i] -= b.derivatives[i];
+      }
+      return *this;
+    }
+    //! \brief multiply by a dual number
+    TFEL_HOST_DEVICE constexpr Dual& operator*=(const Dual& b) noexcept {
+      for (unsigned short i = 0; i != N; ++i) {
+        this->derivatives[i] =
+            this->derivatives[i] * b.value + this->value * b.derivatives[i];
+      }
+      this->value *= b.value;
+      return *this;
+    }
+    //! \brief divide by a dual number
+    TFEL_HOST_DEVICE constexpr Dual& operator/=(const Dual& b) noexcept {
+      const auto ib = 1 / b.value;
+      this->value *= ib;
+      for (unsigned short i = 0; i != N; ++i) {
+        this->derivatives[i] =
+            (this->derivatives[i] - this->value * b.derivatives[i]) * ib;
+      }
+      return *this;
+    }
+    //! \brief add a constant value
+    template <StandardArithmeticTypeConcept ValueType2>
+    TFEL_HOST_DEVICE constexpr Dual& operator+=(const ValueType2 b) noexcept {
+      this->value += b;
+      return *this;
+    }
+    //! \brief substract a constant value
+    template <StandardArithmeticTypeConcept ValueType2>
+    TFEL_HOST_DEVICE constexpr Dual& operator-=(const ValueType2 b) noexcept {
+      this->value -= b;
+      return *this;
+    }
+    //! \brief multiply by a constant value
+    template <StandardArithmeticTypeConcept ValueType2>
+    TFEL_HOST_DEVICE constexpr Dual& operator*=(const ValueType2 b) noexcept {
+      this->value *= b;
+      for (auto& d : this->derivatives) {
+        d *= b;
+      }
+      return *this;
+    }
+    //! \brief divide by a constant value
+    template <StandardArithmeticTypeConcept ValueType2>
+    TFEL_HOST_DEVICE constexpr Dual& operator/=(const ValueType2 b) noexcept {
+      const auto ib = ValueType(1) / static_cast<ValueType>(b);
+      return this->operator*=(ib);
+    }
+
+    /*!
+     * \brief standard mathematical functions. Those functions are
+     * defined as hidden friends so that they are only found by
+     * argument-dependent lookup and do not hide the overloads of the
+     * standard library for fundamental types.
+     */
+    //! \return the square root of a dual number
+    TFEL_HOST_DEVICE friend Dual sqrt(const Dual& x) noexcept {
+      const auto v = std::sqrt(x.value);
+      return internals::applyChainRuleAtRoot(x, v, 1 / (2 * v));
+    }
+    //! \return the cubic root of a dual number
+    TFEL_HOST_DEVICE friend Dual cbrt(const Dual& x) noexcept {
+      const auto v = std::cbrt(x.value);
+      return internals::applyChainRuleAtRoot(x, v, 1 / (3 * v * v));
+    }
+    //! \return the exponential of a dual number
+    TFEL_HOST_DEVICE friend Dual exp(const Dual& x) noexcept {
+      const auto v = std::exp(x.value);
+      return internals::applyChainRule(x, v, v);
+    }
+    //! \return the natural logarithm of a dual number
+    TFEL_HOST_DEVICE friend Dual log(const Dual& x) noexcept {
+      return internals::applyChainRule(x, std::log(x.value), 1 / x.value);
+    }
+    //! \return the decimal logarithm of a dual number
+    TFEL_HOST_DEVICE friend Dual log10(const Dual& x) noexcept {
+      return internals::applyChainRule(
+          x, std::log10(x.value), 1 / (x.value * std::log(ValueType(10))));
+    }
+    //! \return the sine of a dual number
+    TFEL_HOST_DEVICE friend Dual sin(const Dual& x) noexcept {
+      return internals::applyChainRule(x, std::sin(x.value),
+                                       std::cos(x.value));
+    }
+    //! \return the cosine of a dual number
+    TFEL_HOST_DEVICE friend Dual cos(const Dual& x) noexcept {
+      return internals::applyChainRule(x, std::cos(x.value),
+                                       -std::sin(x.value));
+    }
+    //! \return the tangent of a dual number
+    TFEL_HOST_DEVICE friend Dual tan(const Dual& x) noexcept {
+      const auto v = std::tan(x.value);
+      return internals::applyChainRule(x, v, 1 + v * v);
+    }
+    //! \return the arc sine of a dual number
+    TFEL_HOST_DEVICE friend Dual asin(const Dual& x) noexcept {
+      return internals::applyChainRule(x, std::asin(x.value),
+                                       1 / std::sqrt(1 - x.value * x.value));
+    }
+    //! \return the arc cosine of a dual number
+    TFEL_HOST_DEVICE friend Dual acos(const Dual& x) noexcept {
+      return internals::applyChainRule(x, std::acos(x.value),
+                                       -1 / std::sqrt(1 - x.value * x.value));
+    }
+    //! \return the arc tangent of a dual number
+    TFEL_HOST_DEVICE friend Dual atan(const Dual& x) noexcept {
+      return internals::applyChainRule(x, std::atan(x.value),
+                                       1 / (1 + x.value * x.value));
+    }
+    //! \return the hyperbolic sine of a dual number
+    TFEL_HOST_DEVICE friend Dual sinh(const Dual& x) noexcept {
+      return internals::applyChainRule(x, std::sinh(x.value),
+                                       std::cosh(x.value));
+    }
+    //! \return the hyperbolic cosine of a dual number
+    TFEL_HOST_DEVICE friend Dual cosh(const Dual& x) noexcept {
+      return internals::applyChainRule(x, std::cosh(x.value),
+                                       std::sinh(x.value));
+    }
+    //! \return the hyperbolic tangent of a dual number
+    TFEL_HOST_DEVICE friend Dual tanh(const Dual& x) noexcept {
+      const auto v = std::tanh(x.value);
+      return internals::applyChainRule(x, v, 1 - v * v);
+    }
+    //! \return the value of a dual number raised to a constant power
+    template <StandardArithmeticTypeConcept ValueType2>
+    TFEL_HOST_DEVICE friend Dual pow(const Dual& x,
+                                     const ValueType2 p) noexcept {
+      const auto e = static_cast<ValueType>(p);
+      const auto v = std::pow(x.value, e);
+      const auto df = e * std::pow(x.value, e - 1);
+      if (e < ValueType(1)) {
+        return internals::applyChainRuleAtRoot(x, v, df);
+      }
+      return internals::applyChainRule(x, v, df);
+    }
+    //! \return the value of a constant raised to the power of a dual number
+    template <StandardArithmeticTypeConcept ValueType2>
+    TFEL_HOST_DEVICE friend Dual pow(const ValueType2 a,
+                                     const Dual& p) noexcept {
+      const auto b = static_cast<ValueType>(a);
+      const auto v = std::pow(b, p.value);
+      return internals::applyChainRule(p, v, v * std::log(b));
+    }
+    //! \return the value of a dual number raised to the power of a dual
+    //! number
+    TFEL_HOST_DEVICE friend Dual pow(const Dual& x, const Dual& p) noexcept {
+      // x^p = exp(p log(x))
+      return exp(p * log(x));
+    }
+
+   private:
+    //! \brief value
+    ValueType value;
+    //! \brief derivatives with respect to the independent variables
+    std::array<ValueType, N> derivatives;
+  };  // end of struct Dual
+
+
+  /*!
+   * \brief partial specialisation for the basic operations between dual
+   * numbers
+   */
+  template <typename ValueType, unsigned short N, typename Op>
+  requires(internals::DualArithmeticOperationConcept<Op>)  //
+      struct ComputeBinaryOperationResult<ScalarTag,
+                                          ScalarTag,
+                                          Dual<ValueType, N>,
+                                          Dual<ValueType, N>,
+                                          Op> {
+    //! \brief result of the metafunction
+    using type = Dual<ValueType, N>;
+  };
+  /*!
+   * \brief partial specialisation for the basic operations between a dual
+   * number and a standard arithmetic type
+   */
+  template <typename ValueType,
+            unsigned short N,
+            StandardArithmeticTypeConcept ValueType2,
+            typename Op>
+  requires(internals::DualArithmeticOperationConcept<Op>)  //
+      struct ComputeBinaryOperationResult<ScalarTag,
+                                          ScalarTag,
+                                          Dual<ValueType, N>,
+                                          ValueType2,
+                                          Op> {
+    //! \brief result of the metafunction
+    using type = Dual<ValueType, N>;
+  };
+  /*!
+   * \brief partial specialisation for the basic operations between a
+   * standard arithmetic type and a dual number
+   */
+  template <StandardArithmeticTypeConcept ValueType2,
+            typename ValueType,
+            unsigned short N,
+            typename Op>
+  requires(internals::DualArithmeticOperationConcept<Op>)  //
+      struct ComputeBinaryOperationResult<ScalarTag,
+                                          ScalarTag,
+                                          ValueType2,
+                                          Dual<ValueType, N>,
+                                          Op> {
+    //! \brief result of the metafunction
+    using type = Dual<ValueType, N>;
+  };
+  //! \brief partial specialisation for the negation of a dual number
+  template <typename ValueType, unsigned short N>
+  struct ComputeUnaryOperationResult<ScalarTag,
+                                     UnaryOperatorTag,
+                                     Dual<ValueType, N>,
+                                     OpNeg> {
+    //! \brief result of the metafunction
+    using type = Dual<ValueType, N>;
+  };
+  //! \brief partial specialisation for the power of a dual number
+  template <typename ValueType, unsigned short N, int M, unsigned int D>
+  requires(D != 0) struct UnaryResultType<Dual<ValueType, N>, Power<M, D>> {
+    //! \brief result of the metafunction
+    using type = Dual<ValueType, N>;
+  };
+
+  //! \brief unary plus
+  template <typename ValueType, unsigned short N>
+  TFEL_HOST_DEVICE constexpr Dual<ValueType, N> operator+(
+      const Dual<ValueType, N>& a) noexcept {
+    return a;
+  }
+  //! \brief negation
+  template <typename ValueType, unsigned short N>
+  TFEL_HOST_DEVICE constexpr Dual<ValueType, N> operator-(
+      const Dual<ValueType, N>& a) noexcept {
+    auto r = Dual<ValueType, N>{-a.getValue()};
+    for (unsigned short i = 0; i != N; ++i) {
+      r.getDerivative(i) = -a.getDerivative(i);
+    }
+    return r;
+  }
+  //! \brief sum of two dual numbers
+  template <typename ValueType, unsigned short N>
+  TFEL_HOST_DEVICE constexpr Dual<ValueType, N> operator+(
+      const Dual<ValueType, N>& a, const Dual<ValueType, N>& b) noexcept {
+    auto r = a;
+    r += b;
+    return r;
+  }
+  //! \brief difference of two dual numbers
+  template <typename ValueType, unsigned short N>
+  TFEL_HOST_DEVICE constexpr Dual<ValueType, N> operator-(
+      const Dual<ValueType, N>& a, const Dual<ValueType, N>& b) noexcept {
+    auto r = a;
+    r -= b;
+    return r;
+  }
+  //! \brief product of two dual numbers
+  template <typename ValueType, unsigned short N>
+  TFEL_HOST_DEVICE constexpr Dual<ValueType, N> operator*(
+      const Dual<ValueType, N>& a, const Dual<ValueType, N>& b) noexcept {
+    auto r = Dual<ValueType, N>{a.getValue() * b.getValue()};
+    for (unsigned short i = 0; i != N; ++i) {
+      r.getDerivative(i) = a.getDerivative(i) * b.getValue() +
+                           a.getValue() * b.getDerivative(i);
+    }
+    return r;
+  }
+  //! \brief ratio of two dual numbers
+  template <typename ValueType, unsigned short N>
+  TFEL_HOST_DEVICE constexpr Dual<ValueType, N> operator/(
+      const Dual<ValueType, N>& a, const Dual<ValueType, N>& b) noexcept {
+    auto r = a;
+    r /= b;
+    return r;
+  }
+  //! \brief sum of a dual number and a constant value
+  template <typename ValueType,
+            unsigned short N,
+            StandardArithmeticTypeConcept ValueType2>
+  TFEL_HOST_DEVICE constexpr Dual<ValueType, N> operator+(
+      const Dual<ValueType, N>& a, const ValueType2 b) noexcept {
+    auto r = a;
+    r += b;
+    return r;
+  }
+  //! \brief sum of a constant value and a dual number
+  template <StandardArithmeticTypeConcept ValueType2,
+            typename ValueType,
+            unsigned short N>
+  TFEL_HOST_DEVICE constexpr Dual<ValueType, N> operator+(
+      const ValueType2 a, const Dual<ValueType, N>& b) noexcept {
+    auto r = b;
+    r += a;
+    return r;
+  }
+  //! \brief difference of a dual number and a constant value
+  template <typename ValueType,
+            unsigned short N,
+            StandardArithmeticTypeConcept ValueType2>
+  TFEL_HOST_DEVICE constexpr Dual<ValueType, N> operator-(
+      const Dual<ValueType, N>& a, const ValueType2 b) noexcept {
+    auto r = a;
+    r -= b;
+    return r;
+  }
+  //! \brief difference of a constant value and a dual number
+  template <StandardArithmeticTypeConcept ValueType2,
+            typename ValueType,
+            unsigned short N>
+  TFEL_HOST_DEVICE constexpr Dual<ValueType, N> operator-(
+      const ValueType2 a, const Dual<ValueType, N>& b) noexcept {
+    auto r = -b;
+    r += a;
+    return r;
+  }
+  //! \brief product of a dual number and a constant value
+  template <typename ValueType,
+            unsigned short N,
+            StandardArithmeticTypeConcept ValueType2>
+  TFEL_HOST_DEVICE constexpr Dual<ValueType, N> operator*(
+      const Dual<ValueType, N>& a, const ValueType2 b) noexcept {
+    auto r = a;
+    r *= b;
+    return r;
+  }
+  //! \brief product of a constant value and a dual number
+  template <StandardArithmeticTypeConcept ValueType2,
+            typename ValueType,
+            unsigned short N>
+  TFEL_HOST_DEVICE constexpr Dual<ValueType, N> operator*(
+      const ValueType2 a, const Dual<ValueType, N>& b) noexcept {
+    auto r = b;
+    r *= a;
+    return r;
+  }
+  //! \brief ratio of a dual number and a constant value
+  template <typename ValueType,
+            unsigned short N,
+            StandardArithmeticTypeConcept ValueType2>
+  TFEL_HOST_DEVICE constexpr Dual<ValueType, N> operator/(
+      const Dual<ValueType, N>& a, const ValueType2 b) noexcept {
+    auto r = a;
+    r /= b;
+    return r;
+  }
+  //! \brief ratio of a constant value and a dual number
+  template <StandardArithmeticTypeConcept ValueType2,
+            typename ValueType,
+            unsigned short N>
+  TFEL_HOST_DEVICE constexpr Dual<ValueType, N> operator/(
+      const ValueType2 a, const Dual<ValueType, N>& b) noexcept {
+    const auto ib = 1 / b.getValue();
+    const auto v = static_cast<ValueType>(a) * ib;
+    return internals::applyChainRule(b, v, -v * ib);
+  }
+  /*!
+   * \brief comparison of two dual numbers. Only the values are
+   * compared.
+   */
+  template <typename ValueType, unsigned short N>
+  TFEL_HOST_DEVICE constexpr bool operator==(
+      const Dual<ValueType, N>& a, const Dual<ValueType, N>& b) noexcept {
+    return tfel::math::ieee754::fpclassify(a.getValue() - b.getValue()) ==
+           FP_ZERO;
+  }
+  /*!
+   * \brief comparison of two dual numbers. Only the values are
+   * compared.
+   */
+  template <typename ValueType, unsigned short N>
+  TFEL_HOST_DEVICE constexpr auto operator<=>(
+      const Dual<ValueType, N>& a, const Dual<ValueType, N>& b) noexcept {
+    return a.getValue() <=> b.getValue();
+  }
+  /*!
+   * \brief comparison of a dual number and a constant value. Only the
+   * value of the dual number is considered.
+   */
+  template <typename ValueType,
+            unsigned short N,
+            StandardArithmeticTypeConcept ValueType2>
+  TFEL_HOST_DEVICE constexpr bool operator==(const Dual<ValueType, N>& a,
+                                             const ValueType2 b) noexcept {
+    return tfel::math::ieee754::fpclassify(
+               a.getValue() - static_cast<ValueType>(b)) == FP_ZERO;
+  }
+  /*!
+   * \brief comparison of a dual number and a constant value. Only the
+   * value of the dual number is considered.
+   */
+  template <typename ValueType,
+            unsigned short N,
+            StandardArithmeticTypeConcept ValueType2>
+  TFEL_HOST_DEVICE constexpr auto operator<=>(const Dual<ValueType, N>& a,
+                                              const ValueType2 b) noexcept {
+    return a.getValue() <=> static_cast<ValueType>(b);
+  }
+
+  //! \return the value of a dual number raised to the power `M`
+  template <int M, typename ValueType, unsigned short N>
+  TFEL_HOST_DEVICE Dual<ValueType, N> power(
+      const Dual<ValueType, N>& x) noexcept {
+    if constexpr (M == 0) {
+      return Dual<ValueType, N>{ValueType(1)};
+    } else {
+      const auto v = power<M - 1>(x.getValue());
+      return internals::applyChainRule(x, v * x.getValue(), M * v);
+    }
+  }
+  //! \return the value of a dual number raised to the power `M/D`
+  template <int M, unsigned int D, typename ValueType, unsigned short N>
+  TFEL_HOST_DEVICE Dual<ValueType, N> power(
+      const Dual<ValueType, N>& x) noexcept requires(D != 0) {
+    if constexpr (M == 0) {
+      return Dual<ValueType, N>{ValueType(1)};
+    } else {
+      constexpr auto e = static_cast<ValueType>(M) / static_cast<ValueType>(D);
+      const auto v = power<M, D>(x.getValue());
+      if constexpr (e < 1) {
+        return internals::applyChainRuleAtRoot(x, v, e * v / x.getValue());
+      } else {
+        return internals::applyChainRule(x, v,
+                                         e * power<M - int(D), D>(x.getValue()));
+      }
+    }
+  }
+
+}  // end of namespace tfel::math
+
+namespace tfel::math::ieee754 {
+
+  /*!
+   * \return the class of the value of the dual number
+   * \param[in] x: dual number
+   */
+  template <typename ValueType, unsigned short N>
+  TFEL_HOST_DEVICE constexpr int fpclassify(
+      const tfel::math::Dual<ValueType, N>& x) noexcept {
+    return fpclassify(x.getValue());
+  }
+  /*!
+   * \return true if the value or one of the derivatives of the dual
+   * number is a not-a-number (NaN) value.
+   * \param[in] x: dual number
+   */
+  template <typename ValueType, unsigned short N>
+  TFEL_HOST_DEVICE constexpr bool isnan(
+      const tfel::math::Dual<ValueType, N>& x) noexcept {
+    if (isnan(x.getValue())) {
+      return true;
+    }
+    for (const auto& d : x.getDerivatives()) {
+      if (isnan(d)) {
+        return true;
+      }
+    }
+    return false;
+  }
+  /*!
+   * \return true if the value and all the derivatives of the dual
+   * number are finite.
+   * \param[in] x: dual number
+   */
+  template <typename ValueType, unsigned short N>
+  TFEL_HOST_DEVICE constexpr bool isfinite(
+      const tfel::math::Dual<ValueType, N>& x) noexcept {
+    if (!isfinite(x.getValue())) {
+      return false;
+    }
+    for (const auto& d : x.getDerivatives()) {
+      if (!isfinite(d)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+}  // end of namespace tfel::math::ieee754
+
+namespace tfel::typetraits {
+
+  //! \brief partial specialisation for dual numbers
+  template <typename ValueType, unsigned short N>
+  struct IsScalar<tfel::math::Dual<ValueType, N>> {
+    //! \brief result
+    static constexpr bool cond = true;
+  };
+  //! \brief partial specialisation for dual numbers
+  template <typename ValueType, unsigned short N>
+  struct IsReal<tfel::math::Dual<ValueType, N>> {
+    //! \brief result
+    static constexpr bool cond = IsReal<ValueType>::cond;
+  };
+  //! \brief partial specialisation for dual numbers
+  template <typename ValueType, unsigned short N>
+  struct IsFundamentalNumericType<tfel::math::Dual<ValueType, N>> {
+    //! \brief result
+    static constexpr bool cond = true;
+  };
+  //! \brief partial specialisation for dual numbers
+  template <typename ValueType, unsigned short N>
+  struct BaseType<tfel::math::Dual<ValueType, N>> {
+    //! \brief result
+    using type = tfel::math::Dual<ValueType, N>;
+  };
+  //! \brief partial specialisation for dual numbers
+  template <typename ValueType, unsigned short N>
+  struct AbsType<tfel::math::Dual<ValueType, N>> {
+    //! \brief result
+    using type = tfel::math::Dual<ValueType, N>;
+  };
+  //! \brief partial specialisation for dual numbers
+  template <typename ValueType, unsigned short N>
+  struct IsAssignableTo<tfel::math::Dual<ValueType, N>,
+                        tfel::math::Dual<ValueType, N>> {
+    //! \brief result
+    static constexpr bool value = true;
+    //! \brief result
+    static constexpr bool cond = true;
+  };
+  //! \brief partial specialisation for dual numbers
+  template <StandardArithmeticTypeConcept ValueType2,
+            typename ValueType,
+            unsigned short N>
+  struct IsAssignableTo<ValueType2, tfel::math::Dual<ValueType, N>> {
+    //! \brief result
+    static constexpr bool value = true;
+    //! \brief result
+    static constexpr bool cond = true;
+  };
+
+}  // end of namespace tfel::typetraits
+
+namespace std {
+
+  //! \brief partial specialisation for dual numbers
+  template <typename ValueType, unsigned short N>
+  struct numeric_limits<tfel::math::Dual<ValueType, N>>
+      : public numeric_limits<ValueType> {
+    //! \brief a simple alias
+    using Dual = tfel::math::Dual<ValueType, N>;
+    static constexpr Dual min() noexcept {
+      return Dual{numeric_limits<ValueType>::min()};
+    }
+    static constexpr Dual max() noexcept {
+      return Dual{numeric_limits<ValueType>::max()};
+    }
+    static constexpr Dual lowest() noexcept {
+      return Dual{numeric_limits<ValueType>::lowest()};
+    }
+    static constexpr Dual epsilon() noexcept {
+      return Dual{numeric_limits<ValueType>::epsilon()};
+    }
+    static constexpr Dual round_error() noexcept {
+      return Dual{numeric_limits<ValueType>::round_error()};
+    }
+    static constexpr Dual infinity() noexcept {
+      return Dual{numeric_limits<ValueType>::infinity()};
+    }
+    static constexpr Dual quiet_NaN() noexcept {
+      return Dual{numeric_limits<ValueType>::quiet_NaN()};
+    }
+    static constexpr Dual signaling_NaN() noexcept {
+      return Dual{numeric_limits<ValueType>::signaling_NaN()};
+    }
+    static constexpr Dual denorm_min() noexcept {
+      return Dual{numeric_limits<ValueType>::denorm_min()};
+    }
+  };
+
+}  // end of namespace std
+
+#endif /* LIB_TFEL_MATH_DUAL_HXX */
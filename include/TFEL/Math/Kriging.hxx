@@ -14,6 +14,7 @@
 #ifndef LIB_TFEL_MATH_KRIGING_HXX
 #define LIB_TFEL_MATH_KRIGING_HXX
 
+#include <span>
 #include "TFEL/Math/tvector.hxx"
 #include "TFEL/Math/vector.hxx"
 
@@ -36,6 +37,17 @@ namespace tfel::math {
 
     [[nodiscard]] T operator()(
         const typename KrigingVariable<N, T>::type&) const;
+    /*!
+     * \brief evaluate the interpolation on many points
+     * \param[out] r: values
+     * \param[in] xv: points
+     *
+     * The points are treated by blocks: the samples are only traversed once
+     * per block, rather than once per point.
+     */
+    void getValues(
+        std::span<T>,
+        std::span<const typename KrigingVariable<N, T>::type>) const;
 
     ~Kriging() noexcept;
 
@@ -20,7 +20,7 @@
 #ifdef HAVE_ATLAS
 #include "TFEL/Math/Bindings/atlas.hxx"
 #else
-#include "TFEL/Math/LUSolve.hxx"
+#include "TFEL/Math/LDLTSolve.hxx"
 #endif /* LIB_TFEL_MATH_FACTORIZEDKRIGINGIXX */
 #include "TFEL/Math/Kriging/KrigingErrors.hxx"
 
@@ -112,7 +112,8 @@ namespace tfel::math {
 #ifdef HAVE_ATLAS
     gesv(m, this->a);
 #else
-    LUSolve::exe(m, this->a);
+    // the matrix is symmetric but not positive definite in general
+    LDLTSolve::exe(m, this->a);
 #endif /* LIB_TFEL_MATH_FACTORIZEDKRIGINGIXX */
   }
 
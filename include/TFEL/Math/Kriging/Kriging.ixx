@@ -20,7 +20,7 @@
 #ifdef HAVE_ATLAS
 #include "TFEL/Math/Bindings/atlas.hxx"
 #else
-#include "TFEL/Math/LUSolve.hxx"
+#include "TFEL/Math/LDLTSolve.hxx"
 #endif /* LIB_TFEL_MATH_KRIGINGIXX */
 #include "TFEL/Math/Kriging/KrigingErrors.hxx"
 
@@ -84,6 +84,38 @@ namespace tfel::math {
     return r;
   }  // end of Kriging<N,T,Model>::operator()
 
+  template <unsigned short N, typename T, typename Model>
+  void Kriging<N, T, Model>::getValues(
+      std::span<T> r,
+      std::span<const typename KrigingVariable<N, T>::type> xv) const {
+    using namespace tfel::math::internals;
+    using size_type = typename vector<T>::size_type;
+    using diff = typename vector<T>::difference_type;
+    //! \brief number of points treated at once
+    constexpr size_type block_size = 64;
+    if (r.size() != xv.size()) {
+      throw(KrigingErrorInvalidLength());
+    }
+    const auto ns = this->x.size();
+    const auto np = static_cast<size_type>(xv.size());
+    for (size_type b = 0; b < np; b += block_size) {
+      const auto e = std::min(b + block_size, np);
+      for (size_type q = b; q != e; ++q) {
+        auto p = this->a.begin() + static_cast<diff>(ns);
+        r[q] = T(0);
+        ApplySpecificationDrifts<0, Model::nb, N, T, Model>::apply(r[q], p,
+                                                                   xv[q]);
+      }
+      for (size_type i = 0; i != ns; ++i) {
+        const auto ai = this->a[i];
+        const auto& xi = this->x[i];
+        for (size_type q = b; q != e; ++q) {
+          r[q] += ai * Model::covariance(xv[q] - xi);
+        }
+      }
+    }
+  }  // end of Kriging<N,T,Model>::getValues
+
   template <unsigned short N, typename T, typename Model>
   void Kriging<N, T, Model>::addValue(
       const typename KrigingVariable<N, T>::type& xv, const T& fv) {
@@ -129,7 +161,8 @@ namespace tfel::math {
 #ifdef HAVE_ATLAS
     gesv(m, this->a);
 #else
-    LUSolve::exe(m, this->a);
+    // the matrix is symmetric but not positive definite in general
+    LDLTSolve::exe(m, this->a);
 #endif /* LIB_TFEL_MATH_KRIGINGIXX */
   }
 
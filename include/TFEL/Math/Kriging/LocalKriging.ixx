@@ -0,0 +1,201 @@
+/*!
+ * \file  include/TFEL/Math/Kriging/LocalKriging.ixx
+ * \brief This file implements the `LocalKriging` class.
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright Copyright (C) 2006-2025 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_LOCALKRIGING_IXX
+#define LIB_TFEL_MATH_LOCALKRIGING_IXX
+
+#include <cmath>
+#include <algorithm>
+#include "TFEL/Math/Kriging/KrigingErrors.hxx"
+
+namespace tfel::math {
+
+  namespace internals {
+
+    /*!
+     * \brief move to the next cell of the box [lo, hi]
+     * \return false if all the cells of the box have been visited
+     * \param[in,out] c: coordinates of the current cell
+     * \param[in] lo: lower corner of the box
+     * \param[in] hi: upper corner of the box
+     */
+    template <typename size_type, std::size_t N>
+    bool nextLocalKrigingCell(std::array<size_type, N>& c,
+                              const std::array<size_type, N>& lo,
+                              const std::array<size_type, N>& hi) {
+      for (std::size_t d = 0; d != N; ++d) {
+        if (c[d] != hi[d]) {
+          ++(c[d]);
+          return true;
+        }
+        c[d] = lo[d];
+      }
+      return false;
+    }  // end of nextLocalKrigingCell
+
+  }  // end of namespace internals
+
+  template <unsigned short N, typename T, typename Model>
+  void LocalKriging<N, T, Model>::addValue(const Variable& xv, const T& fv) {
+    this->x.push_back(xv);
+    this->f.push_back(fv);
+  }  // end of addValue
+
+  template <unsigned short N, typename T, typename Model>
+  void LocalKriging<N, T, Model>::setNumberOfNeighbours(const size_type n) {
+    this->nn = n;
+  }  // end of setNumberOfNeighbours
+
+  template <unsigned short N, typename T, typename Model>
+  void LocalKriging<N, T, Model>::buildInterpolation() {
+    using Cell = std::array<size_type, N>;
+    if (this->x.size() != this->f.size()) {
+      throw(KrigingErrorInvalidLength());
+    }
+    if (this->x.empty()) {
+      throw(KrigingErrorNoDataSpecified());
+    }
+    const auto ns = this->x.size();
+    const auto nmin = std::max(this->nn, static_cast<size_type>(Model::nb + 1));
+    // bounding box
+    auto xmax = std::array<T, N>{};
+    for (unsigned short d = 0; d != N; ++d) {
+      this->xmin[d] = xmax[d] = getComponent(this->x[0], d);
+      for (const auto& xv : this->x) {
+        this->xmin[d] = std::min(this->xmin[d], getComponent(xv, d));
+        xmax[d] = std::max(xmax[d], getComponent(xv, d));
+      }
+    }
+    // number of cells per direction, chosen so that a cell and its direct
+    // neighbours contain about nmin samples
+    const auto r = std::pow(3., N) * static_cast<double>(ns) /
+                   static_cast<double>(nmin);
+    this->nc = std::max(
+        static_cast<size_type>(std::floor(std::pow(r, 1. / N))), size_type{1});
+    for (unsigned short d = 0; d != N; ++d) {
+      this->h[d] = (xmax[d] - this->xmin[d]) / static_cast<T>(this->nc);
+    }
+    auto ncells = size_type{1};
+    for (unsigned short d = 0; d != N; ++d) {
+      ncells *= this->nc;
+    }
+    // samples per cell
+    auto samples = std::vector<std::vector<size_type>>(ncells);
+    for (size_type i = 0; i != ns; ++i) {
+      const auto c = this->getCellCoordinates(this->x[i]);
+      samples[this->getCellIndex(c)].push_back(i);
+    }
+    // local interpolations
+    this->interpolations.clear();
+    this->interpolations.resize(ncells);
+    auto c = Cell{};
+    const auto cmin = Cell{};
+    auto cmax = Cell{};
+    cmax.fill(this->nc - 1);
+    do {
+      auto lo = Cell{};
+      auto hi = Cell{};
+      for (size_type ring = 1;; ++ring) {
+        for (unsigned short d = 0; d != N; ++d) {
+          lo[d] = c[d] >= ring ? c[d] - ring : 0;
+          hi[d] = std::min(c[d] + ring, this->nc - 1);
+        }
+        auto n = size_type{};
+        auto c2 = lo;
+        do {
+          n += samples[this->getCellIndex(c2)].size();
+        } while (internals::nextLocalKrigingCell(c2, lo, hi));
+        if ((n >= nmin) || (ring >= this->nc)) {
+          break;
+        }
+      }
+      auto k = std::make_unique<Kriging<N, T, Model>>();
+      static_cast<Model&>(*k) = static_cast<const Model&>(*this);
+      auto c2 = lo;
+      do {
+        for (const auto i : samples[this->getCellIndex(c2)]) {
+          k->addValue(this->x[i], this->f[i]);
+        }
+      } while (internals::nextLocalKrigingCell(c2, lo, hi));
+      k->buildInterpolation();
+      this->interpolations[this->getCellIndex(c)] = std::move(k);
+    } while (internals::nextLocalKrigingCell(c, cmin, cmax));
+  }  // end of buildInterpolation
+
+  template <unsigned short N, typename T, typename Model>
+  T LocalKriging<N, T, Model>::operator()(const Variable& xv) const {
+    const auto c = this->getCellCoordinates(xv);
+    return (*(this->interpolations[this->getCellIndex(c)]))(xv);
+  }  // end of operator()
+
+  template <unsigned short N, typename T, typename Model>
+  void LocalKriging<N, T, Model>::getValues(
+      std::span<T> r, std::span<const Variable> xv) const {
+    if (r.size() != xv.size()) {
+      throw(KrigingErrorInvalidLength());
+    }
+    for (typename std::span<T>::size_type i = 0; i != r.size(); ++i) {
+      r[i] = this->operator()(xv[i]);
+    }
+  }  // end of getValues
+
+  template <unsigned short N, typename T, typename Model>
+  typename LocalKriging<N, T, Model>::size_type
+  LocalKriging<N, T, Model>::getNumberOfCells() const {
+    return this->interpolations.size();
+  }  // end of getNumberOfCells
+
+  template <unsigned short N, typename T, typename Model>
+  std::array<typename LocalKriging<N, T, Model>::size_type, N>
+  LocalKriging<N, T, Model>::getCellCoordinates(const Variable& xv) const {
+    auto c = std::array<size_type, N>{};
+    for (unsigned short d = 0; d != N; ++d) {
+      if (!(this->h[d] > 0)) {
+        continue;
+      }
+      const auto v = (getComponent(xv, d) - this->xmin[d]) / this->h[d];
+      if (v > 0) {
+        c[d] = std::min(static_cast<size_type>(v), this->nc - 1);
+      }
+    }
+    return c;
+  }  // end of getCellCoordinates
+
+  template <unsigned short N, typename T, typename Model>
+  typename LocalKriging<N, T, Model>::size_type
+  LocalKriging<N, T, Model>::getCellIndex(
+      const std::array<size_type, N>& c) const {
+    auto i = size_type{};
+    for (unsigned short d = N; d != 0; --d) {
+      i = i * this->nc + c[d - 1];
+    }
+    return i;
+  }  // end of getCellIndex
+
+  template <unsigned short N, typename T, typename Model>
+  T LocalKriging<N, T, Model>::getComponent(const Variable& xv,
+                                            const unsigned short d) {
+    if constexpr (N == 1) {
+      static_cast<void>(d);
+      return xv;
+    } else {
+      return xv(d);
+    }
+  }  // end of getComponent
+
+  template <unsigned short N, typename T, typename Model>
+  LocalKriging<N, T, Model>::~LocalKriging() noexcept = default;
+
+}  // end of namespace tfel::math
+
+#endif /* LIB_TFEL_MATH_LOCALKRIGING_IXX */
@@ -0,0 +1,268 @@
+/*!
+ * \file   include/TFEL/Math/LDLTSolve.hxx
+ * \brief  This file declares the `LDLTSolve` class.
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright Copyright (C) 2006-2025 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_LDLTSOLVE_HXX
+#define LIB_TFEL_MATH_LDLTSOLVE_HXX
+
+#include <cmath>
+#include <vector>
+#include <cstddef>
+#include <utility>
+#include <algorithm>
+#include <type_traits>
+#include "TFEL/Config/TFELConfig.hxx"
+#include "TFEL/Math/Matrix/MatrixConcept.hxx"
+#include "TFEL/Math/LU/LUException.hxx"
+
+namespace tfel::math {
+
+  /*!
+   * \brief This structure contains static methods for solving linear systems
+   * whose matrix is symmetric, but not necessarily positive definite.
+   *
+   * The matrix is decomposed as \f$P\,L\,D\,L^{T}\,P^{T}\f$ where \f$L\f$ is
+   * a unit lower triangular matrix, \f$D\f$ is a block diagonal matrix made
+   * of \f$1\times 1\f$ and \f$2\times 2\f$ blocks and \f$P\f$ is a
+   * permutation matrix. The pivots are chosen using the partial pivoting
+   * strategy of Bunch and Kaufman, following the `dsytf2` and `dsytrs`
+   * routines of the `LAPACK` library.
+   *
+   * Only the upper triangular part of the matrix is read and overwritten by
+   * the decomposition: the \f$k\f$-th column of \f$L\f$ is stored in the
+   * \f$k\f$-th row of the matrix. With the row major storage used by the
+   * `matrix` class, the inner loops thus access contiguous memory.
+   *
+   * The cost of the decomposition is roughly half the cost of a LU
+   * decomposition.
+   */
+  struct LDLTSolve {
+    /*!
+     * \brief description of the pivots
+     *
+     * A positive or null value \f$p\f$ at index \f$k\f$ denotes a
+     * \f$1\times 1\f$ block and means that the rows and columns \f$k\f$ and
+     * \f$p\f$ were interchanged. A negative value \f$-p-1\f$ stored at the
+     * indices \f$k\f$ and \f$k+1\f$ denotes a \f$2\times 2\f$ block and means
+     * that the rows and columns \f$k+1\f$ and \f$p\f$ were interchanged.
+     */
+    using Pivots = std::vector<std::ptrdiff_t>;
+    /*!
+     * \brief decompose the matrix and solve the linear system
+     * \param[in,out] m: matrix, replaced by its decomposition
+     * \param[in,out] b: right hand side, replaced by the solution
+     */
+    template <typename MatrixType, typename VectorType>
+    static void exe(MatrixType& m, VectorType& b) {
+      auto p = Pivots{};
+      LDLTSolve::decompose(m, p);
+      LDLTSolve::back_substitute(m, p, b);
+    }  // end of exe
+    /*!
+     * \brief compute the decomposition of the matrix in place
+     * \param[in,out] m: matrix
+     * \param[out] p: pivots
+     */
+    template <typename MatrixType>
+    static void decompose(MatrixType& m, Pivots& p) {
+      using size_type = index_type<MatrixType>;
+      using real = std::decay_t<decltype(m(0, 0))>;
+      // l(i, j) is the element of the lower triangular part of the LAPACK
+      // algorithm, stored in the upper triangular part of m
+      auto l = [&m](const size_type i, const size_type j) -> real& {
+        return m(j, i);
+      };
+      LDLTSolve::checkMatrix(m);
+      const auto alpha = (1 + std::sqrt(real(17))) / 8;
+      const auto n = m.getNbRows();
+      p.resize(n);
+      size_type k = 0;
+      while (k < n) {
+        auto kstep = size_type{1};
+        auto kp = k;
+        const auto absakk = std::abs(l(k, k));
+        // largest off-diagonal element in column k
+        auto imax = k;
+        auto colmax = real(0);
+        for (size_type i = k + 1; i < n; ++i) {
+          if (std::abs(l(i, k)) > colmax) {
+            colmax = std::abs(l(i, k));
+            imax = i;
+          }
+        }
+        if (!(std::max(absakk, colmax) > 0)) {
+          throw(LUNullPivot());
+        }
+        if (absakk < alpha * colmax) {
+          // largest off-diagonal element in row imax
+          auto rowmax = real(0);
+          for (size_type j = k; j != imax; ++j) {
+            rowmax = std::max(rowmax, std::abs(l(imax, j)));
+          }
+          for (size_type j = imax + 1; j < n; ++j) {
+            rowmax = std::max(rowmax, std::abs(l(j, imax)));
+          }
+          if (absakk >= alpha * colmax * (colmax / rowmax)) {
+            kp = k;
+          } else if (std::abs(l(imax, imax)) >= alpha * rowmax) {
+            kp = imax;
+          } else {
+            kp = imax;
+            kstep = 2;
+          }
+        }
+        const auto kk = k + kstep - 1;
+        if (kp != kk) {
+          // interchange of the rows and columns kk and kp in the trailing
+          // submatrix
+          for (size_type i = kp + 1; i < n; ++i) {
+            std::swap(l(i, kk), l(i, kp));
+          }
+          for (size_type j = kk + 1; j < kp; ++j) {
+            std::swap(l(j, kk), l(kp, j));
+          }
+          std::swap(l(kk, kk), l(kp, kp));
+          if (kstep == 2) {
+            std::swap(l(k + 1, k), l(kp, k));
+          }
+        }
+        if (kstep == 1) {
+          // rank-1 update of the trailing submatrix
+          const auto d11 = 1 / l(k, k);
+          for (size_type j = k + 1; j < n; ++j) {
+            const auto c = d11 * l(j, k);
+            for (size_type i = j; i < n; ++i) {
+              l(i, j) -= c * l(i, k);
+            }
+          }
+          for (size_type i = k + 1; i < n; ++i) {
+            l(i, k) *= d11;
+          }
+          p[k] = static_cast<std::ptrdiff_t>(kp);
+        } else {
+          // rank-2 update of the trailing submatrix
+          if (k + 2 < n) {
+            auto d21 = l(k + 1, k);
+            const auto d11 = l(k + 1, k + 1) / d21;
+            const auto d22 = l(k, k) / d21;
+            const auto t = 1 / (d11 * d22 - 1);
+            d21 = t / d21;
+            for (size_type j = k + 2; j < n; ++j) {
+              const auto wk = d21 * (d11 * l(j, k) - l(j, k + 1));
+              const auto wkp1 = d21 * (d22 * l(j, k + 1) - l(j, k));
+              for (size_type i = j; i < n; ++i) {
+                l(i, j) -= l(i, k) * wk + l(i, k + 1) * wkp1;
+              }
+              l(j, k) = wk;
+              l(j, k + 1) = wkp1;
+            }
+          }
+          p[k] = p[k + 1] = -static_cast<std::ptrdiff_t>(kp) - 1;
+        }
+        k += kstep;
+      }
+    }  // end of decompose
+    /*!
+     * \brief solve the linear system using a matrix decomposed by the
+     * `decompose` method
+     * \param[in] m: decomposed matrix
+     * \param[in] p: pivots
+     * \param[in,out] b: right hand side, replaced by the solution
+     */
+    template <typename MatrixType, typename VectorType>
+    static void back_substitute(const MatrixType& m,
+                                const Pivots& p,
+                                VectorType& b) {
+      using size_type = index_type<MatrixType>;
+      auto l = [&m](const size_type i, const size_type j) {
+        return m(j, i);
+      };
+      LDLTSolve::checkMatrix(m);
+      const auto n = m.getNbRows();
+      if ((b.size() != n) || (p.size() != n)) {
+        throw(LUUnmatchedSize());
+      }
+      // solution of L D y = P^T b
+      size_type k = 0;
+      while (k < n) {
+        if (p[k] >= 0) {
+          const auto kp = static_cast<size_type>(p[k]);
+          if (kp != k) {
+            std::swap(b(k), b(kp));
+          }
+          for (size_type i = k + 1; i < n; ++i) {
+            b(i) -= l(i, k) * b(k);
+          }
+          b(k) /= l(k, k);
+          k += 1;
+        } else {
+          const auto kp = static_cast<size_type>(-p[k] - 1);
+          if (kp != k + 1) {
+            std::swap(b(k + 1), b(kp));
+          }
+          for (size_type i = k + 2; i < n; ++i) {
+            b(i) -= l(i, k) * b(k) + l(i, k + 1) * b(k + 1);
+          }
+          const auto akm1k = l(k + 1, k);
+          const auto akm1 = l(k, k) / akm1k;
+          const auto ak = l(k + 1, k + 1) / akm1k;
+          const auto denom = akm1 * ak - 1;
+          const auto bkm1 = b(k) / akm1k;
+          const auto bk = b(k + 1) / akm1k;
+          b(k) = (ak * bkm1 - bk) / denom;
+          b(k + 1) = (akm1 * bk - bkm1) / denom;
+          k += 2;
+        }
+      }
+      // solution of L^T P^T x = y
+      k = n;
+      while (k != 0) {
+        const auto k1 = k - 1;
+        if (p[k1] >= 0) {
+          for (size_type i = k; i < n; ++i) {
+            b(k1) -= l(i, k1) * b(i);
+          }
+          const auto kp = static_cast<size_type>(p[k1]);
+          if (kp != k1) {
+            std::swap(b(k1), b(kp));
+          }
+          k -= 1;
+        } else {
+          for (size_type i = k; i < n; ++i) {
+            b(k1) -= l(i, k1) * b(i);
+            b(k1 - 1) -= l(i, k1 - 1) * b(i);
+          }
+          const auto kp = static_cast<size_type>(-p[k1] - 1);
+          if (kp != k1) {
+            std::swap(b(k1), b(kp));
+          }
+          k -= 2;
+        }
+      }
+    }  // end of back_substitute
+
+   private:
+    //! \brief check that the matrix is square and not empty
+    template <typename MatrixType>
+    static void checkMatrix(const MatrixType& m) {
+      if (m.getNbRows() != m.getNbCols()) {
+        throw(LUMatrixNotSquare());
+      }
+      if (m.getNbRows() == 0) {
+        throw(LUInvalidMatrixSize());
+      }
+    }  // end of checkMatrix
+  };   // end of struct LDLTSolve
+
+}  // end of namespace tfel::math
+
+#endif /* LIB_TFEL_MATH_LDLTSOLVE_HXX */
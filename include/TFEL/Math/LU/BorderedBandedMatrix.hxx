@@ -0,0 +1,171 @@
+/*!
+ * \file   include/TFEL/Math/LU/BorderedBandedMatrix.hxx
+ * \brief  This file declares the `BorderedBandedMatrix` class.
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright Copyright (C) 2006-2025 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_LU_BORDEREDBANDEDMATRIX_HXX
+#define LIB_TFEL_MATH_LU_BORDEREDBANDEDMATRIX_HXX
+
+#include <vector>
+#include "TFEL/Config/TFELConfig.hxx"
+#include "TFEL/Math/matrix.hxx"
+#include "TFEL/Math/LU/Permutation.hxx"
+
+namespace tfel::math {
+
+  // forward declaration
+  struct BorderedBandedLUSolve;
+
+  /*!
+   * \brief a square matrix of the form:
+   *
+   * \f[
+   * \begin{pmatrix}
+   * A & B \\
+   * C & D
+   * \end{pmatrix}
+   * \f]
+   *
+   * where \f$A\f$ is a banded matrix of size \f$n\f$ with \f$k_{l}\f$
+   * sub-diagonals and \f$k_{u}\f$ super-diagonals, \f$B\f$ and \f$C\f$ are
+   * dense \f$n\times m\f$ and \f$m\times n\f$ matrices and \f$D\f$ is a dense
+   * \f$m\times m\f$ matrix, called the border. Such matrices typically arise
+   * from the discretisation of one dimensional problems with a few global
+   * unknowns.
+   *
+   * Only the terms of the band and of the border are stored. The band is
+   * stored column by column, following the conventions of the `LAPACK`
+   * library, with \f$k_{l}\f$ additional rows used to store the fill-in
+   * generated by the partial pivoting.
+   *
+   * \note the `BorderedBandedLUSolve` class computes the decomposition of the
+   * matrix in place.
+   */
+  template <typename ValueType>
+  struct BorderedBandedMatrix {
+    //! \brief a simple alias
+    using size_type = typename matrix<ValueType>::size_type;
+    //! \brief default constructor
+    BorderedBandedMatrix() = default;
+    /*!
+     * \brief constructor
+     * \param[in] n: size of the banded part
+     * \param[in] kl: number of sub-diagonals of the banded part
+     * \param[in] ku: number of super-diagonals of the banded part
+     * \param[in] m: size of the border
+     */
+    BorderedBandedMatrix(const size_type,
+                         const size_type,
+                         const size_type,
+                         const size_type);
+    /*!
+     * \brief resize the matrix. All the terms are set to zero.
+     * \param[in] n: size of the banded part
+     * \param[in] kl: number of sub-diagonals of the banded part
+     * \param[in] ku: number of super-diagonals of the banded part
+     * \param[in] m: size of the border
+     */
+    void resize(const size_type,
+                const size_type,
+                const size_type,
+                const size_type);
+    //! \brief set all the terms to zero
+    void zero();
+    /*!
+     * \brief copy the terms of a dense matrix. The terms outside the band and
+     * the border are ignored.
+     * \param[in] k: dense matrix
+     */
+    template <typename MatrixType>
+    void import(const MatrixType&);
+    //! \return the number of rows
+    [[nodiscard]] size_type getNbRows() const noexcept;
+    //! \return the number of columns
+    [[nodiscard]] size_type getNbCols() const noexcept;
+    //! \return the size of the banded part
+    [[nodiscard]] size_type getBandSize() const noexcept;
+    //! \return the size of the border
+    [[nodiscard]] size_type getBorderSize() const noexcept;
+    //! \return the number of sub-diagonals of the banded part
+    [[nodiscard]] size_type getNumberOfSubDiagonals() const noexcept;
+    //! \return the number of super-diagonals of the banded part
+    [[nodiscard]] size_type getNumberOfSuperDiagonals() const noexcept;
+    /*!
+     * \return if the given term is stored
+     * \param[in] i: row index
+     * \param[in] j: column index
+     */
+    [[nodiscard]] bool isStored(const size_type,
+                                const size_type) const noexcept;
+    /*!
+     * \return the given term
+     * \param[in] i: row index
+     * \param[in] j: column index
+     * \pre the term must be stored
+     */
+    ValueType& operator()(const size_type, const size_type) noexcept;
+    /*!
+     * \return the given term
+     * \param[in] i: row index
+     * \param[in] j: column index
+     * \pre the term must be stored
+     */
+    const ValueType& operator()(const size_type,
+                                const size_type) const noexcept;
+
+   private:
+    //! \brief the `BorderedBandedLUSolve` class computes the decomposition
+    friend struct BorderedBandedLUSolve;
+    //! \return the leading dimension of the storage of the banded part
+    [[nodiscard]] size_type getLeadingDimension() const noexcept;
+    /*!
+     * \return the given term of the banded part
+     * \param[in] i: row index
+     * \param[in] j: column index
+     * \pre `j` must be lower than `i + kl + ku` and `i` must be lower
+     * than `j + kl`.
+     */
+    ValueType& band(const size_type, const size_type) noexcept;
+    /*!
+     * \return the given term of the banded part
+     * \param[in] i: row index
+     * \param[in] j: column index
+     * \pre `j` must be lower than `i + kl + ku` and `i` must be lower
+     * than `j + kl`.
+     */
+    const ValueType& band(const size_type, const size_type) const noexcept;
+    //! \brief size of the banded part
+    size_type n = 0;
+    //! \brief number of sub-diagonals of the banded part
+    size_type kl = 0;
+    //! \brief number of super-diagonals of the banded part
+    size_type ku = 0;
+    //! \brief size of the border
+    size_type m = 0;
+    //! \brief terms of the banded part
+    std::vector<ValueType> A;
+    //! \brief terms of upper right part, stored column by column
+    std::vector<ValueType> B;
+    //! \brief terms of lower left part, stored row by row
+    std::vector<ValueType> C;
+    //! \brief terms of the border
+    matrix<ValueType> D;
+    //! \brief row permutations of the banded part
+    std::vector<size_type> pivots;
+    //! \brief permutation associated with the border
+    Permutation<size_type> p;
+  };  // end of struct BorderedBandedMatrix
+
+}  // end of namespace tfel::math
+
+#include "TFEL/Math/LU/BorderedBandedMatrix.ixx"
+
+#endif /* LIB_TFEL_MATH_LU_BORDEREDBANDEDMATRIX_HXX */
@@ -0,0 +1,175 @@
+/*!
+ * \file   include/TFEL/Math/LU/BorderedBandedMatrix.ixx
+ * \brief  This file implements the `BorderedBandedMatrix` class.
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright Copyright (C) 2006-2025 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_LU_BORDEREDBANDEDMATRIX_IXX
+#define LIB_TFEL_MATH_LU_BORDEREDBANDEDMATRIX_IXX
+
+#include <algorithm>
+
+namespace tfel::math {
+
+  template <typename ValueType>
+  BorderedBandedMatrix<ValueType>::BorderedBandedMatrix(const size_type s,
+                                                        const size_type l,
+                                                        const size_type u,
+                                                        const size_type b) {
+    this->resize(s, l, u, b);
+  }  // end of BorderedBandedMatrix
+
+  template <typename ValueType>
+  void BorderedBandedMatrix<ValueType>::resize(const size_type s,
+                                               const size_type l,
+                                               const size_type u,
+                                               const size_type b) {
+    this->n = s;
+    this->kl = l;
+    this->ku = u;
+    this->m = b;
+    this->A.assign(this->getLeadingDimension() * s, ValueType(0));
+    this->B.assign(s * b, ValueType(0));
+    this->C.assign(b * s, ValueType(0));
+    this->D.resize(b, b, ValueType(0));
+    std::fill(this->D.begin(), this->D.end(), ValueType(0));
+    this->pivots.resize(s);
+    this->p.resize(b);
+  }  // end of resize
+
+  template <typename ValueType>
+  void BorderedBandedMatrix<ValueType>::zero() {
+    std::fill(this->A.begin(), this->A.end(), ValueType(0));
+    std::fill(this->B.begin(), this->B.end(), ValueType(0));
+    std::fill(this->C.begin(), this->C.end(), ValueType(0));
+    std::fill(this->D.begin(), this->D.end(), ValueType(0));
+  }  // end of zero
+
+  template <typename ValueType>
+  template <typename MatrixType>
+  void BorderedBandedMatrix<ValueType>::import(const MatrixType& k) {
+    // the fill-in rows must be cleared
+    this->zero();
+    for (size_type i = 0; i != this->n; ++i) {
+      const auto jb = (i > this->kl) ? i - this->kl : size_type(0);
+      const auto je = std::min(i + this->ku + 1, this->n);
+      for (size_type j = jb; j != je; ++j) {
+        this->band(i, j) = k(i, j);
+      }
+    }
+    for (size_type i = 0; i != this->m; ++i) {
+      for (size_type j = 0; j != this->n; ++j) {
+        this->B[j + this->n * i] = k(j, this->n + i);
+        this->C[j + this->n * i] = k(this->n + i, j);
+      }
+      for (size_type j = 0; j != this->m; ++j) {
+        this->D(i, j) = k(this->n + i, this->n + j);
+      }
+    }
+  }  // end of import
+
+  template <typename ValueType>
+  typename BorderedBandedMatrix<ValueType>::size_type
+  BorderedBandedMatrix<ValueType>::getNbRows() const noexcept {
+    return this->n + this->m;
+  }  // end of getNbRows
+
+  template <typename ValueType>
+  typename BorderedBandedMatrix<ValueType>::size_type
+  BorderedBandedMatrix<ValueType>::getNbCols() const noexcept {
+    return this->n + this->m;
+  }  // end of getNbCols
+
+  template <typename ValueType>
+  typename BorderedBandedMatrix<ValueType>::size_type
+  BorderedBandedMatrix<ValueType>::getBandSize() const noexcept {
+    return this->n;
+  }  // end of getBandSize
+
+  template <typename ValueType>
+  typename BorderedBandedMatrix<ValueType>::size_type
+  BorderedBandedMatrix<ValueType>::getBorderSize() const noexcept {
+    return this->m;
+  }  // end of getBorderSize
+
+  template <typename ValueType>
+  typename BorderedBandedMatrix<ValueType>::size_type
+  BorderedBandedMatrix<ValueType>::getNumberOfSubDiagonals() const noexcept {
+    return this->kl;
+  }  // end of getNumberOfSubDiagonals
+
+  template <typename ValueType>
+  typename BorderedBandedMatrix<ValueType>::size_type
+  BorderedBandedMatrix<ValueType>::getNumberOfSuperDiagonals() const noexcept {
+    return this->ku;
+  }  // end of getNumberOfSuperDiagonals
+
+  template <typename ValueType>
+  typename BorderedBandedMatrix<ValueType>::size_type
+  BorderedBandedMatrix<ValueType>::getLeadingDimension() const noexcept {
+    return 2 * this->kl + this->ku + 1;
+  }  // end of getLeadingDimension
+
+  template <typename ValueType>
+  bool BorderedBandedMatrix<ValueType>::isStored(
+      const size_type i, const size_type j) const noexcept {
+    if ((i >= this->n) || (j >= this->n)) {
+      return (i < this->n + this->m) && (j < this->n + this->m);
+    }
+    return (i <= j + this->kl) && (j <= i + this->ku);
+  }  // end of isStored
+
+  template <typename ValueType>
+  ValueType& BorderedBandedMatrix<ValueType>::band(const size_type i,
+                                                   const size_type j) noexcept {
+    const auto kv = this->kl + this->ku;
+    return this->A[kv + i - j + j * this->getLeadingDimension()];
+  }  // end of band
+
+  template <typename ValueType>
+  const ValueType& BorderedBandedMatrix<ValueType>::band(
+      const size_type i, const size_type j) const noexcept {
+    const auto kv = this->kl + this->ku;
+    return this->A[kv + i - j + j * this->getLeadingDimension()];
+  }  // end of band
+
+  template <typename ValueType>
+  ValueType& BorderedBandedMatrix<ValueType>::operator()(
+      const size_type i, const size_type j) noexcept {
+    if (i < this->n) {
+      if (j < this->n) {
+        return this->band(i, j);
+      }
+      return this->B[i + this->n * (j - this->n)];
+    }
+    if (j < this->n) {
+      return this->C[j + this->n * (i - this->n)];
+    }
+    return this->D(i - this->n, j - this->n);
+  }  // end of operator()
+
+  template <typename ValueType>
+  const ValueType& BorderedBandedMatrix<ValueType>::operator()(
+      const size_type i, const size_type j) const noexcept {
+    if (i < this->n) {
+      if (j < this->n) {
+        return this->band(i, j);
+      }
+      return this->B[i + this->n * (j - this->n)];
+    }
+    if (j < this->n) {
+      return this->C[j + this->n * (i - this->n)];
+    }
+    return this->D(i - this->n, j - this->n);
+  }  // end of operator()
+
+}  // end of namespace tfel::math
+
+#endif /* LIB_TFEL_MATH_LU_BORDEREDBANDEDMATRIX_IXX */
@@ -0,0 +1,114 @@
+/*!
+ * \file  include/TFEL/Math/LocalKriging.hxx
+ * \brief This file declares the `LocalKriging` class.
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright Copyright (C) 2006-2025 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_LOCALKRIGING_HXX
+#define LIB_TFEL_MATH_LOCALKRIGING_HXX
+
+#include <span>
+#include <array>
+#include <vector>
+#include <memory>
+#include "TFEL/Math/vector.hxx"
+#include "TFEL/Math/Kriging.hxx"
+
+namespace tfel::math {
+
+  /*!
+   * \brief an interpolation by kriging suitable for large data sets.
+   *
+   * The bounding box of the samples is divided in a regular grid of cells. A
+   * local interpolation is built for each cell using the samples located in
+   * the cell and in the neighbouring cells: rings of cells are added until
+   * the number of samples exceeds the number of neighbours specified by the
+   * `setNumberOfNeighbours` method.
+   *
+   * The cost of building the interpolation is thus linear in the number of
+   * samples, instead of cubic, and the cost of an evaluation only depends on
+   * the number of neighbours.
+   *
+   * \note the interpolation is only continuous inside each cell: small jumps
+   * may occur at the boundaries of the cells.
+   * \note the nugget model must not depend on the index of the sample.
+   */
+  template <unsigned short N,
+            typename T = double,
+            typename Model = KrigingDefaultModel<N, T>>
+  struct TFEL_VISIBILITY_LOCAL LocalKriging : public Model {
+    //! \brief a simple alias
+    using Variable = typename KrigingVariable<N, T>::type;
+    //! \brief a simple alias
+    using size_type = typename tfel::math::vector<T>::size_type;
+    //! \brief default number of neighbours
+    static constexpr size_type defaultNumberOfNeighbours = 64;
+
+    LocalKriging() = default;
+    LocalKriging(const LocalKriging&) = delete;
+    LocalKriging& operator=(const LocalKriging&) = delete;
+    /*!
+     * \brief add a new sample
+     * \param[in] xv: position
+     * \param[in] fv: value
+     */
+    void addValue(const Variable&, const T&);
+    /*!
+     * \brief set the minimal number of samples used to build the local
+     * interpolations
+     * \param[in] n: number of neighbours
+     */
+    void setNumberOfNeighbours(const size_type);
+    //! \brief build the local interpolations
+    void buildInterpolation();
+    //! \return the value of the interpolation at the given point
+    [[nodiscard]] T operator()(const Variable&) const;
+    /*!
+     * \brief evaluate the interpolation on many points
+     * \param[out] r: values
+     * \param[in] xv: points
+     */
+    void getValues(std::span<T>, std::span<const Variable>) const;
+    //! \return the number of cells
+    [[nodiscard]] size_type getNumberOfCells() const;
+
+    ~LocalKriging() noexcept;
+
+   private:
+    //! \return the index of the cell, per direction, containing a point
+    [[nodiscard]] std::array<size_type, N> getCellCoordinates(
+        const Variable&) const;
+    //! \return the index of a cell from its coordinates
+    [[nodiscard]] size_type getCellIndex(
+        const std::array<size_type, N>&) const;
+    //! \return the d-th component of a point
+    [[nodiscard]] static T getComponent(const Variable&,
+                                        const unsigned short);
+    //! \brief positions of the samples
+    tfel::math::vector<Variable> x;
+    //! \brief values of the samples
+    tfel::math::vector<T> f;
+    //! \brief local interpolations
+    std::vector<std::unique_ptr<Kriging<N, T, Model>>> interpolations;
+    //! \brief lower corner of the bounding box of the samples
+    std::array<T, N> xmin = {};
+    //! \brief size of the cells
+    std::array<T, N> h = {};
+    //! \brief number of cells in each direction
+    size_type nc = 0;
+    //! \brief minimal number of samples of the local interpolations
+    size_type nn = defaultNumberOfNeighbours;
+  };  // end of struct LocalKriging
+
+}  // end of namespace tfel::math
+
+#include "TFEL/Math/Kriging/LocalKriging.ixx"
+
+#endif /* LIB_TFEL_MATH_LOCALKRIGING_HXX */
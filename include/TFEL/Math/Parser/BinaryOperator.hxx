@@ -18,10 +18,13 @@
 #include "TFEL/Config/TFELConfig.hxx"
 #include <memory>
 #include "TFEL/Math/Parser/Expr.hxx"
+#include "TFEL/Math/Parser/Bytecode.hxx"
 
 namespace tfel::math::parser {
 
   struct OpPlus {
+    //! \brief operation code used by the bytecode compiler
+    static constexpr auto opcode = Bytecode::ADDITION;
     /*!
      * \param[in] a: lhs
      * \param[in] b: rhs
@@ -36,6 +39,8 @@ namespace tfel::math::parser {
   };  // end of struct OpPlus
 
   struct OpMinus {
+    //! \brief operation code used by the bytecode compiler
+    static constexpr auto opcode = Bytecode::SUBTRACTION;
     /*!
      * \param[in] a: lhs
      * \param[in] b: rhs
@@ -50,6 +55,8 @@ namespace tfel::math::parser {
   };  // end of struct OpMinus
 
   struct OpMult {
+    //! \brief operation code used by the bytecode compiler
+    static constexpr auto opcode = Bytecode::MULTIPLICATION;
     /*!
      * \param[in] a: lhs
      * \param[in] b: rhs
@@ -64,6 +71,8 @@ namespace tfel::math::parser {
   };  // end of struct OpMult
 
   struct OpDiv {
+    //! \brief operation code used by the bytecode compiler
+    static constexpr auto opcode = Bytecode::DIVISION;
     /*!
      * \param[in] a: lhs
      * \param[in] b: rhs
@@ -78,6 +87,8 @@ namespace tfel::math::parser {
   };  // end of struct OpDiv
 
   struct OpPower {
+    //! \brief operation code used by the bytecode compiler
+    static constexpr auto opcode = Bytecode::POWER;
     /*!
      * \param[in] a: lhs
      * \param[in] b: rhs
@@ -107,6 +118,8 @@ namespace tfel::math::parser {
     //
     [[nodiscard]] bool isConstant() const override;
     [[nodiscard]] double getValue() const final;
+    [[nodiscard]] std::vector<double>::size_type compile(
+        BytecodeCompiler&) const override;
     [[nodiscard]] bool dependsOnVariable(
         const std::vector<double>::size_type) const override;
     [[nodiscard]] std::string getCxxFormula(
@@ -38,6 +38,14 @@ namespace tfel::math::parser {
     return Op::apply(this->a->getValue(), this->b->getValue());
   }  // end of getValue
 
+  template <typename Op>
+  std::vector<double>::size_type BinaryOperation<Op>::compile(
+      BytecodeCompiler& c) const {
+    const auto ra = this->a->compile(c);
+    const auto rb = this->b->compile(c);
+    return c.addOperation(Op::opcode, ra, rb);
+  }  // end of compile
+
   template <typename Op>
   std::string BinaryOperation<Op>::getCxxFormula(
       const std::vector<std::string>& m) const {
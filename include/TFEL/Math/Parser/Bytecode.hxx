@@ -0,0 +1,350 @@
+/*!
+ * \file   include/TFEL/Math/Parser/Bytecode.hxx
+ * \brief  This file declares the `Bytecode` and `BytecodeCompiler` classes.
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright Copyright (C) 2006-2025 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_PARSER_BYTECODE_HXX
+#define LIB_TFEL_MATH_PARSER_BYTECODE_HXX
+
+#include <map>
+#include <vector>
+#include <cstdint>
+#include "TFEL/Config/TFELConfig.hxx"
+
+namespace tfel::math::parser {
+
+  // forward declaration
+  struct Expr;
+  // forward declaration
+  struct LogicalExpr;
+  // forward declaration
+  struct BytecodeCompiler;
+  // forward declaration
+  struct ExternalFunctionExpr;
+
+  /*!
+   * \brief a flat representation of an expression, made of a sequence of
+   * instructions operating on registers.
+   *
+   * The registers are organised as follows:
+   *
+   * - the first registers hold the values of the variables,
+   * - the following registers hold the constants appearing in the
+   *   expression, after constant folding,
+   * - the last registers hold the results of the intermediate computations.
+   *
+   * Apart from the results of conditional expressions, each register is
+   * assigned once, which allows to share common sub-expressions.
+   *
+   * Calls to external functions are evaluated through the
+   * `ExternalFunction` interface: the vectorised evaluation relies on the
+   * `getValues` method, which allows external functions, such as kriged
+   * functions, to treat many points at once. Other sub-expressions which
+   * can't be compiled are evaluated by calling their `getValue` method.
+   */
+  struct TFELMATHPARSER_VISIBILITY_EXPORT Bytecode {
+    //! \brief a simple alias
+    using size_type = std::vector<double>::size_type;
+    //! \brief a simple alias
+    using UnaryFunctionPtr = double (*)(double);
+    //! \brief a simple alias
+    using BinaryFunctionPtr = double (*)(double, double);
+    //! \brief a simple alias
+    using ComparisonOperatorPtr = bool (*)(double, double);
+    //! \brief a simple alias
+    using LogicalOperatorPtr = bool (*)(bool, bool);
+    //! \brief list of supported operations
+    enum OpCode : std::uint8_t {
+      COPY,
+      NEGATION,
+      ADDITION,
+      SUBTRACTION,
+      MULTIPLICATION,
+      DIVISION,
+      POWER,
+      UNARYFUNCTION,
+      UNARYOPERATION,
+      BINARYFUNCTION,
+      COMPARISON,
+      LOGICALOPERATION,
+      LOGICALNEGATION,
+      JUMP,
+      JUMPIFFALSE,
+      EXPRESSION,
+      LOGICALEXPRESSION,
+      EXTERNALFUNCTION
+    };  // end of enum OpCode
+    //! \brief an elementary instruction
+    struct Instruction {
+      //! \brief operation
+      OpCode opcode;
+      /*!
+       * \brief destination register. For jumps, index of the next
+       * instruction to be executed.
+       */
+      size_type r = 0;
+      /*!
+       * \brief register holding the first operand. For calls to external
+       * functions, position of the first argument in the list of arguments.
+       */
+      size_type a = 0;
+      /*!
+       * \brief register holding the second operand. For calls to external
+       * functions, number of arguments.
+       */
+      size_type b = 0;
+      //! \brief function, operator or expression associated with the
+      //! instruction, if any
+      union {
+        UnaryFunctionPtr f1 = nullptr;
+        BinaryFunctionPtr f2;
+        ComparisonOperatorPtr c;
+        LogicalOperatorPtr l;
+        const Expr* e;
+        const LogicalExpr* le;
+        const ExternalFunctionExpr* ef;
+      };
+    };  // end of struct Instruction
+    //! \brief number of points treated at once by the vectorised evaluation
+    static constexpr size_type chunk_size = 64;
+    /*!
+     * \return the value of the expression
+     * \param[in] v: values of the variables
+     */
+    [[nodiscard]] double execute(const double* const) const;
+    /*!
+     * \return if the bytecode can be evaluated on many points at once, i.e.
+     * if it does not contain any jump nor any sub-expression which could not
+     * be compiled.
+     */
+    [[nodiscard]] bool isVectorizable() const noexcept;
+    /*!
+     * \brief evaluate the expression for many values of the variables.
+     * \param[out] r: results
+     * \param[in] v: values of the variables. `v[i]` points to the `n`
+     * values of the `i`-th variable.
+     * \param[in] n: number of evaluations
+     * \pre the bytecode must be vectorizable
+     */
+    void execute(double* const, const double* const* const, const size_type)
+        const;
+    //! \return the number of instructions
+    [[nodiscard]] size_type getNumberOfInstructions() const noexcept;
+    //! \return the number of registers
+    [[nodiscard]] size_type getNumberOfRegisters() const noexcept;
+
+   private:
+    //! \brief the compiler builds the bytecode
+    friend struct BytecodeCompiler;
+    //! \brief instructions
+    std::vector<Instruction> instructions;
+    //! \brief values of the constants
+    std::vector<double> constants;
+    //! \brief registers holding the arguments of the external functions
+    std::vector<size_type> arguments;
+    //! \brief number of variables
+    size_type number_of_variables = 0;
+    //! \brief number of registers
+    size_type number_of_registers = 0;
+    //! \brief register holding the result
+    size_type output = 0;
+    //! \brief boolean stating if the bytecode is vectorizable
+    bool vectorizable = true;
+  };  // end of struct Bytecode
+
+  /*!
+   * \brief class in charge of building the bytecode associated with an
+   * expression.
+   *
+   * The compiler performs constant folding and common sub-expression
+   * elimination. The expressions are compiled by calling their `compile`
+   * method.
+   */
+  struct TFELMATHPARSER_VISIBILITY_EXPORT BytecodeCompiler {
+    //! \brief a simple alias
+    using size_type = Bytecode::size_type;
+    //! \brief a simple alias
+    using OpCode = Bytecode::OpCode;
+    /*!
+     * \brief constructor
+     * \param[in] n: number of variables
+     */
+    explicit BytecodeCompiler(const size_type);
+    //! \brief move constructor
+    BytecodeCompiler(BytecodeCompiler&&) = delete;
+    //! \brief copy constructor
+    BytecodeCompiler(const BytecodeCompiler&) = delete;
+    //! \brief move assignement
+    BytecodeCompiler& operator=(BytecodeCompiler&&) = delete;
+    //! \brief standard assignement
+    BytecodeCompiler& operator=(const BytecodeCompiler&) = delete;
+    /*!
+     * \return the register associated with a variable
+     * \param[in] p: position of the variable
+     */
+    [[nodiscard]] size_type getVariableRegister(const size_type) const;
+    /*!
+     * \return the register associated with a constant
+     * \param[in] v: value
+     */
+    [[nodiscard]] size_type addConstant(const double);
+    /*!
+     * \return if the given register holds a constant
+     * \param[in] r: register
+     */
+    [[nodiscard]] bool isConstant(const size_type) const;
+    /*!
+     * \return the value of the constant hold by the given register
+     * \param[in] r: register
+     */
+    [[nodiscard]] double getConstantValue(const size_type) const;
+    /*!
+     * \return the register holding the opposite of the given register
+     * \param[in] a: operand
+     */
+    [[nodiscard]] size_type addNegation(const size_type);
+    /*!
+     * \return the register holding the result of an arithmetic operation
+     * \param[in] op: operation. Must be `ADDITION`, `SUBTRACTION`,
+     * `MULTIPLICATION`, `DIVISION` or `POWER`.
+     * \param[in] a: first operand
+     * \param[in] b: second operand
+     */
+    [[nodiscard]] size_type addOperation(const OpCode,
+                                         const size_type,
+                                         const size_type);
+    /*!
+     * \return the register holding the result of the call to a function
+     * \param[in] f: function
+     * \param[in] a: argument
+     */
+    [[nodiscard]] size_type addUnaryFunction(const Bytecode::UnaryFunctionPtr,
+                                             const size_type);
+    /*!
+     * \return the register holding the result of the call to a function
+     * which reports errors by throwing exceptions rather than by setting
+     * `errno`.
+     * \param[in] f: function
+     * \param[in] a: argument
+     */
+    [[nodiscard]] size_type addUnaryOperation(
+        const Bytecode::UnaryFunctionPtr, const size_type);
+    /*!
+     * \return the register holding the result of the call to a function
+     * \param[in] f: function
+     * \param[in] a: first argument
+     * \param[in] b: second argument
+     */
+    [[nodiscard]] size_type addBinaryFunction(
+        const Bytecode::BinaryFunctionPtr, const size_type, const size_type);
+    /*!
+     * \return the register holding the result of a comparison
+     * \param[in] op: comparison operator
+     * \param[in] a: first operand
+     * \param[in] b: second operand
+     */
+    [[nodiscard]] size_type addComparison(
+        const Bytecode::ComparisonOperatorPtr,
+        const size_type,
+        const size_type);
+    /*!
+     * \return the register holding the result of a logical operation
+     * \param[in] op: logical operator
+     * \param[in] a: first operand
+     * \param[in] b: second operand
+     */
+    [[nodiscard]] size_type addLogicalOperation(
+        const Bytecode::LogicalOperatorPtr, const size_type, const size_type);
+    /*!
+     * \return the register holding the negation of a logical value
+     * \param[in] a: operand
+     */
+    [[nodiscard]] size_type addLogicalNegation(const size_type);
+    /*!
+     * \return the register holding the value of a conditional expression.
+     * Only the selected expression is evaluated.
+     * \param[in] c: register holding the condition
+     * \param[in] a: expression evaluated if the condition is true
+     * \param[in] b: expression evaluated if the condition is false
+     */
+    [[nodiscard]] size_type addConditionalExpression(const size_type,
+                                                     const Expr&,
+                                                     const Expr&);
+    /*!
+     * \return the register holding the value of an expression which can't
+     * be compiled. This expression is evaluated by calling its `getValue`
+     * method.
+     * \param[in] e: expression
+     */
+    [[nodiscard]] size_type addExpression(const Expr&);
+    /*!
+     * \return the register holding the value of a logical expression which
+     * can't be compiled. This expression is evaluated by calling its
+     * `getValue` method.
+     * \param[in] e: logical expression
+     */
+    [[nodiscard]] size_type addLogicalExpression(const LogicalExpr&);
+    /*!
+     * \return the register holding the result of the call to an external
+     * function. Such a call is never shared nor evaluated at compile time.
+     * \param[in] f: expression calling the external function
+     * \param[in] args: registers holding the arguments
+     */
+    [[nodiscard]] size_type addExternalFunction(
+        const ExternalFunctionExpr&, const std::vector<size_type>&);
+    /*!
+     * \return the bytecode
+     * \param[in] r: register holding the result
+     */
+    [[nodiscard]] Bytecode getBytecode(const size_type) const;
+    //! \brief destructor
+    ~BytecodeCompiler();
+
+   private:
+    /*!
+     * \brief add a new instruction, unless an equivalent instruction is
+     * available or unless the instruction can be evaluated at compile time.
+     * \return the register holding the result of the instruction
+     * \param[in] i: instruction
+     */
+    size_type addInstruction(Bytecode::Instruction);
+    //! \brief instructions
+    std::vector<Bytecode::Instruction> instructions;
+    //! \brief registers holding the arguments of the external functions
+    std::vector<size_type> arguments;
+    /*!
+     * \brief list of the instructions whose results may be reused, i.e.
+     * instructions which are not part of a closed conditional branch.
+     */
+    std::vector<size_type> available_instructions;
+    //! \brief registers associated with the constants, indexed by their bits
+    std::map<std::uint64_t, size_type> constants_registers;
+    //! \brief values of the constants, indexed by their registers
+    std::map<size_type, double> constants_values;
+    //! \brief number of variables
+    const size_type number_of_variables;
+    //! \brief number of registers
+    size_type number_of_registers;
+    //! \brief boolean stating if the bytecode is vectorizable
+    bool vectorizable = true;
+  };  // end of struct BytecodeCompiler
+
+  /*!
+   * \return the bytecode associated with the given expression
+   * \param[in] e: expression
+   * \param[in] n: number of variables
+   */
+  TFELMATHPARSER_VISIBILITY_EXPORT Bytecode compile(const Expr&,
+                                                    const Bytecode::size_type);
+
+}  // end of namespace tfel::math::parser
+
+#endif /* LIB_TFEL_MATH_PARSER_BYTECODE_HXX */
@@ -34,6 +34,8 @@ namespace tfel::math::parser {
     [[nodiscard]] bool dependsOnVariable(
         const std::vector<double>::size_type) const override;
     [[nodiscard]] double getValue() const override;
+    [[nodiscard]] std::vector<double>::size_type compile(
+        BytecodeCompiler&) const override;
     [[nodiscard]] std::string getCxxFormula(
         const std::vector<std::string>&) const override;
 
@@ -23,6 +23,9 @@
 
 namespace tfel::math::parser {
 
+  // forward declaration
+  struct BytecodeCompiler;
+
   /*!
    * \brief base class resulting from the analysis of a formula.
    */
@@ -38,6 +41,16 @@ namespace tfel::math::parser {
     [[nodiscard]] virtual bool isConstant() const = 0;
     //! \return the result of the evaluation of the expression
     [[nodiscard]] virtual double getValue() const = 0;
+    /*!
+     * \brief add the instructions needed to evaluate the expression
+     * \return the register holding the result of the expression
+     * \param[in] c: bytecode compiler
+     *
+     * \note the default implementation evaluates the expression by calling
+     * the `getValue` method.
+     */
+    [[nodiscard]] virtual std::vector<double>::size_type compile(
+        BytecodeCompiler&) const;
     //! \brief check if the expression does not lead to a cyclic dependency
     virtual void checkCyclicDependency(std::vector<std::string>&) const = 0;
     [[nodiscard]] virtual std::shared_ptr<Expr> resolveDependencies(
@@ -17,6 +17,7 @@
 
 #include <set>
 #include <map>
+#include <span>
 #include <vector>
 #include <string>
 #include <memory>
@@ -31,6 +32,17 @@ namespace tfel::math::parser {
                                   const double) = 0;
     [[nodiscard]] virtual std::vector<double>::size_type getNumberOfVariables()
         const = 0;
+    /*!
+     * \brief evaluate the function on many points
+     * \param[out] r: values
+     * \param[in] v: values of the variables. `v[i]` contains the values of
+     * the `i`-th variable.
+     *
+     * \note the default implementation calls the `setVariableValue` and
+     * `getValue` methods for each point.
+     */
+    virtual void getValues(std::span<double>,
+                           const std::vector<std::span<const double>>&);
     virtual void checkCyclicDependency(const std::string&) const = 0;
     virtual void checkCyclicDependency(std::vector<std::string>&) const = 0;
     [[nodiscard]] virtual std::shared_ptr<ExternalFunction> differentiate(
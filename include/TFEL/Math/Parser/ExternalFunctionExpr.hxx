@@ -33,6 +33,13 @@ namespace tfel::math::parser {
     bool isConstant() const override;
     bool dependsOnVariable(const std::vector<double>::size_type) const override;
     double getValue() const override;
+    std::vector<double>::size_type compile(BytecodeCompiler&) const override;
+    /*!
+     * \return the called function
+     * \note an exception is thrown if the function is not declared or if the
+     * number of arguments does not match its number of variables
+     */
+    ExternalFunction& getExternalFunction() const;
     std::string getCxxFormula(const std::vector<std::string>&) const override;
     void checkCyclicDependency(std::vector<std::string>&) const override;
     std::shared_ptr<Expr> differentiate(
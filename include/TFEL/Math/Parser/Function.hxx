@@ -77,6 +77,8 @@ namespace tfel::math::parser {
     StandardFunction& operator=(StandardFunction&&) = delete;
     //
     [[nodiscard]] double getValue() const override;
+    [[nodiscard]] std::vector<double>::size_type compile(
+        BytecodeCompiler&) const override;
     [[nodiscard]] std::string getCxxFormula(
         const std::vector<std::string>&) const override;
     [[nodiscard]] std::shared_ptr<Expr> resolveDependencies(
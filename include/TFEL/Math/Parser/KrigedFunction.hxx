@@ -15,9 +15,9 @@
 #ifndef LIB_TFEL_MATH_PARSER_KRIGEDFUNCTION_HXX
 #define LIB_TFEL_MATH_PARSER_KRIGEDFUNCTION_HXX
 
+#include <span>
 #include <vector>
 #include <string>
-#include <vector>
 #include <utility>
 #include <memory>
 
@@ -34,6 +34,15 @@ namespace tfel::math::parser {
     [[noreturn]] static void throwInvalidIndexException(
         const std::vector<double>::size_type i, const unsigned short N);
     [[noreturn]] static void throwUnimplementedDifferentiateFunctionException();
+    /*!
+     * \brief check the arguments of the `getValues` method
+     * \param[in] r: values
+     * \param[in] v: values of the variables
+     * \param[in] N: number of variables
+     */
+    static void checkValues(std::span<double>,
+                            const std::vector<std::span<const double>>&,
+                            const unsigned short);
   };  // end of KrigedFunctionBase
 
   template <unsigned short N>
@@ -51,6 +60,8 @@ namespace tfel::math::parser {
 
     //
     [[nodiscard]] double getValue() const override;
+    void getValues(std::span<double>,
+                   const std::vector<std::span<const double>>&) override;
     void setVariableValue(const std::vector<double>::size_type,
                           const double) override;
     [[nodiscard]] std::vector<double>::size_type getNumberOfVariables()
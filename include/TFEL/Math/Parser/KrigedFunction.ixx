@@ -40,6 +40,23 @@ namespace tfel::math::parser {
     return this->k->operator()(this->v);
   }  // end of KrigedFunction<N>::getValue()
 
+  template <unsigned short N>
+  void KrigedFunction<N>::getValues(
+      std::span<double> r, const std::vector<std::span<const double>>& values) {
+    KrigedFunctionBase::checkValues(r, values, N);
+    if constexpr (N == 1) {
+      this->k->getValues(r, values[0]);
+    } else {
+      auto xv = std::vector<Variable>(r.size());
+      for (decltype(r.size()) i = 0; i != r.size(); ++i) {
+        for (unsigned short j = 0; j != N; ++j) {
+          xv[i](j) = values[j][i];
+        }
+      }
+      this->k->getValues(r, std::span<const Variable>(xv));
+    }
+  }  // end of KrigedFunction<N>::getValues
+
   template <unsigned short N>
   void KrigedFunction<N>::setVariableValue(
       const std::vector<double>::size_type i_, const double v_) {
@@ -115,6 +115,16 @@ namespace tfel::math::parser {
   struct LogicalExpr {
     //! \return the result of the evaluation of the logical expression
     [[nodiscard]] virtual bool getValue() const = 0;
+    /*!
+     * \brief add the instructions needed to evaluate the logical expression
+     * \return the register holding the result of the logical expression
+     * \param[in] c: bytecode compiler
+     *
+     * \note the default implementation evaluates the logical expression by
+     * calling the `getValue` method.
+     */
+    [[nodiscard]] virtual std::vector<double>::size_type compile(
+        BytecodeCompiler&) const;
     //! \brief return if the expression is constant
     [[nodiscard]] virtual bool isConstant() const = 0;
     /*!
@@ -159,6 +169,8 @@ namespace tfel::math::parser {
     [[nodiscard]] bool dependsOnVariable(
         const std::vector<double>::size_type) const override;
     [[nodiscard]] bool getValue() const override;
+    [[nodiscard]] std::vector<double>::size_type compile(
+        BytecodeCompiler&) const override;
     [[nodiscard]] std::string getCxxFormula(
         const std::vector<std::string>&) const override;
     void checkCyclicDependency(std::vector<std::string>&) const override;
@@ -192,6 +204,8 @@ namespace tfel::math::parser {
     [[nodiscard]] bool dependsOnVariable(
         const std::vector<double>::size_type) const override;
     [[nodiscard]] bool getValue() const override;
+    [[nodiscard]] std::vector<double>::size_type compile(
+        BytecodeCompiler&) const override;
     [[nodiscard]] std::string getCxxFormula(
         const std::vector<std::string>&) const override;
     void checkCyclicDependency(std::vector<std::string>&) const override;
@@ -223,6 +237,8 @@ namespace tfel::math::parser {
     [[nodiscard]] bool dependsOnVariable(
         const std::vector<double>::size_type) const override;
     [[nodiscard]] bool getValue() const override;
+    [[nodiscard]] std::vector<double>::size_type compile(
+        BytecodeCompiler&) const override;
     [[nodiscard]] std::string getCxxFormula(
         const std::vector<std::string>&) const override;
     void checkCyclicDependency(std::vector<std::string>&) const override;
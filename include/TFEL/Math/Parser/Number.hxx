@@ -56,6 +56,8 @@ namespace tfel::math::parser {
     [[nodiscard]] std::string getCxxFormula(
         const std::vector<std::string>&) const override;
     [[nodiscard]] double getValue() const override;
+    [[nodiscard]] std::vector<double>::size_type compile(
+        BytecodeCompiler&) const override;
     //! \brief destructor
     ~Number() override;
 
@@ -37,7 +37,14 @@ namespace tfel::math::parser {
     PowerFunction& operator=(const PowerFunction&) = delete;
     PowerFunction& operator=(PowerFunction&&) = delete;
     //
+    /*!
+     * \return the value of the argument to the power N
+     * \param[in] x: argument
+     */
+    [[nodiscard]] static double apply(const double);
     [[nodiscard]] double getValue() const override;
+    [[nodiscard]] std::vector<double>::size_type compile(
+        BytecodeCompiler&) const override;
     [[nodiscard]] std::string getCxxFormula(
         const std::vector<std::string>&) const override;
     [[nodiscard]] std::shared_ptr<Expr> resolveDependencies(
@@ -24,6 +24,7 @@
 #include "TFEL/Math/Parser/Number.hxx"
 #include "TFEL/Math/Parser/BinaryOperator.hxx"
 #include "TFEL/Math/Parser/Function.hxx"
+#include "TFEL/Math/Parser/Bytecode.hxx"
 
 namespace tfel::math::parser {
 
@@ -31,20 +32,37 @@ namespace tfel::math::parser {
   PowerFunction<N>::PowerFunction(const std::shared_ptr<Expr> e) noexcept
       : Function(e) {}  // end of PowerFunction
 
+  template <int N>
+  double PowerFunction<N>::apply(const double x) {
+    if constexpr (N < 0) {
+      if (tfel::math::ieee754::fpclassify(x) == FP_ZERO) {
+        FunctionBase::throwInvalidCallException(x, EINVAL);
+      }
+    }
+    return tfel::math::power<N>(x);
+  }  // end of apply
+
   template <int N>
   double PowerFunction<N>::getValue() const {
     if constexpr (N == 0) {
       return 1;
     }
-    const auto arg = this->expr->getValue();
-    if constexpr (N < 0) {
-      if (tfel::math::ieee754::fpclassify(arg) == FP_ZERO) {
-        FunctionBase::throwInvalidCallException(arg, EINVAL);
-      }
-    }
-    return tfel::math::power<N>(arg);
+    return PowerFunction<N>::apply(this->expr->getValue());
   }  // end of getValue
 
+  template <int N>
+  std::vector<double>::size_type PowerFunction<N>::compile(
+      BytecodeCompiler& c) const {
+    if constexpr (N == 0) {
+      return c.addConstant(1);
+    }
+    if constexpr (N == 1) {
+      return this->expr->compile(c);
+    }
+    return c.addUnaryOperation(&PowerFunction<N>::apply,
+                               this->expr->compile(c));
+  }  // end of compile
+
   template <int N>
   std::string PowerFunction<N>::getCxxFormula(
       const std::vector<std::string>& m) const {
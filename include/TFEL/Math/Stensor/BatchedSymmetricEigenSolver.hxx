@@ -0,0 +1,452 @@
+/*!
+ * \file   include/TFEL/Math/Stensor/BatchedSymmetricEigenSolver.hxx
+ * \brief  This file declares the `BatchedSymmetricEigenSolver` class.
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright Copyright (C) 2006-2025 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_STENSOR_BATCHEDSYMMETRICEIGENSOLVER_HXX
+#define LIB_TFEL_MATH_STENSOR_BATCHEDSYMMETRICEIGENSOLVER_HXX
+
+#include <cmath>
+#include <algorithm>
+#include <limits>
+#include <cstddef>
+#include <type_traits>
+#include "TFEL/Raise.hxx"
+#include "TFEL/Config/TFELConfig.hxx"
+#include "TFEL/Math/General/MathConstants.hxx"
+#include "TFEL/Math/tvector.hxx"
+#include "TFEL/Math/tmatrix.hxx"
+#include "TFEL/Math/stensor.hxx"
+#include "TFEL/Math/Array/StridedCoalescedViewsArray.hxx"
+
+namespace tfel::math {
+
+  /*!
+   * \brief eigen solver for batches of symmetric tensors stored as a
+   * structure of arrays, i.e. the `k`-th component of the `i`-th tensor is
+   * stored at `s[i + k * stride]`.
+   *
+   * Tensors are treated by groups of `W` tensors. The treatment of a tensor
+   * is free of data-dependent branches, so that the loop over the tensors of
+   * a group can be vectorised by the compiler.
+   *
+   * In \f$3D\f$, the eigenvalue which is the most isolated from the others
+   * is computed using the trigonometric solution of the characteristic
+   * polynomial and the associated eigenvector is computed by cross products
+   * of the rows of \f$\underline{s}-\lambda\,\underline{I}\f$. The two
+   * other eigenvalues and eigenvectors are obtained by a Jacobi rotation of
+   * the restriction of the tensor to the plane orthogonal to this first
+   * eigenvector, which is robust in case of double eigenvalues. The tensor
+   * is scaled beforehand to avoid overflows and underflows.
+   *
+   * \note the eigenvalues are not sorted.
+   * \note the eigenvectors are stored in the columns of the rotation
+   * matrices, as in `stensor::computeEigenVectors`.
+   *
+   * \tparam N: space dimension
+   * \tparam real: numeric type
+   * \tparam W: number of tensors treated by group
+   */
+  template <unsigned short N, typename real, unsigned short W = 8>
+  struct BatchedSymmetricEigenSolver {
+    static_assert((N == 1) || (N == 2) || (N == 3), "invalid space dimension");
+    static_assert(std::is_floating_point_v<real>, "invalid numeric type");
+    static_assert(W > 0, "invalid group size");
+    //! \brief number of components of the tensors
+    static constexpr unsigned short StensorSize = StensorDimeToSize<N>::value;
+    /*!
+     * \brief compute the eigenvalues of a batch of tensors
+     * \param[out] vp: eigenvalues
+     * \param[in] vp_stride: stride of the eigenvalues
+     * \param[in] s: tensors
+     * \param[in] s_stride: stride of the tensors
+     * \param[in] n: number of tensors
+     */
+    static void computeEigenValues(real* const vp,
+                                   const std::size_t vp_stride,
+                                   const real* const s,
+                                   const std::size_t s_stride,
+                                   const std::size_t n) noexcept {
+      const auto ng = n / W;
+      for (std::size_t g = 0; g != ng; ++g) {
+        BatchedSymmetricEigenSolver::treatGroup<W, false>(
+            vp, vp_stride, nullptr, 0, s, s_stride, g * W);
+      }
+      for (auto i = ng * W; i != n; ++i) {
+        BatchedSymmetricEigenSolver::treatGroup<1, false>(
+            vp, vp_stride, nullptr, 0, s, s_stride, i);
+      }
+    }  // end of computeEigenValues
+    /*!
+     * \brief compute the eigenvalues and the eigenvectors of a batch of
+     * tensors
+     * \param[out] vp: eigenvalues
+     * \param[in] vp_stride: stride of the eigenvalues
+     * \param[out] m: rotation matrices, whose columns are the eigenvectors
+     * \param[in] m_stride: stride of the rotation matrices
+     * \param[in] s: tensors
+     * \param[in] s_stride: stride of the tensors
+     * \param[in] n: number of tensors
+     */
+    static void computeEigenVectors(real* const vp,
+                                    const std::size_t vp_stride,
+                                    real* const m,
+                                    const std::size_t m_stride,
+                                    const real* const s,
+                                    const std::size_t s_stride,
+                                    const std::size_t n) noexcept {
+      const auto ng = n / W;
+      for (std::size_t g = 0; g != ng; ++g) {
+        BatchedSymmetricEigenSolver::treatGroup<W, true>(
+            vp, vp_stride, m, m_stride, s, s_stride, g * W);
+      }
+      for (auto i = ng * W; i != n; ++i) {
+        BatchedSymmetricEigenSolver::treatGroup<1, true>(
+            vp, vp_stride, m, m_stride, s, s_stride, i);
+      }
+    }  // end of computeEigenVectors
+    /*!
+     * \brief compute the eigenvalues of a tensor
+     * \param[out] vp: eigenvalues
+     * \param[in] s: components of the tensor
+     */
+    TFEL_HOST_DEVICE static void computeEigenValues(
+        real* const vp, const real* const s) noexcept {
+      real m[9];
+      BatchedSymmetricEigenSolver::computeEigenVectors(vp, m, s);
+    }  // end of computeEigenValues
+    /*!
+     * \brief compute the eigenvalues and the eigenvectors of a tensor
+     * \param[out] vp: eigenvalues
+     * \param[out] m: rotation matrix (row-major storage) whose columns are
+     * the eigenvectors
+     * \param[in] s: components of the tensor
+     */
+    TFEL_HOST_DEVICE static void computeEigenVectors(
+        real* const vp, real* const m, const real* const s) noexcept {
+      real sl[StensorSize][1];
+      real vpl[3][1];
+      real ml[9][1];
+      for (unsigned short k = 0; k != StensorSize; ++k) {
+        sl[k][0] = s[k];
+      }
+      BatchedSymmetricEigenSolver::computeEigenVectors<1>(vpl, ml, sl);
+      for (unsigned short k = 0; k != 3; ++k) {
+        vp[k] = vpl[k][0];
+      }
+      for (unsigned short k = 0; k != 9; ++k) {
+        m[k] = ml[k][0];
+      }
+    }  // end of computeEigenVectors
+    /*!
+     * \brief compute the eigenvalues and the eigenvectors of a group of `L`
+     * tensors, the `k`-th component of the `l`-th tensor being stored in
+     * `s[k][l]`.
+     *
+     * The loop over the tensors of the group is the innermost loop and its
+     * body is free of data-dependent branches and of function calls other
+     * than elementary mathematical functions: it is meant to be vectorised
+     * by the compiler. Vectorising `std::acos` and `std::cos` requires a
+     * vectorised mathematical library (for instance, `libmvec` which is used
+     * by `gcc` when `-ffast-math` is given).
+     *
+     * \tparam L: number of tensors in the group
+     * \param[out] vp: eigenvalues
+     * \param[out] m: rotation matrices (row-major storage) whose columns are
+     * the eigenvectors
+     * \param[in] s: components of the tensors
+     */
+    template <unsigned short L>
+    TFEL_HOST_DEVICE static void computeEigenVectors(
+        real (&vp)[3][L],
+        real (&m)[9][L],
+        const real (&s)[StensorSize][L]) noexcept {
+      constexpr auto icste = Cste<real>::isqrt2;
+      if constexpr (N == 1) {
+        for (unsigned short l = 0; l != L; ++l) {
+          vp[0][l] = s[0][l];
+          vp[1][l] = s[1][l];
+          vp[2][l] = s[2][l];
+          for (unsigned short k = 0; k != 9; ++k) {
+            m[k][l] = (k % 4 == 0) ? real(1) : real(0);
+          }
+        }
+      } else if constexpr (N == 2) {
+        for (unsigned short l = 0; l != L; ++l) {
+          const auto a = s[0][l];
+          const auto c = s[1][l];
+          const auto b = s[3][l] * icste;
+          // Jacobi rotation
+          const auto nz = std::abs(b) > std::numeric_limits<real>::min();
+          const auto tau = nz ? (c - a) / (2 * (nz ? b : real(1))) : real(0);
+          const auto at = std::abs(tau);
+          const auto t0 = 1 / (at + std::sqrt(1 + at * at));
+          const auto t = nz ? (tau < 0 ? -t0 : t0) : real(0);
+          const auto cs = 1 / std::sqrt(1 + t * t);
+          const auto sn = t * cs;
+          vp[0][l] = a - t * b;
+          vp[1][l] = c + t * b;
+          vp[2][l] = s[2][l];
+          m[0][l] = cs;
+          m[1][l] = sn;
+          m[2][l] = 0;
+          m[3][l] = -sn;
+          m[4][l] = cs;
+          m[5][l] = 0;
+          m[6][l] = 0;
+          m[7][l] = 0;
+          m[8][l] = 1;
+        }
+      } else {
+        constexpr auto two_pi_3 = real(2.0943951023931954923084289221863);
+        // results are stored in local arrays, which can't alias the
+        // components of the tensors
+        real vpl[3][L];
+        real ml[9][L];
+        for (unsigned short l = 0; l != L; ++l) {
+          // scaling of the tensor to avoid overflows and underflows
+          const auto s0 = s[0][l];
+          const auto s1 = s[1][l];
+          const auto s2 = s[2][l];
+          const auto s3 = s[3][l];
+          const auto s4 = s[4][l];
+          const auto s5 = s[5][l];
+          const auto m01 = std::max(std::abs(s0), std::abs(s1));
+          const auto m23 = std::max(std::abs(s2), std::abs(s3));
+          const auto m45 = std::max(std::abs(s4), std::abs(s5));
+          const auto smax = std::max(std::max(m01, m23), m45);
+          const auto f =
+              (smax > std::numeric_limits<real>::min()) ? smax : real(1);
+          const auto i_f = 1 / f;
+          const auto a00 = s0 * i_f;
+          const auto a11 = s1 * i_f;
+          const auto a22 = s2 * i_f;
+          const auto a01 = s3 * i_f * icste;
+          const auto a02 = s4 * i_f * icste;
+          const auto a12 = s5 * i_f * icste;
+          // trigonometric solution of the characteristic polynomial of the
+          // deviator. The greatest and the lowest eigenvalues are computed.
+          const auto q = (a00 + a11 + a22) / 3;
+          const auto b00 = a00 - q;
+          const auto b11 = a11 - q;
+          const auto b22 = a22 - q;
+          const auto p = std::sqrt((b00 * b00 + b11 * b11 + b22 * b22 +
+                                    2 * (a01 * a01 + a02 * a02 + a12 * a12)) /
+                                   6);
+          // the deviator is normalised to avoid overflows
+          const auto pnz = p > std::numeric_limits<real>::min();
+          const auto ip = pnz ? 1 / (pnz ? p : real(1)) : real(0);
+          const auto c00 = b00 * ip;
+          const auto c11 = b11 * ip;
+          const auto c22 = b22 * ip;
+          const auto c01 = a01 * ip;
+          const auto c02 = a02 * ip;
+          const auto c12 = a12 * ip;
+          const auto det = c00 * (c11 * c22 - c12 * c12) -
+                           c01 * (c01 * c22 - c12 * c02) +
+                           c02 * (c01 * c12 - c11 * c02);
+          const auto r = det / 2;
+          const auto phi =
+              std::acos(r < -1 ? real(-1) : (r > 1 ? real(1) : r)) / 3;
+          const auto l0 = q + 2 * p * std::cos(phi);
+          const auto l2 = q + 2 * p * std::cos(phi + two_pi_3);
+          const auto l1 = 3 * q - l0 - l2;
+          // eigenvalue the most isolated from the others
+          const auto li = (l0 - l1 >= l1 - l2) ? l0 : l2;
+          // cross products of the rows of s - li I
+          const auto r00 = a00 - li;
+          const auto r11 = a11 - li;
+          const auto r22 = a22 - li;
+          const real x0[3] = {a01 * a12 - a02 * r11,  //
+                              a02 * a01 - r00 * a12,  //
+                              r00 * r11 - a01 * a01};
+          const real x1[3] = {a01 * r22 - a02 * a12,  //
+                              a02 * a02 - r00 * r22,  //
+                              r00 * a12 - a01 * a02};
+          const real x2[3] = {r11 * r22 - a12 * a12,  //
+                              a12 * a02 - a01 * r22,  //
+                              a01 * a12 - r11 * a02};
+          const auto n0 = x0[0] * x0[0] + x0[1] * x0[1] + x0[2] * x0[2];
+          const auto n1 = x1[0] * x1[0] + x1[1] * x1[1] + x1[2] * x1[2];
+          const auto n2 = x2[0] * x2[0] + x2[1] * x2[1] + x2[2] * x2[2];
+          const auto sel1 = n1 > n0;
+          const auto n01 = sel1 ? n1 : n0;
+          const auto sel2 = n2 > n01;
+          const auto nm = sel2 ? n2 : n01;
+          // if all the cross products vanish, the tensor is spherical and
+          // any vector is an eigenvector
+          const auto enz = nm > std::numeric_limits<real>::min();
+          const auto ie = 1 / std::sqrt(enz ? nm : real(1));
+          const auto e0 = enz ? (sel2 ? x2[0] : (sel1 ? x1[0] : x0[0])) * ie  //
+                              : real(1);
+          const auto e1 = enz ? (sel2 ? x2[1] : (sel1 ? x1[1] : x0[1])) * ie  //
+                              : real(0);
+          const auto e2 = enz ? (sel2 ? x2[2] : (sel1 ? x1[2] : x0[2])) * ie  //
+                              : real(0);
+          // orthonormal basis of the plane orthogonal to e
+          const auto sx = std::abs(e0) > std::abs(e1);
+          const auto iu =
+              1 / std::sqrt(sx ? e0 * e0 + e2 * e2 : e1 * e1 + e2 * e2);
+          const auto u0 = sx ? -e2 * iu : real(0);
+          const auto u1 = sx ? real(0) : e2 * iu;
+          const auto u2 = sx ? e0 * iu : -e1 * iu;
+          const auto w0 = e1 * u2 - e2 * u1;
+          const auto w1 = e2 * u0 - e0 * u2;
+          const auto w2 = e0 * u1 - e1 * u0;
+          // restriction of the tensor to this plane
+          const auto au0 = a00 * u0 + a01 * u1 + a02 * u2;
+          const auto au1 = a01 * u0 + a11 * u1 + a12 * u2;
+          const auto au2 = a02 * u0 + a12 * u1 + a22 * u2;
+          const auto aw0 = a00 * w0 + a01 * w1 + a02 * w2;
+          const auto aw1 = a01 * w0 + a11 * w1 + a12 * w2;
+          const auto aw2 = a02 * w0 + a12 * w1 + a22 * w2;
+          const auto puu = u0 * au0 + u1 * au1 + u2 * au2;
+          const auto puw = w0 * au0 + w1 * au1 + w2 * au2;
+          const auto pww = w0 * aw0 + w1 * aw1 + w2 * aw2;
+          // Jacobi rotation of the restriction
+          const auto nz = std::abs(puw) > std::numeric_limits<real>::min();
+          const auto tau =
+              nz ? (pww - puu) / (2 * (nz ? puw : real(1))) : real(0);
+          const auto at = std::abs(tau);
+          const auto t0 = 1 / (at + std::sqrt(1 + at * at));
+          const auto t = nz ? (tau < 0 ? -t0 : t0) : real(0);
+          const auto cs = 1 / std::sqrt(1 + t * t);
+          const auto sn = t * cs;
+          vpl[0][l] = li * f;
+          vpl[1][l] = (puu - t * puw) * f;
+          vpl[2][l] = (pww + t * puw) * f;
+          ml[0][l] = e0;
+          ml[1][l] = cs * u0 - sn * w0;
+          ml[2][l] = sn * u0 + cs * w0;
+          ml[3][l] = e1;
+          ml[4][l] = cs * u1 - sn * w1;
+          ml[5][l] = sn * u1 + cs * w1;
+          ml[6][l] = e2;
+          ml[7][l] = cs * u2 - sn * w2;
+          ml[8][l] = sn * u2 + cs * w2;
+        }
+        for (unsigned short k = 0; k != 3; ++k) {
+          for (unsigned short l = 0; l != L; ++l) {
+            vp[k][l] = vpl[k][l];
+          }
+        }
+        for (unsigned short k = 0; k != 9; ++k) {
+          for (unsigned short l = 0; l != L; ++l) {
+            m[k][l] = ml[k][l];
+          }
+        }
+      }
+    }  // end of computeEigenVectors
+
+   private:
+    /*!
+     * \brief treat a group of `L` tensors starting at index `i0`
+     * \tparam L: number of tensors in the group
+     * \tparam eigenvectors: if true, the eigenvectors are stored
+     */
+    template <unsigned short L, bool eigenvectors>
+    static void treatGroup(real* const vp,
+                           const std::size_t vp_stride,
+                           real* const m,
+                           const std::size_t m_stride,
+                           const real* const s,
+                           const std::size_t s_stride,
+                           const std::size_t i0) noexcept {
+      real sg[StensorSize][L];
+      real vpg[3][L];
+      real mg[9][L];
+      for (unsigned short k = 0; k != StensorSize; ++k) {
+        for (unsigned short l = 0; l != L; ++l) {
+          sg[k][l] = s[i0 + l + k * s_stride];
+        }
+      }
+      BatchedSymmetricEigenSolver::computeEigenVectors<L>(vpg, mg, sg);
+      for (unsigned short k = 0; k != 3; ++k) {
+        for (unsigned short l = 0; l != L; ++l) {
+          vp[i0 + l + k * vp_stride] = vpg[k][l];
+        }
+      }
+      if constexpr (eigenvectors) {
+        for (unsigned short k = 0; k != 9; ++k) {
+          for (unsigned short l = 0; l != L; ++l) {
+            m[i0 + l + k * m_stride] = mg[k][l];
+          }
+        }
+      }
+    }  // end of treatGroup
+  };   // end of struct BatchedSymmetricEigenSolver
+
+  /*!
+   * \brief compute the eigenvalues of an array of symmetric tensors
+   * \param[out] vp: eigenvalues
+   * \param[in] s: tensors
+   */
+  template <typename real,
+            typename StensorType,
+            typename MemoryIndexingPolicyType,
+            typename MemoryIndexingPolicyType2>
+  void computeEigenValues(
+      StridedCoalescedViewsArray<tvector<3u, real>, MemoryIndexingPolicyType>&
+          vp,
+      const StridedCoalescedViewsArray<StensorType, MemoryIndexingPolicyType2>&
+          s) requires(std::is_same_v<std::remove_cv_t<StensorType>,
+                                     stensor<getSpaceDimension<StensorType>(),
+                                             real>>) {
+    constexpr auto N = getSpaceDimension<StensorType>();
+    raise_if(vp.size() != s.size(),
+             "computeEigenValues: unmatched number of eigenvalues and tensors");
+    if (s.size() == 0) {
+      return;
+    }
+    const auto [pvp, svp] = vp[0].data();
+    const auto [ps, ss] = s[0].data();
+    BatchedSymmetricEigenSolver<N, real>::computeEigenValues(pvp, svp, ps, ss,
+                                                              s.size());
+  }  // end of computeEigenValues
+
+  /*!
+   * \brief compute the eigenvalues and the eigenvectors of an array of
+   * symmetric tensors
+   * \param[out] vp: eigenvalues
+   * \param[out] m: rotation matrices, whose columns are the eigenvectors
+   * \param[in] s: tensors
+   */
+  template <typename real,
+            typename StensorType,
+            typename MemoryIndexingPolicyType,
+            typename MemoryIndexingPolicyType2,
+            typename MemoryIndexingPolicyType3>
+  void computeEigenVectors(
+      StridedCoalescedViewsArray<tvector<3u, real>, MemoryIndexingPolicyType>&
+          vp,
+      StridedCoalescedViewsArray<tmatrix<3u, 3u, real>,
+                                 MemoryIndexingPolicyType2>& m,
+      const StridedCoalescedViewsArray<StensorType, MemoryIndexingPolicyType3>&
+          s) requires(std::is_same_v<std::remove_cv_t<StensorType>,
+                                     stensor<getSpaceDimension<StensorType>(),
+                                             real>>) {
+    constexpr auto N = getSpaceDimension<StensorType>();
+    raise_if((vp.size() != s.size()) || (m.size() != s.size()),
+             "computeEigenVectors: unmatched number of eigenvalues, "
+             "eigenvectors and tensors");
+    if (s.size() == 0) {
+      return;
+    }
+    const auto [pvp, svp] = vp[0].data();
+    const auto [pm, sm] = m[0].data();
+    const auto [ps, ss] = s[0].data();
+    BatchedSymmetricEigenSolver<N, real>::computeEigenVectors(
+        pvp, svp, pm, sm, ps, ss, s.size());
+  }  // end of computeEigenVectors
+
+}  // end of namespace tfel::math
+
+#endif /* LIB_TFEL_MATH_STENSOR_BATCHEDSYMMETRICEIGENSOLVER_HXX */
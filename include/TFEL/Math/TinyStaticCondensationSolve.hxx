@@ -0,0 +1,159 @@
+/*!
+ * \file   include/TFEL/Math/TinyStaticCondensationSolve.hxx
+ * \brief  This file declares the `TinyStaticCondensationSolve` class.
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright Copyright (C) 2006-2025 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_TINYSTATICCONDENSATIONSOLVE_HXX
+#define LIB_TFEL_MATH_TINYSTATICCONDENSATIONSOLVE_HXX
+
+#include <limits>
+#include "TFEL/Raise.hxx"
+#include "TFEL/Config/TFELConfig.hxx"
+#include "TFEL/Math/General/Abs.hxx"
+#include "TFEL/Math/tvector.hxx"
+#include "TFEL/Math/tmatrix.hxx"
+#include "TFEL/Math/TinyMatrixSolve.hxx"
+#include "TFEL/Math/LU/LUException.hxx"
+
+namespace tfel::math {
+
+  /*!
+   * \brief solve a linear system by static condensation of its last unknowns.
+   *
+   * The matrix is split in four blocks:
+   *
+   * \f[
+   * \begin{pmatrix}
+   * A & B \\
+   * C & D
+   * \end{pmatrix}
+   * \f]
+   *
+   * where \f$A\f$ is associated with the first `M` unknowns, which are
+   * retained, and \f$D\f$ is associated with the last `N-M` unknowns, which
+   * are condensed. The retained unknowns are computed by solving the system
+   * associated with the Schur complement \f$A-B\,D^{-1}\,C\f$ using a LU
+   * decomposition. The condensed unknowns are then recovered.
+   *
+   * If the block \f$D\f$ is known to be diagonal, only its diagonal is read
+   * and the cost of the resolution is of order \f$M^{2}\,N\f$ instead of
+   * \f$N^{3}\f$ for a dense LU decomposition of the whole matrix.
+   *
+   * \tparam N: size of the system
+   * \tparam M: number of retained unknowns
+   * \tparam T: numeric type
+   * \tparam diagonal_block: if true, the block \f$D\f$ is assumed diagonal
+   * \tparam use_exceptions: if false, failures are reported by returning false
+   */
+  template <unsigned short N,
+            unsigned short M,
+            typename T,
+            bool diagonal_block = false,
+            bool use_exceptions = true>
+  struct TinyStaticCondensationSolve {
+    static_assert(M > 0, "no retained unknown");
+    static_assert(M < N, "no condensed unknown");
+    //! \brief number of condensed unknowns
+    static constexpr unsigned short K = N - M;
+    /*!
+     * \brief solve the linear system m.x = b
+     * \param[in] m: matrix
+     * \param[in,out] b: right member on input, solution on output
+     * \param[in] eps: numerical parameter to detect null pivots
+     */
+    TFEL_HOST_DEVICE static bool exe(
+        const tmatrix<N, N, T>& m,
+        tvector<N, T>& b,
+        const T eps =
+            100 * std::numeric_limits<T>::min()) noexcept(!use_exceptions) {
+      using size_type = unsigned short;
+      // iDC = D^{-1} C and iDd = D^{-1} d
+      auto iDC = tmatrix<K, M, T>{};
+      auto iDd = tvector<K, T>{};
+      for (size_type i = 0; i != K; ++i) {
+        iDd(i) = b(M + i);
+        for (size_type j = 0; j != M; ++j) {
+          iDC(i, j) = m(M + i, j);
+        }
+      }
+      if constexpr (diagonal_block) {
+        for (size_type i = 0; i != K; ++i) {
+          const auto d = m(M + i, M + i);
+          if (tfel::math::abs(d) < eps) {
+            if constexpr (use_exceptions) {
+              tfel::raise<LUNullPivot>();
+            } else {
+              return false;
+            }
+          }
+          const auto id = 1 / d;
+          iDd(i) *= id;
+          for (size_type j = 0; j != M; ++j) {
+            iDC(i, j) *= id;
+          }
+        }
+      } else {
+        using DSolver = TinyMatrixSolveBase<K, T, use_exceptions, false>;
+        auto D = tmatrix<K, K, T>{};
+        for (size_type i = 0; i != K; ++i) {
+          for (size_type j = 0; j != K; ++j) {
+            D(i, j) = m(M + i, M + j);
+          }
+        }
+        auto p = TinyPermutation<K>{};
+        if (!DSolver::decomp(D, p, eps)) {
+          return false;
+        }
+        if (!DSolver::back_substitute(D, p, iDd, eps)) {
+          return false;
+        }
+        if (!DSolver::back_substitute(D, p, iDC, eps)) {
+          return false;
+        }
+      }
+      // Schur complement S = A - B D^{-1} C and reduced right member
+      auto S = tmatrix<M, M, T>{};
+      auto x = tvector<M, T>{};
+      for (size_type i = 0; i != M; ++i) {
+        auto r = b(i);
+        for (size_type k = 0; k != K; ++k) {
+          r -= m(i, M + k) * iDd(k);
+        }
+        x(i) = r;
+        for (size_type j = 0; j != M; ++j) {
+          auto v = m(i, j);
+          for (size_type k = 0; k != K; ++k) {
+            v -= m(i, M + k) * iDC(k, j);
+          }
+          S(i, j) = v;
+        }
+      }
+      if (!TinyMatrixSolve<M, T, use_exceptions>::exe(S, x, eps)) {
+        return false;
+      }
+      // recovering the condensed unknowns
+      for (size_type i = 0; i != M; ++i) {
+        b(i) = x(i);
+      }
+      for (size_type k = 0; k != K; ++k) {
+        auto v = iDd(k);
+        for (size_type j = 0; j != M; ++j) {
+          v -= iDC(k, j) * x(j);
+        }
+        b(M + k) = v;
+      }
+      return true;
+    }  // end of exe
+  };   // end of struct TinyStaticCondensationSolve
+
+}  // end of namespace tfel::math
+
+#endif /* LIB_TFEL_MATH_TINYSTATICCONDENSATIONSOLVE_HXX */
@@ -15,6 +15,9 @@
 #define LIB_TFEL_SYSTEM_EXTERNALLIBRARYMANAGER_HXX
 
 #include <map>
+#include <tuple>
+#include <mutex>
+#include <memory>
 #include <vector>
 #include <string>
 
@@ -31,9 +34,16 @@
 
 namespace tfel::system {
 
+  // forward declaration
+  struct ExternalMaterialKnowledgeDescription;
+  // forward declaration
+  struct ExternalBehaviourDescription;
+
   /*!
    * \brief Structure in charge of loading external function and
    * retrieving information from shared libraries.
+   *
+   * \note this class can be used concurrently by many threads.
    */
   struct TFELSYSTEM_VISIBILITY_EXPORT ExternalLibraryManager {
     //! \return the uniq instance of this class
@@ -58,6 +68,17 @@ namespace tfel::system {
 #else
     void* loadLibrary(const std::string&, const bool = false);
 #endif /* LIB_EXTERNALLIBRARYMANAGER_HXX */
+    /*!
+     * \brief unload a library previously loaded by the `loadLibrary`
+     * method. The descriptions of the entry points of this library are
+     * removed from the cache, so that they are rebuilt if the library is
+     * loaded again.
+     * \param[in] name: name of the library
+     * \return true if the library was loaded, false otherwise
+     * \note pointers to functions of this library shall not be used once
+     * the library is unloaded.
+     */
+    bool unloadLibrary(const std::string&);
        /*!
         * \return the path of a library
         * \param[in] l: library name
@@ -69,6 +90,31 @@ namespace tfel::system {
      * \param[in] l: library name
      */
     std::vector<std::string> getEntryPoints(const std::string&);
+    /*!
+     * \return a description of an entry point gathering all the metadata
+     * exported by this entry point.
+     *
+     * The description is built on the first call and cached: subsequent
+     * calls return the same object without querying the library.
+     *
+     * \param[in] l: library name
+     * \param[in] f: entry point
+     */
+    std::shared_ptr<const ExternalMaterialKnowledgeDescription> describe(
+        const std::string&, const std::string&);
+    /*!
+     * \return a description of a behaviour for the given modelling
+     * hypothesis.
+     *
+     * The description is built on the first call and cached: subsequent
+     * calls return the same object without querying the library.
+     *
+     * \param[in] l: library name
+     * \param[in] f: behaviour
+     * \param[in] h: modelling hypothesis
+     */
+    std::shared_ptr<const ExternalBehaviourDescription> describe(
+        const std::string&, const std::string&, const std::string&);
     /*!
      * \return the material knowledge type of an entry point in a
      * library. The returned value has the following meaning:
@@ -577,6 +623,14 @@ namespace tfel::system {
      */
     GenericBehaviourFctPtr getGenericBehaviourFunction(const std::string&,
                                                        const std::string&);
+    /*!
+     * \return the function integrating a behaviour generated through the
+     * `generic` interface over a set of integration points.
+     * \param[in] l: name of the library
+     * \param[in] f: function name
+     */
+    GenericBehaviourBatchFctPtr getGenericBehaviourBatchFunction(
+        const std::string&, const std::string&);
     /*!
      * \return the post-processings associated with a behaviour generated
      * through the `generic` interface.
@@ -1462,7 +1516,19 @@ namespace tfel::system {
 #else
     std::map<std::string, void*> librairies;
 #endif /* LIB_EXTERNALLIBRARYMANAGER_HXX */
-
+    //! \brief descriptions of the entry points, indexed by library and name
+    std::map<std::tuple<std::string, std::string>,
+             std::shared_ptr<const ExternalMaterialKnowledgeDescription>>
+        descriptions;
+    /*!
+     * \brief descriptions of the behaviours, indexed by library, name and
+     * modelling hypothesis
+     */
+    std::map<std::tuple<std::string, std::string, std::string>,
+             std::shared_ptr<const ExternalBehaviourDescription>>
+        behaviours_descriptions;
+    //! \brief mutex protecting the libraries and the descriptions
+    std::mutex libraries_mutex;
   };  // end of struct LibraryManager
 
 }  // end of namespace tfel::system
@@ -20,12 +20,15 @@
 #ifndef TFEL_SYSTEM_THREAD_POOL_HXX
 #define TFEL_SYSTEM_THREAD_POOL_HXX
 
-#include <queue>
+#include <deque>
 #include <mutex>
+#include <atomic>
+#include <memory>
 #include <vector>
 #include <thread>
 #include <future>
-#include <functional>
+#include <cstddef>
+#include <exception>
 #include <condition_variable>
 #include "TFEL/Config/TFELConfig.hxx"
 #include "TFEL/System/ThreadedTaskResult.hxx"
@@ -34,6 +37,12 @@ namespace tfel::system {
 
   /*!
    * \brief structure handling a fixed-size pool of threads
+   *
+   * Each worker owns a queue of tasks. Tasks added by a worker are pushed
+   * in its own queue and tasks added by other threads are distributed
+   * among the queues in a round-robin fashion. A worker takes the last
+   * task added to its own queue and, when this queue is empty, steals the
+   * oldest task of the queues of the other workers.
    */
   struct TFELSYSTEM_VISIBILITY_EXPORT ThreadPool {
     //! a simple alias
@@ -52,6 +61,30 @@ namespace tfel::system {
     [[nodiscard]] std::future<
         ThreadedTaskResult<std::invoke_result_t<F, Args...>>>
     addTask(F&&, Args&&...);
+    /*!
+     * \brief call the given function on the sub-ranges of the range
+     * `[b, e[`.
+     *
+     * The range is divided in chunks of `g` indices (the last one may be
+     * smaller). The chunks are treated by the workers and by the calling
+     * thread, which returns when all the chunks have been treated. This
+     * method can thus be called by a task executed by the pool.
+     *
+     * The function is called with the bounds of the sub-range as arguments.
+     * If the function throws, the first exception is rethrown by this
+     * method and the chunks not yet treated are discarded.
+     *
+     * \param[in] b: beginning of the range
+     * \param[in] e: end of the range
+     * \param[in] f: function
+     * \param[in] g: grain size. If null, the grain size is chosen to
+     * create about four chunks per thread.
+     */
+    template <typename F>
+    void parallel_for(const size_type,
+                      const size_type,
+                      const F&,
+                      const size_type = 0);
     //! \return the number of threads managed by the ppol
     [[nodiscard]] size_type getNumberOfThreads() const;
     //! \brief wait for all tasks to be finished
@@ -63,17 +96,121 @@ namespace tfel::system {
     //! wrapper around the given task
     template <typename F>
     struct Wrapper;
-    //! enum describing the status of workers
-    enum Status { WORKING, IDLE };  // end of enum Status
-    std::vector<Status> statuses;
+    /*!
+     * \brief a type-erased, move-only, task. Small tasks are stored in an
+     * internal buffer to avoid memory allocations.
+     */
+    struct TFELSYSTEM_VISIBILITY_EXPORT Task {
+      //! \brief default constructor
+      Task() noexcept;
+      /*!
+       * \brief constructor from a callable object
+       * \param[in] f: callable object
+       */
+      template <typename F>
+      explicit Task(F&&);
+      //! \brief move constructor
+      Task(Task&&) noexcept;
+      //! \brief move assignement
+      Task& operator=(Task&&) noexcept;
+      //! \brief call operator
+      void operator()();
+      //! \brief destructor
+      ~Task();
+
+     private:
+      //! \brief actions performed by the manager
+      enum Action { CALL, MOVE, DESTROY };
+      //! \brief size of the internal buffer
+      static constexpr std::size_t buffer_size = 64;
+      //! \brief manager of the stored callable object
+      template <typename F, bool>
+      struct Manager;
+      //! \brief internal buffer
+      alignas(std::max_align_t) unsigned char buffer[buffer_size];
+      /*!
+       * \brief function calling, moving or destroying the callable object
+       * stored in the buffer. If the action is `MOVE`, the object is moved
+       * to the buffer given as the second argument.
+       */
+      void (*manager)(const Action, void* const, void* const) = nullptr;
+    };  // end of struct Task
+    //! \brief queue of tasks associated with a worker
+    struct Queue {
+      //! \brief mutex protecting the tasks
+      std::mutex m;
+      //! \brief tasks
+      std::deque<Task> tasks;
+    };
+    //! \brief data shared by the chunks of a call to `parallel_for`
+    struct TFELSYSTEM_VISIBILITY_EXPORT ParallelForContext {
+      //! \brief treat chunks until all of them are treated
+      void run();
+      //! \brief beginning of the range
+      size_type begin;
+      //! \brief end of the range
+      size_type end;
+      //! \brief grain size
+      size_type grain;
+      //! \brief number of chunks
+      size_type number_of_chunks;
+      //! \brief index of the next chunk to be treated
+      std::atomic<size_type> next_chunk = 0;
+      //! \brief number of chunks treated
+      std::atomic<size_type> treated_chunks = 0;
+      //! \brief function called on each chunk
+      void (*call)(const void* const, const size_type, const size_type);
+      //! \brief object passed to the `call` function
+      const void* function;
+      //! \brief flag stating if an exception has been thrown
+      std::atomic<bool> failed = false;
+      //! \brief first exception thrown
+      std::exception_ptr exception;
+      //! \brief mutex used to signal the end of the treatment
+      std::mutex m;
+      //! \brief condition variable used to signal the end of the treatment
+      std::condition_variable c;
+    };
+    /*!
+     * \brief add a task to the queue of the calling worker or, if the
+     * calling thread is not a worker of the pool, to the queue of a worker.
+     * \param[in] t: task
+     */
+    void push(Task&&);
+    /*!
+     * \brief retrieve a task from the queue of the given worker or, if this
+     * queue is empty, from the queue of another worker.
+     * \return true if a task has been retrieved
+     * \param[out] t: task
+     * \param[in] i: index of the worker
+     */
+    TFEL_VISIBILITY_LOCAL bool pop(Task&, const size_type);
+    //! \brief function executed by the workers
+    TFEL_VISIBILITY_LOCAL void work(const size_type);
+    /*!
+     * \brief treat the chunks of a call to `parallel_for`
+     * \param[in] ctx: context
+     */
+    void execute(const std::shared_ptr<ParallelForContext>&);
     //! list of available threads
     std::vector<std::thread> workers;
-    // the task queue
-    std::queue<std::function<void()>> tasks;
+    //! \brief queues of tasks, one per worker
+    std::vector<std::unique_ptr<Queue>> queues;
+    //! \brief index of the queue used for the next task added externally
+    std::atomic<size_type> next_queue = 0;
+    //! \brief number of tasks waiting in the queues
+    std::atomic<size_type> queued_tasks = 0;
+    //! \brief number of tasks waiting or being executed
+    std::atomic<size_type> pending_tasks = 0;
+    //! \brief number of workers waiting for a task
+    std::atomic<size_type> sleeping_workers = 0;
     // synchronization
     std::mutex m;
+    //! \brief condition variable used to wake up workers
     std::condition_variable c;
-    bool stop = false;
+    //! \brief condition variable used to signal that all tasks are done
+    std::condition_variable done;
+    std::atomic<bool> stop = false;
   };
 
 }  // end of namespace tfel::system
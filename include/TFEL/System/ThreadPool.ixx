@@ -14,7 +14,10 @@
 #ifndef TFEL_SYSTEM_THREAD_POOL_IXX
 #define TFEL_SYSTEM_THREAD_POOL_IXX
 
+#include <new>
 #include <memory>
+#include <functional>
+#include <utility>
 #include <type_traits>
 
 namespace tfel::system {
@@ -58,29 +61,85 @@ namespace tfel::system {
     F f;
   };
 
+  template <typename F>
+  struct ThreadPool::Task::Manager<F, true> {
+    static void manage(const Action a, void* const s, void* const d) {
+      auto& f = *(static_cast<F*>(s));
+      if (a == CALL) {
+        f();
+      } else if (a == MOVE) {
+        ::new (d) F(std::move(f));
+        f.~F();
+      } else {
+        f.~F();
+      }
+    }
+  };
+
+  template <typename F>
+  struct ThreadPool::Task::Manager<F, false> {
+    static void manage(const Action a, void* const s, void* const d) {
+      auto* const f = *(static_cast<F**>(s));
+      if (a == CALL) {
+        (*f)();
+      } else if (a == MOVE) {
+        ::new (d) F*(f);
+      } else {
+        delete f;
+      }
+    }
+  };
+
+  template <typename F>
+  ThreadPool::Task::Task(F&& f) {
+    using Function = std::decay_t<F>;
+    static_assert(!std::is_same_v<Function, Task>);
+    constexpr auto is_small = (sizeof(Function) <= buffer_size) &&
+                              (alignof(Function) <= alignof(std::max_align_t)) &&
+                              (std::is_nothrow_move_constructible_v<Function>);
+    if constexpr (is_small) {
+      ::new (static_cast<void*>(this->buffer))
+          Function(std::forward<F>(f));
+    } else {
+      ::new (static_cast<void*>(this->buffer))
+          Function*(new Function(std::forward<F>(f)));
+    }
+    this->manager = &Manager<Function, is_small>::manage;
+  }  // end of Task
+
   // add new work item to the pool
   template <typename F, typename... Args>
   std::future<ThreadedTaskResult<std::invoke_result_t<F, Args...>>>
   ThreadPool::addTask(F&& f, Args&&... a) {
     using return_type = ThreadedTaskResult<std::invoke_result_t<F, Args...>>;
     using task = std::packaged_task<return_type()>;
-    auto t = std::make_shared<task>(
+    auto t = task(
         std::bind(Wrapper<F>(std::forward<F>(f)), std::forward<Args>(a)...));
-    auto res = t->get_future();
-    {
-      std::unique_lock<std::mutex> lock(this->m);
-      // don't allow enqueueing after stopping the pool
-      if (this->stop) {
-        throw std::runtime_error(
-            "ThreadPool::addTask: "
-            "enqueue on stopped ThreadPool");
-      }
-      this->tasks.emplace([t] { (*t)(); });
-    }
-    this->c.notify_one();
+    auto res = t.get_future();
+    this->push(Task(std::move(t)));
     return res;
   }
 
+  template <typename F>
+  void ThreadPool::parallel_for(const size_type b,
+                                const size_type e,
+                                const F& f,
+                                const size_type g) {
+    if (e <= b) {
+      return;
+    }
+    auto ctx = std::make_shared<ParallelForContext>();
+    ctx->begin = b;
+    ctx->end = e;
+    ctx->grain = g;
+    ctx->call = [](const void* const p, const size_type ib,
+                   const size_type ie) {
+      (*(static_cast<const F*>(p)))(ib, ie);
+    };
+    ctx->function = &f;
+    this->execute(ctx);
+  }  // end of parallel_for
+
 }  // end of namespace tfel::system
 
 #endif /* TFEL_SYSTEM_THREAD_POOL_IXX */
@@ -110,6 +110,17 @@ double(TFEL_ADDCALL_PTR tfel_getGenericMaterialProperty(
 int(TFEL_ADDCALL_PTR tfel_getGenericBehaviourFunction(LibraryHandlerPtr,
                                                       const char* const))(
     struct mfront_gb_BehaviourData* const);
+/*!
+ * \brief return a function generated by the generic behaviour interface
+ * integrating a behaviour over a set of integration points.
+ * \param l: library handler
+ * \param f: function name
+ * \return the searched function pointer if the call succeed, the NULL pointer
+ * if not.
+ */
+int(TFEL_ADDCALL_PTR tfel_getGenericBehaviourBatchFunction(
+    LibraryHandlerPtr, const char* const))(
+    struct mfront_gb_BatchBehaviourData* const);
 /*!
  * \brief return a function generated by the generic behaviour interface
  * associated with an initialize functions.
@@ -164,6 +164,15 @@ namespace tfel::utilities {
     void stripArguments();
   };
 
+  /*!
+   * \return the number of jobs given by the option of a `--jobs` command
+   * line argument. If the option is empty, the number of cores is returned.
+   * \param[in] m: calling method, used in error messages
+   * \param[in] o: option
+   */
+  TFELUTILITIES_VISIBILITY_EXPORT std::size_t parseNumberOfJobs(
+      const std::string&, const std::string&);
+
 }  // end of namespace tfel::utilities
 
 #endif /* LIB_TFEL_UTILITIES_ARGUMENTPARSER_HXX */
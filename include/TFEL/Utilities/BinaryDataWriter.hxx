@@ -0,0 +1,112 @@
+/*!
+ * \file   include/TFEL/Utilities/BinaryDataWriter.hxx
+ * \brief  This file declares the `BinaryDataWriter` class.
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright Copyright (C) 2006-2025 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_UTILITIES_BINARYDATAWRITER_HXX
+#define LIB_TFEL_UTILITIES_BINARYDATAWRITER_HXX
+
+#include <span>
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <fstream>
+#include <string_view>
+#include "TFEL/Config/TFELConfig.hxx"
+
+namespace tfel::utilities {
+
+  /*!
+   * \brief class in charge of writing data in the binary format read by
+   * the `TextData` class.
+   *
+   * A binary data file is made of:
+   *
+   * - a header containing the magic string `TFELBDAT`, the version of the
+   *   format, the number of columns and the names of the columns. Each
+   *   name is given by its size followed by its characters.
+   * - a list of chunks. A chunk starts with the number of lines that it
+   *   contains, followed by the values of each column, column by column.
+   *
+   * Integers are stored as unsigned integers on 32 bits, except the
+   * number of lines of a chunk which is stored on 64 bits. Values are
+   * stored as IEEE 754 double precision numbers. All numbers are stored
+   * in little-endian order, whatever the platform.
+   *
+   * Lines are buffered and a chunk is written to the file when the number
+   * of buffered lines reaches the chunk size, when the `flush` method is
+   * called or when the writer is destroyed.
+   */
+  struct TFELUTILITIES_VISIBILITY_EXPORT BinaryDataWriter {
+    //! \brief a simple alias
+    using size_type = std::size_t;
+    //! \brief magic string at the beginning of a binary data file
+    static constexpr std::string_view magic = "TFELBDAT";
+    //! \brief version of the format
+    static constexpr unsigned int version = 1;
+    //! \brief default number of lines of a chunk
+    static constexpr size_type defaultChunkSize = 256;
+    /*!
+     * \brief constructor
+     * \param[in] f: file name
+     * \param[in] c: names of the columns
+     * \param[in] n: number of lines of a chunk
+     */
+    BinaryDataWriter(const std::string&,
+                     const std::vector<std::string>&,
+                     const size_type = defaultChunkSize);
+    //
+    BinaryDataWriter() = delete;
+    BinaryDataWriter(BinaryDataWriter&&) = delete;
+    BinaryDataWriter(const BinaryDataWriter&) = delete;
+    BinaryDataWriter& operator=(BinaryDataWriter&&) = delete;
+    BinaryDataWriter& operator=(const BinaryDataWriter&) = delete;
+    /*!
+     * \brief add a value to the current line
+     * \param[in] v: value
+     */
+    void write(const double);
+    /*!
+     * \brief add values to the current line
+     * \param[in] v: values
+     */
+    void write(std::span<const double>);
+    /*!
+     * \brief end the current line
+     * \throw std::runtime_error if the number of values of the current line
+     * does not match the number of columns
+     */
+    void endLine();
+    //! \brief write the buffered lines to the file
+    void flush();
+    //! \return the number of columns
+    [[nodiscard]] size_type getNumberOfColumns() const noexcept;
+    //! \brief destructor
+    ~BinaryDataWriter() noexcept;
+
+   private:
+    //! \brief output file
+    std::ofstream out;
+    //! \brief buffered values, stored line by line
+    std::vector<double> values;
+    //! \brief buffer used to encode a chunk
+    std::vector<char> buffer;
+    //! \brief number of columns
+    size_type ncolumns;
+    //! \brief number of lines of a chunk
+    size_type chunk_size;
+    //! \brief number of buffered lines
+    size_type nlines = 0;
+  };  // end of struct BinaryDataWriter
+
+}  // end of namespace tfel::utilities
+
+#endif /* LIB_TFEL_UTILITIES_BINARYDATAWRITER_HXX */
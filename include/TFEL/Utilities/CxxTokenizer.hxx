@@ -16,6 +16,8 @@
 #define LIB_TFEL_UTILITIES_CXXTOKENIZER_HXX
 
 #include <map>
+#include <deque>
+#include <memory>
 #include <string>
 #include <vector>
 #include <iosfwd>
@@ -393,6 +395,19 @@ namespace tfel::utilities {
     [[nodiscard]] const Token &operator[](const size_type) const;
     //! \return the number of token
     [[nodiscard]] size_type size() const;
+    /*!
+     * \brief set if the tokens shall only be stored as views on the parsed
+     * sources. In this case, the tokens are only available through the
+     * `getTokenViews` method.
+     * \param[in] b: boolean
+     */
+    void useTokenViews(const bool);
+    /*!
+     * \return the token views
+     * \note the token views are empty unless the `storeTokenViews` option
+     * is set
+     */
+    [[nodiscard]] const std::vector<TokenView> &getTokenViews() const noexcept;
     //! \brief destructor
     virtual ~CxxTokenizer();
 
@@ -408,11 +423,67 @@ namespace tfel::utilities {
                              Token::size_type &,
                              const std::string &);
     /*!
-     * \param[in] l:    line
-     * \param[in] n:    line number
-     * \param[in] from: origin of the stream
+     * \brief parse the given source
+     * \param[in]     s:    source
+     * \param[in,out] n:    line number
+     * \param[in]     from: origin of the source
+     */
+    virtual void parseSource(std::string,
+                             Token::size_type &,
+                             const std::string &);
+    /*!
+     * \param[in] b: iterator to the beginning of the line
+     * \param[in] e: iterator past the end of the line
+     * \param[in] n: line number
+     * \note the line must be stored in the parsed source or in the
+     * strings stored by the tokenizer
+     */
+    virtual void splitLine(const std::string::const_iterator,
+                           const std::string::const_iterator,
+                           const Token::size_type);
+    /*!
+     * \brief add a new token
+     * \param[in] v: value
+     * \param[in] n: line number
+     * \param[in] o: offset in the line
+     * \param[in] f: flag
+     * \note the value must be stored in the parsed source or in the
+     * strings stored by the tokenizer
+     */
+    void addToken(std::string_view,
+                  const Token::size_type,
+                  const Token::size_type,
+                  const Token::TokenFlag);
+    /*!
+     * \brief store the given string
+     * \return a reference to the stored string, valid until the tokenizer
+     * is cleared
+     * \param[in] s: string
+     */
+    const std::string &store(std::string);
+    //! \return true if no token has been read
+    [[nodiscard]] bool hasNoTokens() const noexcept;
+    //! \return the flag of the last token
+    [[nodiscard]] Token::TokenFlag getLastTokenFlag() const;
+    /*!
+     * \return the last token as a token view
+     * \note if the last token is an owning token, it is converted to a view
      */
-    virtual void splitLine(const std::string &, const Token::size_type);
+    TokenView &getLastToken();
+    /*!
+     * \brief append a new line to the value of the given token
+     * \param[in] t: token
+     * \param[in] b: iterator to the beginning of the line
+     * \param[in] e: iterator past the end of the line
+     */
+    void appendLine(TokenView &,
+                    const std::string::const_iterator,
+                    const std::string::const_iterator);
+    /*!
+     * \brief build the owning tokens from the token views, unless the
+     * `storeTokenViews` option is set.
+     */
+    void flushTokenViews();
 
     virtual void parseChar(Token::size_type &,
                            std::string::const_iterator &,
@@ -470,6 +541,17 @@ namespace tfel::utilities {
     std::vector<std::string> additional_separators;
     //! list of tokens read
     TokensContainer tokens;
+    //! \brief list of token views read
+    std::vector<TokenView> token_views;
+    /*!
+     * \brief parsed sources and strings built during the parsing. The
+     * token views refer to those strings. A `std::deque` is used since the
+     * insertion of a new string does not invalidate the previous ones. This
+     * storage is shared between copies of the tokenizer.
+     */
+    std::shared_ptr<std::deque<std::string>> strings;
+    //! \brief source currently parsed
+    std::string_view current_source;
     //! store all the comments of a line
     std::map<Token::size_type, std::string> comments;
     /*!
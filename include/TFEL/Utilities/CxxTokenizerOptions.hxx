@@ -82,6 +82,13 @@ namespace tfel::utilities {
     bool minusAsSeparator = true;
     //! \brief add curly braces at the beginning and at the end of the file
     bool addCurlyBraces = false;
+    /*!
+     * \brief if `true`, the parsed sources are kept alive and the tokens
+     * are only stored as views on those sources (see the `TokenView`
+     * class). Otherwise, owning tokens are built from those views at the
+     * end of each parsing.
+     */
+    bool storeTokenViews = false;
   };  // end of struct CxxTokenizerOptions
 
 }  // end of namespace tfel::utilities
@@ -0,0 +1,57 @@
+/*!
+ * \file   include/TFEL/Utilities/FNV1aHash.hxx
+ * \brief  This file implements the 64 bits version of the
+ * Fowler-Noll-Vo (FNV-1a) hash function.
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright Copyright (C) 2006-2025 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_UTILITIES_FNV1AHASH_HXX
+#define LIB_TFEL_UTILITIES_FNV1AHASH_HXX
+
+#include <cstdint>
+#include <string_view>
+
+namespace tfel::utilities {
+
+  //! \brief offset basis of the 64 bits FNV-1a hash function
+  inline constexpr std::uint64_t fnv1a_offset_basis =
+      std::uint64_t{14695981039346656037u};
+  //! \brief prime of the 64 bits FNV-1a hash function
+  inline constexpr std::uint64_t fnv1a_prime = std::uint64_t{1099511628211u};
+
+  /*!
+   * \return the hash obtained by appending the given bytes to the data
+   * associated with the given hash
+   * \param[in] h: initial hash
+   * \param[in] s: bytes
+   *
+   * \note this function is not meant for cryptographic purposes
+   */
+  constexpr std::uint64_t fnv1a(const std::uint64_t h,
+                                std::string_view s) noexcept {
+    auto r = h;
+    for (const auto c : s) {
+      r ^= static_cast<std::uint64_t>(static_cast<unsigned char>(c));
+      r *= fnv1a_prime;
+    }
+    return r;
+  }  // end of fnv1a
+
+  /*!
+   * \return the hash of the given bytes
+   * \param[in] s: bytes
+   */
+  constexpr std::uint64_t fnv1a(std::string_view s) noexcept {
+    return fnv1a(fnv1a_offset_basis, s);
+  }  // end of fnv1a
+
+}  // end of namespace tfel::utilities
+
+#endif /* LIB_TFEL_UTILITIES_FNV1AHASH_HXX */
@@ -14,8 +14,12 @@
 #ifndef LIB_TFEL_UTILITIES_TEXTDATA_HXX
 #define LIB_TFEL_UTILITIES_TEXTDATA_HXX
 
+#include <map>
+#include <mutex>
 #include <vector>
 #include <string>
+#include <string_view>
+#include <utility>
 
 #include "TFEL/Config/TFELConfig.hxx"
 #include "TFEL/Utilities/Token.hxx"
@@ -24,6 +28,12 @@ namespace tfel::utilities {
 
   /*!
    * \brief class in charge of reading data in a text file
+   *
+   * The file is memory-mapped and the values are stored by columns. The
+   * words of a line are parsed using `std::from_chars`. If one word of a
+   * line is not a number, the line is treated by the `CxxTokenizer` class
+   * and the tokens which are not numbers are stored separately. An error
+   * is reported if a column containing such a token is requested.
    */
   struct TFELUTILITIES_VISIBILITY_EXPORT TextData {
     //! a simple alias
@@ -42,6 +52,7 @@ namespace tfel::utilities {
      * \brief constructor
      * \param[in] file   : file name
      * \param[in] format : file format
+     * \param[in] n      : maximum number of threads used to parse the data
      * Available file formats include:
      * - the default. If the first line is a comment, column legends
      *   are extracted out of it. If the next lines are comments,
@@ -51,8 +62,16 @@ namespace tfel::utilities {
      *   the behaviour of gnuplot when the following command is
      *   used:
      *   set key autotitle columnhead
+     * - binary. The file has been written by the `BinaryDataWriter`
+     *   class. This format is automatically detected, whatever the
+     *   format specified.
+     *
+     * The data lines are parsed in parallel by chunks if more than one
+     * thread is allowed and if the file is large enough.
      */
-    explicit TextData(const std::string&, const std::string& = "");
+    explicit TextData(const std::string&,
+                      const std::string& = "",
+                      const unsigned short = 1);
     //
     TextData() = delete;
     TextData(TextData&&) = delete;
@@ -94,8 +113,14 @@ namespace tfel::utilities {
      * \throw std::runtime_error if no title is found
      */
     [[nodiscard]] std::string getLegend(const size_type c) const;
+    //! \return the number of lines of data
+    [[nodiscard]] size_type getNumberOfLines() const;
     /*!
      * \return an iterator to the first line
+     *
+     * \note the lines are built from the stored data on the first call.
+     * The values of the numerical tokens are given by their shortest
+     * representation and may thus differ from the text of the file.
      */
     [[nodiscard]] std::vector<Line>::const_iterator begin() const;
     /*!
@@ -113,8 +138,36 @@ namespace tfel::utilities {
     void skipLines(const Token::size_type);
 
    private:
-    //! list of all tokens of the file, sorted by line
-    std::vector<Line> lines;
+    //! \brief build the lines returned by the `begin` and `end` methods
+    TFEL_VISIBILITY_LOCAL void buildLines() const;
+    /*!
+     * \brief read the content of a file written by the `BinaryDataWriter`
+     * class
+     * \param[in] s: content of the file
+     * \param[in] f: file name
+     */
+    TFEL_VISIBILITY_LOCAL void readBinaryData(std::string_view,
+                                              const std::string&);
+    //! \brief line numbers of the lines of data
+    std::vector<size_type> numbers;
+    //! \brief number of values of each line of data
+    std::vector<size_type> sizes;
+    /*!
+     * \brief values stored by columns. If a line is shorter than the
+     * column, the value is a NaN.
+     */
+    std::vector<std::vector<double>> columns;
+    /*!
+     * \brief tokens which are not numbers, indexed by their column and
+     * the index of the line of data.
+     */
+    std::map<std::pair<size_type, size_type>, std::string> words;
+    //! \brief minimal number of values over all the lines of data
+    size_type minimal_size = 0;
+    //! \brief flag used to build the lines only once
+    mutable std::once_flag lines_flag;
+    //! \brief lines of tokens, built on demand
+    mutable std::vector<Line> lines;
     //! list of column titles
     std::vector<std::string> legends;
     //! first commented lines
@@ -15,10 +15,14 @@
 #define LIB_TFEL_UTILITIES_TOKEN_HXX
 
 #include <string>
+#include <string_view>
 #include "TFEL/Config/TFELConfig.hxx"
 
 namespace tfel::utilities {
 
+  // forward declaration
+  struct TokenView;
+
   /*!
    * \brief class representing a token in a C++-like file
    */
@@ -49,6 +53,11 @@ namespace tfel::utilities {
           const size_type,
           const size_type,
           const TokenFlag = Standard);
+    /*!
+     * \brief constructor from a token view
+     * \param[in] t: token view
+     */
+    explicit Token(const TokenView&);
     //! \brief copy constructor
     Token(const Token&);
     //! \brief move constructor
@@ -71,11 +80,37 @@ namespace tfel::utilities {
     TokenFlag flag = Standard;
   };  // end of struct Token
 
+  /*!
+   * \brief a non-owning token. The value and the comment are views on
+   * the source parsed by the `CxxTokenizer` class or on strings stored by
+   * this class. Those views are valid until the tokenizer is cleared or
+   * destroyed.
+   */
+  struct TFELUTILITIES_VISIBILITY_EXPORT TokenView {
+    //! a simple alias
+    using size_type = Token::size_type;
+    //! \brief string holded by the token
+    std::string_view value;
+    //! \brief line number
+    size_type line = 0u;
+    //! \brief offset in the line
+    size_type offset = 0u;
+    //! \brief comment
+    std::string_view comment;
+    //! \brief type of the token
+    Token::TokenFlag flag = Token::Standard;
+  };  // end of struct TokenView
+
   /*!
    * \return true if the argument is a comment
    * \param[in] t: token
    */
   TFELUTILITIES_VISIBILITY_EXPORT bool isComment(const Token&);
+  /*!
+   * \return true if the argument is a comment
+   * \param[in] t: token
+   */
+  TFELUTILITIES_VISIBILITY_EXPORT bool isComment(const TokenView&);
 
 }  // end of namespace tfel::utilities
 
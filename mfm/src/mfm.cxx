@@ -28,6 +28,7 @@ struct MFM : tfel::utilities::ArgumentParserBase<MFM>, mfront::MFrontDatabase {
       : tfel::utilities::ArgumentParserBase<MFM>(argc, argv) {
     this->registerCommandLineCallBacks();
     this->parseArguments();
+    this->analyseInputs();
     try {
       for (const auto& e : this->getEntryPoints(this->query)) {
         if (this->show_libs) {
@@ -120,6 +121,27 @@ struct MFM : tfel::utilities::ArgumentParserBase<MFM>, mfront::MFrontDatabase {
     auto interface_filter = [this] {
       this->query.interface_filter = this->currentArgument->getOption();
     };
+    auto index_file_setter = [this] {
+      this->index_file = this->currentArgument->getOption();
+      tfel::raise_if(this->index_file.empty(),
+                     "mfm: no file given to the --index option");
+    };
+    auto number_of_jobs = [this] {
+      const auto& o = this->currentArgument->getOption();
+      if (o.empty()) {
+        // the number of threads is given by the hardware concurrency
+        this->jobs = 0;
+        return;
+      }
+      auto pos = std::size_t{};
+      try {
+        this->jobs = std::stoul(o, &pos);
+      } catch (std::exception&) {
+        pos = 0;
+      }
+      tfel::raise_if((pos != o.size()) || (this->jobs == 0),
+                     "mfm: invalid number of jobs '" + o + "'");
+    };
     this->registerCallBack("--regex-syntax",
                            CallBack("select the syntax used by "
                                     "regular expressions. "
@@ -141,6 +163,18 @@ struct MFM : tfel::utilities::ArgumentParserBase<MFM>, mfront::MFrontDatabase {
             "filter entry points by material knowledge type. Valid types are "
             "material-property, behaviour or model",
             type_filter, true));
+    this->registerCallBack(
+        "--index",
+        CallBack("file used to store the entry points of the analysed "
+                 "libraries. Libraries described in this file are not "
+                 "loaded unless their size or their modification time "
+                 "changed",
+                 index_file_setter, true));
+    this->registerCallBack(
+        "--jobs", "-j",
+        CallBack("number of threads used to analyse the libraries. If no "
+                 "value is given, the number of cores is used.",
+                 number_of_jobs, true));
     this->registerCallBack(
         "--verbose", CallBack("set verbose output", set_verbose_level, true));
     this->registerCallBack(
@@ -172,6 +206,41 @@ struct MFM : tfel::utilities::ArgumentParserBase<MFM>, mfront::MFrontDatabase {
       return;
     }
     throw_if(e[0] == '-', "unsupported option '" + e + "'");
+    this->inputs.push_back(e);
+  }  // end of treatUnknownArgument
+
+  //! \brief analyse the libraries and directories given on the command line
+  void analyseInputs() {
+    if (!this->index_file.empty()) {
+      try {
+        this->loadIndex(this->index_file);
+      } catch (std::exception& error) {
+        if (this->vlevel >= VERBOSE_DEBUG) {
+          std::clog << "Error while loading index '" << this->index_file
+                    << "': " << error.what() << "'\n";
+        }
+      }
+    }
+    for (const auto& e : this->inputs) {
+      this->analyseInput(e);
+    }
+    if (!this->index_file.empty()) {
+      try {
+        this->saveIndex(this->index_file);
+      } catch (std::exception& error) {
+        if (this->vlevel >= VERBOSE_DEBUG) {
+          std::clog << "Error while saving index '" << this->index_file
+                    << "': " << error.what() << "'\n";
+        }
+      }
+    }
+  }  // end of analyseInputs
+
+  /*!
+   * \brief analyse a library or a directory
+   * \param[in] e: library or directory
+   */
+  void analyseInput(const std::string& e) {
     if (this->vlevel >= VERBOSE_LEVEL1) {
       std::clog << "Treating library or directory '" << e << "'\n";
     }
@@ -181,7 +250,8 @@ struct MFM : tfel::utilities::ArgumentParserBase<MFM>, mfront::MFrontDatabase {
         if (this->vlevel >= VERBOSE_LEVEL2) {
           std::clog << "Treating directory '" << e << "'\n";
         }
-        const auto r = this->analyseDirectory(e, {.ignore_errors = true});
+        const auto r = this->analyseDirectory(
+            e, {.ignore_errors = true, .number_of_threads = this->jobs});
         if (this->vlevel >= VERBOSE_DEBUG) {
           if (!r.library_analysis_failures.empty()) {
             std::clog << "Error while treating directory'" << e << ":\n";
@@ -205,7 +275,7 @@ struct MFM : tfel::utilities::ArgumentParserBase<MFM>, mfront::MFrontDatabase {
                   << error.what() << "'\n";
       }
     }
-  }  // end of treatUnknownArgument
+  }  // end of analyseInput
 
   [[nodiscard]] std::string getVersionDescription() const override {
     return "1.0";
@@ -231,6 +301,15 @@ struct MFM : tfel::utilities::ArgumentParserBase<MFM>, mfront::MFrontDatabase {
 
   mfront::MFrontDatabase::Query query;
 
+  //! \brief libraries and directories given on the command line
+  std::vector<std::string> inputs;
+
+  //! \brief index file
+  std::string index_file;
+
+  //! \brief number of threads used to analyse directories
+  std::size_t jobs = 1;
+
   VerboseLevel vlevel = VERBOSE_LEVEL0;
 
   bool show_libs = false;
@@ -124,6 +124,14 @@ namespace mfront {
      */
     [[nodiscard]] virtual const TargetsDescription& getTargetsDescription()
         const = 0;
+    /*!
+     * \return the list of the files read while analysing the input
+     * file: the input file itself, the imported files and the files
+     * describing the material properties, models or behaviours used by
+     * the input file. An empty list means that this list is unknown.
+     * \note This method shall be called *after* the `analyseFile` method.
+     */
+    [[nodiscard]] virtual std::vector<std::string> getInputFiles() const;
     /*!
      * \brief treat the specified file.
      * \note This method shall be called *after* the analyseFile method
@@ -149,6 +149,15 @@ namespace mfront {
     //! if this attribute is true, the implicit algorithm compares the
     //! analytical jacobian to the numeric one
     static const char* const compareToNumericalJacobian;
+    //! if this attribute is true, the numerical jacobian is computed by
+    //! forward automatic differentiation rather than by finite differences
+    static const char* const automaticDifferentiation;
+    //! list of the integration variables condensed when solving the linear
+    //! systems of implicit schemes
+    static const char* const staticCondensationVariables;
+    //! if this attribute is true, the block of the jacobian associated with
+    //! the condensed integration variables is assumed to be diagonal
+    static const char* const staticCondensationDiagonalBlock;
     //! list of jacobian blocks that must be computed numerically
     static const char* const numericallyComputedJacobianBlocks;
     /*!
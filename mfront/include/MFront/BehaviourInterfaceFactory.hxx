@@ -15,6 +15,7 @@
 #define LIB_MFRONBEHAVIOURTINTERFACEFACTORY_HXX
 
 #include <map>
+#include <mutex>
 #include <memory>
 #include <vector>
 #include <string>
@@ -24,6 +25,11 @@
 
 namespace mfront {
 
+  /*!
+   * \brief factory of behaviour interfaces
+   *
+   * \note the methods of this class are thread-safe.
+   */
   struct MFRONT_VISIBILITY_EXPORT BehaviourInterfaceFactory {
     typedef std::shared_ptr<AbstractBehaviourInterface> (*InterfaceCreator)();
 
@@ -69,6 +75,8 @@ namespace mfront {
     InterfaceCreatorsContainer& getInterfaceCreatorsMap() const;
     TFEL_VISIBILITY_LOCAL
     AliasContainer& getAliasesMap() const;
+    //! \brief mutex protecting the maps of the factory
+    mutable std::recursive_mutex m;
   };
 
 }  // end of namespace mfront
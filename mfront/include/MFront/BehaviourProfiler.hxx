@@ -25,18 +25,61 @@
 #include "MFront/MFrontConfig.hxx"
 
 #include <array>
-#include <atomic>
+#include <mutex>
+#include <vector>
+#include <memory>
 #include <string>
+#include <cstdint>
+#include <cstddef>
 
 namespace mfront {
 
   /*!
    * structure in charge of performance measurements in mechanical
    * behaviour
+   *
+   * The measures are accumulated in per-thread shards, so that timers
+   * running concurrently in distinct threads never share a cache line. The
+   * shards are merged when the results are reported, i.e. when the profiler
+   * is destroyed.
+   *
+   * If the `MFRONT_PROFILING_OUTPUT` environment variable is defined, the
+   * merged measures are also written in the file given by this variable, in
+   * the `JSON` format if the file name ends with `.json` and in the `CSV`
+   * format otherwise. The `{behaviour}` substring, if present, is replaced by
+   * the name of the behaviour.
    */
   struct MFRONTPROFILING_VISIBILITY_EXPORT BehaviourProfiler {
     //! a simple alias
     using index_type = unsigned short;
+    //! \brief number of code blocks
+    static constexpr std::size_t number_of_code_blocks = 23;
+    /*!
+     * \brief number of buckets of the histograms. The `i`-th bucket counts
+     * the measures whose duration `t`, expressed in nanoseconds, satisfies
+     * \f$2^{i-1} \leq t < 2^{i}\f$, the last bucket counting all the
+     * measures greater than \f$2^{i-1}\f$.
+     */
+    static constexpr std::size_t number_of_histogram_buckets = 40;
+    //! \brief measures associated with a code block
+    struct MFRONTPROFILING_VISIBILITY_EXPORT CodeBlockMeasures {
+      //! \brief add a new measure (in nanoseconds)
+      void add(const std::intmax_t) noexcept;
+      //! \brief merge the given measures
+      void merge(const CodeBlockMeasures&) noexcept;
+      //! \brief number of calls
+      std::intmax_t count = 0;
+      //! \brief total time spent in the code block (nanoseconds)
+      std::intmax_t total = 0;
+      //! \brief minimal time spent in the code block (nanoseconds)
+      std::intmax_t minimum = 0;
+      //! \brief maximal time spent in the code block (nanoseconds)
+      std::intmax_t maximum = 0;
+      //! \brief logarithmic histogram of the measures
+      std::array<std::intmax_t, number_of_histogram_buckets> histogram = {};
+    };  // end of CodeBlockMeasures
+    //! \brief measures of all code blocks
+    using Measures = std::array<CodeBlockMeasures, number_of_code_blocks>;
     /*!
      * a timer for a specicied code block.
      * This descructor will increase the time count for the code block.
@@ -138,14 +181,35 @@ namespace mfront {
         APOSTERIORITIMESTEPSCALINGFACTOR = 21;
     //! code block index in the measures array
     static MFRONTBEHAVIOURPROFILER_CONST_QUALIFIER index_type TOTALTIME = 22;
+    /*!
+     * \return the measures of all threads merged together
+     * \note this method shall not be called while timers are running
+     */
+    Measures getMeasures() const;
     //! destructor
     ~BehaviourProfiler();
 
    protected:
+    /*!
+     * \brief measures associated with one thread. This structure is aligned
+     * on a cache line to avoid false sharing between threads.
+     */
+    struct alignas(64) ThreadMeasures {
+      //! \brief measures
+      Measures measures;
+    };
+    //! \return the measures associated with the calling thread
+    ThreadMeasures& getThreadMeasures();
+    //! \brief write the measures in the file given by the environment
+    void writeMeasures(const Measures&) const;
     //! name of the behaviour
     const std::string name;
-    //! time spend in each code block (nanoseconds)
-    std::array<std::atomic<intmax_t>, 23> measures;
+    //! \brief unique identifier of the profiler
+    const std::size_t identifier;
+    //! \brief mutex protecting the list of the per-thread measures
+    mutable std::mutex m;
+    //! \brief per-thread measures
+    std::vector<std::unique_ptr<ThreadMeasures>> shards;
   };  // end of BehaviourProfiler
 
 }  // end of namespace mfront
@@ -0,0 +1,135 @@
+/*!
+ * \file   mfront/include/MFront/BuildCache.hxx
+ * \brief  This file declares the `SourcesCache` and `ObjectsCache` classes
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright Copyright (C) 2006-2025 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_MFRONT_BUILDCACHE_HXX
+#define LIB_MFRONT_BUILDCACHE_HXX
+
+#include <string>
+#include <vector>
+#include <optional>
+#include <string_view>
+#include "MFront/MFrontConfig.hxx"
+#include "MFront/TargetsDescription.hxx"
+
+namespace mfront {
+
+  /*!
+   * \return a hexadecimal representation of the 64 bits FNV-1a hash
+   * of the given string
+   * \param[in] s: string
+   */
+  MFRONT_VISIBILITY_EXPORT std::string computeHash(std::string_view);
+  /*!
+   * \return a hexadecimal representation of the 64 bits FNV-1a hash
+   * of the content of the given file, or an empty string if the file
+   * can't be read
+   * \param[in] f: file
+   */
+  MFRONT_VISIBILITY_EXPORT std::string computeFileHash(const std::string&);
+
+  /*!
+   * \brief a structure recording, for each input file, the hash of all
+   * the files read during its analysis and the targets generated from
+   * it.
+   *
+   * An entry is only valid if the generation options, the input file
+   * and all its dependencies are unchanged and if the generated files
+   * still exist. This allows to skip code generation in the
+   * incremental mode of `MFront`.
+   *
+   * The entries are stored in the `src/mfront-cache` directory.
+   */
+  struct MFRONT_VISIBILITY_EXPORT SourcesCache {
+    /*!
+     * \brief constructor
+     * \param[in] h: hash of the options used to generate the sources
+     */
+    explicit SourcesCache(std::string);
+    /*!
+     * \return the targets generated by the given file if the entry
+     * associated with this file is valid, an empty optional otherwise.
+     * \param[in] f: input file
+     */
+    [[nodiscard]] std::optional<TargetsDescription> get(
+        const std::string&) const;
+    /*!
+     * \brief store the entry associated with the given file
+     * \param[in] f: input file
+     * \param[in] deps: files read during the analysis of the input file
+     * \param[in] t: targets generated by the input file
+     */
+    void store(const std::string&,
+               const std::vector<std::string>&,
+               const TargetsDescription&) const;
+
+   private:
+    //! \return the entry associated with the given file
+    [[nodiscard]] static std::string getEntryPath(const std::string&);
+    //! \brief hash of the generation options
+    const std::string options_hash;
+  };  // end of struct SourcesCache
+
+  /*!
+   * \brief a content-addressed cache of object files, which may be
+   * shared between build directories.
+   *
+   * The key associated with an object file is built from:
+   * - a global key describing the compiler and the compilation options.
+   * - the preprocessor flags of the library.
+   * - the content of the source file and of the local headers it
+   *   includes, directly or indirectly, i.e. the headers found in the
+   *   `include` and `src` directories.
+   */
+  struct MFRONT_VISIBILITY_EXPORT ObjectsCache {
+    /*!
+     * \brief constructor
+     * \param[in] d: cache directory
+     * \param[in] k: global key
+     */
+    ObjectsCache(std::string, std::string);
+    /*!
+     * \brief copy cached object files in the `src` directory when
+     * those object files are missing or out of date.
+     * \return the list of the restored object files
+     * \param[in] t: targets description
+     */
+    std::vector<std::string> restore(const TargetsDescription&) const;
+    /*!
+     * \brief store the object files of the `src` directory not yet
+     * available in the cache.
+     * \param[in] t: targets description
+     */
+    void store(const TargetsDescription&) const;
+
+   private:
+    /*!
+     * \brief a structure describing a cacheable object file
+     */
+    struct CachedObject {
+      //! \brief path of the object file in the `src` directory
+      std::string object;
+      //! \brief path of the object file in the cache
+      std::string entry;
+    };
+    //! \return the cacheable object files associated with a description
+    [[nodiscard]] std::vector<CachedObject> getCachedObjects(
+        const TargetsDescription&) const;
+    //! \brief cache directory
+    const std::string directory;
+    //! \brief global key
+    const std::string key;
+  };  // end of struct ObjectsCache
+
+}  // end of namespace mfront
+
+#endif /* LIB_MFRONT_BUILDCACHE_HXX */
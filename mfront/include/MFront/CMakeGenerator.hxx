@@ -45,6 +45,16 @@ namespace mfront {
    */
   MFRONT_VISIBILITY_EXPORT void callCMake(const std::string&,
                                           const std::string& = "src");
+  /*!
+   * \brief a function calling the `cmake` utility in the given
+   * directory.
+   * \param[in] t : target name
+   * \param[in] o : options
+   * \param[in] d : directory
+   */
+  MFRONT_VISIBILITY_EXPORT void callCMake(const std::string&,
+                                          const GeneratorOptions&,
+                                          const std::string& = "src");
 
 }  // end of namespace mfront
 
@@ -86,6 +86,7 @@ namespace mfront {
     [[nodiscard]] const FileDescription& getFileDescription() const final;
     [[nodiscard]] const TargetsDescription& getTargetsDescription()
         const override;
+    [[nodiscard]] std::vector<std::string> getInputFiles() const override;
     /*!
      * \brief open a file and add given external instructions at the
      * beginning
@@ -477,6 +478,11 @@ namespace mfront {
      */
     [[nodiscard]] std::pair<std::string, VariableBoundsDescription>
     readVariableBounds();
+    /*!
+     * \brief add the given files to the list of input files
+     * \param[in] files: files read while analysing the input file
+     */
+    virtual void addInputFiles(const std::vector<std::string>&);
     /*!
      * call mfront in a subprocess
      * \param[in] files      : list of files
@@ -608,6 +614,8 @@ namespace mfront {
      * `completeTargetsDescription` method.
      */
     TargetsDescription td;
+    //! \brief files read while analysing the input file
+    std::vector<std::string> input_files;
     //! \brief additional linker flags
     std::vector<std::string> ldflags;
     //! \brief additional libraries's sources
@@ -15,6 +15,7 @@
 #define LIB_MFRONTPARSERFACTORY_HXX
 
 #include <map>
+#include <mutex>
 #include <vector>
 #include <string>
 #include <memory>
@@ -28,6 +29,8 @@ namespace mfront {
   /*!
    * \brief an abstract factory for the domain specific languages supported by
    * `MFront` implemented using the singleton pattern.
+   *
+   * \note the methods of this class are thread-safe.
    */
   struct MFRONT_VISIBILITY_EXPORT DSLFactory {
     //! \brief a simple alias
@@ -84,9 +87,19 @@ namespace mfront {
     std::map<std::string, std::vector<std::string>> aliases;
     //! \brief list of descriptions
     std::map<std::string, DescriptionGenerator> descriptions;
+    //! \brief mutex protecting the generators, aliases and descriptions
+    mutable std::mutex generators_mutex;
     //! \brief default constructor
     TFEL_VISIBILITY_LOCAL
     DSLFactory();
+    /*!
+     * \return the name of the DSL associated with the given alias, or the
+     * given name if it is not an alias.
+     * \param[in] n: name or alias of a DSL
+     * \note the mutex must be locked by the caller
+     */
+    TFEL_VISIBILITY_LOCAL const std::string& getDSLNameFromAlias(
+        const std::string&) const;
   };  // end of struct DSLFactory
 
 }  // end of namespace mfront
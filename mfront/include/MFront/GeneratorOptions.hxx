@@ -16,6 +16,7 @@
 
 #include <string>
 #include <vector>
+#include <cstddef>
 #include "MFront/MFrontConfig.hxx"
 
 namespace mfront {
@@ -91,6 +92,18 @@ namespace mfront {
     bool nodeps = false;
 #endif /* (defined _WIN32 || defined _WIN64 ||defined __CYGWIN__) */
     bool melt = true;
+    //! \brief number of jobs used to build the libraries
+    std::size_t jobs = 1;
+    /*!
+     * \brief boolean stating if the `TFEL` headers shared by the
+     * generated sources shall be precompiled.
+     */
+    bool precompiledHeaders = false;
+    /*!
+     * \brief boolean stating if the generated sources of each library
+     * shall be compiled in a single translation unit.
+     */
+    bool unityBuild = false;
   };  // end of struct GeneratorOptions
 
 }  // end of namespace mfront
@@ -0,0 +1,166 @@
+/*!
+ * \file   include/MFront/GenericBehaviour/BatchBehaviourData.h
+ * \brief  This file declares the structures used to integrate a behaviour
+ * over a set of integration points in a single call.
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright Copyright (C) 2006-2025 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with linking exception
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_MFRONT_GENERICBEHAVIOUR_BATCHBEHAVIOURDATA_H
+#define LIB_MFRONT_GENERICBEHAVIOUR_BATCHBEHAVIOURDATA_H
+
+#include "MFront/GenericBehaviour/Types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/*!
+ * \brief description of a read-only array holding the values of a variable
+ * for a set of integration points.
+ *
+ * The `i`-th component of the variable at the `p`-th integration point is
+ * stored at `values[p * point_stride + i * component_stride]`. Hence:
+ *
+ * - an array of structures (all the components of one point are contiguous)
+ *   is described by `point_stride = size` and `component_stride = 1`,
+ * - a structure of arrays (the values of one component are contiguous) is
+ *   described by `point_stride = 1` and `component_stride = n` where `n` is
+ *   the number of integration points.
+ *
+ * \note `values` can be null if `size` is null.
+ */
+typedef struct {
+  //! \brief pointer to the values
+  const mfront_gb_real* values;
+  //! \brief number of components per integration point
+  mfront_gb_size_type size;
+  //! \brief offset between two successive integration points
+  mfront_gb_size_type point_stride;
+  //! \brief offset between two successive components
+  mfront_gb_size_type component_stride;
+} mfront_gb_ConstBatchArray;
+
+/*!
+ * \brief description of a mutable array holding the values of a variable
+ * for a set of integration points.
+ * \see mfront_gb_ConstBatchArray for details on the memory layout.
+ */
+typedef struct {
+  //! \brief pointer to the values
+  mfront_gb_real* values;
+  //! \brief number of components per integration point
+  mfront_gb_size_type size;
+  //! \brief offset between two successive integration points
+  mfront_gb_size_type point_stride;
+  //! \brief offset between two successive components
+  mfront_gb_size_type component_stride;
+} mfront_gb_BatchArray;
+
+//! \brief state of a set of integration points at the end of the time step
+typedef struct {
+  //! \brief value of the gradients
+  mfront_gb_ConstBatchArray gradients;
+  //! \brief values of the thermodynamic_forces
+  mfront_gb_BatchArray thermodynamic_forces;
+  //! \brief volumetric mass density in the reference configuration
+  mfront_gb_ConstBatchArray mass_density;
+  //! \brief values of the material properties
+  mfront_gb_ConstBatchArray material_properties;
+  //! \brief values of the internal state variables
+  mfront_gb_BatchArray internal_state_variables;
+  //! \brief stored energy (optional)
+  mfront_gb_BatchArray stored_energy;
+  //! \brief dissipated energy (optional)
+  mfront_gb_BatchArray dissipated_energy;
+  //! \brief values of the external state variables
+  mfront_gb_ConstBatchArray external_state_variables;
+} mfront_gb_BatchState;
+
+//! \brief state of a set of integration points at the beginning of the time
+//! step
+typedef struct {
+  //! \brief value of the gradients
+  mfront_gb_ConstBatchArray gradients;
+  //! \brief values of the thermodynamic_forces
+  mfront_gb_ConstBatchArray thermodynamic_forces;
+  //! \brief volumetric mass density in the reference configuration
+  mfront_gb_ConstBatchArray mass_density;
+  //! \brief values of the material properties
+  mfront_gb_ConstBatchArray material_properties;
+  //! \brief values of the internal state variables
+  mfront_gb_ConstBatchArray internal_state_variables;
+  //! \brief stored energy (optional)
+  mfront_gb_ConstBatchArray stored_energy;
+  //! \brief dissipated energy (optional)
+  mfront_gb_ConstBatchArray dissipated_energy;
+  //! \brief values of the external state variables
+  mfront_gb_ConstBatchArray external_state_variables;
+} mfront_gb_BatchInitialState;
+
+/*!
+ * \brief structure passed to the integration of a behaviour over a set of
+ * integration points.
+ */
+#ifndef MFRONT_GB_BATCHBEHAVIOURDATA_FORWARD_DECLARATION
+typedef struct mfront_gb_BatchBehaviourData mfront_gb_BatchBehaviourData;
+#endif
+
+/*!
+ * \brief structure passed to the integration of a behaviour over a set of
+ * integration points.
+ *
+ * The meaning of each member is the same than the one of the members of the
+ * `mfront_gb_BehaviourData` structure for one integration point.
+ */
+struct mfront_gb_BatchBehaviourData {
+  /*!
+   * \brief pointer to a buffer used to store error message
+   *
+   * \note This pointer can be nullptr.  If not null, the pointer must
+   * point to a buffer which is at least 512 characters wide. Only the
+   * error message associated with the first integration point for which
+   * the integration failed is reported.
+   */
+  char* error_message;
+  //! \brief number of integration points
+  mfront_gb_size_type n;
+  //! \brief time increment
+  mfront_gb_real dt;
+  /*!
+   * \brief the stiffness matrices.
+   *
+   * On input, the first components of the stiffness matrix associated with
+   * each integration point have the same meaning as in the
+   * `mfront_gb_BehaviourData` structure.
+   */
+  mfront_gb_BatchArray K;
+  //! \brief proposed time step increment increase factors (`n` values)
+  mfront_gb_real* rdt;
+  /*!
+   * \brief speeds of sound (`n` values, only computed if requested).
+   * \note This pointer can be nullptr if the speed of sound is not requested.
+   */
+  mfront_gb_real* speed_of_sound;
+  /*!
+   * \brief status of the integration at each integration point (`n` values)
+   * \note This pointer can be nullptr.
+   */
+  int* status;
+  //! \brief state at the beginning of the time step
+  mfront_gb_BatchInitialState s0;
+  //! \brief state at the end of the time step
+  mfront_gb_BatchState s1;
+};
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* LIB_MFRONT_GENERICBEHAVIOUR_BATCHBEHAVIOURDATA_H */
@@ -0,0 +1,268 @@
+/*!
+ * \file   mfront/include/MFront/GenericBehaviour/BatchIntegrate.hxx
+ * \brief  This file implements the integration of a behaviour over a set of
+ * integration points.
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright Copyright (C) 2006-2025 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_MFRONT_GENERICBEHAVIOUR_BATCHINTEGRATE_HXX
+#define LIB_MFRONT_GENERICBEHAVIOUR_BATCHINTEGRATE_HXX
+
+#include <vector>
+#include <algorithm>
+#include <type_traits>
+#include "MFront/GenericBehaviour/Types.hxx"
+#include "MFront/GenericBehaviour/BehaviourData.h"
+#include "MFront/GenericBehaviour/BatchBehaviourData.h"
+
+namespace mfront::gb {
+
+  //! \brief a simple alias
+  using BatchBehaviourData = ::mfront_gb_BatchBehaviourData;
+
+  namespace internals {
+
+    /*!
+     * \brief an helper class giving access to the values of an array
+     * associated with one integration point.
+     *
+     * If the components of a point are not contiguous in memory, the values
+     * are gathered in a buffer before the integration and scattered back
+     * after the integration.
+     *
+     * \tparam ArrayType: type of the array (`mfront_gb_ConstBatchArray` or
+     * `mfront_gb_BatchArray`)
+     */
+    template <typename ArrayType>
+    struct BatchArrayHandler {
+      //! \brief type of the pointer to the values
+      using pointer = decltype(ArrayType::values);
+      /*!
+       * \return if the values associated with an integration point must be
+       * copied in a buffer.
+       * \param[in] a: array
+       */
+      static bool requiresCopy(const ArrayType& a) noexcept {
+        return (a.values != nullptr) && (a.size > 1) &&
+               (a.component_stride != 1);
+      }
+      /*!
+       * \return the size of the buffer required to handle the given array
+       * \param[in] a: array
+       */
+      static mfront_gb_size_type getBufferSize(const ArrayType& a) noexcept {
+        return requiresCopy(a) ? a.size : 0;
+      }
+      /*!
+       * \brief constructor
+       * \param[in] a: array
+       * \param[in,out] o: offset of the next free location in the buffer
+       * associated with an integration point
+       */
+      BatchArrayHandler(const ArrayType& a, mfront_gb_size_type& o) noexcept
+          : array(a), offset(o), copy(requiresCopy(a)) {
+        o += getBufferSize(a);
+      }
+      /*!
+       * \return a pointer to the values associated with an integration point.
+       * \param[in] p: index of the integration point
+       * \param[in] b: buffer associated with the integration point
+       */
+      pointer load(const mfront_gb_size_type p, real* const b) const noexcept {
+        if (this->array.values == nullptr) {
+          return nullptr;
+        }
+        const auto o = p * this->array.point_stride;
+        if (!this->copy) {
+          return this->array.values + o;
+        }
+        auto* const v = b + this->offset;
+        for (mfront_gb_size_type i = 0; i != this->array.size; ++i) {
+          v[i] = this->array.values[o + i * this->array.component_stride];
+        }
+        return v;
+      }
+      /*!
+       * \brief copy back the values stored in the buffer, if any.
+       * \param[in] p: index of the integration point
+       * \param[in] b: buffer associated with the integration point
+       */
+      void store(const mfront_gb_size_type p,
+                 const real* const b) const noexcept {
+        if constexpr (!std::is_const_v<std::remove_pointer_t<pointer>>) {
+          if (!this->copy) {
+            return;
+          }
+          const auto o = p * this->array.point_stride;
+          const auto* const v = b + this->offset;
+          for (mfront_gb_size_type i = 0; i != this->array.size; ++i) {
+            this->array.values[o + i * this->array.component_stride] = v[i];
+          }
+        } else {
+          static_cast<void>(p);
+          static_cast<void>(b);
+        }
+      }
+
+     private:
+      //! \brief underlying array
+      const ArrayType array;
+      //! \brief offset of the values in the buffer, if required
+      const mfront_gb_size_type offset;
+      //! \brief boolean stating if a copy is required
+      const bool copy;
+    };  // end of BatchArrayHandler
+
+    /*!
+     * \brief an helper class used to integrate a behaviour at one integration
+     * point of a set of integration points.
+     *
+     * The integration of one point only modifies the values associated with
+     * this point, so that distinct points can be treated concurrently
+     * provided that each of them is given its own buffer.
+     */
+    struct BatchIntegrator {
+      /*!
+       * \brief constructor
+       * \param[in] bd: behaviour data
+       */
+      BatchIntegrator(const BatchBehaviourData& bd) noexcept
+          : d(bd),
+            buffer_size(0),
+            K(bd.K, buffer_size),
+            g0(bd.s0.gradients, buffer_size),
+            th0(bd.s0.thermodynamic_forces, buffer_size),
+            rho0(bd.s0.mass_density, buffer_size),
+            mp0(bd.s0.material_properties, buffer_size),
+            isvs0(bd.s0.internal_state_variables, buffer_size),
+            se0(bd.s0.stored_energy, buffer_size),
+            de0(bd.s0.dissipated_energy, buffer_size),
+            esvs0(bd.s0.external_state_variables, buffer_size),
+            g1(bd.s1.gradients, buffer_size),
+            th1(bd.s1.thermodynamic_forces, buffer_size),
+            rho1(bd.s1.mass_density, buffer_size),
+            mp1(bd.s1.material_properties, buffer_size),
+            isvs1(bd.s1.internal_state_variables, buffer_size),
+            se1(bd.s1.stored_energy, buffer_size),
+            de1(bd.s1.dissipated_energy, buffer_size),
+            esvs1(bd.s1.external_state_variables, buffer_size) {}
+      //! \return the size of the buffer required by one integration point
+      mfront_gb_size_type getBufferSize() const noexcept {
+        return this->buffer_size;
+      }
+      /*!
+       * \brief integrate the behaviour at one integration point
+       * \param[in] f: function integrating the behaviour at one integration
+       * point
+       * \param[in] p: index of the integration point
+       * \param[in] b: buffer associated with the integration point
+       * \param[in] e: buffer used to report an error message (may be null)
+       */
+      template <typename IntegrationFunction>
+      int integrate(const IntegrationFunction& f,
+                    const mfront_gb_size_type p,
+                    real* const b,
+                    char* const e) const {
+        auto pd = mfront_gb_BehaviourData{};
+        pd.error_message = e;
+        pd.dt = this->d.dt;
+        pd.K = this->K.load(p, b);
+        pd.rdt = this->d.rdt + p;
+        pd.speed_of_sound = (this->d.speed_of_sound == nullptr)
+                                ? nullptr
+                                : this->d.speed_of_sound + p;
+        pd.s0.gradients = this->g0.load(p, b);
+        pd.s0.thermodynamic_forces = this->th0.load(p, b);
+        pd.s0.mass_density = this->rho0.load(p, b);
+        pd.s0.material_properties = this->mp0.load(p, b);
+        pd.s0.internal_state_variables = this->isvs0.load(p, b);
+        pd.s0.stored_energy = this->se0.load(p, b);
+        pd.s0.dissipated_energy = this->de0.load(p, b);
+        pd.s0.external_state_variables = this->esvs0.load(p, b);
+        pd.s1.gradients = this->g1.load(p, b);
+        pd.s1.thermodynamic_forces = this->th1.load(p, b);
+        pd.s1.mass_density = this->rho1.load(p, b);
+        pd.s1.material_properties = this->mp1.load(p, b);
+        pd.s1.internal_state_variables = this->isvs1.load(p, b);
+        pd.s1.stored_energy = this->se1.load(p, b);
+        pd.s1.dissipated_energy = this->de1.load(p, b);
+        pd.s1.external_state_variables = this->esvs1.load(p, b);
+        const auto r = f(pd);
+        this->K.store(p, b);
+        this->th1.store(p, b);
+        this->isvs1.store(p, b);
+        if (this->d.status != nullptr) {
+          this->d.status[p] = r;
+        }
+        return r;
+      }  // end of integrate
+
+     private:
+      //! \brief a simple alias
+      using ConstArrayHandler = BatchArrayHandler<mfront_gb_ConstBatchArray>;
+      //! \brief a simple alias
+      using ArrayHandler = BatchArrayHandler<mfront_gb_BatchArray>;
+      //! \brief behaviour data
+      const BatchBehaviourData& d;
+      //! \brief size of the buffer required by one integration point
+      mfront_gb_size_type buffer_size;
+      // handlers of the arrays
+      const ArrayHandler K;
+      const ConstArrayHandler g0;
+      const ConstArrayHandler th0;
+      const ConstArrayHandler rho0;
+      const ConstArrayHandler mp0;
+      const ConstArrayHandler isvs0;
+      const ConstArrayHandler se0;
+      const ConstArrayHandler de0;
+      const ConstArrayHandler esvs0;
+      const ConstArrayHandler g1;
+      const ArrayHandler th1;
+      const ConstArrayHandler rho1;
+      const ConstArrayHandler mp1;
+      const ArrayHandler isvs1;
+      const ArrayHandler se1;
+      const ArrayHandler de1;
+      const ConstArrayHandler esvs1;
+    };  // end of BatchIntegrator
+
+  }  // end of namespace internals
+
+  /*!
+   * \brief integrate a behaviour over a set of integration points
+   * \tparam IntegrationFunction: type of the function used to integrate the
+   * behaviour over one integration point.
+   * \param[in,out] d: behaviour data
+   * \param[in] f: function integrating the behaviour at one integration point
+   * \return the minimum of the values returned at each integration point,
+   * i.e. `1` if all integrations succeeded, `0` if all integrations
+   * succeeded but a time step reduction is proposed and `-1` if at least one
+   * integration failed.
+   */
+  template <typename IntegrationFunction>
+  int integrateBatch(BatchBehaviourData& d, const IntegrationFunction& f) {
+    const auto i = internals::BatchIntegrator(d);
+    auto buffer = std::vector<real>(i.getBufferSize());
+    auto r = 1;
+    auto* error_message = d.error_message;
+    for (mfront_gb_size_type p = 0; p != d.n; ++p) {
+      const auto rp = i.integrate(f, p, buffer.data(), error_message);
+      if (rp < 0) {
+        // only the first error message is kept
+        error_message = nullptr;
+      }
+      r = std::min(r, rp);
+    }
+    return r;
+  }  // end of integrateBatch
+
+}  // end of namespace mfront::gb
+
+#endif /* LIB_MFRONT_GENERICBEHAVIOUR_BATCHINTEGRATE_HXX */
@@ -0,0 +1,82 @@
+/*!
+ * \file   mfront/include/MFront/GenericBehaviour/ParallelBatchIntegrate.hxx
+ * \brief  This file implements the integration of a behaviour over a set of
+ * integration points using the parallel algorithms of the standard library.
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright Copyright (C) 2006-2025 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_MFRONT_GENERICBEHAVIOUR_PARALLELBATCHINTEGRATE_HXX
+#define LIB_MFRONT_GENERICBEHAVIOUR_PARALLELBATCHINTEGRATE_HXX
+
+#include <atomic>
+#include <vector>
+#include <numeric>
+#include <execution>
+#include <algorithm>
+#include <functional>
+#include <type_traits>
+#include "MFront/GenericBehaviour/BatchIntegrate.hxx"
+
+namespace mfront::gb {
+
+  /*!
+   * \brief integrate a behaviour over a set of integration points using the
+   * given execution policy.
+   *
+   * \tparam ExecutionPolicy: type of the execution policy
+   * \tparam IntegrationFunction: type of the function used to integrate the
+   * behaviour over one integration point.
+   * \param[in] policy: execution policy
+   * \param[in,out] d: behaviour data
+   * \param[in] f: function integrating the behaviour at one integration point
+   * \return the minimum of the values returned at each integration point.
+   *
+   * \note if the integration fails at several integration points, the
+   * reported error message is the one of one of those points, which is not
+   * necessarily the first one.
+   */
+  template <typename ExecutionPolicy, typename IntegrationFunction>
+  std::enable_if_t<
+      std::is_execution_policy_v<std::remove_cvref_t<ExecutionPolicy>>,
+      int>
+  integrateBatch(ExecutionPolicy&& policy,
+                 BatchBehaviourData& d,
+                 const IntegrationFunction& f) {
+    const auto i = internals::BatchIntegrator(d);
+    const auto bs = i.getBufferSize();
+    auto buffer = std::vector<real>(bs * d.n);
+    // the indices of the integration points are explicitly stored, as some
+    // implementations only parallelize loops over random access iterators
+    auto indices = std::vector<mfront_gb_size_type>(d.n);
+    std::iota(indices.begin(), indices.end(), mfront_gb_size_type{});
+    auto error_reported = std::atomic<bool>{d.error_message == nullptr};
+    return std::transform_reduce(
+        std::forward<ExecutionPolicy>(policy), indices.begin(), indices.end(),
+        1, [](const int a, const int b) { return std::min(a, b); },
+        [&i, &f, &d, &error_reported, &buffer,
+         bs](const mfront_gb_size_type p) {
+          auto* const b = buffer.data() + p * bs;
+          if (error_reported.load()) {
+            return i.integrate(f, p, b, nullptr);
+          }
+          // a local buffer is used so that only one integration point
+          // writes in the error message
+          char e[512] = {'\0'};
+          const auto r = i.integrate(f, p, b, e);
+          if ((r < 0) && (!error_reported.exchange(true))) {
+            std::copy(e, e + 512, d.error_message);
+          }
+          return r;
+        });
+  }  // end of integrateBatch
+
+}  // end of namespace mfront::gb
+
+#endif /* LIB_MFRONT_GENERICBEHAVIOUR_PARALLELBATCHINTEGRATE_HXX */
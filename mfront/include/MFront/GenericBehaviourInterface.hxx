@@ -15,9 +15,17 @@
 #define LIB_MFRONT_GENERICBEHAVIOURINTERFACE_HXX
 
 #include <set>
+#include <memory>
 #include <optional>
 #include "MFront/BehaviourInterfaceBase.hxx"
 
+namespace mfront::generic_parallel::behaviour {
+
+  // forward declaration
+  struct AbstractBackend;
+
+}  // end of namespace mfront::generic_parallel::behaviour
+
 namespace mfront {
 
   /*!
@@ -35,7 +43,10 @@ namespace mfront {
      * changes.
      */
     [[nodiscard]] static unsigned short getAPIVersion();
+    //! \brief default constructor
+    GenericBehaviourInterface();
     //
+    void setOptions(const DataMap&) override;
     [[nodiscard]] std::string getInterfaceName() const override;
     [[nodiscard]] std::pair<bool, tokens_iterator> treatKeyword(
         BehaviourDescription&,
@@ -106,6 +117,12 @@ namespace mfront {
     //! \brief list of selected hypotheses
     std::optional<std::set<GenericBehaviourInterface::Hypothesis>>
         selectedHypotheses;
+    /*!
+     * \brief backend used to integrate the behaviour over a set of
+     * integration points
+     */
+    std::unique_ptr<const generic_parallel::behaviour::AbstractBackend>
+        backend;
   };  // end of struct GenericBehaviourInterface
 
 }  // end of namespace mfront
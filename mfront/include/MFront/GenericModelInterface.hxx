@@ -14,8 +14,16 @@
 #ifndef LIB_MFRONT_GENERICMODELINTERFACE_HXX
 #define LIB_MFRONT_GENERICMODELINTERFACE_HXX
 
+#include <memory>
 #include "MFront/AbstractModelInterface.hxx"
 
+namespace mfront::generic_parallel::behaviour {
+
+  // forward declaration
+  struct AbstractBackend;
+
+}  // end of namespace mfront::generic_parallel::behaviour
+
 namespace mfront {
 
   /*!
@@ -63,6 +71,12 @@ namespace mfront {
      */
     virtual void writeSourceFile(const FileDescription &,
                                  const ModelDescription &);
+    /*!
+     * \brief backend used to evaluate the model over a set of integration
+     * points
+     */
+    std::unique_ptr<const generic_parallel::behaviour::AbstractBackend>
+        backend;
 
   };  // end of struct GenericModelInterface
 
@@ -0,0 +1,72 @@
+/*!
+ * \file   MFront/GenericParallel/Behaviour/AbstractBackend.hxx
+ * \brief  This file declares the `AbstractBackend` class
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright Copyright (C) 2006-2025 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_MFRONT_GENERICPARALLEL_BEHAVIOUR_ABSTRACTBACKEND_HXX
+#define LIB_MFRONT_GENERICPARALLEL_BEHAVIOUR_ABSTRACTBACKEND_HXX
+
+#include <iosfwd>
+#include <string>
+#include <string_view>
+#include "MFront/MFrontConfig.hxx"
+
+namespace mfront {
+  // forward declaration
+  struct LibraryDescription;
+}  // end of namespace mfront
+
+namespace mfront::generic_parallel::behaviour {
+
+  /*!
+   * \brief an abstract class which aims at writing the code integrating a
+   * behaviour (or evaluating a model) over a set of integration points.
+   *
+   * Backends are used by the `generic` interfaces for behaviours and models
+   * to generate the functions exported with the `_batch` suffix.
+   */
+  struct MFRONT_VISIBILITY_EXPORT AbstractBackend {
+    //! \brief return the name of the backend
+    [[nodiscard]] virtual std::string getName() const = 0;
+    /*!
+     * \brief write additional headers in the source file
+     *
+     * \param[in] os: output stream
+     */
+    virtual void writeSpecificIncludesInSourceFile(std::ostream&) const = 0;
+    /*!
+     * \brief write an expression returning the result of the integration over
+     * all the integration points
+     *
+     * \param[in] os: output stream
+     * \param[in] d: name of the variable of type
+     * `mfront_gb_BatchBehaviourData`
+     * \param[in] f: name of the variable holding the function which
+     * integrates the behaviour at one integration point
+     */
+    virtual void writeBatchIntegration(std::ostream&,
+                                       std::string_view,
+                                       std::string_view) const = 0;
+    /*!
+     * \brief add the compilation and linking flags required by the
+     * backend to the description of the generated library. By default, no
+     * flag is added.
+     *
+     * \param[in,out] l: library description
+     */
+    virtual void completeLibraryDescription(LibraryDescription&) const;
+    //! \brief destructor
+    virtual ~AbstractBackend() noexcept;
+  };  // end of AbstractBackend
+
+}  // end of namespace mfront::generic_parallel::behaviour
+
+#endif /* LIB_MFRONT_GENERICPARALLEL_BEHAVIOUR_ABSTRACTBACKEND_HXX */
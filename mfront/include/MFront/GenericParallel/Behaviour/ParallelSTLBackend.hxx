@@ -0,0 +1,60 @@
+/*!
+ * \file   MFront/GenericParallel/Behaviour/ParallelSTLBackend.hxx
+ * \brief  This file declares the `ParallelSTLBackend` class
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright Copyright (C) 2006-2025 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_MFRONT_GENERICPARALLEL_BEHAVIOUR_PARALLELSTLBACKEND_HXX
+#define LIB_MFRONT_GENERICPARALLEL_BEHAVIOUR_PARALLELSTLBACKEND_HXX
+
+#include "TFEL/Utilities/Data.hxx"
+#include "MFront/MFrontConfig.hxx"
+#include "MFront/GenericParallel/Behaviour/AbstractBackend.hxx"
+
+namespace mfront::generic_parallel::behaviour {
+
+  /*!
+   * \brief This class implements a backend for the parallel STL algorithms
+   *
+   * The implementation of the parallel algorithms of the GNU standard
+   * library relies on TBB. If TFEL was built with TBB and a parallel
+   * execution policy is selected, the generated libraries are linked with
+   * it. Otherwise, the serial implementation of those algorithms is
+   * explicitly selected.
+   */
+  struct MFRONT_VISIBILITY_EXPORT ParallelSTLBackend final : AbstractBackend {
+    //! \brief default constructor
+    ParallelSTLBackend();
+    /*!
+     * \brief constructor
+     *
+     * \param[in] opts: options
+     */
+    ParallelSTLBackend(const tfel::utilities::DataMap&);
+    //
+    [[nodiscard]] std::string getName() const override;
+    void writeSpecificIncludesInSourceFile(std::ostream&) const override;
+    void writeBatchIntegration(std::ostream&,
+                               std::string_view,
+                               std::string_view) const override;
+    void completeLibraryDescription(LibraryDescription&) const override;
+    //! \brief destructor
+    ~ParallelSTLBackend() noexcept override;
+
+   private:
+    //! \return if the execution policy is a parallel one
+    [[nodiscard]] bool isParallelExecutionPolicy() const;
+    //! \brief execution policy
+    std::string execution_policy;
+  };  // end of ParallelSTLBackend
+
+}  // end of namespace mfront::generic_parallel::behaviour
+
+#endif /* LIB_MFRONT_GENERICPARALLEL_BEHAVIOUR_PARALLELSTLBACKEND_HXX */
@@ -0,0 +1,48 @@
+/*!
+ * \file   MFront/GenericParallel/Behaviour/SequentialBackend.hxx
+ * \brief  This file declares the `SequentialBackend` class
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright Copyright (C) 2006-2025 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_MFRONT_GENERICPARALLEL_BEHAVIOUR_SEQUENTIALBACKEND_HXX
+#define LIB_MFRONT_GENERICPARALLEL_BEHAVIOUR_SEQUENTIALBACKEND_HXX
+
+#include "TFEL/Utilities/Data.hxx"
+#include "MFront/MFrontConfig.hxx"
+#include "MFront/GenericParallel/Behaviour/AbstractBackend.hxx"
+
+namespace mfront::generic_parallel::behaviour {
+
+  /*!
+   * \brief This class implements a backend which treats the integration
+   * points sequentially. This is the default backend.
+   */
+  struct MFRONT_VISIBILITY_EXPORT SequentialBackend final : AbstractBackend {
+    //! \brief default constructor
+    SequentialBackend();
+    /*!
+     * \brief constructor
+     *
+     * \param[in] opts: options
+     */
+    SequentialBackend(const tfel::utilities::DataMap&);
+    //
+    [[nodiscard]] std::string getName() const override;
+    void writeSpecificIncludesInSourceFile(std::ostream&) const override;
+    void writeBatchIntegration(std::ostream&,
+                               std::string_view,
+                               std::string_view) const override;
+    //! \brief destructor
+    ~SequentialBackend() noexcept override;
+  };  // end of SequentialBackend
+
+}  // end of namespace mfront::generic_parallel::behaviour
+
+#endif /* LIB_MFRONT_GENERICPARALLEL_BEHAVIOUR_SEQUENTIALBACKEND_HXX */
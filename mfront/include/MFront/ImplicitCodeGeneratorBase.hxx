@@ -64,6 +64,8 @@ namespace mfront {
     [[nodiscard]] std::string getIntegrationVariablesIncrementsInitializers(
         const Hypothesis) const override;
     void writeBehaviourFriends(std::ostream&, const Hypothesis) const override;
+    void writeBehaviourConstructors(std::ostream&,
+                                    const Hypothesis) const override;
     void writeBehaviourLocalVariablesInitialisation(
         std::ostream&, const Hypothesis) const override;
     void writeBehaviourIntegrator(std::ostream&,
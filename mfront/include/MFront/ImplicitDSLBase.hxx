@@ -123,6 +123,10 @@ namespace mfront {
     virtual void treatComputeThermodynamicForces();
     //! \brief treat the `@CompareToNumericalJacobian` keyword
     virtual void treatCompareToNumericalJacobian();
+    //! \brief treat the `@AutomaticDifferentiation` keyword
+    virtual void treatAutomaticDifferentiation();
+    //! \brief treat the `@StaticCondensation` keyword
+    virtual void treatStaticCondensation();
     //! \brief treat the `@JacobianComparisonCriterion` keyword
     virtual void treatJacobianComparisonCriterion();
     //! \brief treat the `@InitJacobian` keyword
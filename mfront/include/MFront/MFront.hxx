@@ -51,6 +51,19 @@ namespace mfront {
      */
     [[nodiscard]] virtual TargetsDescription treatFile(
         const std::string&, const tfel::utilities::DataMap& = {}) const;
+    /*!
+     * \brief treat a file (analyse and generate output files)
+     * \param[in] f : file name
+     * \param[out] deps : files read during the analysis of the input file.
+     * This list is empty if the domain specific language does not
+     * report the files read.
+     * \param[in] dsl_options : options passed to the domain specific language
+     * \return the target's description
+     */
+    [[nodiscard]] TargetsDescription treatFile(
+        const std::string&,
+        std::vector<std::string>&,
+        const tfel::utilities::DataMap& = {}) const;
     //! \brief execute MFront process
     virtual void exe();
     //! \brief destructor
@@ -86,6 +99,21 @@ namespace mfront {
     virtual void treatNoMelt();
     //! treat the --silent-build command line option
     virtual void treatSilentBuild();
+    //! \brief treat the --jobs command line option
+    virtual void treatJobs();
+    //! \brief treat the --object-cache command line option
+    virtual void treatObjectCache();
+    /*!
+     * \return a hash of the command line options affecting code
+     * generation, the version of `TFEL` and its installation path.
+     */
+    [[nodiscard]] virtual std::string getGenerationOptionsHash() const;
+    /*!
+     * \return a key used by the object cache. This key describes the
+     * generation options, the compilers (path and version) and the
+     * compilation flags, including the ones given by `tfel-config`.
+     */
+    [[nodiscard]] virtual std::string getObjectCacheKey() const;
 
     virtual void treatNoDeps();
 
@@ -154,6 +182,12 @@ namespace mfront {
     bool buildLibs = false;
 
     bool cleanLibs = false;
+    //! \brief number of files treated simultaneously
+    std::size_t jobs = 1;
+    //! \brief skip the code generation of up to date files
+    bool incremental = false;
+    //! \brief directory used to share object files between build directories
+    std::string object_cache;
 
   };  // end of class MFront
 
@@ -14,10 +14,16 @@
 #ifndef LIB_MFRONT_MFRONTDATABASE_HXX
 #define LIB_MFRONT_MFRONTDATABASE_HXX
 
+#include <map>
+#include <set>
 #include <regex>
 #include <string>
 #include <vector>
+#include <utility>
+#include <cstddef>
+#include <cstdint>
 #include <optional>
+#include <unordered_map>
 #include <string_view>
 #include "MFront/MFrontConfig.hxx"
 
@@ -38,6 +44,10 @@ namespace mfront {
       std::string name;
       //! \brief source of the entry point
       std::string source;
+      //! \brief material associated with the entry point, if any
+      std::string material;
+      //! \brief interface used to generate the entry point
+      std::string interface;
       //! \brief type of material knownledge described by the entry point
       MaterialKnowledgeType type;
     };  // end of EntryPoint
@@ -84,6 +94,11 @@ namespace mfront {
        * used.
        */
       std::optional<std::string> library_suffix = {};
+      /*!
+       * \brief number of threads used to analyse the libraries. If null,
+       * the number of threads is given by the hardware concurrency.
+       */
+      std::size_t number_of_threads = 1;
     };
     //! \brief data structure resulting for the analysis of a directory
     struct AnalyseDirectoryResults {
@@ -112,6 +127,13 @@ namespace mfront {
      * \param[in] libraries: libraries to be analysed
      */
     void analyseLibraries(const std::vector<std::string>&);
+    /*!
+     * \brief analyse a set of libraries in parallel
+     * \param[in] libraries: libraries to be analysed
+     * \param[in] n: number of threads. If null, the number of threads is
+     * given by the hardware concurrency.
+     */
+    void analyseLibraries(const std::vector<std::string>&, const std::size_t);
     /*!
      * \brief method used to analyse a directory with the default options
      * \param[in] d: directory
@@ -174,10 +196,63 @@ namespace mfront {
     [[nodiscard]] std::vector<EntryPoint> getEntryPoints(const Query&) const;
     //! \return all the entry points
     [[nodiscard]] const std::vector<EntryPoint>& getEntryPoints() const;
+    /*!
+     * \brief load an index of libraries previously saved by the `saveIndex`
+     * method.
+     *
+     * The entry points of a library described in the index are not
+     * registred by this method. They will be registred without loading the
+     * library if this library is analysed later and if its size and its
+     * last modification time did not change.
+     *
+     * \param[in] f: file name
+     * \note nothing is done if the file does not exist
+     */
+    void loadIndex(const std::string&);
+    /*!
+     * \brief save the index of all the libraries analysed since the last
+     * call to the `clear` method.
+     *
+     * The libraries described in the indexes previously loaded which were
+     * not analysed are not saved, so that the index does not keep records
+     * of libraries which were removed.
+     *
+     * \param[in] f: file name
+     */
+    void saveIndex(const std::string&) const;
     //! \brief clear all registred entry points
     void clear();
 
    private:
+    //! \brief description of an analysed library stored in the index
+    struct LibraryIndexEntry {
+      //! \brief size of the library
+      std::uintmax_t size = 0;
+      //! \brief last modification time of the library
+      std::int64_t modification_time = 0;
+      //! \brief entry points defined in the library
+      std::vector<EntryPoint> entry_points;
+    };
+    /*!
+     * \brief analyse a library, using the index if possible
+     * \param[in] l: library
+     * \return the description of the library and a boolean stating if the
+     * library can be described in the index
+     */
+    [[nodiscard]] std::pair<LibraryIndexEntry, bool> analyse(
+        const std::string&) const;
+    /*!
+     * \brief register the entry points of a library
+     * \param[in] l: library
+     * \param[in] e: description of the library
+     * \param[in] b: if true, the library is described in the index
+     */
+    void registerLibrary(const std::string&, LibraryIndexEntry, const bool);
+    /*!
+     * \brief register an entry point
+     * \param[in] e: entry point
+     */
+    void registerEntryPoint(EntryPoint);
     /*!
      * \brief method used to analyse a directory
      * \param[out] r: result of the analysis
@@ -187,8 +262,37 @@ namespace mfront {
     void analyseDirectory(AnalyseDirectoryResults&,
                           const std::string&,
                           const AnalyseDirectoryOptions&);
+    /*!
+     * \brief analyse a set of libraries, possibly in parallel, and register
+     * their entry points in the order of the libraries
+     * \param[out] r: result of the analysis
+     * \param[in] libraries: libraries to be analysed
+     * \param[in] opts: options used for the analysis
+     */
+    void analyseLibraries(AnalyseDirectoryResults&,
+                          const std::vector<std::string>&,
+                          const AnalyseDirectoryOptions&);
     //! \brief registred entry points
     std::vector<EntryPoint> epts;
+    /*!
+     * \brief positions of the entry points in `epts` sorted by their names,
+     * in lower case
+     */
+    std::unordered_map<std::string, std::vector<std::size_t>> names;
+    /*!
+     * \brief positions of the entry points in `epts` sorted by their
+     * materials, in lower case
+     */
+    std::unordered_map<std::string, std::vector<std::size_t>> materials;
+    /*!
+     * \brief positions of the entry points in `epts` sorted by their
+     * interfaces, in lower case
+     */
+    std::unordered_map<std::string, std::vector<std::size_t>> interfaces;
+    //! \brief index of the libraries, sorted by their paths
+    std::map<std::string, LibraryIndexEntry> index;
+    //! \brief libraries analysed since the last call to `clear`
+    std::set<std::string> analysed_libraries;
   };
 
 }  // end of namespace mfront
@@ -68,6 +68,17 @@ namespace mfront {
    * The user has to take care of it
    */
   MFRONTLOGSTREAM_VISIBILITY_EXPORT void setLogStream(std::ostream&);
+  /*!
+   * \brief set the logging stream used by the calling thread. If not null,
+   * this stream is returned by the `getLogStream` function when called by
+   * this thread, in place of the global logging stream.
+   * \param[in] os: logging stream. A null pointer restores the global
+   * logging stream
+   * \return the previous logging stream of the calling thread
+   * \warning the stream is not handled by this function.
+   */
+  MFRONTLOGSTREAM_VISIBILITY_EXPORT std::ostream* setThreadLogStream(
+      std::ostream* const);
 
   /*!
    * \brief set if MFront shall use unicode characters on output.
@@ -37,15 +37,36 @@ namespace mfront {
       const GeneratorOptions&,
       const std::string& = "src",
       const std::string& = "Makefile.mfront");
+  /*!
+   * \return a description of the environment used to compile the
+   * sources with the generated Makefile: the compilers, their version,
+   * the compilation flags and the flags returned by `tfel-config`.
+   * \param[in] o : options
+   */
+  MFRONT_VISIBILITY_EXPORT std::string getMakeFileBuildEnvironment(
+      const GeneratorOptions&);
+  /*!
+   * \brief a function calling the `make` utility in the given
+   * directory using the specified file.
+   * \param[in] t : target name
+   * \param[in] d : directory
+   * \param[in] f : file name
+   */
+  MFRONT_VISIBILITY_EXPORT void callMake(
+      const std::string&,
+      const std::string& = "src",
+      const std::string& = "Makefile.mfront");
   /*!
    * \brief a function calling the `make` utility in the given
    * directory using the specified file.
    * \param[in] t : target name
+   * \param[in] o : options
    * \param[in] d : directory
    * \param[in] f : file name
    */
   MFRONT_VISIBILITY_EXPORT void callMake(
       const std::string&,
+      const GeneratorOptions&,
       const std::string& = "src",
       const std::string& = "Makefile.mfront");
 
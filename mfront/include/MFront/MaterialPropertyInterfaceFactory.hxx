@@ -15,6 +15,7 @@
 #define LIB_MFRONTLAWINTERFACEFACTORY_HXX
 
 #include <map>
+#include <mutex>
 #include <vector>
 #include <memory>
 #include <string>
@@ -24,6 +25,11 @@
 
 namespace mfront {
 
+  /*!
+   * \brief factory of material property interfaces
+   *
+   * \note the methods of this class are thread-safe.
+   */
   struct MFRONT_VISIBILITY_EXPORT MaterialPropertyInterfaceFactory {
     typedef std::shared_ptr<AbstractMaterialPropertyInterface> (
         *InterfaceCreator)();
@@ -86,6 +92,8 @@ namespace mfront {
 
     TFEL_VISIBILITY_LOCAL
     AliasContainer& getAliasesMap() const;
+    //! \brief mutex protecting the maps of the factory
+    mutable std::recursive_mutex m;
   };
 
 }  // end of namespace mfront
@@ -0,0 +1,39 @@
+/*!
+ * \file   mfront/include/MFront/PrecompiledHeaders.hxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright Copyright (C) 2006-2025 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_MFRONT_PRECOMPILEDHEADERS_HXX
+#define LIB_MFRONT_PRECOMPILEDHEADERS_HXX
+
+#include <string>
+#include <vector>
+#include "MFront/MFrontConfig.hxx"
+
+namespace mfront {
+
+  // forward declaration
+  struct TargetsDescription;
+
+  /*!
+   * \return the list of the `TFEL` headers included, directly or
+   * through the generated headers, by at least two of the `C++` sources
+   * of the given targets. Those headers are good candidates for
+   * precompilation.
+   * \param[in] t : target description
+   * \param[in] d : directory containing the sources
+   */
+  MFRONT_VISIBILITY_EXPORT std::vector<std::string> getPrecompiledHeaders(
+      const TargetsDescription&, const std::string& = "src");
+
+}  // end of namespace mfront
+
+#endif /* LIB_MFRONT_PRECOMPILEDHEADERS_HXX */
@@ -63,6 +63,21 @@ namespace mfront {
                                               const Hypothesis) const;
     virtual void writeBehaviourRKCastemIntegrator(std::ostream&,
                                                   const Hypothesis) const;
+    /*!
+     * \brief write the Dormand-Prince 5(4) integrator. The derivatives
+     * computed at the end of an accepted sub-step are reused at the
+     * beginning of the next one (first same as last property) and the time
+     * step is controlled by a PI controller.
+     */
+    virtual void writeBehaviourDP54Integrator(std::ostream&,
+                                              const Hypothesis) const;
+    /*!
+     * \brief write the two-stages Rosenbrock (linearly implicit) integrator
+     * ROS2. The jacobian of the derivatives is computed by finite
+     * differences.
+     */
+    virtual void writeBehaviourRosenbrock2Integrator(std::ostream&,
+                                                     const Hypothesis) const;
   };  // end of RungeKuttaCodeGeneratorBase
 
 }  // end of namespace mfront
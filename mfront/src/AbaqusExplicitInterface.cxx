@@ -1035,21 +1035,15 @@ namespace mfront {
           << "integrate(i);\n"
           << "}\n";
     } else if (ppolicy == "ThreadPool") {
-      out << "auto integrate2 = [&integrate,nblock](const int b, const int "
-             "e){\n"
-          << "for(int i=b;i!=e;++i){\n"
-          << "integrate(i);\n"
+      out << "using size_type = tfel::system::ThreadPool::size_type;\n"
+          << "auto integrate2 = [&integrate](const size_type b, "
+             "const size_type e){\n"
+          << "for(auto i=b;i!=e;++i){\n"
+          << "integrate(static_cast<int>(i));\n"
           << "}\n"
           << "};\n"
-          << "const auto nthreads = pool.getNumberOfThreads();\n"
-          << "const auto ntasks   = nthreads/(*nblock);\n"
-          << "for(tfel::system::ThreadPool::size_type i=0;i!=nthreads;++i){\n"
-          << "pool.addTask(integrate2,i*ntasks,(i+1)*ntasks);\n"
-          << "}\n"
-          << "if(*nblock-ntasks*nthreads!=0){\n"
-          << "pool.addTask(integrate2,nthreads*ntasks,*nblock);\n"
-          << "}\n"
-          << "pool.wait();\n";
+          << "pool.parallel_for(0,static_cast<size_type>(*nblock),"
+             "integrate2);\n";
     } else {
       tfel::raise(
           "AbaqusExplicitInterface::writeIntegrateLoop: "
@@ -16,6 +16,10 @@
 
 namespace mfront {
 
+  std::vector<std::string> AbstractDSL::getInputFiles() const {
+    return {};
+  }  // end of getInputFiles
+
   AbstractDSL::~AbstractDSL() = default;
 
 }  // end of namespace mfront
@@ -1291,62 +1291,80 @@ namespace mfront {
        << this->bd.getClassName() << "BehaviourData(const "
        << this->bd.getClassName() << "BehaviourData& src)\n"
        << ": ";
-    auto first = true;
-    if (this->bd.getAttribute(BehaviourDescription::requiresStiffnessTensor,
-                              false)) {
-      os << "D(src.D)";
-      first = false;
-    }
-    if (this->bd.getAttribute(
-            BehaviourDescription::requiresThermalExpansionCoefficientTensor,
-            false)) {
-      if (!first) {
-        os << ",\n";
-      }
-      os << "A(src.A)";
-      first = false;
-    }
-    for (const auto& mv : this->bd.getMainVariables()) {
-      if (!first) {
-        os << ",\n";
+    // the initializers are shared by the copy constructor and the
+    // converting constructor used by automatic differentiation
+    const auto init = [this, &md] {
+      std::ostringstream out;
+      auto first = true;
+      if (this->bd.getAttribute(BehaviourDescription::requiresStiffnessTensor,
+                                false)) {
+        out << "D(src.D)";
+        first = false;
+      }
+      if (this->bd.getAttribute(
+              BehaviourDescription::requiresThermalExpansionCoefficientTensor,
+              false)) {
+        if (!first) {
+          out << ",\n";
+        }
+        out << "A(src.A)";
+        first = false;
       }
-      if (Gradient::isIncrementKnown(mv.first)) {
-        os << mv.first.name << "(src." << mv.first.name << "),\n";
-      } else {
-        os << mv.first.name << "0(src." << mv.first.name << "0),\n";
+      for (const auto& mv : this->bd.getMainVariables()) {
+        if (!first) {
+          out << ",\n";
+        }
+        if (Gradient::isIncrementKnown(mv.first)) {
+          out << mv.first.name << "(src." << mv.first.name << "),\n";
+        } else {
+          out << mv.first.name << "0(src." << mv.first.name << "0),\n";
+        }
+        out << mv.second.name << "(src." << mv.second.name << ")";
+        first = false;
       }
-      os << mv.second.name << "(src." << mv.second.name << ")";
-      first = false;
-    }
-    for (const auto& v : md.getMaterialProperties()) {
-      if (!first) {
-        os << ",\n";
+      for (const auto& v : md.getMaterialProperties()) {
+        if (!first) {
+          out << ",\n";
+        }
+        out << v.name << "(src." << v.name << ")";
+        first = false;
       }
-      os << v.name << "(src." << v.name << ")";
-      first = false;
-    }
-    for (const auto& v : md.getStateVariables()) {
-      if (!first) {
-        os << ",\n";
+      for (const auto& v : md.getStateVariables()) {
+        if (!first) {
+          out << ",\n";
+        }
+        out << v.name << "(src." << v.name << ")";
+        first = false;
       }
-      os << v.name << "(src." << v.name << ")";
-      first = false;
-    }
-    for (const auto& v : md.getAuxiliaryStateVariables()) {
-      if (!first) {
-        os << ",\n";
+      for (const auto& v : md.getAuxiliaryStateVariables()) {
+        if (!first) {
+          out << ",\n";
+        }
+        out << v.name << "(src." << v.name << ")";
+        first = false;
       }
-      os << v.name << "(src." << v.name << ")";
-      first = false;
-    }
-    for (const auto& v : md.getExternalStateVariables()) {
-      if (!first) {
-        os << ",\n";
+      for (const auto& v : md.getExternalStateVariables()) {
+        if (!first) {
+          out << ",\n";
+        }
+        out << v.name << "(src." << v.name << ")";
+        first = false;
       }
-      os << v.name << "(src." << v.name << ")";
-      first = false;
+      return out.str();
+    }();
+    os << init << "\n{}\n\n";
+    if (this->bd.getAttribute(h, BehaviourData::automaticDifferentiation,
+                              false)) {
+      os << "/*!\n"
+         << "* \\brief converting constructor, used to build a copy of the\n"
+         << "* behaviour data with another numeric type\n"
+         << "*/\n"
+         << "template<typename NumericType2>\n"
+         << "explicit " << this->bd.getClassName() << "BehaviourData(const "
+         << this->bd.getClassName()
+         << "BehaviourData<hypothesis, NumericType2, false>& src)\n"
+         << ": " << init << "\n{}\n\n";
     }
-    os << "\n{}\n\n";
     // Creating constructor for external interfaces
     for (const auto& i : this->interfaces) {
       if (i.second->isBehaviourConstructorRequired(h, this->bd)) {
@@ -1548,8 +1566,13 @@ namespace mfront {
        << "IsFundamentalNumericType<NumericType>::cond);\n"
        << "static_assert(tfel::typetraits::IsReal<NumericType>::cond);\n\n"
        << "friend std::ostream& operator<< <>(std::ostream&,const "
-       << this->bd.getClassName() << "BehaviourData&);\n\n"
-       << "/* integration data is declared friend to access"
+       << this->bd.getClassName() << "BehaviourData&);\n";
+    if (this->bd.getAttribute(h, BehaviourData::automaticDifferentiation,
+                              false)) {
+      os << "template<ModellingHypothesis::Hypothesis, typename, bool>\n"
+         << "friend class " << this->bd.getClassName() << "BehaviourData;\n";
+    }
+    os << "\n/* integration data is declared friend to access"
        << "   driving variables at the beginning of the time step */\n";
     if (this->bd.useQt()) {
       os << "friend class " << this->bd.getClassName()
@@ -4666,9 +4689,25 @@ namespace mfront {
              << "\"invalid prediction operator flag\");\n";
         }
       }
-      os << this->bd.getCode(h, BehaviourData::ComputePredictionOperator)
-         << "return SUCCESS;\n"
-         << "}\n\n";
+      if (this->bd.getAttribute(h, BehaviourData::automaticDifferentiation,
+                                false)) {
+        // the copies of the behaviour used by the automatic
+        // differentiation of the residual never compute the prediction
+        // operator
+        os << "if constexpr (!std::is_floating_point_v<NumericType>) {\n"
+           << "tfel::raise(\"" << this->bd.getClassName()
+           << "::computePredictionOperator: \"\n"
+           << "\"unsupported numeric type\");\n"
+           << "} else {\n"
+           << this->bd.getCode(h, BehaviourData::ComputePredictionOperator)
+           << "return SUCCESS;\n"
+           << "}\n"
+           << "}\n\n";
+      } else {
+        os << this->bd.getCode(h, BehaviourData::ComputePredictionOperator)
+           << "return SUCCESS;\n"
+           << "}\n\n";
+      }
     }
   }  // end of writeBehaviourComputePredictionOperator
 
@@ -5507,18 +5546,36 @@ namespace mfront {
        << this->bd.getClassName() << "IntegrationData(const "
        << this->bd.getClassName() << "IntegrationData& src)\n"
        << ": ";
-    for (const auto& v : this->bd.getMainVariables()) {
-      if (Gradient::isIncrementKnown(v.first)) {
-        os << "d" << v.first.name << "(src.d" << v.first.name << "),\n";
-      } else {
-        os << v.first.name << "1(src." << v.first.name << "1),\n";
+    // the initializers are shared by the copy constructor and the
+    // converting constructor used by automatic differentiation
+    const auto init = [this, &md] {
+      std::ostringstream out;
+      for (const auto& v : this->bd.getMainVariables()) {
+        if (Gradient::isIncrementKnown(v.first)) {
+          out << "d" << v.first.name << "(src.d" << v.first.name << "),\n";
+        } else {
+          out << v.first.name << "1(src." << v.first.name << "1),\n";
+        }
       }
+      out << "dt(src.dt)";
+      for (const auto& v : md.getExternalStateVariables()) {
+        out << ",\nd" << v.name << "(src.d" << v.name << ")";
+      }
+      return out.str();
+    }();
+    os << init << "\n{}\n\n";
+    if (this->bd.getAttribute(h, BehaviourData::automaticDifferentiation,
+                              false)) {
+      os << "/*!\n"
+         << "* \\brief converting constructor, used to build a copy of the\n"
+         << "* integration data with another numeric type\n"
+         << "*/\n"
+         << "template<typename NumericType2>\n"
+         << "explicit " << this->bd.getClassName() << "IntegrationData(const "
+         << this->bd.getClassName()
+         << "IntegrationData<hypothesis, NumericType2, false>& src)\n"
+         << ": " << init << "\n{}\n\n";
     }
-    os << "dt(src.dt)";
-    for (const auto& v : md.getExternalStateVariables()) {
-      os << ",\nd" << v.name << "(src.d" << v.name << ")";
-    }
-    os << "\n{}\n\n";
     // Creating constructor for external interfaces
     for (const auto& i : this->interfaces) {
       if (i.second->isBehaviourConstructorRequired(h, this->bd)) {
@@ -5739,7 +5796,13 @@ namespace mfront {
        << "IsFundamentalNumericType<NumericType>::cond);\n";
     os << "static_assert(tfel::typetraits::IsReal<NumericType>::cond);\n\n";
     os << "friend std::ostream& operator<< <>(std::ostream&,const ";
-    os << this->bd.getClassName() << "IntegrationData&);\n\n";
+    os << this->bd.getClassName() << "IntegrationData&);\n";
+    if (this->bd.getAttribute(h, BehaviourData::automaticDifferentiation,
+                              false)) {
+      os << "template<ModellingHypothesis::Hypothesis, typename, bool>\n"
+         << "friend class " << this->bd.getClassName() << "IntegrationData;\n";
+    }
+    os << '\n';
   }
 
   void BehaviourCodeGeneratorBase::writeIntegrationDataOutputOperator(
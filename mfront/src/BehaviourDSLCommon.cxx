@@ -933,6 +933,7 @@ namespace mfront {
     try {
       dsl.setInterfaces({"mfront"});
       dsl.analyseFile(path, {}, {});
+      this->addInputFiles(dsl.getInputFiles());
       const auto t = dsl.getTargetsDescription();
       if (!t.specific_targets.empty()) {
         this->throwRuntimeError("BehaviourDSLCommon::getModelDescription",
@@ -994,6 +995,7 @@ namespace mfront {
     // getting informations the source files
     try {
       dsl->analyseFile(path, {}, {});
+      this->addInputFiles(dsl->getInputFiles());
       const auto t = dsl->getTargetsDescription();
       if (!t.specific_targets.empty()) {
         this->throwRuntimeError("BehaviourDSLCommon::getBehaviourDescription",
@@ -92,6 +92,12 @@ namespace mfront {
       "hasPredictionOperator";
   const char* const BehaviourData::compareToNumericalJacobian =
       "compareToNumericalJacobian";
+  const char* const BehaviourData::automaticDifferentiation =
+      "automaticDifferentiation";
+  const char* const BehaviourData::staticCondensationVariables =
+      "staticCondensationVariables";
+  const char* const BehaviourData::staticCondensationDiagonalBlock =
+      "staticCondensationDiagonalBlock";
   const char* const BehaviourData::numericallyComputedJacobianBlocks =
       "numericallyComputedJacobianBlocks";
   const char* const BehaviourData::allowsNewUserDefinedVariables =
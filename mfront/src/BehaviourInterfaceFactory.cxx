@@ -12,6 +12,7 @@
  * project under specific licensing conditions.
  */
 
+#include <mutex>
 #include <cassert>
 #include <stdexcept>
 #include "TFEL/Raise.hxx"
@@ -33,6 +34,7 @@ namespace mfront {
 
   std::vector<std::string> BehaviourInterfaceFactory::getRegistredInterfaces()
       const {
+    auto lock = std::lock_guard<std::recursive_mutex>{this->m};
     auto res = std::vector<std::string>{};
     for (const auto& p : this->getInterfaceCreatorsMap()) {
       res.push_back(p.first);
@@ -41,11 +43,13 @@ namespace mfront {
   }
 
   bool BehaviourInterfaceFactory::exists(const std::string& n) const {
+    auto lock = std::lock_guard<std::recursive_mutex>{this->m};
     return this->getAliasesMap().count(n) != 0;
   }  // end of BehaviourInterfaceFactory::exists
 
   std::string BehaviourInterfaceFactory::getUniqueNameFromAlias(
       const std::string& n) const {
+    auto lock = std::lock_guard<std::recursive_mutex>{this->m};
     auto p = this->getAliasesMap().find(n);
     if (p == this->getAliasesMap().end()) {
       auto msg = std::string(
@@ -64,6 +68,7 @@ namespace mfront {
   void BehaviourInterfaceFactory::registerInterfaceCreator(
       const std::string& i,
       const BehaviourInterfaceFactory::InterfaceCreator f) {
+    auto lock = std::lock_guard<std::recursive_mutex>{this->m};
     auto& imap = this->getInterfaceCreatorsMap();
     tfel::raise_if(imap.find(i) != imap.end(),
                    "BehaviourInterfaceFactory::registerInterfaceCreator: "
@@ -75,6 +80,7 @@ namespace mfront {
 
   void BehaviourInterfaceFactory::registerInterfaceAlias(const std::string& i,
                                                          const std::string& a) {
+    auto lock = std::lock_guard<std::recursive_mutex>{this->m};
     auto& amap = this->getAliasesMap();
     tfel::raise_if(amap.find(a) != amap.end(),
                    "BehaviourInterfaceFactory::registerInterfaceAlias: "
@@ -90,10 +96,14 @@ namespace mfront {
 
   std::shared_ptr<AbstractBehaviourInterface>
   BehaviourInterfaceFactory::getInterface(const std::string& n) {
-    const auto id = this->getUniqueNameFromAlias(n);
-    const auto p = this->getInterfaceCreatorsMap().find(id);
-    assert(p != this->getInterfaceCreatorsMap().end());
-    auto c = p->second;
+    // the interface is created outside the lock
+    const auto c = [this, &n] {
+      auto lock = std::lock_guard<std::recursive_mutex>{this->m};
+      const auto id = this->getUniqueNameFromAlias(n);
+      const auto p = this->getInterfaceCreatorsMap().find(id);
+      assert(p != this->getInterfaceCreatorsMap().end());
+      return p->second;
+    }();
     return c();
   }
 
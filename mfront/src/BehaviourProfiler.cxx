@@ -11,11 +11,16 @@
  * project under specific licensing conditions.
  */
 
+#include <bit>
 #include <ctime>
+#include <atomic>
 #include <string>
 #include <cstdint>
+#include <cstdlib>
+#include <utility>
 #include <iterator>
 #include <iomanip>
+#include <fstream>
 #include <iostream>
 #include <algorithm>
 #include <stdexcept>
@@ -26,14 +31,12 @@ namespace mfront {
 
 #if !(defined _WIN32 || defined _WIN64)
   /*!
-   * add a new measure
-   * t     : measure to which the new measure is added
+   * \return the duration of a measure in nanoseconds
    * start : start of the measure
    * end   : end of the measure
    */
-  static inline void add_measure(std::atomic<intmax_t>& t,
-                                 const timespec& start,
-                                 const timespec& end) {
+  static inline std::intmax_t get_duration(const timespec& start,
+                                           const timespec& end) {
     /* http://www.guyrutenberg.com/2007/09/22/profiling-code-using-clock_gettime
      */
     timespec temp;
@@ -44,8 +47,9 @@ namespace mfront {
       temp.tv_sec = end.tv_sec - start.tv_sec;
       temp.tv_nsec = end.tv_nsec - start.tv_nsec;
     }
-    t += 1000000000 * temp.tv_sec + temp.tv_nsec;
-  }  // end of add_measure
+    return 1000000000 * static_cast<std::intmax_t>(temp.tv_sec) +
+           static_cast<std::intmax_t>(temp.tv_nsec);
+  }  // end of get_duration
 #endif
 
   /*!
@@ -172,6 +176,40 @@ namespace mfront {
     return n;
   }
 
+  void BehaviourProfiler::CodeBlockMeasures::add(
+      const std::intmax_t t) noexcept {
+    if (this->count == 0) {
+      this->minimum = t;
+      this->maximum = t;
+    } else {
+      this->minimum = std::min(this->minimum, t);
+      this->maximum = std::max(this->maximum, t);
+    }
+    ++(this->count);
+    this->total += t;
+    const auto b = static_cast<std::size_t>(
+        std::bit_width(static_cast<std::uintmax_t>(std::max(t, intmax_t{0}))));
+    ++(this->histogram[std::min(b, number_of_histogram_buckets - 1)]);
+  }  // end of add
+
+  void BehaviourProfiler::CodeBlockMeasures::merge(
+      const CodeBlockMeasures& o) noexcept {
+    if (o.count == 0) {
+      return;
+    }
+    if (this->count == 0) {
+      *this = o;
+      return;
+    }
+    this->count += o.count;
+    this->total += o.total;
+    this->minimum = std::min(this->minimum, o.minimum);
+    this->maximum = std::max(this->maximum, o.maximum);
+    for (std::size_t i = 0; i != number_of_histogram_buckets; ++i) {
+      this->histogram[i] += o.histogram[i];
+    }
+  }  // end of merge
+
   BehaviourProfiler::Timer::Timer(BehaviourProfiler& t, const unsigned short cn)
       : gtimer(t), c(cn) {
 #if !(defined _WIN32 || defined _WIN64)
@@ -182,34 +220,136 @@ namespace mfront {
   BehaviourProfiler::Timer::~Timer() {
 #if !(defined _WIN32 || defined _WIN64)
     ::clock_gettime(CLOCK_THREAD_CPUTIME_ID, &(this->end));
-    add_measure(this->gtimer.measures[this->c], this->start, this->end);
+    auto& tm = this->gtimer.getThreadMeasures();
+    tm.measures[this->c].add(get_duration(this->start, this->end));
 #endif
   }  // end of BehaviourProfiler::~Timer
 
-  BehaviourProfiler::BehaviourProfiler(const std::string& n) : name(n) {
-    std::fill(begin(measures), end(measures), 0);
+  /*!
+   * \return a new unique identifier for a profiler
+   */
+  static std::size_t getNewProfilerIdentifier() {
+    static std::atomic<std::size_t> i{0};
+    return i++;
+  }  // end of getNewProfilerIdentifier
+
+  BehaviourProfiler::BehaviourProfiler(const std::string& n)
+      : name(n), identifier(getNewProfilerIdentifier()) {
   }  // end of BehaviourProfiler::BehaviourProfiler
 
+  BehaviourProfiler::ThreadMeasures& BehaviourProfiler::getThreadMeasures() {
+    // The measures associated with the calling thread are cached using the
+    // identifier of the profiler rather than its address which may be
+    // reused. The cache is only accessed by the calling thread, so the mutex
+    // is only locked the first time a thread uses this profiler.
+    thread_local std::vector<std::pair<std::size_t, ThreadMeasures*>> cache;
+    for (const auto& [id, ptr] : cache) {
+      if (id == this->identifier) {
+        return *ptr;
+      }
+    }
+    auto tm = std::make_unique<ThreadMeasures>();
+    auto* const ptr = tm.get();
+    {
+      std::lock_guard<std::mutex> lock(this->m);
+      this->shards.push_back(std::move(tm));
+    }
+    cache.emplace_back(this->identifier, ptr);
+    return *ptr;
+  }  // end of getThreadMeasures
+
+  BehaviourProfiler::Measures BehaviourProfiler::getMeasures() const {
+    auto r = Measures{};
+    std::lock_guard<std::mutex> lock(this->m);
+    for (const auto& tm : this->shards) {
+      for (std::size_t i = 0; i != number_of_code_blocks; ++i) {
+        r[i].merge(tm->measures[i]);
+      }
+    }
+    return r;
+  }  // end of getMeasures
+
+  void BehaviourProfiler::writeMeasures(const Measures& measures) const {
+    const auto* const e = std::getenv("MFRONT_PROFILING_OUTPUT");
+    if ((e == nullptr) || (*e == '\0')) {
+      return;
+    }
+    auto f = std::string{e};
+    const auto tag = std::string{"{behaviour}"};
+    for (auto p = f.find(tag); p != std::string::npos; p = f.find(tag)) {
+      f.replace(p, tag.size(), this->name);
+    }
+    std::ofstream out(f);
+    tfel::raise_if(!out, "BehaviourProfiler::writeMeasures: can't open file '" +
+                             f + "'");
+    const auto json = (f.size() >= 5) && (f.substr(f.size() - 5) == ".json");
+    if (json) {
+      out << "{\n"
+          << "  \"behaviour\": \"" << this->name << "\",\n"
+          << "  \"code_blocks\": [";
+    } else {
+      out << "code_block,count,total,min,max";
+      for (std::size_t i = 0; i != number_of_histogram_buckets; ++i) {
+        out << ",bucket" << i;
+      }
+      out << '\n';
+    }
+    auto first = true;
+    for (std::size_t i = 0; i != number_of_code_blocks; ++i) {
+      const auto& cm = measures[i];
+      if (cm.count == 0) {
+        continue;
+      }
+      if (json) {
+        out << (first ? "\n" : ",\n") << "    {\"name\": \""
+            << getCodeBlockName(i) << "\", \"count\": " << cm.count
+            << ", \"total\": " << cm.total << ", \"min\": " << cm.minimum
+            << ", \"max\": " << cm.maximum << ", \"histogram\": [";
+        for (std::size_t j = 0; j != number_of_histogram_buckets; ++j) {
+          out << (j == 0 ? "" : ", ") << cm.histogram[j];
+        }
+        out << "]}";
+      } else {
+        out << getCodeBlockName(i) << ',' << cm.count << ',' << cm.total << ','
+            << cm.minimum << ',' << cm.maximum;
+        for (std::size_t j = 0; j != number_of_histogram_buckets; ++j) {
+          out << ',' << cm.histogram[j];
+        }
+        out << '\n';
+      }
+      first = false;
+    }
+    if (json) {
+      out << "\n  ]\n}\n";
+    }
+  }  // end of writeMeasures
+
   BehaviourProfiler::~BehaviourProfiler() {
-    using size_type = std::array<std::atomic<std::intmax_t>, 23>::size_type;
+    const auto measures = this->getMeasures();
     std::cout << "\nResults of " << this->name << " profiling : ";
-    print_time(std::cout, measures.back());
+    print_time(std::cout, measures[TOTALTIME].total);
     std::cout << '\n';
     std::string::size_type w{0};
-    for (size_type i = 0; i + 1 != measures.size(); ++i) {
-      if (measures[i] != 0) {
+    for (std::size_t i = 0; i + 1 != measures.size(); ++i) {
+      if (measures[i].count != 0) {
         w = std::max(w, getCodeBlockName(i).size());
       }
     }
-    for (size_type i = 0; i + 1 != measures.size(); ++i) {
-      if (measures[i] != 0) {
+    for (std::size_t i = 0; i + 1 != measures.size(); ++i) {
+      if (measures[i].count != 0) {
         std::cout << "- " << std::setw(w) << std::left << getCodeBlockName(i)
                   << " : ";
-        print_time(std::cout, measures[i]);
-        std::cout << " (" << measures[i] << " ns)\n";
+        print_time(std::cout, measures[i].total);
+        std::cout << " (" << measures[i].total << " ns, " << measures[i].count
+                  << " calls)\n";
       }
     }
     std::cout << std::endl;
+    try {
+      this->writeMeasures(measures);
+    } catch (std::exception& ex) {
+      std::cerr << ex.what() << std::endl;
+    }
   }  // end of BehaviourProfiler::~BehaviourProfiler
 
 }  // end of namespace mfront
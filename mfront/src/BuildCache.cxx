@@ -0,0 +1,338 @@
+/*!
+ * \file   mfront/src/BuildCache.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright Copyright (C) 2006-2025 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <set>
+#include <cstdint>
+#include <fstream>
+#include <sstream>
+#include <filesystem>
+#include <system_error>
+#include "TFEL/Raise.hxx"
+#include "TFEL/Utilities/CxxTokenizer.hxx"
+#include "TFEL/Utilities/FNV1aHash.hxx"
+#include "TFEL/System/System.hxx"
+#include "MFront/MFrontLock.hxx"
+#include "MFront/MFrontLogStream.hxx"
+#include "MFront/LibraryDescription.hxx"
+#include "MFront/BuildCache.hxx"
+
+namespace mfront {
+
+  static std::string toHexadecimal(const std::uint64_t h) {
+    constexpr const char* digits = "0123456789abcdef";
+    auto r = std::string(16, '0');
+    for (std::size_t i = 0; i != 16; ++i) {
+      r[15 - i] = digits[(h >> (4 * i)) & 0xf];
+    }
+    return r;
+  }  // end of toHexadecimal
+
+  static std::optional<std::string> readFile(const std::string& f) {
+    std::ifstream file(f, std::ios::binary);
+    if (!file) {
+      return {};
+    }
+    auto r = std::ostringstream{};
+    r << file.rdbuf();
+    if (file.bad()) {
+      return {};
+    }
+    return r.str();
+  }  // end of readFile
+
+  static std::string getAbsolutePath(const std::string& f) {
+    auto ec = std::error_code{};
+    if (!std::filesystem::exists(f, ec)) {
+      return f;
+    }
+    const auto p = std::filesystem::weakly_canonical(f, ec);
+    return ec ? f : p.string();
+  }  // end of getAbsolutePath
+
+  /*!
+   * \brief write a file atomically, i.e. by writing a temporary file
+   * which is then renamed.
+   * \param[in] f: file
+   * \param[in] c: content
+   */
+  static void writeFile(const std::string& f, std::string_view c) {
+    MFrontLockGuard lock;
+    const auto tmp = f + ".tmp";
+    {
+      std::ofstream file(tmp, std::ios::binary);
+      tfel::raise_if(!file, "writeFile: can't open file '" + tmp + "'");
+      file.write(c.data(), static_cast<std::streamsize>(c.size()));
+      tfel::raise_if(!file, "writeFile: can't write file '" + tmp + "'");
+    }
+    auto ec = std::error_code{};
+    std::filesystem::rename(tmp, f, ec);
+    tfel::raise_if(static_cast<bool>(ec),
+                   "writeFile: can't rename file '" + tmp + "' to '" + f +
+                       "' (" + ec.message() + ")");
+  }  // end of writeFile
+
+  std::string computeHash(std::string_view s) {
+    return toHexadecimal(tfel::utilities::fnv1a(s));
+  }  // end of computeHash
+
+  std::string computeFileHash(const std::string& f) {
+    const auto c = readFile(f);
+    if (!c.has_value()) {
+      return {};
+    }
+    return computeHash(*c);
+  }  // end of computeFileHash
+
+  SourcesCache::SourcesCache(std::string h) : options_hash(std::move(h)) {
+    tfel::system::systemCall::mkdir("src/mfront-cache");
+  }  // end of SourcesCache
+
+  std::string SourcesCache::getEntryPath(const std::string& f) {
+    return "src/mfront-cache/" + computeHash(getAbsolutePath(f)) + ".lst";
+  }  // end of getEntryPath
+
+  std::optional<TargetsDescription> SourcesCache::get(
+      const std::string& f) const {
+    const auto c = readFile(getEntryPath(f));
+    if (!c.has_value()) {
+      return {};
+    }
+    auto in = std::istringstream{*c};
+    auto line = std::string{};
+    auto file = std::string{};
+    auto options = std::string{};
+    auto has_dependencies = false;
+    while (std::getline(in, line)) {
+      if (line == "targets") {
+        break;
+      }
+      if (line.starts_with("file ")) {
+        file = line.substr(5);
+      } else if (line.starts_with("options ")) {
+        options = line.substr(8);
+      } else if (line.starts_with("dependency ")) {
+        // dependency <hash> <path>
+        const auto pos = line.find(' ', 11);
+        if (pos == std::string::npos) {
+          return {};
+        }
+        const auto h = line.substr(11, pos - 11);
+        if (computeFileHash(line.substr(pos + 1)) != h) {
+          return {};
+        }
+        has_dependencies = true;
+      } else {
+        return {};
+      }
+    }
+    if ((line != "targets") || (!has_dependencies) ||
+        (file != getAbsolutePath(f)) || (options != this->options_hash)) {
+      return {};
+    }
+    try {
+      auto tokenizer = tfel::utilities::CxxTokenizer{};
+      tokenizer.parseString(c->substr(static_cast<std::size_t>(in.tellg())));
+      auto p = tokenizer.begin();
+      auto td = read<TargetsDescription>(p, tokenizer.end());
+      // the generated files must still exist
+      for (const auto& h : td.headers) {
+        if (!std::filesystem::exists("include/" + h)) {
+          return {};
+        }
+      }
+      for (const auto& l : td.libraries) {
+        for (const auto& s : l.sources) {
+          if (!std::filesystem::exists("src/" + s)) {
+            return {};
+          }
+        }
+      }
+      return td;
+    } catch (std::exception& e) {
+      if (getVerboseMode() >= VERBOSE_DEBUG) {
+        getLogStream() << "SourcesCache::get: invalid entry for file '" << f
+                       << "' (" << e.what() << ")\n";
+      }
+    }
+    return {};
+  }  // end of get
+
+  void SourcesCache::store(const std::string& f,
+                           const std::vector<std::string>& deps,
+                           const TargetsDescription& td) const {
+    if (deps.empty()) {
+      return;
+    }
+    auto out = std::ostringstream{};
+    out << "file " << getAbsolutePath(f) << '\n'
+        << "options " << this->options_hash << '\n';
+    for (const auto& d : deps) {
+      const auto h = computeFileHash(d);
+      if (h.empty()) {
+        // this dependency can't be tracked, the entry would never be
+        // valid
+        return;
+      }
+      out << "dependency " << h << ' ' << getAbsolutePath(d) << '\n';
+    }
+    out << "targets\n" << td << '\n';
+    writeFile(getEntryPath(f), out.str());
+  }  // end of store
+
+  /*!
+   * \brief add to the given set the local headers included, directly or
+   * indirectly, by the given file
+   * \param[out] headers: list of headers
+   * \param[in] f: file
+   */
+  static void getLocalIncludes(std::set<std::string>& headers,
+                               const std::string& f) {
+    const auto c = readFile(f);
+    if (!c.has_value()) {
+      return;
+    }
+    auto in = std::istringstream{*c};
+    auto line = std::string{};
+    while (std::getline(in, line)) {
+      const auto pos = line.find_first_not_of(" \t");
+      if ((pos == std::string::npos) || (line[pos] != '#')) {
+        continue;
+      }
+      const auto pos2 = line.find_first_not_of(" \t", pos + 1);
+      if ((pos2 == std::string::npos) ||
+          (line.compare(pos2, 7, "include") != 0)) {
+        continue;
+      }
+      const auto b = line.find('"', pos2 + 7);
+      if (b == std::string::npos) {
+        continue;
+      }
+      const auto e = line.find('"', b + 1);
+      if (e == std::string::npos) {
+        continue;
+      }
+      const auto h = line.substr(b + 1, e - b - 1);
+      for (const auto& d : {"include/", "src/"}) {
+        const auto p = d + h;
+        if (std::filesystem::is_regular_file(p)) {
+          if (headers.insert(p).second) {
+            getLocalIncludes(headers, p);
+          }
+          break;
+        }
+      }
+    }
+  }  // end of getLocalIncludes
+
+  ObjectsCache::ObjectsCache(std::string d, std::string k)
+      : directory(std::move(d)), key(std::move(k)) {
+    auto ec = std::error_code{};
+    std::filesystem::create_directories(this->directory, ec);
+    tfel::raise_if(static_cast<bool>(ec),
+                   "ObjectsCache::ObjectsCache: can't create directory '" +
+                       this->directory + "' (" + ec.message() + ")");
+  }  // end of ObjectsCache
+
+  std::vector<ObjectsCache::CachedObject> ObjectsCache::getCachedObjects(
+      const TargetsDescription& td) const {
+    auto objects = std::vector<CachedObject>{};
+    for (const auto& l : td.libraries) {
+      for (const auto& s : l.sources) {
+        auto stem = std::string{};
+        if ((s.ends_with(".cxx")) || (s.ends_with(".cpp"))) {
+          stem = s.substr(0, s.size() - 4);
+        } else if (s.ends_with(".c")) {
+          stem = s.substr(0, s.size() - 2);
+        } else {
+          continue;
+        }
+        const auto src = "src/" + s;
+        const auto c = readFile(src);
+        if (!c.has_value()) {
+          continue;
+        }
+        auto k = this->key + '\n' + *c + '\n';
+        for (const auto& f : l.cppflags) {
+          k += f + '\n';
+        }
+        auto headers = std::set<std::string>{};
+        getLocalIncludes(headers, src);
+        for (const auto& h : headers) {
+          k += h + ' ' + computeFileHash(h) + '\n';
+        }
+        objects.push_back(
+            {"src/" + stem + ".o", this->directory + "/" + computeHash(k) + ".o"});
+      }
+    }
+    return objects;
+  }  // end of getCachedObjects
+
+  std::vector<std::string> ObjectsCache::restore(
+      const TargetsDescription& td) const {
+    namespace fs = std::filesystem;
+    auto restored = std::vector<std::string>{};
+    for (const auto& o : this->getCachedObjects(td)) {
+      auto ec = std::error_code{};
+      if (!fs::is_regular_file(o.entry, ec)) {
+        continue;
+      }
+      const auto src = o.object.substr(0, o.object.size() - 2);
+      if (fs::exists(o.object, ec)) {
+        // the object file is only replaced if it is older than the
+        // sources
+        const auto to = fs::last_write_time(o.object, ec);
+        auto uptodate = !ec;
+        for (const auto& ext : {".cxx", ".cpp", ".c"}) {
+          const auto s = src + ext;
+          if ((uptodate) && (fs::exists(s, ec))) {
+            uptodate = fs::last_write_time(s, ec) <= to;
+          }
+        }
+        if (uptodate) {
+          continue;
+        }
+      }
+      fs::copy_file(o.entry, o.object, fs::copy_options::overwrite_existing,
+                    ec);
+      if (ec) {
+        continue;
+      }
+      // the restored object file must be newer than its sources
+      fs::last_write_time(o.object, fs::file_time_type::clock::now(), ec);
+      restored.push_back(o.object);
+    }
+    return restored;
+  }  // end of restore
+
+  void ObjectsCache::store(const TargetsDescription& td) const {
+    namespace fs = std::filesystem;
+    for (const auto& o : this->getCachedObjects(td)) {
+      auto ec = std::error_code{};
+      if ((fs::exists(o.entry, ec)) || (!fs::is_regular_file(o.object, ec))) {
+        continue;
+      }
+      const auto c = readFile(o.object);
+      if (!c.has_value()) {
+        continue;
+      }
+      try {
+        writeFile(o.entry, *c);
+      } catch (std::exception& e) {
+        if (getVerboseMode() >= VERBOSE_LEVEL1) {
+          getLogStream() << "ObjectsCache::store: " << e.what() << '\n';
+        }
+      }
+    }
+  }  // end of store
+
+}  // end of namespace mfront
@@ -51,6 +51,7 @@
 #include "MFront/MFrontDebugMode.hxx"
 #include "MFront/TargetsDescription.hxx"
 #include "MFront/GeneratorOptions.hxx"
+#include "MFront/PrecompiledHeaders.hxx"
 #include "MFront/ConfigurationManager.hxx"
 #include "MFront/CMakeGenerator.hxx"
 
@@ -244,6 +245,8 @@ namespace mfront {
       m << "link_directories(${LINK_DIRECTORIES})\n";
     }
     m << "\n";
+    const auto pch = o.precompiledHeaders ? getPrecompiledHeaders(t)
+                                          : std::vector<std::string>{};
     for (const auto& l : t.libraries) {
       if ((l.name == "MFrontMaterialLaw") || (l.name == "MFrontBehaviour")) {
         continue;
@@ -321,6 +324,21 @@ namespace mfront {
         m << "set_target_properties(" << l.name << '\n'
           << "PROPERTIES LINK_FLAGS \"${" << l.name << "_LINK_FLAGS}\")\n";
       }
+      if ((o.unityBuild) || (!pch.empty())) {
+        m << "if(NOT CMAKE_VERSION VERSION_LESS 3.16)\n";
+        if (o.unityBuild) {
+          m << "  set_target_properties(" << l.name
+            << " PROPERTIES UNITY_BUILD ON)\n";
+        }
+        if (!pch.empty()) {
+          m << "  target_precompile_headers(" << l.name << " PRIVATE";
+          for (const auto& h : pch) {
+            m << "\n    <" << h << ">";
+          }
+          m << ")\n";
+        }
+        m << "endif(NOT CMAKE_VERSION VERSION_LESS 3.16)\n";
+      }
       const auto ipath =
           l.install_path.empty() ? getInstallPath() : l.install_path;
       if (!ipath.empty()) {
@@ -339,6 +357,12 @@ namespace mfront {
   }
 
   void callCMake(const std::string& t, const std::string& d) {
+    callCMake(t, GeneratorOptions{}, d);
+  }  // end of callCMake
+
+  void callCMake(const std::string& t,
+                 const GeneratorOptions& o,
+                 const std::string& d) {
     using namespace tfel::system;
     using tfel::utilities::starts_with;
     const char* cmake = getCMakeCommand();
@@ -373,11 +397,21 @@ namespace mfront {
       tg1 = "--target";
       tg2 = t.c_str();
     }
+    const char* j1 = nullptr;
+    const auto j2 = std::to_string(o.jobs);
+    if (o.jobs > 1) {
+      j1 = "--parallel";
+    }
     const char* argv[] = {cmake, "-G", g.c_str(), ".", silent, nullptr};
-    const char* argv2[] = {cmake, "--build", ".",    tg1,    tg2,
-                           cfg1,  cfg2,      silent, nullptr};
-    std::remove_if(argv2, argv2 + 9,
-                   [](const char* ptr) { return ptr == nullptr; });
+    const char* argv2[] = {cmake, "--build", ".",    tg1,         tg2,
+                           cfg1,  cfg2,      j1,     j2.c_str(),  silent,
+                           nullptr};
+    if (j1 == nullptr) {
+      argv2[8] = nullptr;
+    }
+    std::fill(std::remove_if(argv2, argv2 + 11,
+                             [](const char* ptr) { return ptr == nullptr; }),
+              argv2 + 11, nullptr);
     auto error = [&t](const std::string& e, const char* const* args) {
       auto msg = "callCmake: can't build target '" + t + "'\n";
       if (!e.empty()) {
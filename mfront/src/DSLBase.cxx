@@ -243,6 +243,7 @@ namespace mfront {
         (tfel::utilities::starts_with(f, "edf:"))) {
 #ifdef MFRONT_HAVE_MADNEX
       const auto path = decomposeImplementationPathInMadnexFile(f);
+      this->addInputFiles({std::get<0>(path)});
       const auto& material = std::get<2>(path);
       const auto& name = std::get<3>(path);
       const auto impl = madnex::getMFrontImplementation(
@@ -272,6 +273,7 @@ namespace mfront {
 #endif /* MFRONT_HAVE_MADNEX */
     } else {
       CxxTokenizer::openFile(f);
+      this->addInputFiles({f});
     }
     // substitutions
     const auto pe = s.end();
@@ -314,6 +316,16 @@ namespace mfront {
     return this->td;
   }  // end of getTargetsDescription
 
+  std::vector<std::string> DSLBase::getInputFiles() const {
+    return this->input_files;
+  }  // end of getInputFiles
+
+  void DSLBase::addInputFiles(const std::vector<std::string>& files) {
+    for (const auto& f : files) {
+      insert_if(this->input_files, f);
+    }
+  }  // end of addInputFiles
+
   DSLBase::~DSLBase() = default;
 
   bool DSLBase::readSafeOptionTypeIfPresent() {
@@ -963,7 +975,10 @@ namespace mfront {
       m.setInterface(i);
     }
     for (const auto& f : files) {
-      mergeTargetsDescription(this->td, m.treatFile(f, dsl_options), false);
+      auto deps = std::vector<std::string>{};
+      mergeTargetsDescription(this->td, m.treatFile(f, deps, dsl_options),
+                              false);
+      this->addInputFiles(deps);
     }
   }  // end of callMFront
 
@@ -1064,6 +1079,7 @@ namespace mfront {
       const auto& path = SearchPathsHandler::search(f);
       mp.setInterfaces({"mfront"});
       mp.analyseFile(path);
+      this->addInputFiles(mp.getInputFiles());
       const auto t = mp.getTargetsDescription();
       if (!t.specific_targets.empty()) {
         this->throwRuntimeError("DSLBase::handleMaterialPropertyDescription",
@@ -11,6 +11,7 @@
  * project under specific licensing conditions.
  */
 
+#include <mutex>
 #include <vector>
 #include <string>
 #include <utility>
@@ -32,6 +33,7 @@ namespace mfront {
   DSLFactory::DSLFactory() = default;
 
   std::vector<std::string> DSLFactory::getRegistredDSLs(const bool b) const {
+    auto lock = std::lock_guard<std::mutex>{this->generators_mutex};
     auto res = std::vector<std::string>{};
     for (const auto& p : this->generators) {
       res.push_back(p.first);
@@ -53,6 +55,7 @@ namespace mfront {
       tfel::raise("DSLFactory::registerDSLCreator: a DSL named '" + n +
                   "' has already been registred");
     };
+    auto lock = std::lock_guard<std::mutex>{this->generators_mutex};
     if (!this->generators.insert({n, f}).second) {
       raise();
     }
@@ -72,6 +75,7 @@ namespace mfront {
     auto raise = [](const std::string& m) {
       tfel::raise("DSLFactory::registerAlias: " + m);
     };
+    auto lock = std::lock_guard<std::mutex>{this->generators_mutex};
     if (this->generators.find(n) == this->generators.end()) {
       tfel::raise("no DSL named '" + n + "' registred");
     }
@@ -89,17 +93,17 @@ namespace mfront {
 
   std::shared_ptr<AbstractDSL> DSLFactory::createNewDSL(
       const std::string& n, const AbstractDSL::DSLOptions& opts) const {
-    const auto rn = [this, &n]() -> const std::string& {
-      for (const auto& as : this->aliases) {
-        if (std::find(as.second.cbegin(), as.second.cend(), n) !=
-            as.second.cend()) {
-          return as.first;
-        }
+    // the generator is copied so that the DSL is created outside the lock
+    const auto c = [this, &n]() -> DSLGenerator {
+      auto lock = std::lock_guard<std::mutex>{this->generators_mutex};
+      const auto& rn = this->getDSLNameFromAlias(n);
+      const auto p = this->generators.find(rn);
+      if (p == this->generators.end()) {
+        return {};
       }
-      return n;
+      return p->second;
     }();
-    const auto p = this->generators.find(rn);
-    if (p == this->generators.end()) {
+    if (!c) {
       auto msg =
           "DSLFactory::createNewDSL: "
           "no DSL named '" +
@@ -109,7 +113,6 @@ namespace mfront {
       }
       tfel::raise(msg);
     }
-    auto c = p->second;
     return c(opts);
   }  // end of createNewDSL
 
@@ -119,26 +122,31 @@ namespace mfront {
   }  // end of createNewParser
 
   std::string DSLFactory::getDSLDescription(const std::string& n) const {
-    const auto rn = [this, &n]() -> const std::string& {
-      for (const auto& as : this->aliases) {
-        if (std::find(as.second.cbegin(), as.second.cend(), n) !=
-            as.second.cend()) {
-          return as.first;
-        }
+    const auto c = [this, &n] {
+      auto lock = std::lock_guard<std::mutex>{this->generators_mutex};
+      const auto p = this->descriptions.find(this->getDSLNameFromAlias(n));
+      if (p == this->descriptions.end()) {
+        tfel::raise(
+            "DSLFactory::getDSLDescription: "
+            "no DSL named '" +
+            n + "'");
       }
-      return n;
+      return p->second;
     }();
-    auto p = this->descriptions.find(rn);
-    if (p == this->descriptions.end()) {
-      tfel::raise(
-          "DSLFactory::getDSLDescription: "
-          "no DSL named '" +
-          n + "'");
-    }
-    auto c = p->second;
     return c();
   }  // end of getDSLDescription
 
+  const std::string& DSLFactory::getDSLNameFromAlias(
+      const std::string& n) const {
+    for (const auto& as : this->aliases) {
+      if (std::find(as.second.cbegin(), as.second.cend(), n) !=
+          as.second.cend()) {
+        return as.first;
+      }
+    }
+    return n;
+  }  // end of getDSLNameFromAlias
+
   std::vector<std::string> DSLFactory::getRegistredParsers(const bool b) const {
     return this->getRegistredDSLs(b);
   }  // end of getRegistredParsers()
@@ -16,6 +16,7 @@
 #include "TFEL/Raise.hxx"
 #include "TFEL/Config/GetInstallPath.hxx"
 #include "TFEL/System/System.hxx"
+#include "MFront/MFrontLogStream.hxx"
 #include "MFront/MFrontWarningMode.hxx"
 #include "MFront/CodeGeneratorUtilities.hxx"
 #include "MFront/FileDescription.hxx"
@@ -24,6 +25,9 @@
 #include "MFront/BehaviourDescription.hxx"
 #include "MFront/GenericBehaviourSymbolsGenerator.hxx"
 #include "MFront/GenericBehaviourInterface.hxx"
+#include "MFront/GenericParallel/Behaviour/AbstractBackend.hxx"
+#include "MFront/GenericParallel/Behaviour/BackendFactory.hxx"
+#include "MFront/GenericParallel/Behaviour/SequentialBackend.hxx"
 
 namespace mfront {
 
@@ -980,6 +984,16 @@ namespace mfront {
     return 1;
   }  // end of getAPIVersion
 
+  GenericBehaviourInterface::GenericBehaviourInterface()
+      : backend(std::make_unique<
+                ::mfront::generic_parallel::behaviour::SequentialBackend>()) {
+  }  // end of GenericBehaviourInterface
+
+  void GenericBehaviourInterface::setOptions(const DataMap& opts) {
+    this->backend =
+        ::mfront::generic_parallel::behaviour::generateBackend("GenericBehaviourInterface", opts);
+  }  // end of setOptions
+
   std::string GenericBehaviourInterface::getInterfaceName() const {
     return "Generic";
   }  // end of getInterfaceName
@@ -1119,6 +1133,7 @@ namespace mfront {
     insert_if(l.link_libraries, "$(shell " + tfel_config +
                                     " --library-dependency "
                                     "--material --mfront-profiling)");
+    this->backend->completeLibraryDescription(l);
     for (const auto h : this->getModellingHypothesesToBeTreated(bd)) {
       insert_if(l.epts, this->getFunctionNameForHypothesis(name, h));
     }
@@ -1155,7 +1170,8 @@ namespace mfront {
     out << "#ifndef " << hg << "\n"
         << "#define " << hg << "\n\n"
         << "#include\"TFEL/Config/TFELConfig.hxx\"\n"
-        << "#include\"MFront/GenericBehaviour/BehaviourData.h\"\n\n";
+        << "#include\"MFront/GenericBehaviour/BehaviourData.h\"\n"
+        << "#include\"MFront/GenericBehaviour/BatchBehaviourData.h\"\n\n";
 
     this->writeVisibilityDefines(out);
     out << "#ifdef __cplusplus\n"
@@ -1184,6 +1200,13 @@ namespace mfront {
           << " */\n"
           << "MFRONT_SHAREDOBJ int " << f
           << "(mfront_gb_BehaviourData* const);\n\n";
+      out << "/*!\n"
+          << " * \\brief integrate the behaviour over a set of integration "
+             "points\n"
+          << " * \\param[in,out] d: material data\n"
+          << " */\n"
+          << "MFRONT_SHAREDOBJ int " << f
+          << "_batch(mfront_gb_BatchBehaviourData* const);\n\n";
       // postprocessings
       for (const auto& p : d.getPostProcessings()) {
         out << "/*!\n"
@@ -1278,6 +1301,7 @@ namespace mfront {
     } else {
       raise("unsupported behaviour type");
     }
+    this->backend->writeSpecificIncludesInSourceFile(out);
 
     out << "#include\"MFront/GenericBehaviour/" << header << "\"\n\n";
 
@@ -1361,6 +1385,36 @@ namespace mfront {
     this->writeSetOutOfBoundsPolicyFunctionImplementation(out, bd, name);
     // parameters
     this->writeSetParametersFunctionsImplementations(out, bd, name);
+    // call to the function integrating the behaviour at one integration
+    // point
+    const auto integrate_call = [&bd, &name, &type,
+                                 is_finite_strain_through_strain_measure,
+                                 &raise](const std::string& d) {
+      const auto policy = name + "_getOutOfBoundsPolicy()";
+      if ((type == BehaviourDescription::GENERALBEHAVIOUR) ||
+          (type == BehaviourDescription::COHESIVEZONEMODEL)) {
+        return "mfront::gb::integrate<Behaviour>(" + d +
+               ", Behaviour::STANDARDTANGENTOPERATOR, " + policy + ")";
+      } else if (type == BehaviourDescription::STANDARDSTRAINBASEDBEHAVIOUR) {
+        if (is_finite_strain_through_strain_measure) {
+          const auto ms = bd.getStrainMeasure();
+          if (ms == BehaviourDescription::GREENLAGRANGE) {
+            return "mfront::gb::green_lagrange_strain::integrate<Behaviour>(" +
+                   d + ", " + policy + ")";
+          } else if (ms != BehaviourDescription::HENCKY) {
+            raise("unsupported strain measure");
+          }
+          return "mfront::gb::logarithmic_strain::integrate<Behaviour>(" + d +
+                 ", " + policy + ")";
+        }
+        return "mfront::gb::integrate<Behaviour>(" + d +
+               ", Behaviour::STANDARDTANGENTOPERATOR, " + policy + ")";
+      } else if (type != BehaviourDescription::STANDARDFINITESTRAINBEHAVIOUR) {
+        raise("unsupported behaviour type");
+      }
+      return "mfront::gb::finite_strain::integrate<Behaviour>(" + d + ", " +
+             policy + ")";
+    };
     // behaviour implementations
     for (const auto h : mhs) {
       const auto& d = bd.getBehaviourData(h);
@@ -1437,37 +1491,7 @@ namespace mfront {
       if (this->shallGenerateMTestFileOnFailure(bd)) {
         out << "using mfront::SupportedTypes;\n";
       }
-      if ((type == BehaviourDescription::GENERALBEHAVIOUR) ||
-          (type == BehaviourDescription::COHESIVEZONEMODEL)) {
-        out << "const auto r = mfront::gb::integrate<Behaviour>(*d, "
-            << "Behaviour::STANDARDTANGENTOPERATOR, " << name
-            << "_getOutOfBoundsPolicy());\n";
-      } else if (type == BehaviourDescription::STANDARDSTRAINBASEDBEHAVIOUR) {
-        if (is_finite_strain_through_strain_measure) {
-          const auto ms = bd.getStrainMeasure();
-          if (ms == BehaviourDescription::GREENLAGRANGE) {
-            out << "const auto r = "
-                << "mfront::gb::green_lagrange_strain::integrate<Behaviour>("
-                << "*d, " << name << "_getOutOfBoundsPolicy());\n";
-          } else if (ms == BehaviourDescription::HENCKY) {
-            out << "const auto r = "
-                << "mfront::gb::logarithmic_strain::integrate<Behaviour>("
-                << "*d, " << name << "_getOutOfBoundsPolicy());\n";
-          } else {
-            raise("unsupported strain measure");
-          }
-        } else {
-          out << "const auto r = mfront::gb::integrate<Behaviour>(*d, "
-              << "Behaviour::STANDARDTANGENTOPERATOR, " << name
-              << "_getOutOfBoundsPolicy());\n";
-        }
-      } else if (type == BehaviourDescription::STANDARDFINITESTRAINBEHAVIOUR) {
-        out << "const auto r = "
-            << "mfront::gb::finite_strain::integrate<Behaviour>(*d, "  //
-            << name << "_getOutOfBoundsPolicy());\n";
-      } else {
-        raise("unsupported behaviour type");
-      }
+      out << "const auto r = " << integrate_call("*d") << ";\n";
       if (this->shallGenerateMTestFileOnFailure(bd)) {
         out << "if(r!=1){\n";
         this->generateMTestFile(out, bd, h);
@@ -1475,6 +1499,33 @@ namespace mfront {
       }
       out << "return r;\n"
           << "} // end of " << f << "\n\n";
+      // integration over a set of integration points
+      out << "MFRONT_SHAREDOBJ int " << f
+          << "_batch(mfront_gb_BatchBehaviourData* const d){\n"
+          << "using namespace tfel::material;\n";
+      out << "using real = mfront::gb::real;\n"
+          << "constexpr auto h = ModellingHypothesis::"
+          << ModellingHypothesis::toUpperCaseString(h) << ";\n";
+      if (bd.useQt()) {
+        out << "using Behaviour = " << bd.getClassName() << "<h,real,true>;\n";
+      } else {
+        out << "using Behaviour = " << bd.getClassName() << "<h,real,false>;\n";
+      }
+      if (bd.getAttribute(BehaviourData::profiling, false)) {
+        out << "using mfront::BehaviourProfiler;\n"
+            << "using tfel::material::" << bd.getClassName() << "Profiler;\n"
+            << "BehaviourProfiler::Timer total_timer(" << bd.getClassName()
+            << "Profiler::getProfiler(),\n"
+            << "BehaviourProfiler::TOTALTIME);\n";
+      }
+      out << "const auto mfront_integrate_point = "
+          << "[](mfront_gb_BehaviourData& bd){\n"
+          << "return " << integrate_call("bd") << ";\n"
+          << "};\n"
+          << "return ";
+      this->backend->writeBatchIntegration(out, "*d", "mfront_integrate_point");
+      out << ";\n"
+          << "} // end of " << f << "_batch\n\n";
     }
     // postprocessings
     for (const auto h : mhs) {
@@ -18,6 +18,7 @@
 #include "TFEL/System/System.hxx"
 #include "TFEL/Material/ModellingHypothesis.hxx"
 #include "MFront/MFrontDebugMode.hxx"
+#include "MFront/MFrontLogStream.hxx"
 #include "MFront/CodeGeneratorUtilities.hxx"
 #include "MFront/FileDescription.hxx"
 #include "MFront/SupportedTypes.hxx"
@@ -26,6 +27,9 @@
 #include "MFront/GenericBehaviourSymbolsGenerator.hxx"
 #include "MFront/GenericBehaviourInterface.hxx"
 #include "MFront/GenericModelInterface.hxx"
+#include "MFront/GenericParallel/Behaviour/AbstractBackend.hxx"
+#include "MFront/GenericParallel/Behaviour/BackendFactory.hxx"
+#include "MFront/GenericParallel/Behaviour/SequentialBackend.hxx"
 
 namespace mfront {
 
@@ -77,7 +81,10 @@ namespace mfront {
     }
   }  // end of writeScalarStandardTypedefs
 
-  GenericModelInterface::GenericModelInterface() = default;
+  GenericModelInterface::GenericModelInterface()
+      : backend(std::make_unique<
+                ::mfront::generic_parallel::behaviour::SequentialBackend>()) {
+  }  // end of GenericModelInterface
 
   std::string GenericModelInterface::getLibraryName(
       const ModelDescription& md) const {
@@ -96,10 +103,8 @@ namespace mfront {
   }  // end of getName
 
   void GenericModelInterface::setOptions(const DataMap& opts) {
-    if (!opts.empty()) {
-      tfel::raise("no options expected for interface '" + this->getName() +
-                  "'");
-    }
+    this->backend =
+        ::mfront::generic_parallel::behaviour::generateBackend("GenericModelInterface", opts);
   }  // end of setOptions
 
   std::pair<bool, GenericModelInterface::tokens_iterator>
@@ -149,7 +154,8 @@ namespace mfront {
     os << "#ifndef " << hg << "\n"
        << "#define " << hg << "\n\n"
        << "#include\"TFEL/Config/TFELConfig.hxx\"\n"
-       << "#include\"MFront/GenericBehaviour/BehaviourData.h\"\n\n";
+       << "#include\"MFront/GenericBehaviour/BehaviourData.h\"\n"
+       << "#include\"MFront/GenericBehaviour/BatchBehaviourData.h\"\n\n";
 
     writeExportDirectives(os, false);
 
@@ -178,6 +184,14 @@ namespace mfront {
          << " */\n"
          << "MFRONT_SHAREDOBJ int " << f
          << "(mfront_gb_BehaviourData* const);\n\n";
+      os << "/*!\n"
+         << " * \\brief function implementing the " << name << " model for the "
+         << ModellingHypothesis::toString(h)
+         << " modelling hypothesis over a set of integration points\n"
+         << " * \\param[in,out] d: material data\n"
+         << " */\n"
+         << "MFRONT_SHAREDOBJ int " << f
+         << "_batch(mfront_gb_BatchBehaviourData* const);\n\n";
     }
 
     os << "#ifdef __cplusplus\n"
@@ -234,7 +248,9 @@ namespace mfront {
       os << "#include \"TFEL/Math/qt.hxx\"\n";
     }
     os << "#include \"TFEL/Material/BoundsCheck.hxx\"\n";
-    os << "#include \"MFront/GenericBehaviour/Integrate.hxx\"\n\n"
+    os << "#include \"MFront/GenericBehaviour/Integrate.hxx\"\n";
+    this->backend->writeSpecificIncludesInSourceFile(os);
+    os << "\n"
        << "#include \"MFront/GenericModel/" << header << "\"\n\n";
     //
     if (!md.includes.empty()) {
@@ -535,6 +551,15 @@ namespace mfront {
       os << "int " << fct << "(mfront_gb_BehaviourData* const d){\n"
          << "return mfront::gm::" << name << "_implementation(*d);\n"
          << "}\n\n";
+      os << "int " << fct << "_batch(mfront_gb_BatchBehaviourData* const d){\n"
+         << "const auto mfront_integrate_point = "
+         << "[](mfront_gb_BehaviourData& bd){\n"
+         << "return mfront::gm::" << name << "_implementation(bd);\n"
+         << "};\n"
+         << "return ";
+      this->backend->writeBatchIntegration(os, "*d", "mfront_integrate_point");
+      os << ";\n"
+         << "}\n\n";
     }
   }  // end of writeSourceFile
 
@@ -552,6 +577,7 @@ namespace mfront {
     insert_if(l.link_libraries, "$(shell " + tfel_config +
                                     " --library-dependency "
                                     "--material --mfront-profiling)");
+    this->backend->completeLibraryDescription(l);
     for (const auto& h : ModellingHypothesis::getModellingHypotheses()) {
       insert_if(l.epts, name + "_" + ModellingHypothesis::toString(h));
     }
@@ -0,0 +1,23 @@
+/*!
+ * \file   mfront/src/GenericParallel/Behaviour/AbstractBackend.cxx
+ * \brief  This file implements the `AbstractBackend` class
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright Copyright (C) 2006-2025 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include "MFront/GenericParallel/Behaviour/AbstractBackend.hxx"
+
+namespace mfront::generic_parallel::behaviour {
+
+  void AbstractBackend::completeLibraryDescription(LibraryDescription&) const {
+  }  // end of completeLibraryDescription
+
+  AbstractBackend::~AbstractBackend() = default;
+
+}  // end of namespace mfront::generic_parallel::behaviour
@@ -0,0 +1,89 @@
+/*!
+ * \file   mfront/src/GenericParallel/Behaviour/ParallelSTLBackend.cxx
+ * \brief  This file implements the `ParallelSTLBackend` class
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright Copyright (C) 2006-2025 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <ostream>
+#include "TFEL/Raise.hxx"
+#include "MFront/MFrontUtilities.hxx"
+#include "MFront/LibraryDescription.hxx"
+#include "MFront/GenericParallel/Behaviour/ParallelSTLBackend.hxx"
+
+namespace mfront::generic_parallel::behaviour {
+
+  ParallelSTLBackend::ParallelSTLBackend()
+      : execution_policy("std::execution::par") {
+  }  // end of ParallelSTLBackend
+
+  ParallelSTLBackend::ParallelSTLBackend(const tfel::utilities::DataMap& opts)
+      : ParallelSTLBackend() {
+    auto validator = tfel::utilities::DataMapValidator{};
+    validator.addDataTypeValidator<std::string>("execution_policy");
+    validator.validate(opts);
+    if (contains(opts, "execution_policy")) {
+      const auto p = get<std::string>(opts, "execution_policy");
+      if ((p == "par") || (p == "parallel_policy")) {
+        this->execution_policy = "std::execution::par";
+      } else if ((p == "seq") || (p == "sequenced_policy")) {
+        this->execution_policy = "std::execution::seq";
+      } else if ((p == "unseq") || (p == "unsequenced_policy")) {
+        this->execution_policy = "std::execution::unseq";
+      } else if ((p == "par_unseq") || (p == "parallel_unsequenced_policy")) {
+        this->execution_policy = "std::execution::par_unseq";
+      } else {
+        tfel::raise(
+            "unsuported execution policy '" + p +
+            "'. Valid execution policy are: 'sequenced_policy' (or "
+            "'seq'), 'unsequenced_policy' (or 'unseq'), 'parallel_policy' (or "
+            "'par') and 'parallel_unsequenced_policy' (or 'par_unseq')");
+      }
+    }
+  }  // end of ParallelSTLBackend
+
+  std::string ParallelSTLBackend::getName() const {
+    return "stlpar";
+  }  // end of getName
+
+  bool ParallelSTLBackend::isParallelExecutionPolicy() const {
+    return (this->execution_policy == "std::execution::par") ||
+           (this->execution_policy == "std::execution::par_unseq");
+  }  // end of isParallelExecutionPolicy
+
+  void ParallelSTLBackend::writeSpecificIncludesInSourceFile(
+      std::ostream& os) const {
+    os << "#include<execution>\n"
+       << "#include\"MFront/GenericBehaviour/ParallelBatchIntegrate.hxx\"\n";
+  }  // end of writeSpecificIncludesInSourceFile
+
+  void ParallelSTLBackend::writeBatchIntegration(std::ostream& os,
+                                                 std::string_view d,
+                                                 std::string_view f) const {
+    os << "mfront::gb::integrateBatch(" << this->execution_policy << ", " << d
+       << ", " << f << ")";
+  }  // end of writeBatchIntegration
+
+  void ParallelSTLBackend::completeLibraryDescription(
+      LibraryDescription& l) const {
+#ifdef MFRONT_HAVE_TBB
+    if (this->isParallelExecutionPolicy()) {
+      insert_if(l.link_libraries, "tbb");
+      return;
+    }
+#endif /* MFRONT_HAVE_TBB */
+    // the GNU standard library selects the TBB implementation of the
+    // parallel algorithms as soon as the TBB headers are found, even for
+    // sequential policies
+    insert_if(l.cppflags, "-D_GLIBCXX_USE_TBB_PAR_BACKEND=0");
+  }  // end of completeLibraryDescription
+
+  ParallelSTLBackend::~ParallelSTLBackend() noexcept = default;
+
+}  // end of namespace mfront::generic_parallel::behaviour
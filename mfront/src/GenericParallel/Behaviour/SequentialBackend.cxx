@@ -0,0 +1,43 @@
+/*!
+ * \file   mfront/src/GenericParallel/Behaviour/SequentialBackend.cxx
+ * \brief  This file implements the `SequentialBackend` class
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright Copyright (C) 2006-2025 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <ostream>
+#include "MFront/GenericParallel/Behaviour/SequentialBackend.hxx"
+
+namespace mfront::generic_parallel::behaviour {
+
+  SequentialBackend::SequentialBackend() = default;
+
+  SequentialBackend::SequentialBackend(const tfel::utilities::DataMap& opts) {
+    auto validator = tfel::utilities::DataMapValidator{};
+    validator.validate(opts);
+  }  // end of SequentialBackend
+
+  std::string SequentialBackend::getName() const {
+    return "sequential";
+  }  // end of getName
+
+  void SequentialBackend::writeSpecificIncludesInSourceFile(
+      std::ostream& os) const {
+    os << "#include\"MFront/GenericBehaviour/BatchIntegrate.hxx\"\n";
+  }  // end of writeSpecificIncludesInSourceFile
+
+  void SequentialBackend::writeBatchIntegration(std::ostream& os,
+                                                std::string_view d,
+                                                std::string_view f) const {
+    os << "mfront::gb::integrateBatch(" << d << ", " << f << ")";
+  }  // end of writeBatchIntegration
+
+  SequentialBackend::~SequentialBackend() noexcept = default;
+
+}  // end of namespace mfront::generic_parallel::behaviour
@@ -112,8 +112,57 @@ namespace mfront {
                        "ModellingHypothesisToTensorSize<" + hn + ">::value"});
     os << "friend struct tfel::math::TinyNonLinearSolverBase<" << n
        << ", NumericType, " << this->bd.getClassName() << ">;\n";
+    if (this->bd.getAttribute(h, BehaviourData::automaticDifferentiation,
+                              false)) {
+      os << "template<ModellingHypothesis::Hypothesis, typename, bool>\n"
+         << "friend struct " << this->bd.getClassName() << ";\n";
+    }
   }  // end of writeBehaviourFriends
 
+  void ImplicitCodeGeneratorBase::writeBehaviourConstructors(
+      std::ostream& os, const Hypothesis h) const {
+    BehaviourCodeGeneratorBase::writeBehaviourConstructors(os, h);
+    if (!this->bd.getAttribute(h, BehaviourData::automaticDifferentiation,
+                               false)) {
+      return;
+    }
+    const auto& d = this->bd.getBehaviourData(h);
+    const auto& n = this->bd.getClassName();
+    const auto init = this->getBehaviourConstructorsInitializers(h);
+    os << "/*!\n"
+       << "* \\brief converting constructor used by the automatic\n"
+       << "* differentiation of the residual. The increments of the\n"
+       << "* integration variables are not copied.\n"
+       << "*/\n"
+       << "template<typename NumericType2>\n"
+       << "explicit " << n << "(const " << n
+       << "<hypothesis, NumericType2, false>& src)\n"
+       << ": " << n << "BehaviourData<hypothesis, NumericType, false>(src),\n"
+       << n << "IntegrationData<hypothesis, NumericType, false>(src)";
+    if (!init.empty()) {
+      os << ",\n" << init;
+    }
+    os << "\n{\n";
+    for (const auto& v : d.getLocalVariables()) {
+      // references are bound by the initializers
+      if (!v.type.ends_with('&')) {
+        os << "this->" << v.name << " = src." << v.name << ";\n";
+      }
+    }
+    if (!areParametersTreatedAsStaticVariables(this->bd)) {
+      for (const auto& p : d.getParameters()) {
+        if (!p.getAttribute<bool>(
+                VariableDescription::variableDeclaredInBaseClass, false)) {
+          os << "this->" << p.name << " = src." << p.name << ";\n";
+        }
+      }
+    }
+    if (allowRuntimeModificationOfTheOutOfBoundsPolicy(this->bd)) {
+      os << "this->policy = src.policy;\n";
+    }
+    os << "}\n\n";
+  }  // end of writeBehaviourConstructors
+
   void ImplicitCodeGeneratorBase::writeDerivativeView(
       std::ostream& os, const DerivativeViewDescription& d) const {
     const auto v1 = d.first_variable;
@@ -290,6 +339,16 @@ namespace mfront {
     for (const auto& h : this->solver.getSpecificHeaders()) {
       os << "#include\"" << h << "\"\n";
     }
+    if (this->bd.getAttribute(ModellingHypothesis::UNDEFINEDHYPOTHESIS,
+                              BehaviourData::automaticDifferentiation,
+                              false)) {
+      os << "#include<memory>\n"
+         << "#include\"TFEL/Math/General/Dual.hxx\"\n";
+    }
+    if (this->bd.hasAttribute(ModellingHypothesis::UNDEFINEDHYPOTHESIS,
+                              BehaviourData::staticCondensationVariables)) {
+      os << "#include\"TFEL/Math/TinyStaticCondensationSolve.hxx\"\n";
+    }
   }  // end of writeBehaviourParserSpecificIncludes()
 
   void ImplicitCodeGeneratorBase::writeBehaviourParserSpecificTypedefs(
@@ -991,6 +1050,45 @@ namespace mfront {
     const auto& d = this->bd.getBehaviourData(h);
     const auto n = d.getIntegrationVariables().getTypeSize();
     this->checkBehaviourFile(os);
+    if (this->bd.getAttribute(h, BehaviourData::automaticDifferentiation,
+                              false)) {
+      // the residual is evaluated once by a copy of the behaviour using
+      // dual numbers seeded by the unknowns. This copy is n+1 times larger
+      // than the behaviour and is thus allocated on the heap.
+      os << "void computeNumericalJacobian("
+         << "tfel::math::tmatrix<" << n << "," << n
+         << ", NumericType>& njacobian)\n"
+         << "{\n"
+         << "if constexpr (std::is_floating_point_v<NumericType>) {\n"
+         << "using mfront_dual = tfel::math::Dual<NumericType, " << n
+         << ">;\n"
+         << "auto mfront_ad = std::make_unique<" << this->bd.getClassName()
+         << "<hypothesis, mfront_dual, false>>(*this);\n"
+         << "for(ushort mfront_idx = 0; mfront_idx != " << n
+         << "; ++mfront_idx){\n"
+         << "mfront_ad->zeros(mfront_idx) = "
+         << "mfront_dual(this->zeros(mfront_idx), mfront_idx);\n"
+         << "}\n";
+      if (this->bd.hasCode(h, BehaviourData::ComputeThermodynamicForces)) {
+        os << "mfront_ad->computeThermodynamicForces();\n";
+      }
+      os << "mfront_ad->computeFdF(true);\n"
+         << "for(ushort mfront_idx = 0; mfront_idx != " << n
+         << "; ++mfront_idx){\n"
+         << "for(ushort mfront_idx2 = 0; mfront_idx2 != " << n
+         << "; ++mfront_idx2){\n"
+         << "njacobian(mfront_idx, mfront_idx2) = "
+         << "mfront_ad->fzeros(mfront_idx).getDerivative(mfront_idx2);\n"
+         << "}\n"
+         << "}\n"
+         << "} else {\n"
+         << "tfel::raise(\"" << this->bd.getClassName()
+         << "::computeNumericalJacobian: automatic differentiation is only "
+         << "supported for floating point numeric types\");\n"
+         << "}\n"
+         << "}\n\n";
+      return;
+    }
     os << "TFEL_HOST_DEVICE void computeNumericalJacobian("
        << "tfel::math::tmatrix<" << n << "," << n
        << ", NumericType>& njacobian)\n"
@@ -1072,6 +1170,18 @@ namespace mfront {
         }
       }
     }
+    // the copies of the behaviour used by the automatic differentiation
+    // of the residual are never integrated. Discarding the body of this
+    // method avoids instantiating the solver and the tangent operator
+    // with dual numbers.
+    const auto ad =
+        this->bd.getAttribute(h, BehaviourData::automaticDifferentiation, false);
+    if (ad) {
+      os << "if constexpr (!std::is_floating_point_v<NumericType>) {\n"
+         << "tfel::raise(\"" << this->bd.getClassName() << "::integrate: \"\n"
+         << "\"unsupported numeric type\");\n"
+         << "} else {\n";
+    }
     if (this->bd.hasCode(h, BehaviourData::ComputePredictor)) {
       os << this->bd.getCode(h, BehaviourData::ComputePredictor) << '\n';
     }
@@ -1162,6 +1272,9 @@ namespace mfront {
       os << "return MechanicalBehaviour<" << btype
          << ",hypothesis, NumericType, false>::SUCCESS;\n";
     }
+    if (ad) {
+      os << "}\n";
+    }
     os << "} // end of " << this->bd.getClassName() << "::integrate\n\n";
     //
     os << "TFEL_HOST_DEVICE bool computeResidual(){\n";
@@ -1357,9 +1470,27 @@ namespace mfront {
       writeStandardPerformanceProfilingBegin(os, this->bd.getClassName(),
                                              "TinyMatrixSolve", "lu");
     }
-    os << "mfront_success = "
-       << this->solver.getExternalAlgorithmClassName(this->bd, h)
-       << "::solveLinearSystem(mfront_matrix, mfront_vector);\n";
+    if (this->bd.hasAttribute(h, BehaviourData::staticCondensationVariables)) {
+      // the condensed variables are the last integration variables, as
+      // checked by the DSL
+      const auto& cvars = this->bd.getAttribute<std::vector<std::string>>(
+          h, BehaviourData::staticCondensationVariables);
+      auto nr = SupportedTypes::TypeSize{};
+      for (const auto& v : d.getIntegrationVariables()) {
+        if (std::find(cvars.begin(), cvars.end(), v.name) == cvars.end()) {
+          nr += v.getTypeSize();
+        }
+      }
+      const auto db = this->bd.getAttribute<bool>(
+          h, BehaviourData::staticCondensationDiagonalBlock, false);
+      os << "mfront_success = tfel::math::TinyStaticCondensationSolve<" << n2
+         << ", " << nr << ", NumericType, " << (db ? "true" : "false")
+         << ", false>::exe(mfront_matrix, mfront_vector);\n";
+    } else {
+      os << "mfront_success = "
+         << this->solver.getExternalAlgorithmClassName(this->bd, h)
+         << "::solveLinearSystem(mfront_matrix, mfront_vector);\n";
+    }
     if (this->bd.getAttribute(BehaviourData::profiling, false)) {
       writeStandardPerformanceProfilingEnd(os);
     }
@@ -119,6 +119,10 @@ namespace mfront {
     this->registerNewCallBack(
         "@CompareToNumericalJacobian",
         &ImplicitDSLBase::treatCompareToNumericalJacobian);
+    this->registerNewCallBack("@AutomaticDifferentiation",
+                              &ImplicitDSLBase::treatAutomaticDifferentiation);
+    this->registerNewCallBack("@StaticCondensation",
+                              &ImplicitDSLBase::treatStaticCondensation);
     this->registerNewCallBack(
         "@JacobianComparisonCriterion",
         &ImplicitDSLBase::treatJacobianComparisonCriterion);
@@ -465,6 +469,77 @@ namespace mfront {
                              ";");
   }  // end of treatCompareToNumericalJacobian
 
+  void ImplicitDSLBase::treatAutomaticDifferentiation() {
+    const auto h = ModellingHypothesis::UNDEFINEDHYPOTHESIS;
+    this->checkNotEndOfFile("ImplicitDSLBase::treatAutomaticDifferentiation",
+                            "Expected 'true' or 'false'.");
+    if (this->current->value == "true") {
+      this->mb.setAttribute(h, BehaviourData::automaticDifferentiation, true);
+    } else if (this->current->value == "false") {
+      this->mb.setAttribute(h, BehaviourData::automaticDifferentiation, false);
+    } else {
+      this->throwRuntimeError(
+          "ImplicitDSLBase::treatAutomaticDifferentiation",
+          "Expected to read 'true' or 'false' instead of '" +
+              this->current->value + ".");
+    }
+    ++(this->current);
+    this->readSpecifiedToken("ImplicitDSLBase::treatAutomaticDifferentiation",
+                             ";");
+  }  // end of treatAutomaticDifferentiation
+
+  void ImplicitDSLBase::treatStaticCondensation() {
+    using namespace tfel::utilities;
+    const std::string m = "ImplicitDSLBase::treatStaticCondensation";
+    const auto h = ModellingHypothesis::UNDEFINEDHYPOTHESIS;
+    if (this->mb.hasAttribute(h, BehaviourData::staticCondensationVariables)) {
+      this->throwRuntimeError(m, "static condensation already defined");
+    }
+    this->checkNotEndOfFile(m, "Expected '{'.");
+    const auto options = read<DataMap>(this->current, this->tokens.end());
+    this->readSpecifiedToken(m, ";");
+    DataMapValidator{}
+        .addDataValidator("condensed_variables",
+                          [](const Data& d) {
+                            if ((!d.is<std::string>()) &&
+                                (!d.is<std::vector<Data>>())) {
+                              tfel::raise(
+                                  "expected a string or an array of strings");
+                            }
+                          })
+        .addDataTypeValidator<bool>("diagonal_block")
+        .validate(options);
+    if (!options.contains("condensed_variables")) {
+      this->throwRuntimeError(m, "no condensed variables defined");
+    }
+    const auto& cv = get(options, "condensed_variables");
+    auto vars = std::vector<std::string>{};
+    if (cv.is<std::string>()) {
+      vars.push_back(cv.get<std::string>());
+    } else {
+      for (const auto& v : cv.get<std::vector<Data>>()) {
+        if (!v.is<std::string>()) {
+          this->throwRuntimeError(m, "invalid condensed variable name");
+        }
+        vars.push_back(v.get<std::string>());
+      }
+    }
+    if (vars.empty()) {
+      this->throwRuntimeError(m, "no condensed variables defined");
+    }
+    for (const auto& v : vars) {
+      if (std::count(vars.begin(), vars.end(), v) != 1) {
+        this->throwRuntimeError(m, "variable '" + v + "' multiply declared");
+      }
+    }
+    this->mb.setAttribute(h, BehaviourData::staticCondensationVariables, vars);
+    this->mb.setAttribute(
+        h, BehaviourData::staticCondensationDiagonalBlock,
+        options.contains("diagonal_block")
+            ? get<bool>(options, "diagonal_block")
+            : false);
+  }  // end of treatStaticCondensation
+
   void ImplicitDSLBase::treatJacobianComparisonCriterion() {
     const auto h = ModellingHypothesis::UNDEFINEDHYPOTHESIS;
     if (!this->mb.getAttribute(h, BehaviourData::compareToNumericalJacobian,
@@ -1499,6 +1574,50 @@ namespace mfront {
                "@CompareToNumericalJacobian can only be used with solver using "
                "an analytical jacobian (or an approximation of it");
     }
+    if (this->mb.getAttribute(uh, BehaviourData::automaticDifferentiation,
+                              false)) {
+      throw_if(this->mb.useQt(),
+               "automatic differentiation is not supported when "
+               "quantities are used");
+      for (const auto& h : mh) {
+        const auto& d = this->mb.getBehaviourData(h);
+        throw_if((!d.getBehaviourVariables().empty()) ||
+                     (!d.getBehaviourVariableFactories().empty()),
+                 "automatic differentiation is not supported by behaviours "
+                 "declaring behaviour variables");
+        for (const auto& v : d.getLocalVariables()) {
+          throw_if(v.type.starts_with("struct{"),
+                   "automatic differentiation is not supported by behaviours "
+                   "declaring local data structures");
+        }
+      }
+    }
+    if (this->mb.hasAttribute(uh, BehaviourData::staticCondensationVariables)) {
+      throw_if(!this->solver->usesJacobian(),
+               "static condensation can only be used with solvers "
+               "using the jacobian");
+      const auto& cvars = this->mb.getAttribute<std::vector<std::string>>(
+          uh, BehaviourData::staticCondensationVariables);
+      for (const auto& h : mh) {
+        // the condensed variables must be the last integration variables
+        const auto& ivars =
+            this->mb.getBehaviourData(h).getIntegrationVariables();
+        for (const auto& v : cvars) {
+          throw_if(!this->mb.isIntegrationVariableName(h, v),
+                   "invalid condensed variable '" + v +
+                       "', which is not an integration variable");
+        }
+        throw_if(cvars.size() >= ivars.size(),
+                 "at least one integration variable must not be condensed");
+        for (auto pv = ivars.size() - cvars.size(); pv != ivars.size(); ++pv) {
+          const auto& n = ivars[pv].name;
+          throw_if(std::find(cvars.begin(), cvars.end(), n) == cvars.end(),
+                   "the condensed variables must be the last declared "
+                   "integration variables (the integration variable '" +
+                       n + "' is declared after a condensed variable)");
+        }
+      }
+    }
     // create the compute final stress code is necessary
     this->setComputeFinalThermodynamicForcesFromComputeFinalThermodynamicForcesCandidateIfNecessary();
     // correct prediction to take into account normalisation factors
@@ -23,6 +23,9 @@
 #include <cstring>
 #include <string>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <filesystem>
 
 #include "TFEL/Raise.hxx"
 #include "TFEL/Config/GetInstallPath.hxx"
@@ -30,6 +33,7 @@
 #include "TFEL/Utilities/StringAlgorithms.hxx"
 #include "TFEL/System/System.hxx"
 #include "TFEL/System/ExternalLibraryManager.hxx"
+#include "TFEL/System/ThreadPool.hxx"
 
 #include "MFront/MFrontHeader.hxx"
 #include "MFront/MFrontLogStream.hxx"
@@ -45,6 +49,7 @@
 #include "MFront/BehaviourBrick/KinematicHardeningRuleFactory.hxx"
 #include "MFront/ModelInterfaceFactory.hxx"
 #include "MFront/MFrontLock.hxx"
+#include "MFront/BuildCache.hxx"
 #include "MFront/MFrontWarningMode.hxx"
 #include "MFront/MFrontDebugMode.hxx"
 #include "MFront/MFrontUtilities.hxx"
@@ -237,6 +242,64 @@ namespace mfront {
     }
   }  // end of MFront::treatOBuild
 
+  void MFront::treatJobs() {
+    this->jobs = tfel::utilities::parseNumberOfJobs(
+        "MFront::treatJobs", this->currentArgument->getOption());
+    this->opts.jobs = this->jobs;
+  }  // end of MFront::treatJobs
+
+  void MFront::treatObjectCache() {
+    this->object_cache = this->currentArgument->getOption();
+    tfel::raise_if(this->object_cache.empty(),
+                   "MFront::treatObjectCache: "
+                   "no directory given to the --object-cache option");
+  }  // end of MFront::treatObjectCache
+
+  std::string MFront::getGenerationOptionsHash() const {
+    // options which do not affect code generation
+    static const auto ignored = std::vector<std::string>{
+        "--verbose",   "--jobs",         "-j",       "--incremental",
+        "--make",      "--build",        "--omake",  "-m",
+        "--obuild",    "-b",             "--target", "-t",
+        "--otarget",   "--clean",        "-g",       "--silent-build",
+        "--no-gui",    "--object-cache", "--no-terminate-handler",
+        "--unicode-output", "--precompiled-headers", "--unity-build"};
+    auto h = MFrontHeader::getVersionNumber() + '\n';
+#ifdef TFEL_GIT_HASH
+    h += std::string{TFEL_GIT_HASH} + '\n';
+#endif /* TFEL_GIT_HASH */
+    h += tfel::getInstallPath() + '\n';
+    for (const auto& a : this->args) {
+      const auto& n = a.as_string();
+      if ((!n.starts_with('-')) ||
+          (std::find(ignored.begin(), ignored.end(), n) != ignored.end())) {
+        continue;
+      }
+      h += n;
+      if (a.hasOption()) {
+        const auto& o = a.getOption();
+        h += '=' + o;
+        // content of configuration files
+        auto ec = std::error_code{};
+        if (std::filesystem::is_regular_file(o, ec)) {
+          h += ' ' + computeFileHash(o);
+        }
+      }
+      h += '\n';
+    }
+    return computeHash(h);
+  }  // end of MFront::getGenerationOptionsHash
+
+  std::string MFront::getObjectCacheKey() const {
+    auto k = this->getGenerationOptionsHash() + '\n' +
+             std::to_string(static_cast<int>(this->opts.olevel)) + '\n' +
+             (this->opts.debugFlags ? "debug" : "nodebug") + '\n' +
+             (this->opts.precompiledHeaders ? "pch" : "nopch") + '\n';
+    // compilers, their versions and compilation flags
+    k += getMakeFileBuildEnvironment(this->opts);
+    return computeHash(k);
+  }  // end of MFront::getObjectCacheKey
+
   void MFront::treatListParsers() {
     std::cout << "available dsl: \n";
     auto& parserFactory = DSLFactory::getDSLFactory();
@@ -501,6 +564,35 @@ namespace mfront {
                               "generate build file and clean libraries");
     this->registerNewCallBack("--generator", "-G", &MFront::treatGenerator,
                               "choose build system", true);
+    this->registerNewCallBack(
+        "--jobs", "-j", &MFront::treatJobs,
+        "specifies the number of files treated simultaneously and the "
+        "number of jobs used to build the libraries. If no value "
+        "is given, the number of cores is used.",
+        true);
+    this->registerCallBack(
+        "--precompiled-headers",
+        CallBack(
+            "precompile the TFEL headers shared by the generated sources",
+            [this]() noexcept { this->opts.precompiledHeaders = true; },
+            false));
+    this->registerCallBack(
+        "--unity-build",
+        CallBack(
+            "compile the generated sources of each library in a single "
+            "translation unit",
+            [this]() noexcept { this->opts.unityBuild = true; }, false));
+    this->registerCallBack(
+        "--incremental",
+        CallBack(
+            "skip the code generation for files which did not change, "
+            "nor their dependencies, since the last call of mfront",
+            [this]() noexcept { this->incremental = true; }, false));
+    this->registerNewCallBack(
+        "--object-cache", &MFront::treatObjectCache,
+        "specifies a directory used to share object files between "
+        "build directories (only supported by the Make generator)",
+        true);
 
     this->registerCallBack("--list-material-property-interfaces",
                            CallBack(
@@ -787,8 +879,43 @@ namespace mfront {
   }    // end of void MFront::treatDefFile
 #endif /* (defined _WIN32 || defined _WIN64 ||defined __CYGWIN__) */
 
+  /*!
+   * \return a mutex associated with the given file.
+   *
+   * This mutex prevents two threads from treating the same file
+   * simultaneously, which happens when many files depend on the same
+   * external file (see the `@MaterialLaw` keyword for instance) and would
+   * lead to concurrent writes of the same output files.
+   *
+   * \param[in] f: file name
+   */
+  static std::mutex& getFileMutex(const std::string& f) {
+    static std::mutex m;
+    static std::map<std::string, std::unique_ptr<std::mutex>> mutexes;
+    const auto key = [&f] {
+      auto ec = std::error_code{};
+      const auto p = std::filesystem::weakly_canonical(f, ec);
+      return ec ? f : p.string();
+    }();
+    auto lock = std::lock_guard<std::mutex>{m};
+    auto& pm = mutexes[key];
+    if (pm == nullptr) {
+      pm = std::make_unique<std::mutex>();
+    }
+    return *pm;
+  }  // end of getFileMutex
+
   TargetsDescription MFront::treatFile(
       const std::string& f, const tfel::utilities::DataMap& dsl_options) const {
+    auto deps = std::vector<std::string>{};
+    return this->treatFile(f, deps, dsl_options);
+  }  // end of MFront::treatFile()
+
+  TargetsDescription MFront::treatFile(
+      const std::string& f,
+      std::vector<std::string>& deps,
+      const tfel::utilities::DataMap& dsl_options) const {
+    auto lock = std::lock_guard<std::mutex>{getFileMutex(f)};
     if (getVerboseMode() >= VERBOSE_LEVEL2) {
       getLogStream() << "Treating file: '" << f << "'" << std::endl;
     }
@@ -798,6 +925,7 @@ namespace mfront {
     }
     dsl->analyseFile(f, this->ecmds, this->substitutions);
     dsl->generateOutputFiles();
+    deps = dsl->getInputFiles();
     auto td = dsl->getTargetsDescription();
     for (auto& l : td.libraries) {
       for (const auto& d : this->defines) {
@@ -837,9 +965,9 @@ namespace mfront {
 
   void MFront::buildLibraries(const std::string& target) {
     if (this->generator == CMAKE) {
-      callCMake(target);
+      callCMake(target, this->opts);
     } else {
-      callMake(target);
+      callMake(target, this->opts);
     }
   }  // end of MFront::buildLibraries
 
@@ -907,12 +1035,71 @@ namespace mfront {
     this->analyseTargetsFile();
     auto errors = std::vector<std::pair<std::string, std::string>>{};
     if (!this->inputs.empty()) {
-      for (const auto& i : this->inputs) {
+      const auto files =
+          std::vector<std::string>(this->inputs.begin(), this->inputs.end());
+      auto tds = std::vector<std::optional<TargetsDescription>>(files.size());
+      auto messages = std::vector<std::string>(files.size());
+      auto cache = std::optional<SourcesCache>{};
+      if (this->incremental) {
+        cache.emplace(this->getGenerationOptionsHash());
+      }
+      auto treat = [this, &files, &tds, &messages,
+                    &cache](const std::size_t i) {
         try {
-          const auto td = this->treatFile(i);
-          mergeTargetsDescription(this->targets, td, true);
+          if (!cache.has_value()) {
+            tds[i].emplace(this->treatFile(files[i]));
+            return;
+          }
+          auto td = cache->get(files[i]);
+          if (td.has_value()) {
+            if (getVerboseMode() >= VERBOSE_LEVEL1) {
+              getLogStream() << "File '" << files[i]
+                             << "' is up to date, code generation skipped\n";
+            }
+            tds[i].emplace(std::move(*td));
+            return;
+          }
+          auto deps = std::vector<std::string>{};
+          tds[i].emplace(this->treatFile(files[i], deps));
+          cache->store(files[i], deps, *(tds[i]));
         } catch (std::exception& e) {
-          errors.push_back({i, e.what()});
+          messages[i] = e.what();
+        } catch (...) {
+          messages[i] = "unknown exception";
+        }
+      };
+      if ((this->jobs > 1) && (files.size() > 1)) {
+        // the outputs of each file are buffered and printed in the order
+        // of the files once all the files have been treated
+        auto logs = std::vector<std::ostringstream>(files.size());
+        tfel::system::ThreadPool pool(std::min(this->jobs, files.size()));
+        pool.parallel_for(
+            0, files.size(),
+            [&treat, &logs](const std::size_t b, const std::size_t e) {
+              for (auto i = b; i != e; ++i) {
+                const auto plog = setThreadLogStream(&logs[i]);
+                treat(i);
+                setThreadLogStream(plog);
+              }
+            },
+            1);
+        auto& log = getLogStream();
+        for (const auto& l : logs) {
+          log << l.str();
+        }
+        log.flush();
+      } else {
+        for (std::size_t i = 0; i != files.size(); ++i) {
+          treat(i);
+        }
+      }
+      // the targets are merged in the order of the files, whatever the
+      // number of jobs
+      for (std::size_t i = 0; i != files.size(); ++i) {
+        if (tds[i].has_value()) {
+          mergeTargetsDescription(this->targets, *(tds[i]), true);
+        } else {
+          errors.push_back({files[i], messages[i]});
         }
       }
       for (auto& t : this->targets.specific_targets) {
@@ -969,12 +1156,27 @@ namespace mfront {
     if ((this->buildLibs) &&
         ((has_libs) || (!this->targets.specific_targets.empty()))) {
       auto& log = getLogStream();
+      auto ocache = std::optional<ObjectsCache>{};
+      if (!this->object_cache.empty()) {
+        tfel::raise_if(this->generator == CMAKE,
+                       "MFront::exe: the --object-cache option is only "
+                       "supported by the Make generator");
+        ocache.emplace(this->object_cache, this->getObjectCacheKey());
+        const auto restored = ocache->restore(this->targets);
+        if (getVerboseMode() >= VERBOSE_LEVEL1) {
+          log << restored.size()
+              << " object file(s) restored from the object cache\n";
+        }
+      }
       for (const auto& t : this->specifiedTargets) {
         if (getVerboseMode() >= VERBOSE_LEVEL0) {
           log << "Treating target '" << t << "'" << std::endl;
         }
         this->buildLibraries(t);
       }
+      if (ocache.has_value()) {
+        ocache->store(this->targets);
+      }
       if (getVerboseMode() >= VERBOSE_LEVEL0) {
         if (has_libs) {
           if (this->targets.libraries.end() - this->targets.libraries.begin() ==
@@ -12,30 +12,115 @@
  */
 
 #include <regex>
+#include <cctype>
 #include <cstdlib>
+#include <fstream>
+#include <sstream>
 #include <iostream>
 #include <algorithm>
 #include <stdexcept>
-#include <functional>
+#include <exception>
 #include <functional>
 #include <filesystem>
+#include <thread>
 #include "TFEL/Raise.hxx"
 #include "TFEL/Utilities/StringAlgorithms.hxx"
 #include "TFEL/Utilities/ArgumentParserBase.hxx"
+#include "TFEL/System/ThreadPool.hxx"
+#include "TFEL/System/LibraryInformation.hxx"
 #include "TFEL/System/ExternalLibraryManager.hxx"
 #include "MFront/MFrontDatabase.hxx"
 
 namespace mfront {
 
-  void MFrontDatabase::analyseLibrary(const std::string& l) {
+  //! \brief first line of an index file
+  static constexpr const char* const index_file_header =
+      "MFrontDatabaseIndex 1";
+
+  /*!
+   * \return the given string in lower case
+   * \param[in] s: string
+   */
+  static std::string toLowerCase(std::string s) {
+    for (auto& c : s) {
+      c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    }
+    return s;
+  }  // end of toLowerCase
+
+  /*!
+   * \return if the given filter only contains characters which match
+   * themselves whatever the syntax of regular expressions. Such filters
+   * can be treated by hashed lookups.
+   * \param[in] f: filter
+   */
+  static bool isLiteralFilter(const std::string& f) {
+    return (!f.empty()) && std::all_of(f.begin(), f.end(), [](const char c) {
+      return (std::isalnum(static_cast<unsigned char>(c)) != 0) || (c == '_');
+    });
+  }  // end of isLiteralFilter
+
+  /*!
+   * \return the number of threads to be used
+   * \param[in] n: number of threads requested
+   */
+  static std::size_t getNumberOfThreads(const std::size_t n) {
+    if (n != 0) {
+      return n;
+    }
+    return std::max(std::size_t{1},
+                    static_cast<std::size_t>(std::thread::hardware_concurrency()));
+  }  // end of getNumberOfThreads
+
+  std::pair<MFrontDatabase::LibraryIndexEntry, bool> MFrontDatabase::analyse(
+      const std::string& l) const {
+    namespace fs = std::filesystem;
+    auto ec = std::error_code{};
+    auto r = LibraryIndexEntry{};
+    // the index can only be used if the library is given by its path
+    auto indexable = fs::is_regular_file(l, ec) && (!ec);
+    if (indexable) {
+      r.size = fs::file_size(l, ec);
+      indexable = !ec;
+    }
+    if (indexable) {
+      const auto t = fs::last_write_time(l, ec);
+      indexable = !ec;
+      r.modification_time =
+          static_cast<std::int64_t>(t.time_since_epoch().count());
+    }
+    if (indexable) {
+      const auto p = this->index.find(l);
+      if ((p != this->index.end()) && (p->second.size == r.size) &&
+          (p->second.modification_time == r.modification_time)) {
+        return {p->second, true};
+      }
+    }
     auto& elm =
         tfel::system::ExternalLibraryManager::getExternalLibraryManager();
-    const auto enames = elm.getEntryPoints(l);
+    const auto enames = [&elm, &l, indexable] {
+      if (!indexable) {
+        return elm.getEntryPoints(l);
+      }
+      // the symbols are read without loading the library, so that
+      // libraries which do not contain any entry point are never loaded
+      auto epnames = std::vector<std::string>{};
+      for (const auto& s : tfel::system::LibraryInformation(l).symbols()) {
+        if (tfel::utilities::ends_with(s, "_mfront_ept")) {
+          epnames.push_back(s.substr(0, s.size() - 11));
+        }
+      }
+      return epnames;
+    }();
     for (const auto& en : enames) {
       auto ep = EntryPoint{};
       ep.library = l;
       ep.name = en;
       ep.source = elm.getSource(l, en);
+      ep.material = elm.getMaterial(l, en);
+      if (elm.contains(l, en + "_mfront_interface")) {
+        ep.interface = elm.getInterface(l, en);
+      }
       const auto et = elm.getMaterialKnowledgeType(l, en);
       if (et == 0u) {
         ep.type = EntryPoint::MATERIALPROPERTY;
@@ -49,8 +134,34 @@ namespace mfront {
         }
         ep.type = EntryPoint::MODEL;
       }
-      this->epts.push_back(std::move(ep));
+      r.entry_points.push_back(std::move(ep));
+    }
+    return {std::move(r), indexable};
+  }  // end of analyse
+
+  void MFrontDatabase::registerEntryPoint(EntryPoint e) {
+    const auto pos = this->epts.size();
+    this->names[toLowerCase(e.name)].push_back(pos);
+    this->materials[toLowerCase(e.material)].push_back(pos);
+    this->interfaces[toLowerCase(e.interface)].push_back(pos);
+    this->epts.push_back(std::move(e));
+  }  // end of registerEntryPoint
+
+  void MFrontDatabase::registerLibrary(const std::string& l,
+                                       LibraryIndexEntry e,
+                                       const bool b) {
+    for (const auto& ep : e.entry_points) {
+      this->registerEntryPoint(ep);
+    }
+    if (b) {
+      this->index[l] = std::move(e);
+      this->analysed_libraries.insert(l);
     }
+  }  // end of registerLibrary
+
+  void MFrontDatabase::analyseLibrary(const std::string& l) {
+    auto [e, b] = this->analyse(l);
+    this->registerLibrary(l, std::move(e), b);
   }  // end of analyseLibrary
 
   void MFrontDatabase::analyseLibraries(
@@ -60,6 +171,72 @@ namespace mfront {
     }
   }  // end of analyseLibraries
 
+  void MFrontDatabase::analyseLibraries(
+      const std::vector<std::string>& libraries, const std::size_t n) {
+    auto r = AnalyseDirectoryResults{};
+    auto opts = AnalyseDirectoryOptions{};
+    opts.number_of_threads = n;
+    this->analyseLibraries(r, libraries, opts);
+  }  // end of analyseLibraries
+
+  void MFrontDatabase::analyseLibraries(
+      AnalyseDirectoryResults& r,
+      const std::vector<std::string>& libraries,
+      const AnalyseDirectoryOptions& opts) {
+    const auto nt = getNumberOfThreads(opts.number_of_threads);
+    if ((nt == 1) || (libraries.size() < 2)) {
+      for (const auto& l : libraries) {
+        try {
+          this->analyseLibrary(l);
+        } catch (std::exception& error) {
+          if (!opts.ignore_errors) {
+            throw;
+          }
+          r.library_analysis_failures.push_back(
+              {.library = std::filesystem::path(l).filename().string(),
+               .error_message = error.what()});
+        }
+      }
+      return;
+    }
+    // the libraries are analysed in parallel, but their entry points are
+    // registred in the order of the libraries
+    auto results =
+        std::vector<std::pair<LibraryIndexEntry, bool>>(libraries.size());
+    auto errors = std::vector<std::exception_ptr>(libraries.size());
+    auto pool = tfel::system::ThreadPool{nt - 1};
+    pool.parallel_for(
+        0, libraries.size(),
+        [this, &libraries, &results, &errors](const std::size_t b,
+                                              const std::size_t e) {
+          for (auto i = b; i != e; ++i) {
+            try {
+              results[i] = this->analyse(libraries[i]);
+            } catch (...) {
+              errors[i] = std::current_exception();
+            }
+          }
+        },
+        1);
+    for (std::size_t i = 0; i != libraries.size(); ++i) {
+      if (errors[i] == nullptr) {
+        this->registerLibrary(libraries[i], std::move(results[i].first),
+                              results[i].second);
+        continue;
+      }
+      try {
+        std::rethrow_exception(errors[i]);
+      } catch (std::exception& error) {
+        if (!opts.ignore_errors) {
+          throw;
+        }
+        r.library_analysis_failures.push_back(
+            {.library = std::filesystem::path(libraries[i]).filename().string(),
+             .error_message = error.what()});
+      }
+    }
+  }  // end of analyseLibraries
+
   void MFrontDatabase::analyseDirectory(AnalyseDirectoryResults& r,
                                         const std::string& d,
                                         const AnalyseDirectoryOptions& opts) {
@@ -84,53 +261,46 @@ namespace mfront {
       r.invalid_directories.push_back(d);
       return;
     }
-    for (const auto& entry : std::filesystem::directory_iterator(directory)) {
-      if (!entry.is_regular_file()) {
-        continue;
+    const auto prefix = [&opts]() -> std::string {
+      if (opts.library_prefix.has_value()) {
+        return *(opts.library_prefix);
       }
-      const auto prefix = [&opts]() -> std::string {
-        if (opts.library_prefix.has_value()) {
-          return *(opts.library_prefix);
-        }
 #if defined __CYGWIN__ && (!defined _GLIBCXX_USE_C99)
-        return "cyg";
+      return "cyg";
 #elif defined _MSC_VER
-        return "";
+      return "";
 #else
-        return "lib";
+      return "lib";
 #endif
-      }();
-      const auto suffix = [&opts]() -> std::string {
-        if (opts.library_suffix.has_value()) {
-          return *(opts.library_suffix);
-        }
+    }();
+    const auto suffix = [&opts]() -> std::string {
+      if (opts.library_suffix.has_value()) {
+        return *(opts.library_suffix);
+      }
 #if defined __APPLE__
-        return ".dylib";
+      return ".dylib";
 #elif defined __CYGWIN__
-        return ".cyg";
+      return ".cyg";
 #elif (defined _WIN32 || defined _WIN64)
-        return ".dll";
+      return ".dll";
 #else
-        return ".so";
+      return ".so";
 #endif
-      }();
+    }();
+    auto libraries = std::vector<std::string>{};
+    for (const auto& entry : std::filesystem::directory_iterator(directory)) {
+      if (!entry.is_regular_file()) {
+        continue;
+      }
       const auto p = entry.path();
       const auto l = p.filename().string();
       if ((tfel::utilities::starts_with(l, prefix)) &&
           (tfel::utilities::ends_with(l, suffix))) {
-        try {
-          this->analyseLibrary(p.string());
-        } catch (std::exception& error) {
-          if (opts.ignore_errors) {
-            r.library_analysis_failures.push_back(
-                {.library = l, .error_message = error.what()});
-          } else {
-            throw;
-          }
-        }
+        libraries.push_back(p.string());
       }
     }
-  }  // end of analyseLibraries
+    this->analyseLibraries(r, libraries, opts);
+  }  // end of analyseDirectory
 
   MFrontDatabase::AnalyseDirectoryResults MFrontDatabase::analyseDirectory(
       const std::string& d) {
@@ -190,48 +360,184 @@ namespace mfront {
     return this->analyseDirectories(directories, opts);
   }  // end of analyseDirectoriesListedInEnvironmentVariable
 
-  void MFrontDatabase::clear() { this->epts.clear(); }  // end of clear
+  void MFrontDatabase::loadIndex(const std::string& f) {
+    auto throw_if = [&f](const bool c, const std::string& m) {
+      tfel::raise_if(c, "MFrontDatabase::loadIndex: " + m + " (file '" + f +
+                            "')");
+    };
+    std::ifstream in(f);
+    if (!in) {
+      return;
+    }
+    auto line = std::string{};
+    if ((!std::getline(in, line)) || (line != index_file_header)) {
+      // index generated by another version of this class
+      return;
+    }
+    auto libraries = std::map<std::string, LibraryIndexEntry>{};
+    auto current = libraries.end();
+    while (std::getline(in, line)) {
+      if (line.empty()) {
+        continue;
+      }
+      const auto tokens = tfel::utilities::tokenize(line, '\t', true);
+      if (tokens.at(0) == "library") {
+        throw_if(tokens.size() != 4, "invalid line '" + line + "'");
+        auto e = LibraryIndexEntry{};
+        std::istringstream is(tokens[2] + ' ' + tokens[3]);
+        is >> e.size >> e.modification_time;
+        throw_if(!is, "invalid line '" + line + "'");
+        current = libraries.insert_or_assign(tokens[1], std::move(e)).first;
+        continue;
+      }
+      throw_if(tokens.at(0) != "entry_point", "invalid line '" + line + "'");
+      throw_if((tokens.size() != 6) || (current == libraries.end()),
+               "invalid line '" + line + "'");
+      auto ep = EntryPoint{};
+      ep.library = current->first;
+      if (tokens[1] == "material_property") {
+        ep.type = EntryPoint::MATERIALPROPERTY;
+      } else if (tokens[1] == "behaviour") {
+        ep.type = EntryPoint::BEHAVIOUR;
+      } else {
+        throw_if(tokens[1] != "model",
+                 "invalid material knowledge type '" + tokens[1] + "'");
+        ep.type = EntryPoint::MODEL;
+      }
+      ep.name = tokens[2];
+      ep.source = tokens[3];
+      ep.material = tokens[4];
+      ep.interface = tokens[5];
+      current->second.entry_points.push_back(std::move(ep));
+    }
+    for (auto& [l, e] : libraries) {
+      this->index.insert_or_assign(l, std::move(e));
+    }
+  }  // end of loadIndex
+
+  void MFrontDatabase::saveIndex(const std::string& f) const {
+    auto is_valid = [](const std::string& s) {
+      return s.find_first_of("\t\n\r") == std::string::npos;
+    };
+    // the index is first written in a temporary file so that an
+    // interrupted run does not corrupt the index
+    const auto tmp = f + ".tmp";
+    {
+      std::ofstream out(tmp);
+      tfel::raise_if(!out, "MFrontDatabase::saveIndex: can't open file '" +
+                               tmp + "'");
+      out << index_file_header << '\n';
+      for (const auto& [l, e] : this->index) {
+        if (this->analysed_libraries.count(l) == 0) {
+          // this library was only described in an index previously loaded
+          continue;
+        }
+        const auto valid =
+            is_valid(l) && std::all_of(e.entry_points.begin(),
+                                       e.entry_points.end(),
+                                       [&is_valid](const EntryPoint& ep) {
+                                         return is_valid(ep.name) &&
+                                                is_valid(ep.source) &&
+                                                is_valid(ep.material) &&
+                                                is_valid(ep.interface);
+                                       });
+        if (!valid) {
+          // such libraries are analysed at each run
+          continue;
+        }
+        out << "library\t" << l << '\t' << e.size << '\t'
+            << e.modification_time << '\n';
+        for (const auto& ep : e.entry_points) {
+          out << "entry_point\t";
+          if (ep.type == EntryPoint::MATERIALPROPERTY) {
+            out << "material_property";
+          } else if (ep.type == EntryPoint::BEHAVIOUR) {
+            out << "behaviour";
+          } else {
+            out << "model";
+          }
+          out << '\t' << ep.name << '\t' << ep.source << '\t' << ep.material
+              << '\t' << ep.interface << '\n';
+        }
+      }
+      tfel::raise_if(!out, "MFrontDatabase::saveIndex: error while writing '" +
+                               tmp + "'");
+    }
+    auto ec = std::error_code{};
+    std::filesystem::rename(tmp, f, ec);
+    tfel::raise_if(static_cast<bool>(ec),
+                   "MFrontDatabase::saveIndex: can't rename file '" + tmp +
+                       "' to '" + f + "' (" + ec.message() + ")");
+  }  // end of saveIndex
+
+  void MFrontDatabase::clear() {
+    this->epts.clear();
+    this->names.clear();
+    this->materials.clear();
+    this->interfaces.clear();
+    this->analysed_libraries.clear();
+  }  // end of clear
 
   std::vector<MFrontDatabase::EntryPoint> MFrontDatabase::getEntryPoints(
       const Query& q) const {
     using Filter = std::function<bool(const EntryPoint&)>;
-    auto& elm =
-        tfel::system::ExternalLibraryManager::getExternalLibraryManager();
+    using Index = std::unordered_map<std::string, std::vector<std::size_t>>;
+    static const auto no_candidates = std::vector<std::size_t>{};
+    // positions of the entry points which may match the query. If null,
+    // all the entry points are considered
+    const std::vector<std::size_t>* candidates = nullptr;
     auto filters = std::vector<Filter>{};
+    auto add_filter = [&q, &filters, &candidates](
+                          const Index& idx,
+                          const std::optional<std::string>& f,
+                          std::string EntryPoint::*m) {
+      if (!f.has_value()) {
+        return;
+      }
+      if (isLiteralFilter(*f)) {
+        // hashed lookup
+        const auto p = idx.find(toLowerCase(*f));
+        const auto& c = (p == idx.end()) ? no_candidates : p->second;
+        if ((candidates == nullptr) || (c.size() < candidates->size())) {
+          candidates = &c;
+        }
+        filters.push_back([v = toLowerCase(*f), m](const EntryPoint& e) {
+          return toLowerCase(e.*m) == v;
+        });
+        return;
+      }
+      auto expr = std::regex{
+          *f, q.regular_expression_syntax | std::regex_constants::icase};
+      filters.push_back([r = std::move(expr), m](const EntryPoint& e) {
+        return std::regex_match(e.*m, r);
+      });
+    };
+    add_filter(this->interfaces, q.interface_filter, &EntryPoint::interface);
+    add_filter(this->materials, q.material_filter, &EntryPoint::material);
+    add_filter(this->names, q.name_filter, &EntryPoint::name);
     if (q.type.has_value()) {
       filters.push_back([t = *(q.type)](const EntryPoint& e) noexcept {
         return t == e.type;
       });
     }
-    if (q.interface_filter.has_value()) {
-      auto expr =
-          std::regex{*(q.interface_filter),
-                     q.regular_expression_syntax | std::regex_constants::icase};
-      filters.push_back([&elm, r = expr](const EntryPoint& e) noexcept {
-        return std::regex_match(elm.getInterface(e.library, e.name), r);
-      });
-    }
-    if (q.material_filter.has_value()) {
-      auto expr =
-          std::regex{*(q.material_filter),
-                     q.regular_expression_syntax | std::regex_constants::icase};
-      filters.push_back([&elm, r = expr](const EntryPoint& e) noexcept {
-        return std::regex_match(elm.getMaterial(e.library, e.name), r);
-      });
-    }
-    if (q.name_filter.has_value()) {
-      auto expr = std::regex{*(q.name_filter), q.regular_expression_syntax |
-                                                   std::regex_constants::icase};
-      filters.push_back([r = expr](const EntryPoint& e) noexcept {
-        return std::regex_match(e.name, r);
-      });
-    }
     // applying filters
-    auto r = this->epts;
-    for (const auto& f : filters) {
-      auto p = std::remove_if(r.begin(), r.end(),
-                              [&f](const EntryPoint& e) { return !f(e); });
-      r.erase(p, r.end());
+    auto r = std::vector<EntryPoint>{};
+    auto select = [&filters, &r](const EntryPoint& e) {
+      for (const auto& f : filters) {
+        if (!f(e)) {
+          return;
+        }
+      }
+      r.push_back(e);
+    };
+    if (candidates == nullptr) {
+      for (const auto& e : this->epts) {
+        select(e);
+      }
+    } else {
+      for (const auto i : *candidates) {
+        select(this->epts[i]);
+      }
     }
     return r;
   }  // end of getEntryPoints
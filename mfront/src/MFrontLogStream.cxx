@@ -12,6 +12,7 @@
  */
 
 #include <memory>
+#include <utility>
 #include <fstream>
 #include <iostream>
 #include <stdexcept>
@@ -38,7 +39,7 @@ namespace mfront {
     if (this->ps != nullptr) {
       this->ps->close();
     }
-    this->ps = std::make_shared<std::ofstream>();
+    this->ps.reset();
     this->s = &os;
   }  // end of
 
@@ -97,11 +98,25 @@ namespace mfront {
     }
   }  // end of setVerboseMode
 
+  //! \return the logging stream of the calling thread, if any
+  static std::ostream*& getThreadLogStream() {
+    thread_local std::ostream* os = nullptr;
+    return os;
+  }  // end of getThreadLogStream
+
   std::ostream& getLogStream() {
+    auto* const os = getThreadLogStream();
+    if (os != nullptr) {
+      return *os;
+    }
     auto& log = LogStream::getLogStream();
     return log.getStream();
   }  // end of function getLogStream
 
+  std::ostream* setThreadLogStream(std::ostream* const os) {
+    return std::exchange(getThreadLogStream(), os);
+  }  // end of function setThreadLogStream
+
   void setLogStream(const std::string& f) {
     auto& log = LogStream::getLogStream();
     log.setLogStream(f);
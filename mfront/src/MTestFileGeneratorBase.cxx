@@ -11,6 +11,7 @@
  * project under specific licensing conditions.
  */
 
+#include <atomic>
 #include <fstream>
 #include <iterator>
 #include <stdexcept>
@@ -40,7 +41,7 @@ namespace mfront {
       default;
 
   unsigned int MTestFileGeneratorBase::getIdentifier() {
-    static unsigned int i = 0;
+    static std::atomic<unsigned int> i{0};
     return ++i;
   }
 
@@ -13,7 +13,10 @@
 
 #include <set>
 #include <array>
+#include <cstdio>
 #include <cstring>
+#include <filesystem>
+#include <system_error>
 #include <ostream>
 #include <sstream>
 #include <fstream>
@@ -53,6 +56,7 @@
 #include "MFront/MFrontDebugMode.hxx"
 #include "MFront/TargetsDescription.hxx"
 #include "MFront/GeneratorOptions.hxx"
+#include "MFront/PrecompiledHeaders.hxx"
 #include "MFront/MakefileGenerator.hxx"
 
 namespace mfront {
@@ -75,6 +79,131 @@ namespace mfront {
 #endif
   }
 
+  /*!
+   * \return the compiler associated with a language, as defined by an
+   * environment variable or by the configuration manager.
+   * \param[in] env: environment variable
+   * \param[in] l: language
+   */
+  static std::optional<std::string> get_compiler(
+      const char* const env, const ConfigurationManager::Language l) {
+    const auto* const compiler = std::getenv(env);
+    if (compiler != nullptr) {
+      return compiler;
+    }
+    const auto ocompiler = ConfigurationManager::get().getCompiler(l);
+    if (ocompiler.has_value()) {
+      return *ocompiler;
+    }
+    return {};
+  }  // end of get_compiler
+
+  /*!
+   * \return the compilation flags associated with a language, as defined
+   * by an environment variable or by the configuration manager.
+   * \param[in] env: environment variable
+   * \param[in] l: language
+   * \param[in] c: category of the options
+   */
+  static std::set<std::string> get_compilation_flags(
+      const char* const env,
+      const ConfigurationManager::Language l,
+      const ConfigurationManager::LanguageOptionCategory c) {
+    const auto* const opts = std::getenv(env);
+    if (opts != nullptr) {
+      return std::set<std::string>{{std::string{opts}}};
+    }
+    const auto opts2 = ConfigurationManager::get().getCompilationOptions(l, c);
+    if (opts2.has_value()) {
+      return *opts2;
+    }
+    return {};
+  }  // end of get_compilation_flags
+
+  /*!
+   * \return the linker flags, as defined by an environment variable or by
+   * the configuration manager.
+   * \param[in] env: environment variable
+   * \param[in] c: category of the options
+   */
+  static std::set<std::string> get_linker_flags(
+      const char* const env,
+      const ConfigurationManager::LinkerOptionCategory c) {
+    const auto* const opts = std::getenv(env);
+    if (opts != nullptr) {
+      return std::set<std::string>{{std::string{opts}}};
+    }
+    const auto opts2 = ConfigurationManager::get().getLinkerOptions(c);
+    if (opts2.has_value()) {
+      return *opts2;
+    }
+    return {};
+  }  // end of get_linker_flags
+
+  /*!
+   * \return the absolute path to the executable called by the given
+   * command, or an empty string if the executable is not found.
+   * \param[in] c: command
+   */
+  static std::string getCommandExecutable(const std::string& c) {
+    namespace fs = std::filesystem;
+    const auto words = tfel::utilities::tokenize(c, ' ');
+    if (words.empty()) {
+      return "";
+    }
+    const auto& e = words[0];
+    auto ec = std::error_code{};
+    if (e.find_first_of("/\\") != std::string::npos) {
+      const auto p = fs::weakly_canonical(e, ec);
+      return ((!ec) && (fs::is_regular_file(p, ec))) ? p.string() : "";
+    }
+    const auto* const path = std::getenv("PATH");
+    if (path == nullptr) {
+      return "";
+    }
+#if (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__)
+    const auto separator = ';';
+#else
+    const auto separator = ':';
+#endif
+    for (const auto& d : tfel::utilities::tokenize(path, separator)) {
+      const auto f = fs::path{d} / e;
+      if (fs::is_regular_file(f, ec)) {
+        const auto p = fs::weakly_canonical(f, ec);
+        return ec ? f.string() : p.string();
+      }
+    }
+    return "";
+  }  // end of getCommandExecutable
+
+  /*!
+   * \return the standard output of the given command, or an empty string
+   * if the command could not be run.
+   * \param[in] c: command
+   */
+  static std::string getCommandOutput(const std::string& c) {
+#if (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__)
+    auto* const f = ::_popen(c.c_str(), "r");
+#else
+    auto* const f = ::popen((c + " 2>/dev/null").c_str(), "r");
+#endif
+    if (f == nullptr) {
+      return "";
+    }
+    auto r = std::string{};
+    auto buffer = std::array<char, 256>{};
+    while (std::fgets(buffer.data(), static_cast<int>(buffer.size()), f) !=
+           nullptr) {
+      r += buffer.data();
+    }
+#if (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__)
+    ::_pclose(f);
+#else
+    ::pclose(f);
+#endif
+    return r;
+  }  // end of getCommandOutput
+
   static std::string getLibraryLinkFlags(const TargetsDescription& t,
                                          const GeneratorOptions& o,
                                          const std::string& name) {
@@ -121,11 +250,90 @@ namespace mfront {
     return res;
   }  // end of getLibraryLinkFlags(const std::string&)
 
-  // res.first.first : true if the target has C++ source files
-  // res.first.second: true if the target has CUDA source files
-  // res.first.second: true if the target has CUDA source files
+  static bool isCxxSource(const std::string& s) {
+    return (s.ends_with(".cpp")) || (s.ends_with(".cxx"));
+  }  // end of isCxxSource
+
+  static std::string getUnityBuildSourceName(const LibraryDescription& l) {
+    return l.name + "-unity.cxx";
+  }  // end of getUnityBuildSourceName
+
+  /*!
+   * \return the sources of a library, including the sources of its
+   * dependencies if the `melt` option is used.
+   * \param[in] t: targets description
+   * \param[in] o: generator options
+   * \param[in] name: library name
+   */
+  static std::vector<std::string> getLibrarySources(const TargetsDescription& t,
+                                                    const GeneratorOptions& o,
+                                                    const std::string& name) {
+    const auto& l = t.getLibrary(name);
+    auto sources = std::vector<std::string>{};
+    for (const auto& s : l.sources) {
+      insert_if(sources, s);
+    }
+    if (o.melt) {
+      for (const auto& d : l.deps) {
+        for (const auto& s : getLibrarySources(t, o, d)) {
+          insert_if(sources, s);
+        }
+      }
+    }
+    return sources;
+  }  // end of getLibrarySources
+
+  /*!
+   * \return the sources of a library grouped in the unity build source
+   * of this library, or an empty list if the unity build is not used
+   * for this library.
+   * \param[in] t: targets description
+   * \param[in] o: generator options
+   * \param[in] name: library name
+   */
+  static std::vector<std::string> getUnityBuildSources(
+      const TargetsDescription& t,
+      const GeneratorOptions& o,
+      const std::string& name) {
+    if (!o.unityBuild) {
+      return {};
+    }
+    auto sources = std::vector<std::string>{};
+    for (const auto& s : getLibrarySources(t, o, name)) {
+      if (isCxxSource(s)) {
+        sources.push_back(s);
+      }
+    }
+    if (sources.size() < 2) {
+      return {};
+    }
+    return sources;
+  }  // end of getUnityBuildSources
+
+  //! \return the sources compiled to build a library
+  static std::vector<std::string> getCompiledSources(
+      const TargetsDescription& t,
+      const GeneratorOptions& o,
+      const std::string& name) {
+    const auto sources = getLibrarySources(t, o, name);
+    if (getUnityBuildSources(t, o, name).empty()) {
+      return sources;
+    }
+    auto r = std::vector<std::string>{};
+    for (const auto& s : sources) {
+      if (!isCxxSource(s)) {
+        r.push_back(s);
+      }
+    }
+    r.push_back(getUnityBuildSourceName(t.getLibrary(name)));
+    return r;
+  }  // end of getCompiledSources
+
+  // res.first[0] : true if the target has C++ source files
+  // res.first[1] : true if the target has CUDA source files
+  // res.first[2] : true if the target has HIP source files
   // res.second.first : list of object files
-  // res.second.first : list of library dependencies
+  // res.second.second : list of library dependencies
   static std::pair<std::array<bool, 3u>, std::pair<std::string, std::string>>
   getLibrarySourcesAndDependencies(const TargetsDescription& t,
                                    const GeneratorOptions& o,
@@ -133,9 +341,9 @@ namespace mfront {
     const auto& l = t.getLibrary(name);
     auto res =
         std::pair<std::array<bool, 3u>, std::pair<std::string, std::string>>{};
-    res.first = {false, false};
-    for (const auto& s : l.sources) {
-      if ((s.ends_with(".cpp")) || (s.ends_with(".cxx"))) {
+    res.first = {false, false, false};
+    for (const auto& s : getCompiledSources(t, o, name)) {
+      if (isCxxSource(s)) {
         res.first[0] = true;
         res.second.first += s.substr(0, s.size() - 4) + ".o ";
       }
@@ -151,18 +359,7 @@ namespace mfront {
         res.second.first += s.substr(0, s.size() - 4) + ".o ";
       }
     }
-    if (o.melt) {
-      for (const auto& d : l.deps) {
-        const auto rd = getLibrarySourcesAndDependencies(t, o, d);
-        for (std::size_t i = 0; i != res.first.size(); ++i) {
-          res.first[i] = res.first[i] || rd.first[i];
-        }
-        if (!res.second.first.empty()) {
-          res.second.first += " ";
-        }
-        res.second.first += rd.second.first;
-      }
-    } else {
+    if (!o.melt) {
       for (const auto& d : l.deps) {
         res.second.second += " " + d;
       }
@@ -170,6 +367,29 @@ namespace mfront {
     return res;
   }  // end of getLibrarySourcesAndDependencies
 
+  /*!
+   * \brief write a file if its content changed. This preserves the
+   * modification time of the file, and thus avoids useless
+   * compilations.
+   * \param[in] f: file
+   * \param[in] c: content
+   */
+  static void writeFileIfChanged(const std::string& f, const std::string& c) {
+    {
+      std::ifstream in(f);
+      if (in) {
+        std::ostringstream old;
+        old << in.rdbuf();
+        if (old.str() == c) {
+          return;
+        }
+      }
+    }
+    std::ofstream out(f);
+    tfel::raise_if(!out, "writeFileIfChanged: can't open file '" + f + "'");
+    out << c;
+  }  // end of writeFileIfChanged
+
   static std::string getLibraryFullName(const LibraryDescription& l) {
     return l.prefix + l.name + '.' + l.suffix;
   }  // end of getLibraryFullName
@@ -196,48 +416,6 @@ namespace mfront {
     if (getVerboseMode() >= VERBOSE_LEVEL2) {
       getLogStream() << "generating Makefile\n";
     }
-    const auto& cm = ConfigurationManager::get();
-    auto get_compiler = [&cm](const char* const env,
-                              const ConfigurationManager::Language l)
-        -> std::optional<std::string> {
-      const auto* const compiler = std::getenv(env);
-      if (compiler != nullptr) {
-        return compiler;
-      }
-      const auto ocompiler = cm.getCompiler(l);
-      if (ocompiler.has_value()) {
-        return *ocompiler;
-      }
-      return {};
-    };
-    auto get_compilation_flags =
-        [&cm](const char* const env, const ConfigurationManager::Language l,
-              const ConfigurationManager::LanguageOptionCategory c)
-        -> std::set<std::string> {
-      const auto* const opts = std::getenv(env);
-      if (opts != nullptr) {
-        return std::set<std::string>{{std::string{opts}}};
-      }
-      const auto opts2 = cm.getCompilationOptions(l, c);
-      if (opts2.has_value()) {
-        return *opts2;
-      }
-      return {};
-    };
-    auto get_linker_flags =
-        [&cm](const char* const env,
-              const ConfigurationManager::LinkerOptionCategory c)
-        -> std::set<std::string> {
-      const auto* const opts = std::getenv(env);
-      if (opts != nullptr) {
-        return std::set<std::string>{{std::string{opts}}};
-      }
-      const auto opts2 = cm.getLinkerOptions(c);
-      if (opts2.has_value()) {
-        return *opts2;
-      }
-      return {};
-    };
     auto transform_flag = [](const std::string& flag) {
       if ((tfel::utilities::starts_with(flag, "$(shell ")) ||
           (tfel::utilities::ends_with(flag, ")"))) {
@@ -245,6 +423,7 @@ namespace mfront {
       }
       return flag;
     };
+    const auto& cm = ConfigurationManager::get();
     MFrontLockGuard lock;
     const auto c_compiler = get_compiler("CC", ConfigurationManager::C);
     const auto cxx_compiler = get_compiler("CXX", ConfigurationManager::CXX);
@@ -283,8 +462,8 @@ namespace mfront {
     auto cudaSources = std::set<std::string>{};
     auto hipSources = std::set<std::string>{};
     for (const auto& l : t.libraries) {
-      for (const auto& src : l.sources) {
-        if ((src.ends_with(".cpp")) || (src.ends_with(".cxx"))) {
+      for (const auto& src : getCompiledSources(t, o, l.name)) {
+        if (isCxxSource(src)) {
           cppSources.insert(src);
         }
         if (src.ends_with(".c")) {
@@ -303,6 +482,40 @@ namespace mfront {
           "generateMakeFile: can't mix CUDA and HIP "
           "sources in the same library");
     }
+    // unity build sources
+    for (const auto& l : t.libraries) {
+      const auto sources = getUnityBuildSources(t, o, l.name);
+      if (sources.empty()) {
+        continue;
+      }
+      auto c = "// unity build source generated by mfront.\n" +
+               MFrontHeader::getHeader("// ") + "\n";
+      for (const auto& src : sources) {
+        c += "#include \"" + src + "\"\n";
+      }
+      writeFileIfChanged(d + tfel::system::dirStringSeparator() +
+                             getUnityBuildSourceName(l),
+                         c);
+    }
+    // precompiled headers
+    const auto pch = [&t, &o, &d, &cppSources]() -> std::string {
+      if ((!o.precompiledHeaders) || (cppSources.empty())) {
+        return "";
+      }
+      const auto headers = getPrecompiledHeaders(t, d);
+      if (headers.empty()) {
+        return "";
+      }
+      auto c = "// precompiled headers generated by mfront.\n" +
+               MFrontHeader::getHeader("// ") + "\n";
+      for (const auto& h : headers) {
+        c += "#include \"" + h + "\"\n";
+      }
+      writeFileIfChanged(d + tfel::system::dirStringSeparator() +
+                             "mfront-pch.hxx",
+                         c);
+      return "mfront-pch.hxx";
+    }();
     m << "# Makefile generated by mfront.\n"
       << MFrontHeader::getHeader("# ") << "\n";
     m << "export LD_LIBRARY_PATH:=$(PWD):$(LD_LIBRARY_PATH)\n\n";
@@ -655,12 +868,16 @@ namespace mfront {
     }
     m << "\n";
     if ((o.sys == "win32") || (o.sys == "cygwin")) {
-      m << "\t" << sb << "rm -f *.o *.dll *.d *.d.*\n";
+      m << "\t" << sb << "rm -f *.o *.dll *.d *.d.*";
     } else if (o.sys == "apple") {
-      m << "\t" << sb << "rm -f *.o *.bundle *.d *.d*\n";
+      m << "\t" << sb << "rm -f *.o *.bundle *.d *.d*";
     } else {
-      m << "\t" << sb << "rm -f *.o *.so *.d *.d.*\n";
+      m << "\t" << sb << "rm -f *.o *.so *.d *.d.*";
+    }
+    if (!pch.empty()) {
+      m << " " << pch << ".gch";
     }
+    m << '\n';
     if (p5 != t.specific_targets.end()) {
       for (const auto& cmd : p5->second.cmds) {
         m << "\t" << sb << cmd << '\n';
@@ -671,7 +888,16 @@ namespace mfront {
       m << "-include $(makefiles)\n\n";
     }
     // generic rules for objects file generation
-    if (!cppSources.empty()) {
+    if ((!cppSources.empty()) && (!pch.empty())) {
+      m << pch << ".gch:" << pch << "\n";
+      m << "\t" << sb << cxx << " $(CXXFLAGS) -x c++-header $< -o $@\n\n";
+      m << "%.o:%.cxx " << pch << ".gch\n";
+      m << "\t" << sb << cxx << " $(CXXFLAGS) -include " << pch
+        << " $< -o $@ -c\n\n";
+      m << "%.o:%.cpp " << pch << ".gch\n";
+      m << "\t" << sb << cxx << " $(CXXFLAGS) -include " << pch
+        << " $< -o $@ -c\n\n";
+    } else if (!cppSources.empty()) {
       m << "%.o:%.cxx\n";
       m << "\t" << sb << cxx << " $(CXXFLAGS) $< -o $@ -c\n\n";
       m << "%.o:%.cpp\n";
@@ -732,13 +958,83 @@ namespace mfront {
     m.close();
   }
 
+  std::string getMakeFileBuildEnvironment(const GeneratorOptions& o) {
+    auto r = std::string{};
+    auto add_compiler = [&r](const char* const env,
+                             const ConfigurationManager::Language l,
+                             const char* const default_compiler) {
+      const auto c = get_compiler(env, l).value_or(default_compiler);
+      r += std::string{env} + '=' + c + '\n';
+      r += getCommandExecutable(c) + '\n';
+      r += getCommandOutput(c + " --version") + '\n';
+    };
+    auto add_flags = [&r](const char* const n,
+                          const std::set<std::string>& flags) {
+      r += n;
+      r += '=';
+      for (const auto& flag : flags) {
+        r += flag + ' ';
+      }
+      r += '\n';
+    };
+    add_compiler("CC", ConfigurationManager::C, "cc");
+    add_compiler("CXX", ConfigurationManager::CXX, "g++");
+    add_flags("CXXFLAGS",
+              get_compilation_flags("CXXFLAGS", ConfigurationManager::CXX,
+                                    ConfigurationManager::COMPILATION_FLAGS));
+    add_flags("CFLAGS",
+              get_compilation_flags("CFLAGS", ConfigurationManager::C,
+                                    ConfigurationManager::COMPILATION_FLAGS));
+    add_flags("LDFLAGS",
+              get_linker_flags("LDFLAGS", ConfigurationManager::LINKER_FLAGS));
+    for (const auto& v : {"INCLUDES", "CPPFLAGS"}) {
+      const auto* const e = ::getenv(v);
+      r += std::string{v} + '=' + (e != nullptr ? e : "") + '\n';
+    }
+    for (const auto& p : ConfigurationManager::get().getIncludePaths()) {
+      r += "-I" + p + '\n';
+    }
+    // flags given by tfel-config, as used in the generated Makefile
+    const auto tfel_config = tfel::getTFELConfigExecutableName();
+    switch (o.olevel) {
+      case GeneratorOptions::LEVEL2:
+        r += getCommandOutput(tfel_config + " --oflags --oflags2");
+        break;
+      case GeneratorOptions::LEVEL1:
+        r += getCommandOutput(tfel_config + " --oflags");
+        break;
+      case GeneratorOptions::LEVEL0:
+        r += getCommandOutput(tfel_config + " --oflags0");
+        break;
+    }
+    if (o.debugFlags) {
+      r += getCommandOutput(tfel_config + " --debug-flags");
+    }
+    return r;
+  }  // end of getMakeFileBuildEnvironment
+
   void callMake(const std::string& t,
                 const std::string& d,
                 const std::string& f) {
+    callMake(t, GeneratorOptions{}, d, f);
+  }  // end of callMake
+
+  void callMake(const std::string& t,
+                const GeneratorOptions& o,
+                const std::string& d,
+                const std::string& f) {
     const char* make = getMakeCommand();
-    const char* silent = getDebugMode() ? nullptr : "-s";
-    const char* const argv[] = {make,      "-C",      d.c_str(), "-f",
-                                f.c_str(), t.c_str(), silent,    nullptr};
+    const auto jobs = "-j" + std::to_string(o.jobs);
+    auto args = std::vector<const char*>{make,      "-C",      d.c_str(),
+                                         "-f",      f.c_str(), t.c_str()};
+    if (o.jobs > 1) {
+      args.push_back(jobs.c_str());
+    }
+    if (!getDebugMode()) {
+      args.push_back("-s");
+    }
+    args.push_back(nullptr);
+    const char* const* const argv = args.data();
     auto error = [&argv, &t](const std::string& e) {
       auto msg = "callMake: can't build target '" + t + "'\n";
       if (!e.empty()) {
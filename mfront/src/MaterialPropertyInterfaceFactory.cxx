@@ -12,6 +12,7 @@
  * project under specific licensing conditions.
  */
 
+#include <mutex>
 #include <cassert>
 #include <iterator>
 #include <stdexcept>
@@ -51,6 +52,7 @@ namespace mfront {
 
   std::vector<std::string>
   MaterialPropertyInterfaceFactory::getRegistredInterfaces() const {
+    auto lock = std::lock_guard<std::recursive_mutex>{this->m};
     auto res = std::vector<std::string>{};
     for (const auto& a : this->getAliasesMap()) {
       res.push_back(a.first);
@@ -61,6 +63,7 @@ namespace mfront {
   void MaterialPropertyInterfaceFactory::registerInterfaceCreator(
       const std::string& i,
       const MaterialPropertyInterfaceFactory::InterfaceCreator f) {
+    auto lock = std::lock_guard<std::recursive_mutex>{this->m};
     auto& imap = this->getInterfaceCreatorsMap();
     tfel::raise_if(
         imap.find(i) != imap.end(),
@@ -72,6 +75,7 @@ namespace mfront {
 
   void MaterialPropertyInterfaceFactory::registerInterfaceAlias(
       const std::string& i, const std::string& a) {
+    auto lock = std::lock_guard<std::recursive_mutex>{this->m};
     auto& amap = this->getAliasesMap();
     tfel::raise_if(
         amap.find(a) != amap.end(),
@@ -83,6 +87,7 @@ namespace mfront {
 
   std::string MaterialPropertyInterfaceFactory::getUniqueNameFromAlias(
       const std::string& n) const {
+    auto lock = std::lock_guard<std::recursive_mutex>{this->m};
     auto p = this->getAliasesMap().find(n);
     if (p == this->getAliasesMap().end()) {
       auto msg = std::string(
@@ -100,12 +105,14 @@ namespace mfront {
 
   void MaterialPropertyInterfaceFactory::registerInterfaceDependency(
       const std::string& name, const std::string& dep) {
+    auto lock = std::lock_guard<std::recursive_mutex>{this->m};
     this->getDependenciesMap()[name].push_back(dep);
   }  // end of MaterialPropertyInterfaceFactory::registerInterfaceDependency
 
   std::vector<std::string>
   MaterialPropertyInterfaceFactory::getInterfaceDependencies(
       const std::string& name) const {
+    auto lock = std::lock_guard<std::recursive_mutex>{this->m};
     std::vector<std::string> res;
     const auto id = this->getUniqueNameFromAlias(name);
     const auto& deps = this->getDependenciesMap()[id];
@@ -120,16 +127,21 @@ namespace mfront {
   }  // end of MaterialPropertyInterfaceFactory::getInterfaceDependencies
 
   bool MaterialPropertyInterfaceFactory::exists(const std::string& n) const {
+    auto lock = std::lock_guard<std::recursive_mutex>{this->m};
     return this->getAliasesMap().count(n) != 0;
   }  // end of MaterialPropertyInterfaceFactory::exists
 
   std::shared_ptr<AbstractMaterialPropertyInterface>
   MaterialPropertyInterfaceFactory::getInterface(
       const std::string& interfaceName) const {
-    const auto id = this->getUniqueNameFromAlias(interfaceName);
-    auto p = this->getInterfaceCreatorsMap().find(id);
-    assert(p != this->getInterfaceCreatorsMap().end());
-    auto c = p->second;
+    // the interface is created outside the lock
+    const auto c = [this, &interfaceName] {
+      auto lock = std::lock_guard<std::recursive_mutex>{this->m};
+      const auto id = this->getUniqueNameFromAlias(interfaceName);
+      const auto p = this->getInterfaceCreatorsMap().find(id);
+      assert(p != this->getInterfaceCreatorsMap().end());
+      return p->second;
+    }();
     return c();
   }
 
@@ -12,6 +12,7 @@
  * project under specific licensing conditions.
  */
 
+#include <mutex>
 #include <cassert>
 #include <stdexcept>
 #include "TFEL/Raise.hxx"
@@ -47,6 +48,7 @@ namespace mfront {
 
   std::vector<std::string> ModelInterfaceFactory::getRegistredInterfaces()
       const {
+    auto lock = std::lock_guard<std::recursive_mutex>{this->m};
     auto res = std::vector<std::string>{};
     for (const auto& a : this->getAliasesMap()) {
       res.push_back(a.first);
@@ -56,6 +58,7 @@ namespace mfront {
 
   void ModelInterfaceFactory::registerInterfaceCreator(
       const std::string& i, const ModelInterfaceFactory::InterfaceCreator f) {
+    auto lock = std::lock_guard<std::recursive_mutex>{this->m};
     auto& imap = this->getInterfaceCreatorsMap();
     tfel::raise_if(imap.find(i) != imap.end(),
                    "ModelInterfaceFactory::registerInterfaceCreator: "
@@ -66,6 +69,7 @@ namespace mfront {
 
   void ModelInterfaceFactory::registerInterfaceAlias(const std::string& i,
                                                      const std::string& a) {
+    auto lock = std::lock_guard<std::recursive_mutex>{this->m};
     auto& amap = this->getAliasesMap();
     tfel::raise_if(amap.find(a) != amap.end(),
                    "ModelInterfaceFactory::registerInterfaceCreator: "
@@ -76,11 +80,13 @@ namespace mfront {
 
   void ModelInterfaceFactory::registerInterfaceDependency(
       const std::string& name, const std::string& dep) {
+    auto lock = std::lock_guard<std::recursive_mutex>{this->m};
     this->getDependenciesMap()[name].push_back(dep);
   }  // end of ModelInterfaceFactory::registerInterfaceDependency
 
   std::string ModelInterfaceFactory::getUniqueNameFromAlias(
       const std::string& n) const {
+    auto lock = std::lock_guard<std::recursive_mutex>{this->m};
     auto p = this->getAliasesMap().find(n);
     if (p == this->getAliasesMap().end()) {
       auto msg = std::string("ModelFactory::getUniqueNameFromAlias: ");
@@ -97,6 +103,7 @@ namespace mfront {
 
   std::vector<std::string> ModelInterfaceFactory::getInterfaceDependencies(
       const std::string& name) const {
+    auto lock = std::lock_guard<std::recursive_mutex>{this->m};
     std::vector<std::string> res;
     const auto id = this->getUniqueNameFromAlias(name);
     const auto& deps = this->getDependenciesMap()[id];
@@ -111,15 +118,20 @@ namespace mfront {
   }  // end of ModelInterfaceFactory::getInterfaceDependencies
 
   bool ModelInterfaceFactory::exists(const std::string& n) const {
+    auto lock = std::lock_guard<std::recursive_mutex>{this->m};
     return this->getAliasesMap().count(n) != 0;
   }  // end of ModelInterfaceFactory::exists
 
   std::shared_ptr<AbstractModelInterface> ModelInterfaceFactory::getInterface(
       const std::string& interfaceName) const {
-    const auto id = this->getUniqueNameFromAlias(interfaceName);
-    const auto p = this->getInterfaceCreatorsMap().find(id);
-    assert(p != this->getInterfaceCreatorsMap().end());
-    auto c = p->second;
+    // the interface is created outside the lock
+    const auto c = [this, &interfaceName] {
+      auto lock = std::lock_guard<std::recursive_mutex>{this->m};
+      const auto id = this->getUniqueNameFromAlias(interfaceName);
+      const auto p = this->getInterfaceCreatorsMap().find(id);
+      assert(p != this->getInterfaceCreatorsMap().end());
+      return p->second;
+    }();
     return c();
   }
 
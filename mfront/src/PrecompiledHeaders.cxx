@@ -0,0 +1,114 @@
+/*!
+ * \file   mfront/src/PrecompiledHeaders.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright Copyright (C) 2006-2025 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <map>
+#include <set>
+#include <fstream>
+#include <algorithm>
+#include <filesystem>
+#include "TFEL/Config/TFELConfig.hxx"
+#include "TFEL/System/System.hxx"
+#include "MFront/TargetsDescription.hxx"
+#include "MFront/PrecompiledHeaders.hxx"
+
+namespace mfront {
+
+  //! \brief headers included by a source file
+  struct TFEL_VISIBILITY_LOCAL IncludedHeaders {
+    //! \brief generated headers already treated
+    std::set<std::string> local;
+    //! \brief `TFEL` headers, in the order of inclusion
+    std::vector<std::string> tfel_headers;
+  };
+
+  /*!
+   * \brief scan the quoted `#include` directives of a file. Generated
+   * headers, i.e. the headers found in the sources directory or in the
+   * `include` directory, are treated recursively.
+   * \param[in,out] h: included headers
+   * \param[in] d: directory containing the sources
+   * \param[in] f: file
+   */
+  static void scanIncludes(IncludedHeaders& h,
+                           const std::string& d,
+                           const std::string& f) {
+    const auto sep = tfel::system::dirStringSeparator();
+    std::ifstream file(f);
+    auto line = std::string{};
+    while (std::getline(file, line)) {
+      const auto pos = line.find_first_not_of(" \t");
+      if ((pos == std::string::npos) || (line[pos] != '#')) {
+        continue;
+      }
+      const auto pos2 = line.find_first_not_of(" \t", pos + 1);
+      if ((pos2 == std::string::npos) ||
+          (line.compare(pos2, 7, "include") != 0)) {
+        continue;
+      }
+      const auto b = line.find('"', pos2 + 7);
+      const auto e = (b == std::string::npos) ? b : line.find('"', b + 1);
+      if (e == std::string::npos) {
+        continue;
+      }
+      const auto header = line.substr(b + 1, e - b - 1);
+      auto local = false;
+      for (const auto& p : {d + sep + header,
+                            d + sep + ".." + sep + "include" + sep + header}) {
+        if (std::filesystem::is_regular_file(p)) {
+          local = true;
+          if (h.local.insert(p).second) {
+            scanIncludes(h, d, p);
+          }
+          break;
+        }
+      }
+      if ((!local) && (header.starts_with("TFEL/")) &&
+          (std::find(h.tfel_headers.begin(), h.tfel_headers.end(),
+                     header) == h.tfel_headers.end())) {
+        h.tfel_headers.push_back(header);
+      }
+    }
+  }  // end of scanIncludes
+
+  std::vector<std::string> getPrecompiledHeaders(const TargetsDescription& t,
+                                                 const std::string& d) {
+    const auto sep = tfel::system::dirStringSeparator();
+    auto sources = std::set<std::string>{};
+    for (const auto& l : t.libraries) {
+      for (const auto& s : l.sources) {
+        if ((s.ends_with(".cxx")) || (s.ends_with(".cpp"))) {
+          sources.insert(s);
+        }
+      }
+    }
+    auto counts = std::map<std::string, std::size_t>{};
+    auto headers = std::vector<std::string>{};
+    for (const auto& s : sources) {
+      auto h = IncludedHeaders{};
+      scanIncludes(h, d, d + sep + s);
+      for (const auto& header : h.tfel_headers) {
+        if (counts[header]++ == 0) {
+          headers.push_back(header);
+        }
+      }
+    }
+    auto r = std::vector<std::string>{};
+    for (const auto& header : headers) {
+      if (counts[header] > 1) {
+        r.push_back(header);
+      }
+    }
+    return r;
+  }  // end of getPrecompiledHeaders
+
+}  // end of namespace mfront
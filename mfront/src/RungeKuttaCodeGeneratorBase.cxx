@@ -11,7 +11,10 @@
  * project under specific licensing conditions.
  */
 
+#include <map>
 #include <ostream>
+#include <utility>
+#include <functional>
 #include <string_view>
 #include "TFEL/Glossary/Glossary.hxx"
 #include "TFEL/Glossary/GlossaryEntry.hxx"
@@ -254,6 +257,203 @@ namespace mfront {
        << "NumericType{" << n << "}/NumericType{" << d << "};\n";
   }  // end of writeAlgorithmConstant
 
+  /*!
+   * \brief write the evaluation of the error of an embedded scheme
+   * \param[in] os: output stream
+   * \param[in] bd: behaviour description
+   * \param[in] d: behaviour data
+   * \param[in] e: function returning the estimate of the error on a state
+   * variable. The second argument is the index of the component of an array
+   * of state variables or is empty.
+   */
+  static void writeEmbeddedErrorEvaluation(
+      std::ostream& os,
+      const BehaviourDescription& bd,
+      const BehaviourData& d,
+      const std::function<std::string(const VariableDescription&,
+                                      const std::string&)>& e) {
+    const auto svsize = d.getStateVariables().getTypeSize();
+    const auto use_maximum = svsize.getValueForDimension(1) >= 20;
+    auto get_error = [&e](const VariableDescription& v,
+                          const std::string& idx) {
+      auto r = "tfel::math::abs(" + e(v, idx) + ")";
+      if (v.hasAttribute(VariableDescription::errorNormalisationFactor)) {
+        r = "(" + r + ")/(" +
+            v.getAttribute<std::string>(
+                VariableDescription::errorNormalisationFactor) +
+            ")";
+      }
+      return "tfel::math::base_type_cast(" + r + ")";
+    };
+    os << "error = NumericType(0);\n";
+    if (use_maximum) {
+      os << "auto rk_update_error = [&error](const NumericType rk_error){\n"
+         << "if(!ieee754::isfinite(error)){return;}\n"
+         << "if(!ieee754::isfinite(rk_error)){\n"
+         << "error = rk_error;\n"
+         << "return;\n"
+         << "}\n"
+         << "error = std::max(error, rk_error);\n"
+         << "};\n";
+    } else {
+      os << "auto rk_update_error = [&error](const NumericType rk_error){\n"
+         << "error += rk_error;\n"
+         << "};\n";
+    }
+    for (const auto& v : d.getStateVariables()) {
+      if (v.arraySize == 1u) {
+        os << "rk_update_error(" << get_error(v, "") << ");\n";
+      } else if (bd.useDynamicallyAllocatedVector(v.arraySize)) {
+        os << "for(unsigned short idx=0;idx!=" << v.arraySize << ";++idx){\n"
+           << "rk_update_error(" << get_error(v, "idx") << ");\n"
+           << "}\n";
+      } else {
+        for (unsigned short i = 0; i != v.arraySize; ++i) {
+          os << "rk_update_error(" << get_error(v, std::to_string(i))
+             << ");\n";
+        }
+      }
+    }
+    if (!use_maximum) {
+      os << "error/=" << svsize << ";\n";
+    }
+  }  // end of writeEmbeddedErrorEvaluation
+
+  /*!
+   * \brief write the update of the time step by a PI controller
+   * \param[in] os: output stream
+   * \param[in] bd: behaviour description
+   * \param[in] k: order of the error estimate plus one
+   */
+  static void writePIStepSizeController(std::ostream& os,
+                                        const BehaviourDescription& bd,
+                                        const unsigned short k) {
+    const auto ks = std::to_string(k);
+    os << "// PI controller of the time step\n"
+       << "real corrector;\n"
+       << "if(error < 100*std::numeric_limits<real>::min()){\n"
+       << "corrector=real(10);\n"
+       << "} else if(error<this->epsilon){\n"
+       << "corrector = real(0.9)*pow(this->epsilon/error,real(0.7)/" << ks
+       << ")*pow(rk_previous_error/this->epsilon,real(0.4)/" << ks << ");\n"
+       << "} else {\n"
+       << "corrector = real(0.9)*pow(this->epsilon/error,real(1)/" << ks
+       << ");\n"
+       << "}\n"
+       << "if(error<this->epsilon){\n"
+       << "rk_previous_error = std::max<NumericType>(error, 1.e-4*(this->epsilon));\n"
+       << "}\n"
+       << "if(corrector<real(0.1f)){\n";
+    if (getDebugMode()) {
+      os << "cout << \"" << bd.getClassName()
+         << "::integrate() : reducing time step by a factor 10\" << endl;\n";
+    }
+    os << "dt_ *= real(0.1f);\n"
+       << "} else if(corrector>real(10)){\n";
+    if (getDebugMode()) {
+      os << "cout << \"" << bd.getClassName()
+         << "::integrate() : increasing time step by a factor 10\" << endl;\n";
+    }
+    os << "dt_ *= real(10);\n"
+       << "} else {\n";
+    if (getDebugMode()) {
+      os << "cout << \"" << bd.getClassName()
+         << "::integrate() : multiplying the time step by \" << corrector "
+            "<< endl;\n";
+    }
+    os << "dt_ *= corrector;\n"
+       << "}\n"
+       << "if(dt_<dtprec){\n"
+       << "throw(tfel::material::DivergenceException());\n"
+       << "}\n"
+       << "if((tfel::math::abs(this->dt-t-dt_)<2*dtprec)||(t+dt_>this->dt)){\n"
+       << "dt_=this->dt-t;\n"
+       << "}\n";
+  }  // end of writePIStepSizeController
+
+  /*!
+   * \brief multiply the given variables associated with the state variables
+   * by a scalar
+   * \param[in] os: output stream
+   * \param[in] bd: behaviour description
+   * \param[in] d: behaviour data
+   * \param[in] s: suffix of the variables
+   * \param[in] f: factor
+   */
+  static void writeStateVariablesScaling(std::ostream& os,
+                                         const BehaviourDescription& bd,
+                                         const BehaviourData& d,
+                                         const std::string& s,
+                                         const std::string& f) {
+    for (const auto& v : d.getStateVariables()) {
+      if ((v.arraySize == 1u) ||
+          (bd.useDynamicallyAllocatedVector(v.arraySize))) {
+        os << "this->d" << v.name << s << " *= " << f << ";\n";
+      } else {
+        os << "for(unsigned short idx=0;idx!=" << v.arraySize << ";++idx){\n"
+           << "this->d" << v.name << s << "[idx] *= " << f << ";\n"
+           << "}\n";
+      }
+    }
+  }  // end of writeStateVariablesScaling
+
+  /*!
+   * \brief copy the scalar components of the state variables (or of
+   * variables associated with the state variables) in a vector or
+   * conversely
+   * \param[in] os: output stream
+   * \param[in] d: behaviour data
+   * \param[in] y: name of the vector
+   * \param[in] n: function returning the name of the variable associated
+   * with a state variable
+   * \param[in] b: if true, the variables are copied in the vector
+   */
+  static void writeStateVariablesCopy(
+      std::ostream& os,
+      const BehaviourData& d,
+      const std::string& y,
+      const std::function<std::string(const std::string&)>& n,
+      const bool b) {
+    auto copy = [&os, &y, b](const std::string& c, const std::string& i) {
+      if (b) {
+        os << y << "(" << i << ") = tfel::math::base_type_cast(" << c
+           << ");\n";
+      } else {
+        os << "rk_set(" << c << ", " << y << "(" << i << "));\n";
+      }
+    };
+    auto o = SupportedTypes::TypeSize{};
+    for (const auto& v : d.getStateVariables()) {
+      const auto s = SupportedTypes::getTypeSize(v.type, 1u).asString();
+      const auto o_s = o.asString();
+      if (SupportedTypes::getTypeFlag(v.type) == SupportedTypes::SCALAR) {
+        if (v.arraySize == 1u) {
+          copy(n(v.name), o_s);
+        } else {
+          os << "for(unsigned short idx=0;idx!=" << v.arraySize
+             << ";++idx){\n";
+          copy(n(v.name) + "[idx]", o_s + "+idx");
+          os << "}\n";
+        }
+      } else {
+        if (v.arraySize == 1u) {
+          os << "for(unsigned short idx=0;idx!=" << s << ";++idx){\n";
+          copy(n(v.name) + "[idx]", o_s + "+idx");
+          os << "}\n";
+        } else {
+          os << "for(unsigned short idx=0;idx!=" << v.arraySize
+             << ";++idx){\n"
+             << "for(unsigned short idx2=0;idx2!=" << s << ";++idx2){\n";
+          copy(n(v.name) + "[idx][idx2]",
+               o_s + "+idx*(" + s + ")+idx2");
+          os << "}\n"
+             << "}\n";
+        }
+      }
+      o += SupportedTypes::getTypeSize(v.type, v.arraySize);
+    }
+  }  // end of writeStateVariablesCopy
+
   RungeKuttaCodeGeneratorBase::RungeKuttaCodeGeneratorBase(
       const FileDescription& f,
       const BehaviourDescription& d,
@@ -278,6 +478,14 @@ namespace mfront {
     if (b2) {
       os << "#include\"TFEL/Math/vector.hxx\"\n";
     }
+    if (this->bd.getAttribute<std::string>(BehaviourData::algorithm) ==
+        "Rosenbrock2") {
+      if (!b1) {
+        os << "#include\"TFEL/Math/tvector.hxx\"\n";
+      }
+      os << "#include\"TFEL/Math/tmatrix.hxx\"\n"
+         << "#include\"TFEL/Math/TinyMatrixSolve.hxx\"\n";
+    }
   }
 
   void RungeKuttaCodeGeneratorBase::writeBehaviourLocalVariablesInitialisation(
@@ -2206,6 +2414,486 @@ namespace mfront {
     }
   }  // end of writeBehaviourRK4Integrator
 
+  void RungeKuttaCodeGeneratorBase::writeBehaviourDP54Integrator(
+      std::ostream& os, const Hypothesis h) const {
+    using Coefficients = std::vector<std::pair<std::string, unsigned short>>;
+    const auto& d = this->bd.getBehaviourData(h);
+    const auto uvs = getVariablesUsedDuringIntegration(this->bd, h);
+    const auto updateStiffnessTensor =
+        (this->bd.getAttribute<bool>(
+            BehaviourDescription::computesStiffnessTensor, false)) &&
+        (!this->bd.areElasticMaterialPropertiesConstantDuringTheTimeStep());
+    const auto shallUpdateInternalStateValues = [&d, &uvs] {
+      for (const auto& v : d.getStateVariables()) {
+        if (uvs.find(v.name) != uvs.end()) {
+          return true;
+        }
+      }
+      return false;
+    }();
+    const auto shallUpdateExternalStateValues = [this, &d, &uvs] {
+      for (const auto& mv : this->bd.getMainVariables()) {
+        if (uvs.find(mv.first.name) != uvs.end()) {
+          return true;
+        }
+      }
+      for (const auto& v : d.getAuxiliaryStateVariables()) {
+        if ((v.getAttribute<bool>("ComputedByExternalModel", false)) &&
+            (uvs.find(v.name) != uvs.end())) {
+          return true;
+        }
+      }
+      for (const auto& v : d.getExternalStateVariables()) {
+        if (uvs.find(v.name) != uvs.end()) {
+          return true;
+        }
+      }
+      return false;
+    }();
+    // computation of the i-th stage. The current values of the state
+    // variables are computed from the previous stages using the given
+    // coefficients.
+    auto write_stage = [this, &os, &d, &uvs, h, updateStiffnessTensor](
+                           const unsigned short i, const std::string& p,
+                           const Coefficients& a) {
+      const auto K = "K" + std::to_string(i);
+      os << "if(!failed){\n"
+         << "// Compute " << K << "'s values\n";
+      for (const auto& v : d.getStateVariables()) {
+        if (uvs.find(v.name) == uvs.end()) {
+          continue;
+        }
+        os << "this->" << v.name << "_ = this->" << v.name;
+        for (const auto& [c, j] : a) {
+          os << c << "*(this->d" << v.name << "_K" << j << ")";
+        }
+        os << ";\n";
+      }
+      writeExternalVariablesCurrentValues(os, this->bd, h, p);
+      if (updateStiffnessTensor) {
+        auto m = modifyVariableForStiffnessTensorComputation(
+            this->bd.getClassName());
+        os << "// updating the stiffness tensor\n";
+        this->writeStiffnessTensorComputation(os, "this->D", m);
+      }
+      if (this->bd.hasCode(h, BehaviourData::ComputeThermodynamicForces)) {
+        os << "// update the thermodynamic forces\n"
+           << "failed = !this->computeThermodynamicForces();\n";
+      }
+      if (getDebugMode()) {
+        os << "if(failed){\n"
+           << "cout << \"" << this->bd.getClassName()
+           << "::integrate() : failed while computing " << K
+           << "'s stress\" << endl;\n"
+           << "}\n";
+      }
+      os << "if(!failed){\n"
+         << "failed = !this->computeDerivative();\n";
+      if (getDebugMode()) {
+        os << "if(failed){\n"
+           << "cout << \"" << this->bd.getClassName()
+           << "::integrate() : failed while computing " << K
+           << "'s derivatives\" << endl;\n"
+           << "}\n";
+      }
+      os << "if(!failed){\n";
+      for (const auto& v : d.getStateVariables()) {
+        os << "this->d" << v.name << "_" << K << " = (dt_)*(this->d" << v.name
+           << ");\n";
+      }
+      os << "}\n"
+         << "}\n"
+         << "}\n\n";
+    };
+    // coefficients of the Dormand-Prince scheme
+    if (shallUpdateExternalStateValues) {
+      writeAlgorithmConstant(os, "3", "10");
+      writeAlgorithmConstant(os, "4", "5");
+      writeAlgorithmConstant(os, "8", "9");
+    }
+    if ((shallUpdateExternalStateValues) || (shallUpdateInternalStateValues)) {
+      writeAlgorithmConstant(os, "1", "5");
+    }
+    if (shallUpdateInternalStateValues) {
+      writeAlgorithmConstant(os, "3", "40");
+      writeAlgorithmConstant(os, "9", "40");
+      writeAlgorithmConstant(os, "44", "45");
+      writeAlgorithmConstant(os, "56", "15");
+      writeAlgorithmConstant(os, "32", "9");
+      writeAlgorithmConstant(os, "19372", "6561");
+      writeAlgorithmConstant(os, "25360", "2187");
+      writeAlgorithmConstant(os, "64448", "6561");
+      writeAlgorithmConstant(os, "212", "729");
+      writeAlgorithmConstant(os, "9017", "3168");
+      writeAlgorithmConstant(os, "355", "33");
+      writeAlgorithmConstant(os, "46732", "5247");
+      writeAlgorithmConstant(os, "49", "176");
+      writeAlgorithmConstant(os, "5103", "18656");
+    }
+    writeAlgorithmConstant(os, "35", "384");
+    writeAlgorithmConstant(os, "500", "1113");
+    writeAlgorithmConstant(os, "125", "192");
+    writeAlgorithmConstant(os, "2187", "6784");
+    writeAlgorithmConstant(os, "11", "84");
+    writeAlgorithmConstant(os, "71", "57600");
+    writeAlgorithmConstant(os, "71", "16695");
+    writeAlgorithmConstant(os, "71", "1920");
+    writeAlgorithmConstant(os, "17253", "339200");
+    writeAlgorithmConstant(os, "22", "525");
+    writeAlgorithmConstant(os, "1", "40");
+    const auto b = Coefficients{{"+cste35_384", 1},
+                                {"+cste500_1113", 3},
+                                {"+cste125_192", 4},
+                                {"-cste2187_6784", 5},
+                                {"+cste11_84", 6}};
+    os << "time t      = time(0);\n"
+       << "time dt_    = this->dt;\n"
+       << "time dtprec = 100* (this->dt) * "
+       << "std::numeric_limits<NumericType>::epsilon();\n"
+       << "auto error = NumericType{};\n"
+       << "auto rk_previous_error = NumericType{this->epsilon};\n"
+       << "bool converged = false;\n"
+       << "// true if K1 is known at the beginning of the sub-step\n"
+       << "bool rk_k1 = false;\n";
+    if (getDebugMode()) {
+      os << "cout << endl << \"" << this->bd.getClassName()
+         << "::integrate() : beginning of resolution\" << endl;\n";
+    }
+    os << "while(!converged){\n";
+    if (getDebugMode()) {
+      os << "cout << \"" << this->bd.getClassName()
+         << "::integrate() : from \" << t <<  \" to \" << t+dt_ << \" with "
+            "time step \" << dt_ << endl;\n";
+    }
+    os << "bool failed = false;\n"
+       << "if(!rk_k1){\n";
+    write_stage(1, "0", {});
+    os << "rk_k1 = !failed;\n"
+       << "}\n";
+    write_stage(2, "cste1_5", {{"+cste1_5", 1}});
+    write_stage(3, "cste3_10", {{"+cste3_40", 1}, {"+cste9_40", 2}});
+    write_stage(4, "cste4_5",
+                {{"+cste44_45", 1}, {"-cste56_15", 2}, {"+cste32_9", 3}});
+    write_stage(5, "cste8_9",
+                {{"+cste19372_6561", 1},
+                 {"-cste25360_2187", 2},
+                 {"+cste64448_6561", 3},
+                 {"-cste212_729", 4}});
+    write_stage(6, "1",
+                {{"+cste9017_3168", 1},
+                 {"-cste355_33", 2},
+                 {"+cste46732_5247", 3},
+                 {"+cste49_176", 4},
+                 {"-cste5103_18656", 5}});
+    write_stage(7, "1", b);
+    os << "if(!failed){\n"
+       << "// Computing the error\n";
+    writeEmbeddedErrorEvaluation(
+        os, this->bd, d,
+        [](const VariableDescription& v, const std::string& idx) {
+          auto K = [&v, &idx](const unsigned short i) {
+            const auto c = idx.empty() ? "" : "[" + idx + "]";
+            return "(this->d" + v.name + "_K" + std::to_string(i) + c + ")";
+          };
+          return "cste71_57600*" + K(1) + "-cste71_16695*" + K(3) +
+                 "+cste71_1920*" + K(4) + "-cste17253_339200*" + K(5) +
+                 "+cste22_525*" + K(6) + "-cste1_40*" + K(7);
+        });
+    os << "if(!ieee754::isfinite(error)){\n"
+       << "throw(tfel::material::DivergenceException());\n"
+       << "}\n";
+    if (getDebugMode()) {
+      os << "cout << \"" << this->bd.getClassName()
+         << "::integrate() : error \" << error << endl;\n";
+    }
+    os << "// test for convergence\n"
+       << "if(error<this->epsilon){\n"
+       << "// Final Step\n";
+    for (const auto& v : d.getStateVariables()) {
+      os << "this->" << v.name << " += ";
+      for (const auto& [c, j] : b) {
+        os << c << "*(this->d" << v.name << "_K" << j << ")";
+      }
+      os << ";\n";
+    }
+    if (updateStiffnessTensor) {
+      auto m =
+          modifyVariableForStiffnessTensorComputation(this->bd.getClassName());
+      os << "// updating stiffness tensor at the end of the time step\n";
+      this->writeStiffnessTensorComputation(os, "this->D", m);
+    }
+    if (!this->bd.getMainVariables().empty()) {
+      os << "// update the thermodynamic forces\n"
+         << "if(!this->computeFinalThermodynamicForces()){\n";
+      writeReturnFailure(os, this->bd);
+      os << "}\n";
+    }
+    if (d.hasCode(RungeKuttaDSLBase::RungeKuttaUpdateAuxiliaryStateVariables)) {
+      os << "this->updateAuxiliaryStateVariables(dt_);\n";
+    }
+    os << "// first same as last: the last stage has been evaluated at the\n"
+       << "// end of the sub-step and gives K1 for the next sub-step\n";
+    for (const auto& v : d.getStateVariables()) {
+      os << "this->d" << v.name << "_K1 = this->d" << v.name << "_K7;\n";
+    }
+    os << "t += dt_;\n"
+       << "if(tfel::math::abs(this->dt-t)<dtprec){\n"
+       << "converged=true;\n"
+       << "}\n"
+       << "}\n"
+       << "if(!converged){\n"
+       << "const auto rk_dt = dt_;\n";
+    writePIStepSizeController(os, this->bd, 5u);
+    os << "// K1 is proportional to the time step\n"
+       << "const auto rk_r = tfel::math::base_type_cast(dt_ / rk_dt);\n";
+    writeStateVariablesScaling(os, this->bd, d, "_K1", "rk_r");
+    os << "}\n"
+       << "} else {\n";
+    if (getDebugMode()) {
+      os << "cout << \"" << this->bd.getClassName()
+         << "::integrate() : failure detected, reducing time step by a factor "
+            "10\" << endl;";
+    }
+    os << "// failed is true\n"
+       << "dt_ *= real(0.1f);\n"
+       << "if(dt_<dtprec){\n"
+       << "throw(tfel::material::DivergenceException());\n"
+       << "}\n"
+       << "if(rk_k1){\n"
+       << "// K1 is proportional to the time step\n";
+    writeStateVariablesScaling(os, this->bd, d, "_K1", "real(0.1f)");
+    os << "}\n"
+       << "}\n"
+       << "}\n";
+  }  // end of writeBehaviourDP54Integrator
+
+  void RungeKuttaCodeGeneratorBase::writeBehaviourRosenbrock2Integrator(
+      std::ostream& os, const Hypothesis h) const {
+    const auto& d = this->bd.getBehaviourData(h);
+    const auto svsize = d.getStateVariables().getTypeSize();
+    const auto updateStiffnessTensor =
+        (this->bd.getAttribute<bool>(
+            BehaviourDescription::computesStiffnessTensor, false)) &&
+        (!this->bd.areElasticMaterialPropertiesConstantDuringTheTimeStep());
+    // offsets and sizes of the state variables in the vector of unknowns
+    auto offsets = std::map<std::string, std::pair<std::string, std::string>>{};
+    auto o = SupportedTypes::TypeSize{};
+    for (const auto& v : d.getStateVariables()) {
+      offsets[v.name] = {o.asString(),
+                         SupportedTypes::getTypeSize(v.type, 1u).asString()};
+      o += SupportedTypes::getTypeSize(v.type, v.arraySize);
+    }
+    os << "// ROS2 scheme (Verwer et al., 1999). This scheme is second order\n"
+       << "// accurate whatever the approximation of the jacobian.\n"
+       << "constexpr unsigned short rk_n = " << svsize << ";\n"
+       << "using rk_vector = tfel::math::tvector<rk_n, real>;\n"
+       << "using rk_matrix = tfel::math::tmatrix<rk_n, rk_n, real>;\n"
+       << "using rk_solver = tfel::math::TinyMatrixSolve<rk_n, real, false>;\n"
+       << "constexpr auto rk_gamma = real(1.70710678118654752440);\n"
+       << "auto rk_set = [](auto& rk_v, const real rk_value){\n"
+       << "rk_v = std::remove_cvref_t<decltype(rk_v)>(rk_value);\n"
+       << "};\n"
+       << "// computes the derivatives of the state variables for the given\n"
+       << "// values of the state variables at the given time\n"
+       << "auto rk_evaluate = [this, &rk_set](rk_vector& rk_f,\n"
+       << "                                   const rk_vector& rk_y,\n"
+       << "                                   const time t) -> bool {\n"
+       << "static_cast<void>(t);\n";
+    writeExternalVariablesCurrentValues(os, this->bd, h, "0");
+    if (updateStiffnessTensor) {
+      auto m =
+          modifyVariableForStiffnessTensorComputation(this->bd.getClassName());
+      os << "// updating the stiffness tensor\n";
+      this->writeStiffnessTensorComputation(os, "this->D", m);
+    }
+    writeStateVariablesCopy(
+        os, d, "rk_y", [](const std::string& n) { return "this->" + n + "_"; },
+        false);
+    if (this->bd.hasCode(h, BehaviourData::ComputeThermodynamicForces)) {
+      os << "if(!this->computeThermodynamicForces()){\n"
+         << "return false;\n"
+         << "}\n";
+    }
+    os << "if(!this->computeDerivative()){\n"
+       << "return false;\n"
+       << "}\n";
+    writeStateVariablesCopy(
+        os, d, "rk_f", [](const std::string& n) { return "this->d" + n; },
+        true);
+    os << "return true;\n"
+       << "};\n"
+       << "time t      = time(0);\n"
+       << "time dt_    = this->dt;\n"
+       << "time dtprec = 100* (this->dt) * "
+       << "std::numeric_limits<NumericType>::epsilon();\n"
+       << "auto error = NumericType{};\n"
+       << "auto rk_previous_error = NumericType{this->epsilon};\n"
+       << "bool converged = false;\n"
+       << "// true if the derivatives are known at the beginning of the\n"
+       << "// sub-step\n"
+       << "bool rk_derivatives = false;\n"
+       << "// true if an approximation of the jacobian is available. Since the\n"
+       << "// scheme is a W-method, this approximation is kept across accepted\n"
+       << "// sub-steps and only rebuilt when a sub-step is rejected.\n"
+       << "bool rk_jacobian = false;\n"
+       << "// true if the jacobian has been computed at the beginning of the\n"
+       << "// current sub-step\n"
+       << "bool rk_fresh_jacobian = false;\n"
+       << "auto rk_y0 = rk_vector{};\n"
+       << "auto rk_y = rk_vector{};\n"
+       << "auto rk_f0 = rk_vector{};\n"
+       << "auto rk_f = rk_vector{};\n"
+       << "auto rk_k1 = rk_vector{};\n"
+       << "auto rk_k2 = rk_vector{};\n"
+       << "auto rk_J = rk_matrix{};\n"
+       << "auto rk_m = rk_matrix{};\n"
+       << "auto rk_p = tfel::math::TinyPermutation<rk_n>{};\n";
+    writeStateVariablesCopy(
+        os, d, "rk_y0", [](const std::string& n) { return "this->" + n; },
+        true);
+    if (getDebugMode()) {
+      os << "cout << endl << \"" << this->bd.getClassName()
+         << "::integrate() : beginning of resolution\" << endl;\n";
+    }
+    os << "while(!converged){\n";
+    if (getDebugMode()) {
+      os << "cout << \"" << this->bd.getClassName()
+         << "::integrate() : from \" << t <<  \" to \" << t+dt_ << \" with "
+            "time step \" << dt_ << endl;\n";
+    }
+    os << "bool failed = false;\n"
+       << "const auto rk_h = real(tfel::math::base_type_cast(dt_));\n"
+       << "if(!rk_derivatives){\n"
+       << "// derivatives at the beginning of the sub-step\n"
+       << "failed = !rk_evaluate(rk_f0, rk_y0, t);\n"
+       << "rk_derivatives = !failed;\n"
+       << "}\n"
+       << "if((!failed) && (!rk_jacobian)){\n"
+       << "// jacobian computed by forward finite differences\n"
+       << "for(unsigned short rk_j = 0; (!failed) && (rk_j != rk_n); "
+          "++rk_j){\n"
+       << "rk_y = rk_y0;\n"
+       << "const auto rk_dy = (this->numerical_jacobian_epsilon) * "
+          "std::max(real(1), tfel::math::abs(rk_y0(rk_j)));\n"
+       << "rk_y(rk_j) += rk_dy;\n"
+       << "failed = !rk_evaluate(rk_f, rk_y, t);\n"
+       << "for(unsigned short rk_i = 0; rk_i != rk_n; ++rk_i){\n"
+       << "rk_J(rk_i, rk_j) = (rk_f(rk_i) - rk_f0(rk_i)) / rk_dy;\n"
+       << "}\n"
+       << "}\n"
+       << "rk_jacobian = !failed;\n"
+       << "rk_fresh_jacobian = !failed;\n"
+       << "}\n"
+       << "if(!failed){\n"
+       << "rk_m = (-rk_gamma * rk_h) * rk_J;\n"
+       << "for(unsigned short rk_i = 0; rk_i != rk_n; ++rk_i){\n"
+       << "rk_m(rk_i, rk_i) += 1;\n"
+       << "}\n"
+       << "failed = !rk_solver::decomp(rk_m, rk_p);\n"
+       << "}\n"
+       << "if(!failed){\n"
+       << "// first stage\n"
+       << "rk_k1 = rk_f0;\n"
+       << "failed = !rk_solver::back_substitute(rk_m, rk_p, rk_k1);\n"
+       << "}\n"
+       << "if(!failed){\n"
+       << "// second stage\n"
+       << "rk_y = rk_y0 + rk_h * rk_k1;\n"
+       << "failed = !rk_evaluate(rk_f, rk_y, t + dt_);\n"
+       << "}\n"
+       << "if(!failed){\n"
+       << "rk_k2 = rk_f - real(2) * rk_k1;\n"
+       << "failed = !rk_solver::back_substitute(rk_m, rk_p, rk_k2);\n"
+       << "}\n";
+    if (getDebugMode()) {
+      os << "if(failed){\n"
+         << "cout << \"" << this->bd.getClassName()
+         << "::integrate() : failed while computing the stages\" << endl;\n"
+         << "}\n";
+    }
+    os << "if(!failed){\n"
+       << "// Computing the error by comparison with the linearly implicit\n"
+       << "// Euler scheme\n"
+       << "rk_f = (rk_h / 2) * (rk_k1 + rk_k2);\n"
+       << "auto rk_abs_sum = [&rk_f](const unsigned short rk_o,\n"
+       << "                          const unsigned short rk_s){\n"
+       << "auto rk_r = real(0);\n"
+       << "for(unsigned short rk_i = 0; rk_i != rk_s; ++rk_i){\n"
+       << "rk_r += tfel::math::abs(rk_f(rk_o + rk_i));\n"
+       << "}\n"
+       << "return rk_r;\n"
+       << "};\n";
+    writeEmbeddedErrorEvaluation(
+        os, this->bd, d,
+        [&offsets](const VariableDescription& v, const std::string& idx) {
+          const auto& [vo, vs] = offsets.at(v.name);
+          if (idx.empty()) {
+            return "rk_abs_sum(" + vo + ", " + vs + ")";
+          }
+          return "rk_abs_sum(" + vo + "+" + idx + "*(" + vs + "), " + vs + ")";
+        });
+    os << "if(!ieee754::isfinite(error)){\n"
+       << "throw(tfel::material::DivergenceException());\n"
+       << "}\n";
+    if (getDebugMode()) {
+      os << "cout << \"" << this->bd.getClassName()
+         << "::integrate() : error \" << error << endl;\n";
+    }
+    os << "// test for convergence\n"
+       << "if(error<this->epsilon){\n"
+       << "// Final Step\n"
+       << "rk_y0 += (rk_h / 2) * (real(3) * rk_k1 + rk_k2);\n";
+    writeStateVariablesCopy(
+        os, d, "rk_y0", [](const std::string& n) { return "this->" + n; },
+        false);
+    writeExternalVariablesCurrentValues(os, this->bd, h, "1");
+    if (updateStiffnessTensor) {
+      auto m =
+          modifyVariableForStiffnessTensorComputation(this->bd.getClassName());
+      os << "// updating stiffness tensor at the end of the time step\n";
+      this->writeStiffnessTensorComputation(os, "this->D", m);
+    }
+    if (!this->bd.getMainVariables().empty()) {
+      os << "// update the thermodynamic forces\n"
+         << "if(!this->computeFinalThermodynamicForces()){\n";
+      writeReturnFailure(os, this->bd);
+      os << "}\n";
+    }
+    if (d.hasCode(RungeKuttaDSLBase::RungeKuttaUpdateAuxiliaryStateVariables)) {
+      os << "this->updateAuxiliaryStateVariables(dt_);\n";
+    }
+    os << "t += dt_;\n"
+       << "if(tfel::math::abs(this->dt-t)<dtprec){\n"
+       << "converged=true;\n"
+       << "}\n"
+       << "// the jacobian is kept for the next sub-step\n"
+       << "rk_derivatives = false;\n"
+       << "rk_fresh_jacobian = false;\n"
+       << "} else if(!rk_fresh_jacobian){\n"
+       << "// the sub-step is rejected: the jacobian may be outdated\n"
+       << "rk_jacobian = false;\n"
+       << "}\n"
+       << "if(!converged){\n";
+    writePIStepSizeController(os, this->bd, 2u);
+    os << "}\n"
+       << "} else {\n";
+    if (getDebugMode()) {
+      os << "cout << \"" << this->bd.getClassName()
+         << "::integrate() : failure detected, reducing time step by a factor "
+            "10\" << endl;";
+    }
+    os << "// failed is true\n"
+       << "if(!rk_fresh_jacobian){\n"
+       << "rk_jacobian = false;\n"
+       << "}\n"
+       << "dt_ *= real(0.1f);\n"
+       << "if(dt_<dtprec){\n"
+       << "throw(tfel::material::DivergenceException());\n"
+       << "}\n"
+       << "}\n"
+       << "}\n";
+  }  // end of writeBehaviourRosenbrock2Integrator
+
   void RungeKuttaCodeGeneratorBase::writeBehaviourIntegrator(
       std::ostream& os, const Hypothesis h) const {
     const auto btype = this->bd.getBehaviourTypeFlag();
@@ -2263,6 +2951,10 @@ namespace mfront {
       this->writeBehaviourRK54Integrator(os, h);
     } else if (algorithm == "RungeKuttaCastem") {
       this->writeBehaviourRKCastemIntegrator(os, h);
+    } else if (algorithm == "DormandPrince5/4") {
+      this->writeBehaviourDP54Integrator(os, h);
+    } else if (algorithm == "Rosenbrock2") {
+      this->writeBehaviourRosenbrock2Integrator(os, h);
     } else if (algorithm == "RungeKutta4") {
       this->writeBehaviourRK4Integrator(os, h);
     } else {
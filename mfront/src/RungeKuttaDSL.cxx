@@ -39,7 +39,7 @@ namespace mfront {
     return "this dsl provides a generic integrator based on one of the many "
            "Runge-Kutta algorithm. Avalailable algorithms are 'euler', 'rk2', "
            "'rk4' "
-           "'r42', 'rk54' and 'rkCastem'";
+           "'r42', 'rk54', 'rkdp54', 'ros2' and 'rkCastem'";
   }  // end of RungeKuttaDSL::getDescription
 
   std::string RungeKuttaDSL::getCodeBlockTemplate(
@@ -497,6 +497,17 @@ namespace mfront {
                             false);
     } else if (this->current->value == "rk54") {
       this->setDefaultAlgorithm();
+    } else if (this->current->value == "rkdp54") {
+      this->mb.setAttribute(BehaviourData::algorithm,
+                            std::string("DormandPrince5/4"), false);
+      this->mb.setAttribute(BehaviourData::numberOfEvaluations, ushort(7u),
+                            false);
+    } else if (this->current->value == "ros2") {
+      this->reserveName("numerical_jacobian_epsilon");
+      this->mb.setAttribute(BehaviourData::algorithm,
+                            std::string("Rosenbrock2"), false);
+      this->mb.setAttribute(BehaviourData::numberOfEvaluations, ushort(0u),
+                            false);
     } else if (this->current->value == "rkCastem") {
       const auto bt = this->mb.getBehaviourType();
       if ((bt != BehaviourDescription::STANDARDSTRAINBASEDBEHAVIOUR) &&
@@ -529,7 +540,8 @@ namespace mfront {
                               this->current->value +
                                   " is not a valid algorithm name"
                                   "Supported algorithms are : 'euler', 'rk2',"
-                                  " 'rk4', 'rk42' , 'rk54' and 'rkCastem'");
+                                  " 'rk4', 'rk42' , 'rk54', 'rkdp54', "
+                                  "'ros2' and 'rkCastem'");
     }
     ++this->current;
     this->readSpecifiedToken("RungeKuttaDSLBase::treatAlgorithm", ";");
@@ -637,6 +649,16 @@ namespace mfront {
                             BehaviourData::ALREADYREGISTRED);
       this->mb.setParameterDefaultValue(uh, "epsilon", 1.e-8);
     }
+    // perturbation used to compute the jacobian of the rosenbrock algorithm
+    if ((this->mb.getAttribute<std::string>(BehaviourData::algorithm) ==
+         "Rosenbrock2") &&
+        (!this->mb.hasParameter(uh, "numerical_jacobian_epsilon"))) {
+      this->mb.addParameter(
+          uh, VariableDescription("real", "numerical_jacobian_epsilon", 1u, 0u),
+          BehaviourData::ALREADYREGISTRED);
+      this->mb.setParameterDefaultValue(uh, "numerical_jacobian_epsilon",
+                                        1.e-8);
+    }
     if (this->mb.getAttribute<bool>(
             BehaviourDescription::computesStiffnessTensor, false)) {
       auto D = VariableDescription("StiffnessTensor", "D", 1u, 0u);
@@ -674,6 +696,25 @@ namespace mfront {
                                 "small strain and finite strain behaviours.");
       }
     }
+    if (algorithm == "Rosenbrock2") {
+      for (const auto& h : this->mb.getDistinctModellingHypotheses()) {
+        for (const auto& v :
+             this->mb.getBehaviourData(h).getStateVariables()) {
+          if (this->mb.useDynamicallyAllocatedVector(v.arraySize)) {
+            this->throwRuntimeError(
+                "RungeKuttaDSLBase::endsInputFileProcessing",
+                "the ros2 algorithm does not support dynamically allocated "
+                "arrays of state variables (variable '" +
+                    v.name + "')");
+          }
+        }
+      }
+    }
+    // the following algorithms initialize the current values of the state
+    // variables and of the external state variables by themselves
+    const auto initializesCurrentValues =
+        (algorithm == "RungeKutta4/2") || (algorithm == "RungeKutta5/4") ||
+        (algorithm == "DormandPrince5/4") || (algorithm == "Rosenbrock2");
     // some checks
     for (const auto& h : this->mb.getDistinctModellingHypotheses()) {
       const auto& d = this->mb.getBehaviourData(h);
@@ -706,15 +747,14 @@ namespace mfront {
             icb.code += "this->" + currentVarName + ".resize(" +
                         std::to_string(iv.arraySize) + ");\n";
           }
-          if ((algorithm != "RungeKutta4/2") &&
-              (algorithm != "RungeKutta5/4")) {
+          if (!initializesCurrentValues) {
             icb.code +=
                 "this->" + currentVarName + " = this->" + iv.name + ";\n";
           }
         }
       }
       // driving variables
-      if ((algorithm != "RungeKutta4/2") && (algorithm != "RungeKutta5/4")) {
+      if (!initializesCurrentValues) {
         for (const auto& vm : this->mb.getMainVariables()) {
           const auto& dv = vm.first;
           if (uvs.find(dv.name) != uvs.end()) {
@@ -729,8 +769,7 @@ namespace mfront {
             icb.code += "this->" + currentVarName + ".resize(" +
                         std::to_string(ev.arraySize) + ");\n";
           }
-          if ((algorithm != "RungeKutta4/2") &&
-              (algorithm != "RungeKutta5/4")) {
+          if (!initializesCurrentValues) {
             icb.code +=
                 "this->" + currentVarName + " = this->" + ev.name + ";\n";
           }
@@ -0,0 +1,32 @@
+# This script checks that the consolidated result file written by the
+# `--consolidated-result-file` option of `mtest` describes the expected
+# number of tests, that all those tests succeeded and that each test
+# reports the value of the swept pattern.
+#
+# Usage: cmake -DFILE=<file> -DNUMBER_OF_TESTS=<n> -DPATTERN=<pattern>
+#              -P CheckConsolidatedResultFile.cmake
+
+if(NOT EXISTS "${FILE}")
+  message(FATAL_ERROR "file '${FILE}' does not exist")
+endif(NOT EXISTS "${FILE}")
+file(STRINGS "${FILE}" tests REGEX "^# test: ")
+file(STRINGS "${FILE}" successes REGEX "^# status: success$")
+file(STRINGS "${FILE}" substitutions REGEX "^# substitution: ${PATTERN} ")
+list(LENGTH tests ntests)
+list(LENGTH successes nsuccesses)
+list(LENGTH substitutions nsubstitutions)
+if(NOT ntests EQUAL NUMBER_OF_TESTS)
+  message(FATAL_ERROR "${ntests} tests found, expected ${NUMBER_OF_TESTS}")
+endif(NOT ntests EQUAL NUMBER_OF_TESTS)
+if(NOT nsuccesses EQUAL NUMBER_OF_TESTS)
+  message(FATAL_ERROR "${nsuccesses} tests succeeded, expected ${NUMBER_OF_TESTS}")
+endif(NOT nsuccesses EQUAL NUMBER_OF_TESTS)
+if(NOT nsubstitutions EQUAL NUMBER_OF_TESTS)
+  message(FATAL_ERROR "${nsubstitutions} substitutions found, expected ${NUMBER_OF_TESTS}")
+endif(NOT nsubstitutions EQUAL NUMBER_OF_TESTS)
+# each test must have written some results
+file(STRINGS "${FILE}" lines REGEX "^[-0-9]")
+list(LENGTH lines nlines)
+if(nlines LESS NUMBER_OF_TESTS)
+  message(FATAL_ERROR "no results found in '${FILE}'")
+endif(nlines LESS NUMBER_OF_TESTS)
@@ -0,0 +1,111 @@
+/*!
+ * \file   mfront/tests/behaviours/generic/ExternalLibraryManagerTest.cxx
+ * \brief  This test checks that the descriptions returned by the
+ * `ExternalLibraryManager` class are cached and can be retrieved
+ * concurrently by many threads, and that the cache is cleared when the
+ * library is unloaded.
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright Copyright (C) 2006-2025 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <memory>
+#include <vector>
+#include <string>
+#include <cstdlib>
+#include <iostream>
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+#include "TFEL/System/ThreadPool.hxx"
+#include "TFEL/System/ExternalLibraryManager.hxx"
+#include "TFEL/System/ExternalBehaviourDescription.hxx"
+
+//! \brief path to the library
+static std::string library;
+
+struct ExternalLibraryManagerTest final : public tfel::tests::TestCase {
+  ExternalLibraryManagerTest()
+      : tfel::tests::TestCase("TFEL/System", "ExternalLibraryManagerTest") {
+  }  // end of ExternalLibraryManagerTest
+  tfel::tests::TestResult execute() override {
+    using namespace tfel::system;
+    using BehaviourDescriptionPtr =
+        std::shared_ptr<const ExternalBehaviourDescription>;
+    using DescriptionPtr =
+        std::shared_ptr<const ExternalMaterialKnowledgeDescription>;
+    auto& elm = ExternalLibraryManager::getExternalLibraryManager();
+    const auto b = std::string{"ImplicitNorton"};
+    const auto h = std::string{"Tridimensional"};
+    // the descriptions are retrieved concurrently
+    auto pool = ThreadPool{4};
+    auto bresults =
+        std::vector<std::future<ThreadedTaskResult<BehaviourDescriptionPtr>>>{};
+    auto results =
+        std::vector<std::future<ThreadedTaskResult<DescriptionPtr>>>{};
+    for (int i = 0; i != 16; ++i) {
+      bresults.push_back(
+          pool.addTask([&elm, &b, &h] { return elm.describe(library, b, h); }));
+      results.push_back(
+          pool.addTask([&elm, &b] { return elm.describe(library, b); }));
+    }
+    const auto d = elm.describe(library, b, h);
+    const auto d2 = elm.describe(library, b);
+    for (auto& r : bresults) {
+      TFEL_TESTS_ASSERT(*(r.get()) == d);
+    }
+    for (auto& r : results) {
+      TFEL_TESTS_ASSERT(*(r.get()) == d2);
+    }
+    // comparison with a description built from scratch
+    const auto ref = ExternalBehaviourDescription(library, b, h);
+    TFEL_TESTS_ASSERT(d->behaviour == b);
+    TFEL_TESTS_ASSERT(d->hypothesis == h);
+    TFEL_TESTS_ASSERT(d->build_id == ref.build_id);
+    TFEL_TESTS_ASSERT(d->mpnames == ref.mpnames);
+    TFEL_TESTS_ASSERT(d->ivnames == ref.ivnames);
+    TFEL_TESTS_ASSERT(d->ivtypes == ref.ivtypes);
+    TFEL_TESTS_ASSERT(d->evnames == ref.evnames);
+    TFEL_TESTS_ASSERT(d->pnames == ref.pnames);
+    TFEL_TESTS_ASSERT(d2->entry_point == b);
+    TFEL_TESTS_ASSERT(d2->source == ref.source);
+    TFEL_TESTS_ASSERT(d2->mfront_interface == ref.mfront_interface);
+    // errors are reported and not cached
+    TFEL_TESTS_CHECK_THROW(elm.describe(library, b, "PlaneStress2"),
+                           std::runtime_error);
+    TFEL_TESTS_CHECK_THROW(elm.describe(library, b, "PlaneStress2"),
+                           std::runtime_error);
+    // unloading the library clears the cached descriptions
+    TFEL_TESTS_ASSERT(elm.unloadLibrary(library));
+    TFEL_TESTS_ASSERT(!elm.unloadLibrary(library));
+    const auto d3 = elm.describe(library, b, h);
+    const auto d4 = elm.describe(library, b);
+    TFEL_TESTS_ASSERT(d3 != d);
+    TFEL_TESTS_ASSERT(d4 != d2);
+    TFEL_TESTS_ASSERT(d3->build_id == ref.build_id);
+    TFEL_TESTS_ASSERT(d3->ivnames == ref.ivnames);
+    TFEL_TESTS_ASSERT(d4->source == ref.source);
+    TFEL_TESTS_ASSERT(elm.describe(library, b, h) == d3);
+    return this->result;
+  }  // end of execute
+};
+
+TFEL_TESTS_GENERATE_PROXY(ExternalLibraryManagerTest,
+                          "ExternalLibraryManagerTest");
+
+int main(const int argc, const char* const* const argv) {
+  if (argc != 2) {
+    std::cerr << "ExternalLibraryManagerTest: invalid number of arguments\n";
+    return EXIT_FAILURE;
+  }
+  library = argv[1];
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("ExternalLibraryManagerTest.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}  // end of main
@@ -0,0 +1,252 @@
+/*!
+ * \file   mfront/tests/behaviours/generic/GenericBehaviourBatchTest.cxx
+ * \brief  This test checks that integrating a behaviour over a set of
+ * integration points gives the same results than integrating the behaviour
+ * point by point.
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright Copyright (C) 2006-2025 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <cmath>
+#include <algorithm>
+#include <vector>
+#include <string>
+#include <cstdlib>
+#include <iostream>
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+#include "TFEL/System/ExternalLibraryManager.hxx"
+#include "MFront/GenericBehaviour/BehaviourData.h"
+#include "MFront/GenericBehaviour/BatchBehaviourData.h"
+
+//! \brief path to the library
+static std::string library;
+
+struct GenericBehaviourBatchTest final : public tfel::tests::TestCase {
+  GenericBehaviourBatchTest()
+      : tfel::tests::TestCase("MFront/GenericBehaviour",
+                              "GenericBehaviourBatchTest") {
+  }  // end of GenericBehaviourBatchTest
+  tfel::tests::TestResult execute() override {
+    using namespace tfel::system;
+    auto& elm = ExternalLibraryManager::getExternalLibraryManager();
+    const auto b = std::string{"ImplicitNorton"};
+    const auto h = std::string{"Tridimensional"};
+    const auto f = elm.getGenericBehaviourFunction(library, b + "_" + h);
+    const auto fb =
+        elm.getGenericBehaviourBatchFunction(library, b + "_" + h + "_batch");
+    // material properties
+    const auto mp_names =
+        elm.getUMATMaterialPropertiesNames(library, b, h);
+    auto mps = std::vector<double>{};
+    for (const auto& mp : mp_names) {
+      mps.push_back(mp == "YoungModulus" ? 150e9 : 0.3);
+    }
+    // internal state variables
+    auto nisvs = std::size_t{};
+    for (const auto t :
+         elm.getUMATInternalStateVariablesTypes(library, b, h)) {
+      nisvs += (t == 0) ? 1 : 6;
+    }
+    // external state variables. The temperature is not declared in the list
+    // of external state variables but is always the first one.
+    const auto nesvs =
+        1 + elm.getUMATExternalStateVariablesNames(library, b, h).size();
+    const auto esvs = std::vector<double>(nesvs, 293.15);
+    // point by point integration
+    const auto dt = 1.;
+    auto e0 = std::vector<double>(6 * n, 0);
+    auto e1 = std::vector<double>(6 * n, 0);
+    auto s0 = std::vector<double>(6 * n, 0);
+    auto isvs0 = std::vector<double>(nisvs * n, 0);
+    for (std::size_t p = 0; p != n; ++p) {
+      const auto x = static_cast<double>(p);
+      e1[6 * p] = (x + 1) * 1e-5;
+      e1[6 * p + 1] = -(x + 1) * 3e-6;
+      e1[6 * p + 3] = x * 2e-6;
+    }
+    auto s1_ref = std::vector<double>(6 * n, 0);
+    auto isvs1_ref = std::vector<double>(nisvs * n, 0);
+    auto K_ref = std::vector<double>(36 * n, 0);
+    auto rdt_ref = std::vector<double>(n, 1);
+    auto status_ref = std::vector<int>(n, 0);
+    for (std::size_t p = 0; p != n; ++p) {
+      auto d = mfront_gb_BehaviourData{};
+      d.error_message = nullptr;
+      d.dt = dt;
+      K_ref[36 * p] = 4;
+      d.K = K_ref.data() + 36 * p;
+      d.rdt = rdt_ref.data() + p;
+      d.speed_of_sound = nullptr;
+      d.s0.gradients = e0.data() + 6 * p;
+      d.s0.thermodynamic_forces = s0.data() + 6 * p;
+      d.s0.mass_density = nullptr;
+      d.s0.material_properties = mps.data();
+      d.s0.internal_state_variables = isvs0.data() + nisvs * p;
+      d.s0.stored_energy = nullptr;
+      d.s0.dissipated_energy = nullptr;
+      d.s0.external_state_variables = esvs.data();
+      d.s1.gradients = e1.data() + 6 * p;
+      d.s1.thermodynamic_forces = s1_ref.data() + 6 * p;
+      d.s1.mass_density = nullptr;
+      d.s1.material_properties = mps.data();
+      d.s1.internal_state_variables = isvs1_ref.data() + nisvs * p;
+      d.s1.stored_energy = nullptr;
+      d.s1.dissipated_energy = nullptr;
+      d.s1.external_state_variables = esvs.data();
+      status_ref[p] = f(&d);
+    }
+    const auto r_ref = *(std::min_element(status_ref.begin(), status_ref.end()));
+    TFEL_TESTS_ASSERT(r_ref >= 0);
+    // batch integration, array of structures. The material properties and
+    // the external state variables are shared by all integration points
+    // (null point stride)
+    {
+      auto s1 = std::vector<double>(6 * n, 0);
+      auto isvs1 = std::vector<double>(nisvs * n, 0);
+      auto K = std::vector<double>(36 * n, 0);
+      auto rdt = std::vector<double>(n, 1);
+      auto status = std::vector<int>(n, 0);
+      for (std::size_t p = 0; p != n; ++p) {
+        K[36 * p] = 4;
+      }
+      auto d = mfront_gb_BatchBehaviourData{};
+      d.error_message = nullptr;
+      d.n = n;
+      d.dt = dt;
+      d.K = {K.data(), 36, 36, 1};
+      d.rdt = rdt.data();
+      d.speed_of_sound = nullptr;
+      d.status = status.data();
+      d.s0.gradients = {e0.data(), 6, 6, 1};
+      d.s0.thermodynamic_forces = {s0.data(), 6, 6, 1};
+      d.s0.mass_density = {nullptr, 0, 0, 0};
+      d.s0.material_properties = {mps.data(), mps.size(), 0, 1};
+      d.s0.internal_state_variables = {isvs0.data(), nisvs, nisvs, 1};
+      d.s0.stored_energy = {nullptr, 0, 0, 0};
+      d.s0.dissipated_energy = {nullptr, 0, 0, 0};
+      d.s0.external_state_variables = {esvs.data(), nesvs, 0, 1};
+      d.s1.gradients = {e1.data(), 6, 6, 1};
+      d.s1.thermodynamic_forces = {s1.data(), 6, 6, 1};
+      d.s1.mass_density = {nullptr, 0, 0, 0};
+      d.s1.material_properties = {mps.data(), mps.size(), 0, 1};
+      d.s1.internal_state_variables = {isvs1.data(), nisvs, nisvs, 1};
+      d.s1.stored_energy = {nullptr, 0, 0, 0};
+      d.s1.dissipated_energy = {nullptr, 0, 0, 0};
+      d.s1.external_state_variables = {esvs.data(), nesvs, 0, 1};
+      TFEL_TESTS_ASSERT(fb(&d) == r_ref);
+      for (std::size_t p = 0; p != n; ++p) {
+        TFEL_TESTS_ASSERT(status[p] == status_ref[p]);
+        TFEL_TESTS_ASSERT(std::abs(rdt[p] - rdt_ref[p]) < eps);
+        for (std::size_t i = 0; i != 6; ++i) {
+          TFEL_TESTS_ASSERT(std::abs(s1[6 * p + i] - s1_ref[6 * p + i]) <
+                            seps);
+        }
+        for (std::size_t i = 0; i != nisvs; ++i) {
+          TFEL_TESTS_ASSERT(std::abs(isvs1[nisvs * p + i] -
+                                     isvs1_ref[nisvs * p + i]) < eps);
+        }
+        for (std::size_t i = 0; i != 36; ++i) {
+          TFEL_TESTS_ASSERT(std::abs(K[36 * p + i] - K_ref[36 * p + i]) <
+                            seps);
+        }
+      }
+    }
+    // batch integration, structure of arrays
+    {
+      auto soa = [](const std::vector<double>& v, const std::size_t s) {
+        const auto np = v.size() / s;
+        auto r = std::vector<double>(v.size());
+        for (std::size_t p = 0; p != np; ++p) {
+          for (std::size_t i = 0; i != s; ++i) {
+            r[i * np + p] = v[s * p + i];
+          }
+        }
+        return r;
+      };
+      const auto e0_soa = soa(e0, 6);
+      const auto e1_soa = soa(e1, 6);
+      const auto s0_soa = soa(s0, 6);
+      const auto isvs0_soa = soa(isvs0, nisvs);
+      auto s1 = std::vector<double>(6 * n, 0);
+      auto isvs1 = std::vector<double>(nisvs * n, 0);
+      auto K = std::vector<double>(36 * n, 0);
+      auto rdt = std::vector<double>(n, 1);
+      auto status = std::vector<int>(n, 0);
+      for (std::size_t p = 0; p != n; ++p) {
+        K[p] = 4;
+      }
+      auto d = mfront_gb_BatchBehaviourData{};
+      d.error_message = nullptr;
+      d.n = n;
+      d.dt = dt;
+      d.K = {K.data(), 36, 1, n};
+      d.rdt = rdt.data();
+      d.speed_of_sound = nullptr;
+      d.status = status.data();
+      d.s0.gradients = {e0_soa.data(), 6, 1, n};
+      d.s0.thermodynamic_forces = {s0_soa.data(), 6, 1, n};
+      d.s0.mass_density = {nullptr, 0, 0, 0};
+      d.s0.material_properties = {mps.data(), mps.size(), 0, 1};
+      d.s0.internal_state_variables = {isvs0_soa.data(), nisvs, 1, n};
+      d.s0.stored_energy = {nullptr, 0, 0, 0};
+      d.s0.dissipated_energy = {nullptr, 0, 0, 0};
+      d.s0.external_state_variables = {esvs.data(), nesvs, 0, 1};
+      d.s1.gradients = {e1_soa.data(), 6, 1, n};
+      d.s1.thermodynamic_forces = {s1.data(), 6, 1, n};
+      d.s1.mass_density = {nullptr, 0, 0, 0};
+      d.s1.material_properties = {mps.data(), mps.size(), 0, 1};
+      d.s1.internal_state_variables = {isvs1.data(), nisvs, 1, n};
+      d.s1.stored_energy = {nullptr, 0, 0, 0};
+      d.s1.dissipated_energy = {nullptr, 0, 0, 0};
+      d.s1.external_state_variables = {esvs.data(), nesvs, 0, 1};
+      TFEL_TESTS_ASSERT(fb(&d) == r_ref);
+      for (std::size_t p = 0; p != n; ++p) {
+        TFEL_TESTS_ASSERT(status[p] == status_ref[p]);
+        for (std::size_t i = 0; i != 6; ++i) {
+          TFEL_TESTS_ASSERT(std::abs(s1[i * n + p] - s1_ref[6 * p + i]) <
+                            seps);
+        }
+        for (std::size_t i = 0; i != nisvs; ++i) {
+          TFEL_TESTS_ASSERT(
+              std::abs(isvs1[i * n + p] - isvs1_ref[nisvs * p + i]) < eps);
+        }
+        for (std::size_t i = 0; i != 36; ++i) {
+          TFEL_TESTS_ASSERT(std::abs(K[i * n + p] - K_ref[36 * p + i]) <
+                            seps);
+        }
+      }
+    }
+    return this->result;
+  }  // end of execute
+
+ private:
+  //! \brief number of integration points
+  static constexpr std::size_t n = 4;
+  //! \brief criterion used to compare strains and other dimensionless values
+  static constexpr double eps = 1e-14;
+  //! \brief criterion used to compare stresses and stiffnesses
+  static constexpr double seps = 1e-2;
+};
+
+TFEL_TESTS_GENERATE_PROXY(GenericBehaviourBatchTest,
+                          "GenericBehaviourBatchTest");
+
+int main(const int argc, const char* const* const argv) {
+  if (argc != 2) {
+    std::cerr << "GenericBehaviourBatchTest: invalid number of arguments\n";
+    return EXIT_FAILURE;
+  }
+  library = argv[1];
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("GenericBehaviourBatchTest.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}  // end of main
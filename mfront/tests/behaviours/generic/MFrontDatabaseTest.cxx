@@ -0,0 +1,348 @@
+/*!
+ * \file   mfront/tests/behaviours/generic/MFrontDatabaseTest.cxx
+ * \brief  This test checks the index of the `MFrontDatabase` class, the
+ * parallel analysis of libraries and the filters of the queries.
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright Copyright (C) 2006-2025 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <string>
+#include <vector>
+#include <cctype>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <iostream>
+#include <stdexcept>
+#include <filesystem>
+#if !(defined _WIN32 || defined _WIN64)
+#include <dlfcn.h>
+#endif
+#include "TFEL/Raise.hxx"
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+#include "MFront/MFrontDatabase.hxx"
+
+//! \brief path to the library
+static std::string library;
+
+struct MFrontDatabaseTest final : public tfel::tests::TestCase {
+  MFrontDatabaseTest()
+      : tfel::tests::TestCase("MFront", "MFrontDatabaseTest") {
+  }  // end of MFrontDatabaseTest
+  tfel::tests::TestResult execute() override {
+    namespace fs = std::filesystem;
+    fs::remove_all(directory);
+    fs::create_directory(directory);
+    // each test analyses its own copies of the library, so that checking
+    // that a library is not loaded is not affected by the other tests
+    this->test1();
+    this->test2();
+    this->test3();
+    this->test4();
+    this->test5();
+    this->test6();
+    return this->result;
+  }  // end of execute
+
+ private:
+  using EntryPoint = mfront::MFrontDatabase::EntryPoint;
+  //! \brief directory in which the libraries are copied
+  static constexpr const char* const directory = "MFrontDatabaseTest-libraries";
+  /*!
+   * \return the path to a copy of the tested library
+   * \param[in] n: name of the copy
+   */
+  static std::string copyLibrary(const std::string& n) {
+    namespace fs = std::filesystem;
+    const auto l = fs::absolute(fs::path{directory} / ("lib" + n + ".so"));
+    fs::copy_file(library, l, fs::copy_options::overwrite_existing);
+    return l.string();
+  }  // end of copyLibrary
+  //! \return the content of a file
+  static std::string readFile(const std::string& f) {
+    std::ifstream in(f);
+    tfel::raise_if(!in, "MFrontDatabaseTest: can't open file '" + f + "'");
+    auto c = std::string{};
+    auto line = std::string{};
+    while (std::getline(in, line)) {
+      c += line + '\n';
+    }
+    return c;
+  }  // end of readFile
+  /*!
+   * \brief write an index describing a library by a single fake entry
+   * point named `FakeBehaviour`
+   * \param[in] f: index file
+   * \param[in] l: library
+   * \param[in] ds: increment of the size of the library
+   * \param[in] dt: increment of the modification time of the library
+   */
+  static void writeFakeIndex(const std::string& f,
+                             const std::string& l,
+                             const std::uintmax_t ds = 0,
+                             const std::int64_t dt = 0) {
+    namespace fs = std::filesystem;
+    std::ofstream out(f);
+    tfel::raise_if(!out, "MFrontDatabaseTest: can't open file '" + f + "'");
+    const auto t = static_cast<std::int64_t>(
+        fs::last_write_time(l).time_since_epoch().count());
+    out << "MFrontDatabaseIndex 1\n"
+        << "library\t" << l << '\t' << fs::file_size(l) + ds << '\t'
+        << t + dt << '\n'
+        << "entry_point\tbehaviour\tFakeBehaviour\tFakeBehaviour.mfront\t"
+        << "FakeMaterial\tgeneric\n";
+  }  // end of writeFakeIndex
+  //! \return if the given library is loaded by the current process
+  static bool isLoaded(const std::string& l) {
+#if !(defined _WIN32 || defined _WIN64)
+    auto* const h = ::dlopen(l.c_str(), RTLD_LAZY | RTLD_NOLOAD);
+    if (h == nullptr) {
+      return false;
+    }
+    ::dlclose(h);
+    return true;
+#else
+    static_cast<void>(l);
+    return false;
+#endif
+  }  // end of isLoaded
+  //! \return if two lists of entry points are equal
+  static bool areEqual(const std::vector<EntryPoint>& e1,
+                       const std::vector<EntryPoint>& e2) {
+    if (e1.size() != e2.size()) {
+      return false;
+    }
+    for (std::size_t i = 0; i != e1.size(); ++i) {
+      if ((e1[i].library != e2[i].library) || (e1[i].name != e2[i].name) ||
+          (e1[i].source != e2[i].source) ||
+          (e1[i].material != e2[i].material) ||
+          (e1[i].interface != e2[i].interface) ||
+          (e1[i].type != e2[i].type)) {
+        return false;
+      }
+    }
+    return true;
+  }  // end of areEqual
+  //! \brief a library described by an up to date index is not loaded
+  void test1() {
+    const auto l = copyLibrary("MFrontDatabaseTest1");
+    const auto f = std::string{directory} + "/test1.idx";
+    writeFakeIndex(f, l);
+    auto db = mfront::MFrontDatabase{};
+    db.loadIndex(f);
+    TFEL_TESTS_ASSERT(db.getEntryPoints().empty());
+    db.analyseLibrary(l);
+    const auto& epts = db.getEntryPoints();
+    TFEL_TESTS_ASSERT(epts.size() == 1u);
+    if (epts.size() == 1u) {
+      TFEL_TESTS_ASSERT(epts[0].library == l);
+      TFEL_TESTS_ASSERT(epts[0].name == "FakeBehaviour");
+      TFEL_TESTS_ASSERT(epts[0].source == "FakeBehaviour.mfront");
+      TFEL_TESTS_ASSERT(epts[0].material == "FakeMaterial");
+      TFEL_TESTS_ASSERT(epts[0].interface == "generic");
+      TFEL_TESTS_ASSERT(epts[0].type == EntryPoint::BEHAVIOUR);
+    }
+    TFEL_TESTS_ASSERT(!isLoaded(l));
+  }  // end of test1
+  //! \brief the index is not used if the size or the modification time of
+  //! the library changed
+  void test2() {
+    namespace fs = std::filesystem;
+    const auto l = copyLibrary("MFrontDatabaseTest2");
+    const auto f = std::string{directory} + "/test2.idx";
+    auto reference = mfront::MFrontDatabase{};
+    reference.analyseLibrary(l);
+    TFEL_TESTS_ASSERT(!reference.getEntryPoints().empty());
+    // analysing a library which is not described by the index loads it
+    TFEL_TESTS_ASSERT(isLoaded(l));
+    auto check = [this, &l, &f, &reference](const bool used) {
+      auto db = mfront::MFrontDatabase{};
+      db.loadIndex(f);
+      db.analyseLibrary(l);
+      const auto& epts = db.getEntryPoints();
+      if (used) {
+        TFEL_TESTS_ASSERT(epts.size() == 1u);
+      } else {
+        TFEL_TESTS_ASSERT(areEqual(epts, reference.getEntryPoints()));
+      }
+    };
+    writeFakeIndex(f, l);
+    check(true);
+    writeFakeIndex(f, l, 1, 0);
+    check(false);
+    writeFakeIndex(f, l, 0, 1);
+    check(false);
+    // modification of the library after the generation of the index
+    writeFakeIndex(f, l);
+    fs::last_write_time(l, fs::last_write_time(l) + std::chrono::seconds(10));
+    check(false);
+  }  // end of test2
+  //! \brief save and load an index. Libraries which were not analysed are
+  //! removed from the index
+  void test3() {
+    const auto l = copyLibrary("MFrontDatabaseTest3");
+    const auto l2 = copyLibrary("MFrontDatabaseTest3b");
+    const auto f = std::string{directory} + "/test3.idx";
+    const auto f2 = std::string{directory} + "/test3b.idx";
+    auto db = mfront::MFrontDatabase{};
+    db.analyseLibraries({l, l2});
+    db.saveIndex(f);
+    TFEL_TESTS_ASSERT(readFile(f).find(l2) != std::string::npos);
+    auto db2 = mfront::MFrontDatabase{};
+    db2.loadIndex(f);
+    db2.analyseLibrary(l);
+    auto db3 = mfront::MFrontDatabase{};
+    db3.analyseLibrary(l);
+    TFEL_TESTS_ASSERT(!db2.getEntryPoints().empty());
+    TFEL_TESTS_ASSERT(areEqual(db2.getEntryPoints(), db3.getEntryPoints()));
+    // only l was analysed by db2
+    db2.saveIndex(f2);
+    const auto c = readFile(f2);
+    TFEL_TESTS_ASSERT(c.find(l) != std::string::npos);
+    TFEL_TESTS_ASSERT(c.find(l2) == std::string::npos);
+    // the saved index is usable
+    auto db4 = mfront::MFrontDatabase{};
+    db4.loadIndex(f2);
+    db4.analyseLibrary(l);
+    TFEL_TESTS_ASSERT(areEqual(db4.getEntryPoints(), db3.getEntryPoints()));
+  }  // end of test3
+  //! \brief corrupted indexes
+  void test4() {
+    const auto f = std::string{directory} + "/test4.idx";
+    auto write = [&f](const char* const c) {
+      std::ofstream out(f);
+      out << c;
+    };
+    auto load = [&f] {
+      auto db = mfront::MFrontDatabase{};
+      db.loadIndex(f);
+    };
+    // missing file and index generated by another version: ignored
+    load();
+    write("MFrontDatabaseIndex 0\nlibrary\tlib.so\n");
+    load();
+    // invalid records
+    write("MFrontDatabaseIndex 1\nlibrary\tlib.so\t12\n");
+    TFEL_TESTS_CHECK_THROW(load(), std::runtime_error);
+    write("MFrontDatabaseIndex 1\nlibrary\tlib.so\tabc\t12\n");
+    TFEL_TESTS_CHECK_THROW(load(), std::runtime_error);
+    write(
+        "MFrontDatabaseIndex 1\n"
+        "entry_point\tbehaviour\tA\tA.mfront\tM\tgeneric\n");
+    TFEL_TESTS_CHECK_THROW(load(), std::runtime_error);
+    write(
+        "MFrontDatabaseIndex 1\n"
+        "library\tlib.so\t12\t12\n"
+        "entry_point\tunknown\tA\tA.mfront\tM\tgeneric\n");
+    TFEL_TESTS_CHECK_THROW(load(), std::runtime_error);
+    write("MFrontDatabaseIndex 1\nsomething\n");
+    TFEL_TESTS_CHECK_THROW(load(), std::runtime_error);
+  }  // end of test4
+  //! \brief parallel analysis keeps the order of the libraries
+  void test5() {
+    auto libraries = std::vector<std::string>{};
+    for (const auto& n : {"A", "B", "C"}) {
+      libraries.push_back(copyLibrary(std::string{"MFrontDatabaseTest5"} + n));
+    }
+    auto db = mfront::MFrontDatabase{};
+    db.analyseLibraries(libraries);
+    for (const auto nt : {std::size_t{2}, std::size_t{4}, std::size_t{0}}) {
+      auto db2 = mfront::MFrontDatabase{};
+      db2.analyseLibraries(libraries, nt);
+      TFEL_TESTS_ASSERT(areEqual(db.getEntryPoints(), db2.getEntryPoints()));
+    }
+    // the entry points are sorted by library
+    const auto& epts = db.getEntryPoints();
+    auto pl = libraries.begin();
+    for (const auto& e : epts) {
+      while ((pl != libraries.end()) && (*pl != e.library)) {
+        ++pl;
+      }
+      TFEL_TESTS_ASSERT(pl != libraries.end());
+    }
+  }  // end of test5
+  //! \brief literal filters and regular expressions give the same results
+  void test6() {
+    using Query = mfront::MFrontDatabase::Query;
+    auto db = mfront::MFrontDatabase{};
+    db.analyseLibrary(library);
+    const auto& epts = db.getEntryPoints();
+    TFEL_TESTS_ASSERT(!epts.empty());
+    if (epts.empty()) {
+      return;
+    }
+    auto to_upper = [](std::string s) {
+      for (auto& c : s) {
+        c = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+      }
+      return s;
+    };
+    auto check = [this, &db](const Query& q1, const Query& q2) {
+      const auto r1 = db.getEntryPoints(q1);
+      TFEL_TESTS_ASSERT(!r1.empty());
+      TFEL_TESTS_ASSERT(areEqual(r1, db.getEntryPoints(q2)));
+    };
+    const auto& e = epts.back();
+    // names
+    auto q1 = Query{};
+    q1.name_filter = e.name;
+    auto q2 = Query{};
+    q2.name_filter = "(" + e.name + ")";
+    check(q1, q2);
+    // lookups are case insensitive
+    q2.name_filter = to_upper(e.name);
+    check(q1, q2);
+    // interfaces
+    q1 = Query{};
+    q1.interface_filter = e.interface;
+    q2 = Query{};
+    q2.interface_filter = e.interface.substr(0, 1) + ".*";
+    check(q1, q2);
+    // materials and types
+    if (!e.material.empty()) {
+      q1 = Query{};
+      q1.material_filter = e.material;
+      q1.type = e.type;
+      q2 = Query{};
+      q2.material_filter = "(" + e.material + ")";
+      q2.type = e.type;
+      check(q1, q2);
+    }
+    // combination of filters
+    q1 = Query{};
+    q1.name_filter = e.name;
+    q1.interface_filter = e.interface;
+    q2 = Query{};
+    q2.name_filter = e.name + "|NotAName";
+    q2.interface_filter = "(" + e.interface + ")";
+    check(q1, q2);
+    // unknown names
+    q1 = Query{};
+    q1.name_filter = "NotAName";
+    TFEL_TESTS_ASSERT(db.getEntryPoints(q1).empty());
+  }  // end of test6
+};
+
+TFEL_TESTS_GENERATE_PROXY(MFrontDatabaseTest, "MFrontDatabaseTest");
+
+int main(const int argc, const char* const* const argv) {
+  if (argc != 2) {
+    std::cerr << "MFrontDatabaseTest: invalid number of arguments\n";
+    return EXIT_FAILURE;
+  }
+  library = argv[1];
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("MFrontDatabaseTest.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}  // end of main
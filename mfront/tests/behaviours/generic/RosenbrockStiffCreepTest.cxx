@@ -0,0 +1,155 @@
+/*!
+ * \file   mfront/tests/behaviours/generic/RosenbrockStiffCreepTest.cxx
+ * \brief  This test checks that the `ros2` algorithm requires less
+ * evaluations of the derivatives than the `rk54` algorithm on a stiff creep
+ * problem and that both algorithms give the same results.
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright Copyright (C) 2006-2025 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <cmath>
+#include <array>
+#include <vector>
+#include <string>
+#include <cstdlib>
+#include <iostream>
+#include <algorithm>
+#include "TFEL/Raise.hxx"
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+#include "TFEL/System/ExternalLibraryManager.hxx"
+#include "MFront/GenericBehaviour/BehaviourData.h"
+
+//! \brief path to the library
+static std::string library;
+
+struct RosenbrockStiffCreepTest final : public tfel::tests::TestCase {
+  RosenbrockStiffCreepTest()
+      : tfel::tests::TestCase("MFront/GenericBehaviour",
+                              "RosenbrockStiffCreepTest") {
+  }  // end of RosenbrockStiffCreepTest
+  tfel::tests::TestResult execute() override {
+    const auto [s_rk54, n_rk54] = this->integrate("StiffNorton_rk54");
+    const auto [s_ros2, n_ros2] = this->integrate("StiffNorton_ros2");
+    std::cout << "number of evaluations of the derivatives: " << n_rk54
+              << " (rk54), " << n_ros2 << " (ros2)\n";
+    TFEL_TESTS_ASSERT(n_ros2 < n_rk54);
+    for (std::size_t i = 0; i != 6; ++i) {
+      TFEL_TESTS_ASSERT(std::abs(s_ros2[i] - s_rk54[i]) < seps);
+    }
+    return this->result;
+  }  // end of execute
+
+ private:
+  /*!
+   * \brief integrate the given behaviour under a constant deviatoric
+   * strain rate
+   * \return the final stress and the number of evaluations of the
+   * derivatives
+   * \param[in] b: behaviour
+   */
+  std::pair<std::array<double, 6>, double> integrate(
+      const std::string& b) const {
+    using namespace tfel::system;
+    auto& elm = ExternalLibraryManager::getExternalLibraryManager();
+    const auto h = std::string{"Tridimensional"};
+    const auto f = elm.getGenericBehaviourFunction(library, b + "_" + h);
+    // material properties
+    const auto mp_names = elm.getUMATMaterialPropertiesNames(library, b, h);
+    auto mps = std::vector<double>{};
+    for (const auto& mp : mp_names) {
+      mps.push_back(mp == "YoungModulus" ? 150e9 : 0.3);
+    }
+    // internal state variables and position of the number of evaluations
+    // of the derivatives
+    const auto isvs_names =
+        elm.getUMATInternalStateVariablesNames(library, b, h);
+    const auto isvs_types =
+        elm.getUMATInternalStateVariablesTypes(library, b, h);
+    auto nisvs = std::size_t{};
+    auto pos = std::size_t{};
+    for (std::size_t i = 0; i != isvs_names.size(); ++i) {
+      if (isvs_names[i] == "NumberOfDerivativesEvaluations") {
+        pos = nisvs;
+      }
+      nisvs += (isvs_types[i] == 0) ? 1 : 6;
+    }
+    // external state variables
+    const auto nesvs =
+        1 + elm.getUMATExternalStateVariablesNames(library, b, h).size();
+    const auto esvs = std::vector<double>(nesvs, 293.15);
+    auto e0 = std::array<double, 6>{};
+    auto e1 = std::array<double, 6>{};
+    auto s0 = std::array<double, 6>{};
+    auto s1 = std::array<double, 6>{};
+    auto isvs0 = std::vector<double>(nisvs, 0);
+    auto isvs1 = std::vector<double>(nisvs, 0);
+    auto K = std::array<double, 36>{};
+    for (std::size_t i = 0; i != n; ++i) {
+      const auto e = de * dt * static_cast<double>(i + 1);
+      e1 = {e, -e / 2, -e / 2, 0, 0, 0};
+      auto rdt = double{1};
+      K[0] = 0;
+      auto d = mfront_gb_BehaviourData{};
+      d.error_message = nullptr;
+      d.dt = dt;
+      d.K = K.data();
+      d.rdt = &rdt;
+      d.speed_of_sound = nullptr;
+      d.s0.gradients = e0.data();
+      d.s0.thermodynamic_forces = s0.data();
+      d.s0.mass_density = nullptr;
+      d.s0.material_properties = mps.data();
+      d.s0.internal_state_variables = isvs0.data();
+      d.s0.stored_energy = nullptr;
+      d.s0.dissipated_energy = nullptr;
+      d.s0.external_state_variables = esvs.data();
+      d.s1.gradients = e1.data();
+      d.s1.thermodynamic_forces = s1.data();
+      d.s1.mass_density = nullptr;
+      d.s1.material_properties = mps.data();
+      d.s1.internal_state_variables = isvs1.data();
+      d.s1.stored_energy = nullptr;
+      d.s1.dissipated_energy = nullptr;
+      d.s1.external_state_variables = esvs.data();
+      tfel::raise_if(f(&d) != 1,
+                     "RosenbrockStiffCreepTest::integrate: "
+                     "integration of behaviour '" +
+                         b + "' failed");
+      e0 = e1;
+      s0 = s1;
+      isvs0 = isvs1;
+    }
+    return {s1, isvs1[pos]};
+  }  // end of integrate
+  //! \brief number of time steps
+  static constexpr std::size_t n = 10;
+  //! \brief time step
+  static constexpr double dt = 10;
+  //! \brief imposed strain rate
+  static constexpr double de = 1e-4;
+  //! \brief criterion used to compare stresses
+  static constexpr double seps = 1e2;
+};
+
+TFEL_TESTS_GENERATE_PROXY(RosenbrockStiffCreepTest,
+                          "RosenbrockStiffCreepTest");
+
+int main(const int argc, const char* const* const argv) {
+  if (argc != 2) {
+    std::cerr << "RosenbrockStiffCreepTest: invalid number of arguments\n";
+    return EXIT_FAILURE;
+  }
+  library = argv[1];
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("RosenbrockStiffCreepTest.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}  // end of main
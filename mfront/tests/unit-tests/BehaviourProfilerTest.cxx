@@ -0,0 +1,169 @@
+/*!
+ * \file   BehaviourProfilerTest.cxx
+ * \brief  This test checks that the measures of timers running in distinct
+ * threads are merged and written in the file selected by the
+ * `MFRONT_PROFILING_OUTPUT` environment variable.
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright Copyright (C) 2006-2025 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif /* NDEBUG */
+
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <numeric>
+#include <algorithm>
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+#include "MFront/BehaviourProfiler.hxx"
+
+struct BehaviourProfilerTest final : public tfel::tests::TestCase {
+  BehaviourProfilerTest()
+      : tfel::tests::TestCase("MFront", "BehaviourProfilerTest") {
+  }  // end of BehaviourProfilerTest
+
+  tfel::tests::TestResult execute() override {
+#if !(defined _WIN32 || defined _WIN64)
+    this->test1();
+    this->test2("BehaviourProfilerTest-{behaviour}.json",
+                "BehaviourProfilerTest-Test2.json");
+    this->test2("BehaviourProfilerTest-{behaviour}.csv",
+                "BehaviourProfilerTest-Test2.csv");
+#endif
+    return this->result;
+  }
+
+ private:
+  //! \brief number of threads
+  static constexpr std::intmax_t nthreads = 4;
+  //! \brief number of measures per thread
+  static constexpr std::intmax_t nmeasures = 1000;
+  /*!
+   * \brief run `nmeasures` timers on the `FLOWRULE` code block and
+   * `nmeasures / 2` timers on the `COMPUTEDERIVATIVE` code block in each
+   * thread
+   * \param[in] p: profiler
+   */
+  static void profile(mfront::BehaviourProfiler& p) {
+    using Timer = mfront::BehaviourProfiler::Timer;
+    auto threads = std::vector<std::thread>{};
+    for (std::intmax_t i = 0; i != nthreads; ++i) {
+      threads.emplace_back([&p] {
+        for (std::intmax_t j = 0; j != nmeasures; ++j) {
+          Timer t(p, mfront::BehaviourProfiler::FLOWRULE);
+          if (j % 2 == 0) {
+            Timer t2(p, mfront::BehaviourProfiler::COMPUTEDERIVATIVE);
+          }
+        }
+      });
+    }
+    for (auto& t : threads) {
+      t.join();
+    }
+  }  // end of profile
+  //! \brief check the merged measures
+  void test1() {
+    using mfront::BehaviourProfiler;
+    ::unsetenv("MFRONT_PROFILING_OUTPUT");
+    BehaviourProfiler p("Test1");
+    profile(p);
+    const auto measures = p.getMeasures();
+    const auto& m1 = measures[BehaviourProfiler::FLOWRULE];
+    const auto& m2 = measures[BehaviourProfiler::COMPUTEDERIVATIVE];
+    TFEL_TESTS_ASSERT(m1.count == nthreads * nmeasures);
+    TFEL_TESTS_ASSERT(m2.count == nthreads * nmeasures / 2);
+    for (const auto& m : {m1, m2}) {
+      TFEL_TESTS_ASSERT(m.minimum <= m.maximum);
+      TFEL_TESTS_ASSERT(m.total >= m.count * m.minimum);
+      TFEL_TESTS_ASSERT(m.total <= m.count * m.maximum);
+      TFEL_TESTS_ASSERT(std::accumulate(m.histogram.begin(),
+                                        m.histogram.end(),
+                                        std::intmax_t{}) == m.count);
+    }
+    // code blocks which were not profiled
+    TFEL_TESTS_ASSERT(measures[BehaviourProfiler::INTEGRATOR].count == 0);
+    TFEL_TESTS_ASSERT(measures[BehaviourProfiler::TOTALTIME].count == 0);
+  }  // end of test1
+  /*!
+   * \brief check the file written when the profiler is destroyed
+   * \param[in] e: value of the `MFRONT_PROFILING_OUTPUT` variable
+   * \param[in] f: expected file name
+   */
+  void test2(const std::string& e, const std::string& f) {
+    using mfront::BehaviourProfiler;
+    std::remove(f.c_str());
+    ::setenv("MFRONT_PROFILING_OUTPUT", e.c_str(), 1);
+    {
+      BehaviourProfiler p("Test2");
+      profile(p);
+    }
+    ::unsetenv("MFRONT_PROFILING_OUTPUT");
+    std::ifstream in(f);
+    TFEL_TESTS_ASSERT(in.is_open());
+    auto lines = std::vector<std::string>{};
+    for (auto l = std::string{}; std::getline(in, l);) {
+      lines.push_back(l);
+    }
+    const auto c1 = std::to_string(nthreads * nmeasures);
+    const auto c2 = std::to_string(nthreads * nmeasures / 2);
+    if (f.ends_with(".json")) {
+      TFEL_TESTS_ASSERT(lines.size() == 7u);
+      if (lines.size() != 7u) {
+        return;
+      }
+      TFEL_TESTS_ASSERT(lines[0] == "{");
+      TFEL_TESTS_ASSERT(lines[1] == "  \"behaviour\": \"Test2\",");
+      TFEL_TESTS_ASSERT(lines[2] == "  \"code_blocks\": [");
+      TFEL_TESTS_ASSERT(lines[3].starts_with(
+          "    {\"name\": \"FlowRule\", \"count\": " + c1 + ", "));
+      TFEL_TESTS_ASSERT(lines[4].starts_with(
+          "    {\"name\": \"Integrator::ComputeDerivative\", "
+          "\"count\": " +
+          c2 + ", "));
+      TFEL_TESTS_ASSERT(lines[5] == "  ]");
+      TFEL_TESTS_ASSERT(lines[6] == "}");
+    } else {
+      TFEL_TESTS_ASSERT(lines.size() == 3u);
+      if (lines.size() != 3u) {
+        return;
+      }
+      TFEL_TESTS_ASSERT(lines[0].starts_with("code_block,count,total,min,max,"
+                                             "bucket0,"));
+      TFEL_TESTS_ASSERT(lines[1].starts_with("FlowRule," + c1 + ","));
+      TFEL_TESTS_ASSERT(
+          lines[2].starts_with("Integrator::ComputeDerivative," + c2 + ","));
+      // number of columns
+      for (const auto& l : lines) {
+        TFEL_TESTS_ASSERT(
+            static_cast<std::size_t>(std::count(l.begin(), l.end(), ',')) ==
+            4 + BehaviourProfiler::number_of_histogram_buckets);
+      }
+    }
+  }  // end of test2
+};
+
+TFEL_TESTS_GENERATE_PROXY(BehaviourProfilerTest, "BehaviourProfilerTest");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("BehaviourProfilerTest.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}  // end of main
@@ -18,6 +18,7 @@
 
 #include "TFEL/Math/vector.hxx"
 #include "TFEL/Math/matrix.hxx"
+#include "TFEL/Math/LU/BorderedBandedMatrix.hxx"
 #include "TFEL/Math/General/ConstExprMathFunctions.hxx"
 #include "MTest/Types.hxx"
 #include "MTest/SolverOptions.hxx"
@@ -28,12 +29,16 @@ namespace mtest {
   // forward declaration
   struct Behaviour;
   // forward declaration
+  struct CurrentState;
+  // forward declaration
   struct StructureCurrentState;
 
   /*!
    * \brief structure describing a quadratic element for pipes
    */
   struct PipeQuadraticElement {
+    //! \brief number of Gauss points
+    static constexpr unsigned short number_of_gauss_points = 3;
     // absolute value of the Gauss points position in the reference
     // element
     static constexpr real abs_pg =
@@ -98,9 +103,12 @@ namespace mtest {
      * \param[in]  dt:  time increment
      * \param[in]  mt:  stiffness matrix type
      * \param[in]  i:   element number
+     * \tparam MatrixType: type of the stiffness matrix, either
+     * `tfel::math::matrix<real>` or `tfel::math::BorderedBandedMatrix<real>`
      */
+    template <typename MatrixType>
     static std::pair<bool, real> updateStiffnessMatrixAndInnerForces(
-        tfel::math::matrix<real>&,
+        MatrixType&,
         tfel::math::vector<real>&,
         StructureCurrentState&,
         const Behaviour&,
@@ -109,6 +117,29 @@ namespace mtest {
         const real,
         const StiffnessMatrixType,
         const size_t);
+    /*!
+     * \brief add the contribution of the given Gauss point to the stiffness
+     * matrix and to the inner forces
+     * \param[out] k:  stiffness matrix
+     * \param[out] r:  residual
+     * \param[in]  s:  state of the Gauss point after the behaviour
+     * integration
+     * \param[in]  bk: tangent operator computed by the behaviour
+     * \param[in]  m:  pipe mesh
+     * \param[in]  mt: stiffness matrix type
+     * \param[in]  i:  element number
+     * \param[in]  g:  Gauss point number
+     * \tparam MatrixType: type of the stiffness matrix
+     */
+    template <typename MatrixType>
+    static void addGaussPointContribution(MatrixType&,
+                                          tfel::math::vector<real>&,
+                                          const CurrentState&,
+                                          const tfel::math::matrix<real>&,
+                                          const PipeMesh&,
+                                          const StiffnessMatrixType,
+                                          const size_t,
+                                          const unsigned short);
   };  // end of struct PipeQuadraticElement
 
 }  // end of namespace mtest
@@ -14,6 +14,7 @@
 #ifndef LIB_MTEST_PIPETEST_HXX
 #define LIB_MTEST_PIPETEST_HXX
 
+#include <memory>
 #include <string>
 #include <vector>
 #include "TFEL/Math/vector.hxx"
@@ -29,6 +30,11 @@ namespace tfel::utilities {
   struct TextData;
 }  // namespace tfel::utilities
 
+namespace tfel::system {
+  // forward declaration
+  struct ThreadPool;
+}  // namespace tfel::system
+
 namespace mtest {
 
   // forward declarations
@@ -79,6 +85,20 @@ namespace mtest {
                                         * optimizing material parameters.
                                         */
     };                                 // end of FailurePolicy
+    //! \brief linear solver used to solve the equilibrium equations
+    enum LinearSolver {
+      DENSELINEARSOLVER, /*!<
+                          * \brief LU decomposition of the dense stiffness
+                          * matrix. This solver is mostly useful for
+                          * validation purposes.
+                          */
+      BANDEDLINEARSOLVER /*!<
+                          * \brief LU decomposition taking into account that
+                          * the stiffness matrix is banded, except for the
+                          * rows and columns associated with the axial
+                          * strain.
+                          */
+    };                   // end of LinearSolver
     //! \brief base class for tests
     struct UTest {
       /*!
@@ -258,6 +278,18 @@ namespace mtest {
         const real,
         const real,
         const StiffnessMatrixType) const override;
+    /*!
+     * \brief compute the stiffness matrix and the residual. If the banded
+     * linear solver is used, the stiffness matrix is directly assembled in
+     * the bordered banded matrix of the workspace.
+     */
+    [[nodiscard]] std::pair<bool, real>
+    computeStiffnessMatrixAndResidualInWorkSpace(
+        StudyCurrentState&,
+        SolverWorkSpace&,
+        const real,
+        const real,
+        const StiffnessMatrixType) const override;
     [[nodiscard]] real getErrorNorm(
         const tfel::math::vector<real>&) const override;
     [[nodiscard]] bool checkConvergence(StudyCurrentState&,
@@ -279,6 +311,10 @@ namespace mtest {
                                   const SolverOptions&,
                                   const real,
                                   const real) const override;
+    void solveLinearSystem(SolverWorkSpace&,
+                           tfel::math::vector<real>&) const override;
+    void backSubstitute(SolverWorkSpace&,
+                        tfel::math::vector<real>&) const override;
     [[nodiscard]] bool postConvergence(StudyCurrentState&,
                                        const real,
                                        const real,
@@ -444,6 +480,20 @@ namespace mtest {
      * \param[in] p: failure policy
      */
     void setFailurePolicy(const FailurePolicy);
+    /*!
+     * \brief set the linear solver
+     * \param[in] s: linear solver
+     */
+    void setLinearSolver(const LinearSolver);
+    /*!
+     * \brief set the number of threads used to integrate the behaviour
+     * over the elements.
+     * \param[in] n: number of threads
+     *
+     * \note the behaviour must be thread-safe.
+     * \note the results do not depend on the number of threads.
+     */
+    void setNumberOfThreads(const size_type);
     /*!
      * \brief change the way a failure is treated
      * \param[in] library: library path
@@ -475,6 +525,25 @@ namespace mtest {
    private:
     //! \brief a simple alias
     using ModellingHypothesis = tfel::material::ModellingHypothesis;
+    /*!
+     * \brief compute the stiffness matrix and the residual
+     * \tparam MatrixType: type of the stiffness matrix, either
+     * `tfel::math::matrix<real>` or `tfel::math::BorderedBandedMatrix<real>`
+     * \param[out] s: current structure state
+     * \param[out] k: stiffness matrix
+     * \param[out] r: residual
+     * \param[in]  t: current time
+     * \param[in]  dt: time increment
+     * \param[in]  mt: type of tangent operator
+     */
+    template <typename MatrixType>
+    std::pair<bool, real> assembleStiffnessMatrixAndResidual(
+        StudyCurrentState&,
+        MatrixType&,
+        tfel::math::vector<real>&,
+        const real,
+        const real,
+        const StiffnessMatrixType) const;
     /*!
      * \brief set the position of the Gauss point in the evolution
      * manager
@@ -486,9 +555,28 @@ namespace mtest {
     struct AdditionalOutput {
       //! \brief description
       std::string d;
+      //! \brief name of the column in binary output files
+      std::string n;
       //! \brief functor
-      std::function<void(std::ostream&, const StudyCurrentState&)> f;
+      std::function<real(const StudyCurrentState&)> f;
+    };
+    //! \brief description of a column of the output file
+    struct OutputColumn {
+      //! \brief name of the column in binary output files
+      std::string name;
+      //! \brief description of the column in text output files
+      std::string description;
     };
+    //! \return the columns of the output file
+    [[nodiscard]] std::vector<OutputColumn> getOutputColumns() const;
+    /*!
+     * \return the values written in the output file, in the order of the
+     * columns returned by `getOutputColumns`
+     * \param[in] t: time
+     * \param[in] s: current state
+     */
+    [[nodiscard]] std::vector<real> getOutputValues(
+        const real, const StudyCurrentState&) const;
     //! \brief additional outputs
     std::vector<AdditionalOutput> aoutputs;
     //! \brief failure criteria
@@ -535,6 +623,10 @@ namespace mtest {
     AxialLoading al = DEFAULTAXIALLOADING;
     //! \brief failure policy
     FailurePolicy failure_policy = REPORTONLY;
+    //! \brief linear solver
+    LinearSolver linear_solver = BANDEDLINEARSOLVER;
+    //! \brief pool of threads used to integrate the behaviour
+    std::unique_ptr<tfel::system::ThreadPool> thread_pool;
     //! \brief element type
     //! \brief small strain hypothesis
     bool hpp = false;
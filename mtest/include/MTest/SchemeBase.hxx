@@ -21,6 +21,7 @@
 
 #include "TFEL/Material/ModellingHypothesis.hxx"
 #include "TFEL/Material/MechanicalBehaviour.hxx"
+#include "TFEL/Utilities/BinaryDataWriter.hxx"
 
 #include "MTest/Types.hxx"
 #include "MTest/Config.hxx"
@@ -39,6 +40,12 @@ namespace mtest {
       USERDEFINEDTIMES,
       EVERYPERIOD
     };  // end of enum OutputFrequency
+    //! \brief format of the output file
+    enum OutputFileFormat {
+      UNSPECIFIEDOUTPUTFILEFORMAT,
+      TEXTOUTPUTFILEFORMAT,
+      BINARYOUTPUTFILEFORMAT
+    };  // end of enum OutputFileFormat
     //! a simple alias
     using ModellingHypothesis = tfel::material::ModellingHypothesis;
     //! a simple alias
@@ -75,11 +82,23 @@ namespace mtest {
     virtual void setOutputFileName(const std::string&);
     //! \return true if the output file name has been defined
     virtual bool isOutputFileNameDefined() const;
+    //! \return the output file name
+    virtual std::string getOutputFileName() const;
     /*!
      * \brief set the output file precision
      * \param[in] p : precision
      */
     virtual void setOutputFilePrecision(const unsigned int);
+    /*!
+     * \brief set the output file format
+     * \param[in] f : format (`text` or `binary`)
+     *
+     * Binary files are written by the `BinaryDataWriter` class and can be
+     * read by the `TextData` class.
+     */
+    virtual void setOutputFileFormat(const std::string&);
+    //! \return true if the output file format has been defined
+    virtual bool isOutputFileFormatDefined() const;
     /*!
      * \brief set the residual file
      * \param[in] f : file name
@@ -87,6 +106,15 @@ namespace mtest {
     virtual void setResidualFileName(const std::string&);
     //! \return true if the residual file name has been defined
     virtual bool isResidualFileNameDefined() const;
+    //! \return the residual file name
+    virtual std::string getResidualFileName() const;
+    /*!
+     * \brief append a suffix to the names of the output file and of the
+     * residual file, if defined. The suffix is inserted before the
+     * extension of the file names.
+     * \param[in] s: suffix
+     */
+    virtual void appendSuffixToOutputFileNames(const std::string&);
     /*!
      * \brief set the residual file
      * \param[in] f : file name
@@ -96,6 +124,19 @@ namespace mtest {
     virtual bool isXMLOutputFileNameDefined() const;
     //! \return true if the residual file name has been defined
     virtual std::string getXMLOutputFileName() const;
+    /*!
+     * \return true if the scheme changes the values of some parameters of
+     * the external libraries it uses.
+     */
+    virtual bool definesParameters() const;
+    /*!
+     * \brief set again the parameters defined by the scheme.
+     *
+     * The parameters are stored in the external libraries and are thus
+     * shared by all the schemes using the same library. This method allows
+     * to restore the values expected by the scheme before executing it.
+     */
+    virtual void applyParameters() const;
     /*!
      * \brief set the residual file precision
      * \param[in] p : precision
@@ -249,6 +290,16 @@ namespace mtest {
      * \param[in] v : variable names
      */
     void declareVariables(const std::vector<std::string>&, const bool);
+    //! \return true if the results are written in a binary file
+    bool useBinaryOutputFile() const;
+    /*!
+     * \brief set the names of the columns of the binary output file and
+     * open it.
+     * \param[in] c : names of the columns
+     */
+    void setBinaryOutputFileColumns(const std::vector<std::string>&);
+    //! \brief write the pending results in the output file
+    void flushOutputFile() const;
     //! declared variable names
     std::vector<std::string> vnames;
     //! initilisation stage
@@ -272,6 +323,12 @@ namespace mtest {
     std::string output;
     //! output file
     mutable std::ofstream out;
+    //! output file format
+    OutputFileFormat output_format = UNSPECIFIEDOUTPUTFILEFORMAT;
+    //! names of the columns of the binary output file
+    std::vector<std::string> binary_output_columns;
+    //! binary output file
+    mutable std::unique_ptr<tfel::utilities::BinaryDataWriter> bout;
     //! residual file name
     std::string residualFileName;
     //! xml file name
@@ -14,6 +14,8 @@
 #ifndef LIB_MTEST_SINGLESTRUCTURESCHEME_HXX
 #define LIB_MTEST_SINGLESTRUCTURESCHEME_HXX
 
+#include <map>
+#include <string>
 #include "TFEL/Utilities/Data.hxx"
 #include "TFEL/Material/OutOfBoundsPolicy.hxx"
 #include "MTest/Config.hxx"
@@ -113,6 +115,8 @@ namespace mtest {
      */
     virtual void setUnsignedIntegerParameter(const std::string&,
                                              const unsigned int);
+    bool definesParameters() const override;
+    void applyParameters() const override;
     /*!
      * \brief set the inital value of a scalar variable
      * \param[in] v : value
@@ -183,6 +187,14 @@ namespace mtest {
     std::vector<real> iv_t0;
     //! \brief handle the computation of thermal expansion
     bool handleThermalExpansion = true;
+
+   private:
+    //! \brief parameters of the behaviour set by the scheme
+    std::map<std::string, double> parameters;
+    //! \brief integer parameters of the behaviour set by the scheme
+    std::map<std::string, int> integer_parameters;
+    //! \brief unsigned integer parameters of the behaviour set by the scheme
+    std::map<std::string, unsigned int> unsigned_integer_parameters;
   };  // end of SingleStructureScheme
 
 }  // end of namespace mtest
@@ -17,6 +17,7 @@
 #include "TFEL/Math/vector.hxx"
 #include "TFEL/Math/matrix.hxx"
 #include "TFEL/Math/LUSolve.hxx"
+#include "TFEL/Math/BorderedBandedLUSolve.hxx"
 
 #include "MTest/Config.hxx"
 #include "MTest/Types.hxx"
@@ -39,6 +40,8 @@ namespace mtest {
     tfel::math::Permutation<size_type> p_lu;
     // temporary vector used by the LUSolve::exe function
     tfel::math::vector<real> x;
+    //! \brief stiffness matrix used by studies relying on a banded solver
+    tfel::math::BorderedBandedMatrix<real> Kb;
   };  // end of struct SolverWorkSpace
 
   /*!
@@ -15,6 +15,7 @@
 #define LIB_MTEST_STRUCTURECURRENTSTATE_HXX
 
 #include <memory>
+#include <cstddef>
 #include <vector>
 #include "TFEL/Math/vector.hxx"
 #include "TFEL/Material/ModellingHypothesis.hxx"
@@ -71,6 +72,14 @@ namespace mtest {
     void setModellingHypothesis(const Hypothesis);
     //! \return the behaviour workspace associated to the current thread.
     BehaviourWorkSpace& getBehaviourWorkSpace() const;
+    /*!
+     * \return the behaviour workspace associated with the given thread.
+     * The workspaces are allocated on demand.
+     * \param[in] i: thread index
+     * \note this method is not thread-safe: the workspaces used by
+     * concurrent threads must be retrieved before launching those threads.
+     */
+    BehaviourWorkSpace& getBehaviourWorkSpace(const std::size_t) const;
     //! \return the behaviour associated to the structure
     const Behaviour& getBehaviour() const;
     /*!
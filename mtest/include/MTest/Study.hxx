@@ -126,6 +126,54 @@ namespace mtest {
                                       const real,
                                       const real,
                                       const StiffnessMatrixType) const = 0;
+    /*!
+     * \brief compute the stiffness matrix and the residual in the storage
+     * of the workspace used by the `solveLinearSystem` method.
+     *
+     * The default implementation calls the
+     * `computeStiffnessMatrixAndResidual` method with the dense stiffness
+     * matrix and the residual of the workspace.
+     *
+     * \return a pair containing a boolean stating if the behaviour
+     * integration succeeded and a scaling factor for the time step.
+     * \param[out] s: current structure state
+     * \param[out] wk: solver workspace
+     * \param[in]  t:   current time
+     * \param[in]  dt:  time increment
+     * \param[in]  smt: type of tangent operator
+     */
+    [[nodiscard]] virtual std::pair<bool, real>
+    computeStiffnessMatrixAndResidualInWorkSpace(
+        StudyCurrentState&,
+        SolverWorkSpace&,
+        const real,
+        const real,
+        const StiffnessMatrixType) const;
+    /*!
+     * \brief solve the linear system \f$K\,x=b\f$ where \f$K\f$ is the
+     * stiffness matrix stored in the workspace.
+     *
+     * The decomposition of the stiffness matrix is kept in the workspace so
+     * that the `backSubstitute` method can be used to solve other linear
+     * systems with the same matrix.
+     *
+     * The default implementation relies on the LU decomposition of the dense
+     * stiffness matrix, which is overwritten by its decomposition.
+     *
+     * \param[in,out] wk: solver workspace
+     * \param[in,out] x: right hand side on input, solution on output
+     */
+    virtual void solveLinearSystem(SolverWorkSpace&,
+                                   tfel::math::vector<real>&) const;
+    /*!
+     * \brief solve the linear system \f$K\,x=b\f$ using the
+     * decomposition of the stiffness matrix computed by the last call to the
+     * `solveLinearSystem` method.
+     * \param[in,out] wk: solver workspace
+     * \param[in,out] x: right hand side on input, solution on output
+     */
+    virtual void backSubstitute(SolverWorkSpace&,
+                                tfel::math::vector<real>&) const;
     /*!
      * \param[in] : du unknows increment difference between two iterations
      */
@@ -61,8 +61,8 @@ namespace mtest {
         }
       }
     }
-    const auto r =
-        s.computeStiffnessMatrixAndResidual(scs, wk.K, wk.r, t, dt, o.ktype);
+    const auto r = s.computeStiffnessMatrixAndResidualInWorkSpace(
+        scs, wk, t, dt, o.ktype);
     if (!r.first) {
       return r;
     }
@@ -123,7 +123,7 @@ namespace mtest {
               .first) {
         wk.du = wk.r;
         setRoundingMode();
-        LUSolve::exe(wk.K, wk.du, wk.x, wk.p_lu);
+        s.solveLinearSystem(wk, wk.du);
         setRoundingMode();
         u1 -= wk.du;
       } else {
@@ -153,8 +153,8 @@ namespace mtest {
       ++iter;
       nep2 = nep;
       nep = ne;
-      auto r =
-          s.computeStiffnessMatrixAndResidual(scs, wk.K, wk.r, t, dt, o.ktype);
+      auto r = s.computeStiffnessMatrixAndResidualInWorkSpace(scs, wk, t, dt,
+                                                              o.ktype);
       if (!r.first) {
         return r;
       }
@@ -181,7 +181,7 @@ namespace mtest {
       }
       wk.du = wk.r;
       setRoundingMode();
-      LUSolve::exe(wk.K, wk.du, wk.x, wk.p_lu);
+      s.solveLinearSystem(wk, wk.du);
       setRoundingMode();
       u1 -= wk.du;
       converged =
@@ -13,6 +13,7 @@
 
 #include <map>
 #include <cmath>
+#include <span>
 #include <string>
 #include <vector>
 #include <memory>
@@ -297,7 +298,34 @@ namespace mtest {
     unsigned short cnbr = 2;
     const char* dvn;
     const char* thn;
-    if (this->out) {
+    if (this->useBinaryOutputFile()) {
+      auto c = std::vector<std::string>{"time"};
+      const auto gc = this->b->getGradientsComponents();
+      c.insert(c.end(), gc.begin(), gc.end());
+      if (this->shallPrintLagrangeMultipliers) {
+        auto nc = std::size_t{1};
+        for (const auto& pc : this->constraints) {
+          const auto nlm = pc->getNumberOfLagrangeMultipliers();
+          for (unsigned short i = 0; i != nlm; ++i) {
+            c.push_back("LagrangeMultiplier" + std::to_string(nc) + "_" +
+                        std::to_string(i + 1));
+          }
+          ++nc;
+        }
+      }
+      const auto thc = this->b->getThermodynamicForcesComponents();
+      c.insert(c.end(), thc.begin(), thc.end());
+      const auto ivn = this->b->expandInternalStateVariablesNames();
+      tfel::raise_if(ivn.size() != this->b->getInternalStateVariablesSize(),
+                     "MTest::completeInitialisation : internal error "
+                     "(the number of names given by "
+                     "the mechanical behaviour don't match "
+                     "the number of internal state variables)");
+      c.insert(c.end(), ivn.begin(), ivn.end());
+      c.push_back("StoredEnergy");
+      c.push_back("DissipatedEnergy");
+      this->setBinaryOutputFileColumns(c);
+    } else if (this->out) {
       this->out << "# first column: time\n";
       if (this->b->getBehaviourType() ==
           MechanicalBehaviourBase::STANDARDSTRAINBASEDBEHAVIOUR) {
@@ -528,15 +556,15 @@ namespace mtest {
         ++pt2;
       }
     } catch (std::exception& e) {
-      this->out.flush();
+      this->flushOutputFile();
       report(e.what(), state, false);
       throw;
     } catch (...) {
-      this->out.flush();
+      this->flushOutputFile();
       report(nullptr, state, false);
       throw;
     }
-    this->out.flush();
+    this->flushOutputFile();
     report(nullptr, state, true);
     tfel::tests::TestResult tr;
     for (const auto& t : this->tests) {
@@ -954,7 +982,21 @@ namespace mtest {
     if ((!o) && (this->output_frequency == USERDEFINEDTIMES)) {
       return;
     }
-    if (this->out) {
+    if (this->bout != nullptr) {
+      auto& cs = s.getStructureCurrentState("").istates[0];
+      auto& w = *(this->bout);
+      w.write(t);
+      const auto ng = this->shallPrintLagrangeMultipliers
+                          ? s.u0.size()
+                          : this->b->getGradientsSize();
+      w.write(std::span<const real>(s.u0.data(), ng));
+      w.write(std::span<const real>(cs.s0.data(),
+                                    this->b->getThermodynamicForcesSize()));
+      w.write(std::span<const real>(cs.iv0.data(), cs.iv0.size()));
+      w.write(cs.se0);
+      w.write(cs.de0);
+      w.endLine();
+    } else if (this->out) {
       auto& cs = s.getStructureCurrentState("").istates[0];
       this->out << t << " ";
       if (this->shallPrintLagrangeMultipliers) {
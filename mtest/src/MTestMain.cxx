@@ -13,11 +13,17 @@
 
 #include <cfenv>
 #include <csignal>
+#include <map>
+#include <set>
 #include <regex>
 #include <string>
 #include <vector>
+#include <memory>
 #include <cstdlib>
+#include <algorithm>
+#include <fstream>
 #include <utility>
+#include <optional>
 #include <iostream>
 
 #if defined _WIN32 || defined _WIN64
@@ -42,8 +48,11 @@
 #include "TFEL/Raise.hxx"
 #include "TFEL/Tests/TestManager.hxx"
 #include "TFEL/Tests/XMLTestOutput.hxx"
+#include "TFEL/Utilities/TextData.hxx"
+#include "TFEL/Utilities/BinaryDataWriter.hxx"
 #include "TFEL/Utilities/StringAlgorithms.hxx"
 #include "TFEL/Utilities/ArgumentParserBase.hxx"
+#include "TFEL/System/ThreadPool.hxx"
 
 #if !(defined _WIN32 || defined _WIN64 || defined __CYGWIN__)
 #include "TFEL/System/SignalManager.hxx"
@@ -60,6 +69,59 @@
 
 namespace mtest {
 
+  /*!
+   * \brief a wrapper around a test which allows to execute it in a thread
+   * pool and keeps track of its status.
+   */
+  struct BatchTest final : public tfel::tests::Test {
+    /*!
+     * \brief constructor
+     * \param[in] t: test
+     */
+    explicit BatchTest(std::shared_ptr<SchemeBase> t) noexcept
+        : test(std::move(t)) {}
+    /*!
+     * \brief launch the test in a thread pool. If this method is not
+     * called, the test is executed when the `execute` method is called.
+     * \param[in] p: thread pool
+     */
+    void launch(tfel::system::ThreadPool& p) {
+      this->result = p.addTask([t2 = this->test] { return t2->execute(); });
+    }  // end of launch
+    [[nodiscard]] std::string name() const override {
+      return this->test->name();
+    }  // end of name
+    [[nodiscard]] std::string classname() const override {
+      return this->test->classname();
+    }  // end of classname
+    /*!
+     * \return the result of the test. If the test is executed by a thread
+     * pool, this method waits for its completion. Otherwise, the parameters
+     * defined by the test are set before its execution, since they may have
+     * been modified by the tests read afterwards.
+     */
+    [[nodiscard]] tfel::tests::TestResult execute() override {
+      auto r = [this] {
+        if (this->result.valid()) {
+          return *(this->result.get());
+        }
+        this->test->applyParameters();
+        return this->test->execute();
+      }();
+      this->success = r.success();
+      return r;
+    }  // end of execute
+    //! \brief underlying test
+    const std::shared_ptr<SchemeBase> test;
+    //! \brief status of the test, once executed
+    std::optional<bool> success;
+
+   private:
+    //! \brief result of the test, if executed by a thread pool
+    std::future<tfel::system::ThreadedTaskResult<tfel::tests::TestResult>>
+        result;
+  };  // end of struct BatchTest
+
   struct MTestMain : tfel::utilities::ArgumentParserBase<MTestMain> {
     MTestMain(const int, const char* const* const);
     /*!
@@ -78,7 +140,15 @@ namespace mtest {
     void treatScheme();
     void treatXMLOutput();
     void treatResultFileOutput();
+    //! \brief treat the `--result-file-format` option
+    void treatResultFileFormat();
     void treatResidualFileOutput();
+    //! \brief treat the `--jobs` option
+    void treatJobs();
+    //! \brief treat the `--sweep` option
+    void treatSweep();
+    //! \brief treat the `--consolidated-result-file` option
+    void treatConsolidatedResultFile();
     [[noreturn]] void treatHelpCommandsList();
     [[noreturn]] void treatHelpCommands();
     [[noreturn]] void treatHelpCommand();
@@ -97,12 +167,42 @@ namespace mtest {
      * \brief add a single test and defines the output files
      * \param[in] t: pointer to the test
      * \param[in] n: name of the test
+     * \param[in] s: substitutions used to create the test
+     */
+    void addTest(std::shared_ptr<SchemeBase>,
+                 const std::string&,
+                 const std::map<std::string, std::string>&);
+    /*!
+     * \return a test created from an `mtest` file
+     * \param[in] path: path to the file
+     * \param[in] s: substitutions
      */
-    void addTest(std::shared_ptr<SchemeBase>, const std::string&);
     [[nodiscard]] std::shared_ptr<SchemeBase> createMTestTest(
-        const std::string&);
+        const std::string&, const std::map<std::string, std::string>&);
+    /*!
+     * \return a test created from a `ptest` file
+     * \param[in] path: path to the file
+     * \param[in] s: substitutions
+     */
     [[nodiscard]] std::shared_ptr<SchemeBase> createPTestTest(
-        const std::string&);
+        const std::string&, const std::map<std::string, std::string>&);
+    /*!
+     * \return the sets of substitutions resulting from the sweeps. If no
+     * sweep has been defined, the substitutions given on the command line
+     * are returned.
+     */
+    [[nodiscard]] std::vector<std::map<std::string, std::string>>
+    getSubstitutionsSets() const;
+    //! \brief write the consolidated result file
+    void writeConsolidatedResultFile() const;
+    /*!
+     * \brief launch the tests in a thread pool if more than one job is
+     * allowed.
+     *
+     * The parameters of the behaviours are global: the tests are thus
+     * executed sequentially if one of them defines some parameters.
+     */
+    void launchTests();
     void treatMadnexInputFile(const std::string&);
     void treatStandardInputFile(const std::string&);
 
@@ -125,6 +225,30 @@ namespace mtest {
     std::vector<std::string> ecmds;
     //! \brief substitutions
     std::map<std::string, std::string> substitutions;
+    /*!
+     * \brief substitutions swept over. Each pattern is associated with the
+     * list of its values.
+     */
+    std::vector<std::pair<std::string, std::vector<std::string>>> sweeps;
+    //! \brief description of a test and of the substitutions used
+    struct BatchCase {
+      //! \brief name of the test
+      std::string name;
+      //! \brief test
+      std::shared_ptr<BatchTest> test;
+      //! \brief substitutions
+      std::map<std::string, std::string> substitutions;
+    };
+    //! \brief list of all tests
+    std::vector<BatchCase> cases;
+    //! \brief output and residual files used by the tests
+    std::set<std::string> output_files;
+    //! \brief number of tests executed concurrently
+    tfel::system::ThreadPool::size_type jobs = 1;
+    //! \brief thread pool used to execute the tests concurrently
+    std::unique_ptr<tfel::system::ThreadPool> pool;
+    //! \brief name of the consolidated result file, if any
+    std::string consolidated_result_file;
 #ifdef MTEST_HAVE_MADNEX
     //! \brief material name (only useful for madnex files)
     std::string material;
@@ -137,6 +261,8 @@ namespace mtest {
     bool xml_output = false;
     // generate result file
     bool result_file_output = true;
+    //! \brief format of the result files
+    std::string result_file_format;
     // generate residual file
     bool residual_file_output = false;
   };
@@ -160,9 +286,30 @@ namespace mtest {
     this->registerNewCallBack("--result-file-output",
                               &MTestMain::treatResultFileOutput,
                               "control result output (default yes)", true);
+    this->registerNewCallBack(
+        "--result-file-format", &MTestMain::treatResultFileFormat,
+        "specify the format of the result files, unless defined in the "
+        "input file. Valid values are 'text' (default) and 'binary'. Binary "
+        "files can be read by the TextData class.",
+        true);
     this->registerNewCallBack("--residual-file-output",
                               &MTestMain::treatResidualFileOutput,
                               "control residual output (default no)", true);
+    this->registerNewCallBack(
+        "--jobs", "-j", &MTestMain::treatJobs,
+        "specifies the number of tests to run simultaneously. If no value "
+        "is given, the number of cores is used.",
+        true);
+    this->registerNewCallBack(
+        "--sweep", &MTestMain::treatSweep,
+        "run each input file for a list of values of a substitution "
+        "pattern. The syntax is `--sweep=@Pattern@:value1,value2,...`. If "
+        "this option is repeated, the input files are run for all the "
+        "combinations of values.",
+        true);
+    this->registerNewCallBack(
+        "--consolidated-result-file", &MTestMain::treatConsolidatedResultFile,
+        "gather the results of all tests in the given file", true);
     this->registerNewCallBack(
         "--help-keywords", &MTestMain::treatHelpCommands,
         "display the help of all available commands and exit.");
@@ -373,6 +520,15 @@ namespace mtest {
     }
   }  // end of MTestMain::treatResultFileOutput
 
+  void MTestMain::treatResultFileFormat() {
+    const auto& option = this->currentArgument->getOption();
+    tfel::raise_if((option != "text") && (option != "binary"),
+                   "MTestMain::treatResultFileFormat: "
+                   "invalid format '" +
+                       option + "' (expected 'text' or 'binary')");
+    this->result_file_format = option;
+  }  // end of MTestMain::treatResultFileFormat
+
   void MTestMain::treatResidualFileOutput() {
     if (this->currentArgument->getOption().empty()) {
       this->residual_file_output = true;
@@ -391,6 +547,48 @@ namespace mtest {
     }
   }  // end of MTestMain::treatResidualFileOutput
 
+  void MTestMain::treatJobs() {
+    this->jobs = tfel::utilities::parseNumberOfJobs(
+        "MTestMain::treatJobs", this->currentArgument->getOption());
+  }  // end of MTestMain::treatJobs
+
+  void MTestMain::treatSweep() {
+    const auto& o = this->currentArgument->getOption();
+    auto raise = [&o](const std::string& m) {
+      tfel::raise("MTestMain::treatSweep: " + m + " ('" + o + "')");
+    };
+    if (o.empty()) {
+      raise("no option given");
+    }
+    const auto pos = o.find('@', 1);
+    if ((o[0] != '@') || (pos == std::string::npos) ||
+        (pos + 1 == o.size()) || (o[pos + 1] != ':')) {
+      raise("invalid sweep, expected '@Pattern@:value1,value2,...'");
+    }
+    const auto p = o.substr(0, pos + 1);
+    for (const auto& s : this->sweeps) {
+      if (s.first == p) {
+        raise("multiple sweeps defined for pattern '" + p + "'");
+      }
+    }
+    auto values = tfel::utilities::tokenize(o.substr(pos + 2), ',');
+    if (values.empty()) {
+      raise("no value given");
+    }
+    this->sweeps.push_back({p, std::move(values)});
+  }  // end of MTestMain::treatSweep
+
+  void MTestMain::treatConsolidatedResultFile() {
+    const auto& o = this->currentArgument->getOption();
+    tfel::raise_if(o.empty(),
+                   "MTestMain::treatConsolidatedResultFile: "
+                   "no option given");
+    tfel::raise_if(!this->consolidated_result_file.empty(),
+                   "MTestMain::treatConsolidatedResultFile: "
+                   "consolidated result file already defined");
+    this->consolidated_result_file = o;
+  }  // end of MTestMain::treatConsolidatedResultFile
+
   void MTestMain::treatHelpCommandsList() {
     if ((this->scheme == MTEST) || (this->scheme == DEFAULT)) {
       MTestParser().displayKeyWordsList();
@@ -510,22 +708,133 @@ namespace mtest {
         }
       }
     }
+    this->launchTests();
     auto& tm = tfel::tests::TestManager::getTestManager();
     const auto r = tm.execute();
+    if (!this->consolidated_result_file.empty()) {
+      this->writeConsolidatedResultFile();
+    }
     return r.success() ? EXIT_SUCCESS : EXIT_FAILURE;
   }  // end of execute
 
+  void MTestMain::launchTests() {
+    if ((this->jobs <= 1) || (this->cases.size() <= 1)) {
+      return;
+    }
+    const auto p = std::find_if(
+        this->cases.begin(), this->cases.end(),
+        [](const BatchCase& c) { return c.test->test->definesParameters(); });
+    if (p != this->cases.end()) {
+      if (mfront::getVerboseMode() >= mfront::VERBOSE_LEVEL1) {
+        mfront::getLogStream()
+            << "the tests are executed sequentially since test '" << p->name
+            << "' defines some parameters\n";
+      }
+      return;
+    }
+    this->pool = std::make_unique<tfel::system::ThreadPool>(
+        std::min(this->jobs, this->cases.size()));
+    for (auto& c : this->cases) {
+      c.test->launch(*(this->pool));
+    }
+  }  // end of launchTests
+
+  std::vector<std::map<std::string, std::string>>
+  MTestMain::getSubstitutionsSets() const {
+    auto sets = std::vector<std::map<std::string, std::string>>{
+        this->substitutions};
+    for (const auto& [p, values] : this->sweeps) {
+      tfel::raise_if(this->substitutions.count(p) != 0,
+                     "MTestMain::getSubstitutionsSets: "
+                     "pattern '" +
+                         p +
+                         "' is used both in a substitution "
+                         "and in a sweep");
+      auto nsets = std::vector<std::map<std::string, std::string>>{};
+      nsets.reserve(sets.size() * values.size());
+      for (const auto& s : sets) {
+        for (const auto& v : values) {
+          auto ns = s;
+          ns[p] = v;
+          nsets.push_back(std::move(ns));
+        }
+      }
+      sets = std::move(nsets);
+    }
+    return sets;
+  }  // end of getSubstitutionsSets
+
+  /*!
+   * \brief copy the results of a test in the given stream. Results stored
+   * in the binary format are converted to text.
+   * \param[in,out] out: output stream
+   * \param[in] f: results file
+   */
+  static void writeResults(std::ostream& out, const std::string& f) {
+    using tfel::utilities::TextData;
+    using tfel::utilities::BinaryDataWriter;
+    auto in = std::ifstream(f, std::ios::binary);
+    if (!in) {
+      return;
+    }
+    auto magic = std::string(BinaryDataWriter::magic.size(), '\0');
+    in.read(magic.data(), static_cast<std::streamsize>(magic.size()));
+    if ((!in) || (magic != BinaryDataWriter::magic)) {
+      in.clear();
+      in.seekg(0);
+      out << in.rdbuf();
+      return;
+    }
+    const auto data = TextData(f);
+    const auto& legends = data.getLegends();
+    auto columns = std::vector<std::vector<double>>{};
+    out << '#';
+    for (const auto& l : legends) {
+      out << ' ' << l;
+      columns.push_back(data.getColumn(columns.size() + 1));
+    }
+    out << '\n';
+    const auto p = out.precision(15);
+    for (std::size_t i = 0; i != data.getNumberOfLines(); ++i) {
+      for (const auto& c : columns) {
+        out << c[i] << ' ';
+      }
+      out << '\n';
+    }
+    out.precision(p);
+  }  // end of writeResults
+
+  void MTestMain::writeConsolidatedResultFile() const {
+    auto out = std::ofstream(this->consolidated_result_file);
+    tfel::raise_if(!out,
+                   "MTestMain::writeConsolidatedResultFile: "
+                   "can't open file '" +
+                       this->consolidated_result_file + "'");
+    for (const auto& c : this->cases) {
+      const auto success = c.test->success.value_or(false);
+      out << "# test: " << c.name << '\n';
+      for (const auto& [p, v] : c.substitutions) {
+        out << "# substitution: " << p << " " << v << '\n';
+      }
+      out << "# status: " << (success ? "success" : "failure") << '\n';
+      if (c.test->test->isOutputFileNameDefined()) {
+        writeResults(out, c.test->test->getOutputFileName());
+      }
+      out << "\n\n";
+    }
+  }  // end of writeConsolidatedResultFile
+
   std::shared_ptr<SchemeBase> MTestMain::createMTestTest(
-      const std::string& path) {
+      const std::string& path, const std::map<std::string, std::string>& s) {
     auto t = std::make_shared<MTest>();
-    t->readInputFile(path, this->ecmds, this->substitutions);
+    t->readInputFile(path, this->ecmds, s);
     return t;
   }  // end of createMTestTest
 
   std::shared_ptr<SchemeBase> MTestMain::createPTestTest(
-      const std::string& path) {
+      const std::string& path, const std::map<std::string, std::string>& s) {
     auto t = std::make_shared<PipeTest>();
-    PipeTestParser().execute(*t, path, this->ecmds, this->substitutions);
+    PipeTestParser().execute(*t, path, this->ecmds, s);
     return t;
   }  // end of createPTestTest
 
@@ -551,14 +860,14 @@ namespace mtest {
             "MTestMain::appendTestFromMadnexFile: the scheme specified on the "
             "command line does not match the scheme declared by the test");
       }
-      t = this->createMTestTest(path);
+      t = this->createMTestTest(path, this->substitutions);
     } else if (this->scheme == PTEST) {
       if ((!test_scheme.empty()) && (test_scheme != "ptest")) {
         tfel::raise(
             "MTestMain::appendTestFromMadnexFile: the scheme specified on the "
             "command line does not match the scheme declared by the test");
       }
-      t = this->createPTestTest(path);
+      t = this->createPTestTest(path, this->substitutions);
     } else {
       if (test_scheme.empty()) {
         tfel::raise(
@@ -567,12 +876,12 @@ namespace mtest {
             "line argument when using a madnex file");
       }
       if (test_scheme == "mtest") {
-        t = this->createMTestTest(path);
+        t = this->createMTestTest(path, this->substitutions);
       } else {
-        t = this->createPTestTest(path);
+        t = this->createPTestTest(path, this->substitutions);
       }
     }
-    this->addTest(t, test_name);
+    this->addTest(t, test_name, this->substitutions);
   }    // end of appendTestFromMadnexFile
 #endif /* MADNEX_MTEST_TEST_SUPPORT */
 
@@ -670,38 +979,65 @@ namespace mtest {
                    "MTestMain::treatStandardInputFile: "
                    "invalid input file name '" +
                        i + "'");
-    if (this->scheme == MTEST) {
-      this->addTest(this->createMTestTest(i), tname);
-    } else if (this->scheme == PTEST) {
-      this->addTest(this->createPTestTest(i), tname);
-    } else if (this->scheme == DEFAULT) {
-      const auto ext = [&i, &pos]() -> std::string {
-        if (pos != std::string::npos) {
-          return i.substr(pos);
-        }
-        return "";
-      }();
-      if (ext == ".ptest") {
-        this->addTest(this->createPTestTest(i), tname);
-      } else {
-        this->addTest(this->createMTestTest(i), tname);
+    const auto ext = [&i, &pos]() -> std::string {
+      if (pos != std::string::npos) {
+        return i.substr(pos);
+      }
+      return "";
+    }();
+    const auto ptest = (this->scheme == PTEST) ||
+                       ((this->scheme == DEFAULT) && (ext == ".ptest"));
+    const auto sets = this->getSubstitutionsSets();
+    for (decltype(sets.size()) idx = 0; idx != sets.size(); ++idx) {
+      // when sweeping, the index of the set of substitutions is appended to
+      // the name of the test
+      const auto n =
+          this->sweeps.empty() ? tname : tname + "-" + std::to_string(idx);
+      const auto& s = sets[idx];
+      auto t = ptest ? this->createPTestTest(i, s)  //
+                     : this->createMTestTest(i, s);
+      if (!this->sweeps.empty()) {
+        // output files explicitly given in the input file are made unique
+        t->appendSuffixToOutputFileNames("-" + std::to_string(idx));
       }
+      this->addTest(t, n, s);
     }
   }  // end of treatStandardInputFile
 
-  void MTestMain::addTest(std::shared_ptr<SchemeBase> t, const std::string& n) {
+  void MTestMain::addTest(std::shared_ptr<SchemeBase> t,
+                          const std::string& n,
+                          const std::map<std::string, std::string>& s) {
     auto& tm = tfel::tests::TestManager::getTestManager();
     if (this->result_file_output) {
       if (!t->isOutputFileNameDefined()) {
         t->setOutputFileName(n + ".res");
       }
+      if ((!this->result_file_format.empty()) &&
+          (!t->isOutputFileFormatDefined())) {
+        t->setOutputFileFormat(this->result_file_format);
+      }
     }
     if (this->residual_file_output) {
       if (!t->isResidualFileNameDefined()) {
         t->setResidualFileName(n + "-residual.res");
       }
     }
-    tm.addTest("MTest/" + n, t);
+    // two tests can't share the same output files
+    auto check_output_file = [this, &n](const std::string& f) {
+      tfel::raise_if(!this->output_files.insert(f).second,
+                     "MTestMain::addTest: file '" + f +
+                         "' used by test '" + n +
+                         "' is also used by another test");
+    };
+    if (t->isOutputFileNameDefined()) {
+      check_output_file(t->getOutputFileName());
+    }
+    if (t->isResidualFileNameDefined()) {
+      check_output_file(t->getResidualFileName());
+    }
+    auto bt = std::make_shared<BatchTest>(t);
+    this->cases.push_back({n, bt, s});
+    tm.addTest("MTest/" + n, bt);
     if (this->xml_output) {
       std::shared_ptr<tfel::tests::TestOutput> o;
       if (!t->isXMLOutputFileNameDefined()) {
@@ -195,8 +195,9 @@ namespace mtest {
     }
   }  // end of PipeCubicElement::computeStrain
 
+  template <typename MatrixType>
   std::pair<bool, real> PipeCubicElement::updateStiffnessMatrixAndInnerForces(
-      tfel::math::matrix<real>& k,
+      MatrixType& k,
       tfel::math::vector<real>& r,
       StructureCurrentState& scs,
       const Behaviour& b,
@@ -205,26 +206,6 @@ namespace mtest {
       const real dt,
       const StiffnessMatrixType mt,
       const size_t i) {
-    //! a simple alias
-    constexpr real pi = 3.14159265358979323846;
-    // number of elements
-    const auto ne = size_t(m.number_of_elements);
-    // number of nodes
-    const auto n = 3 * ne + 1;
-    // inner radius
-    const auto Ri = m.inner_radius;
-    // outer radius
-    const auto Re = m.outer_radius;
-    // radius increment
-    const auto dr = (Re - Ri) / ne;
-    // radial position of the first node
-    const auto r0 = Ri + dr * i;
-    // radial position of the second node
-    const auto r1 = r0 + dr / 3;
-    // radial position of the third node
-    const auto r2 = r0 + 2 * dr / 3;
-    // radial position of the fourth node
-    const auto r3 = r0 + dr;
     /* inner forces */
     auto& bwk = scs.getBehaviourWorkSpace();
     // compute the strain
@@ -232,16 +213,8 @@ namespace mtest {
     // loop over Gauss point
     auto r_dt = real{};
     for (const auto g : {0, 1, 2, 3}) {
-      // Gauss point position in the reference element
-      const auto pg = pg_radii[g];
       // current state
       auto& s = scs.istates[4 * i + g];
-      // radial position of the Gauss point
-      const auto rg = s.position;
-      const real sfv[4] = {sf0(rg), sf1(rg), sf2(rg), sf3(rg)};
-      const real dsfv[4] = {dsf0(rg), dsf1(rg), dsf2(rg), dsf3(rg)};
-      // jacobian of the transformation
-      const auto J = PipeCubicElement::jacobian(r0, r1, r2, r3, pg);
       setRoundingMode();
       const auto rb = b.integrate(s, bwk, dt, mt);
       setRoundingMode();
@@ -254,41 +227,121 @@ namespace mtest {
         }
         return {false, r_dt};
       }
-      // stress tensor
-      const auto pi_rr = s.s1[0];
-      const auto pi_zz = s.s1[1];
-      const auto pi_tt = s.s1[2];
-      const auto w = 2 * pi * wg[g] * J;
-      // innner forces
-      for (const auto j : {0, 1, 2, 3}) {
-        r[3 * i + j] += w * (rg * pi_rr * dsfv[j] / J + pi_tt * sfv[j]);
-      }
-      // axial forces
-      r[n] += w * rg * pi_zz;
-      // jacobian matrix
-      if (mt != StiffnessMatrixType::NOSTIFFNESS) {
-        const auto& bk = bwk.k;
-        for (const auto l : {0, 1, 2, 3}) {
-          for (const auto j : {0, 1, 2, 3}) {
-            const auto de0_du = dsfv[j] / J;
-            const auto de2_du = sfv[j] / rg;
-            k(3 * i + l, 3 * i + j) +=
-                w *
-                (rg * dsfv[l] / J * (bk(0, 0) * de0_du + bk(0, 2) * de2_du) +
-                 sfv[l] * (bk(2, 0) * de0_du + bk(2, 2) * de2_du));
-          }
-          k(3 * i + l, n) +=
-              w * (rg * dsfv[l] / J * bk(0, 1) + bk(2, 1) * sfv[l]);
-        }  // loop over nodes
+      addGaussPointContribution(k, r, s, bwk.k, m, mt, i, g);
+    }  // loop over gauss point
+    return {true, r_dt};
+  }
+
+  template <typename MatrixType>
+  void PipeCubicElement::addGaussPointContribution(
+      MatrixType& k,
+      tfel::math::vector<real>& r,
+      const CurrentState& s,
+      const tfel::math::matrix<real>& bk,
+      const PipeMesh& m,
+      const StiffnessMatrixType mt,
+      const size_t i,
+      const unsigned short g) {
+    //! a simple alias
+    constexpr real pi = 3.14159265358979323846;
+    // number of elements
+    const auto ne = size_t(m.number_of_elements);
+    // number of nodes
+    const auto n = 3 * ne + 1;
+    // inner radius
+    const auto Ri = m.inner_radius;
+    // outer radius
+    const auto Re = m.outer_radius;
+    // radius increment
+    const auto dr = (Re - Ri) / ne;
+    // radial position of the first node
+    const auto r0 = Ri + dr * i;
+    // radial position of the second node
+    const auto r1 = r0 + dr / 3;
+    // radial position of the third node
+    const auto r2 = r0 + 2 * dr / 3;
+    // radial position of the fourth node
+    const auto r3 = r0 + dr;
+    // Gauss point position in the reference element
+    const auto pg = pg_radii[g];
+    // radial position of the Gauss point
+    const auto rg = s.position;
+    const real sfv[4] = {sf0(rg), sf1(rg), sf2(rg), sf3(rg)};
+    const real dsfv[4] = {dsf0(rg), dsf1(rg), dsf2(rg), dsf3(rg)};
+    // jacobian of the transformation
+    const auto J = PipeCubicElement::jacobian(r0, r1, r2, r3, pg);
+    // stress tensor
+    const auto pi_rr = s.s1[0];
+    const auto pi_zz = s.s1[1];
+    const auto pi_tt = s.s1[2];
+    const auto w = 2 * pi * wg[g] * J;
+    // innner forces
+    for (const auto j : {0, 1, 2, 3}) {
+      r[3 * i + j] += w * (rg * pi_rr * dsfv[j] / J + pi_tt * sfv[j]);
+    }
+    // axial forces
+    r[n] += w * rg * pi_zz;
+    // jacobian matrix
+    if (mt != StiffnessMatrixType::NOSTIFFNESS) {
+      for (const auto l : {0, 1, 2, 3}) {
         for (const auto j : {0, 1, 2, 3}) {
           const auto de0_du = dsfv[j] / J;
           const auto de2_du = sfv[j] / rg;
-          k(n, 3 * i + j) += w * rg * (bk(1, 0) * de0_du + bk(1, 2) * de2_du);
+          k(3 * i + l, 3 * i + j) +=
+              w * (rg * dsfv[l] / J * (bk(0, 0) * de0_du + bk(0, 2) * de2_du) +
+                   sfv[l] * (bk(2, 0) * de0_du + bk(2, 2) * de2_du));
         }
-        k(n, n) += w * rg * bk(1, 1);
+        k(3 * i + l, n) +=
+            w * (rg * dsfv[l] / J * bk(0, 1) + bk(2, 1) * sfv[l]);
+      }  // loop over nodes
+      for (const auto j : {0, 1, 2, 3}) {
+        const auto de0_du = dsfv[j] / J;
+        const auto de2_du = sfv[j] / rg;
+        k(n, 3 * i + j) += w * rg * (bk(1, 0) * de0_du + bk(1, 2) * de2_du);
       }
-    }  // loop over gauss point
-    return {true, r_dt};
-  }
+      k(n, n) += w * rg * bk(1, 1);
+    }
+  }  // end of addGaussPointContribution
+
+  template std::pair<bool, real>
+  PipeCubicElement::updateStiffnessMatrixAndInnerForces(
+      tfel::math::matrix<real>&,
+      tfel::math::vector<real>&,
+      StructureCurrentState&,
+      const Behaviour&,
+      const tfel::math::vector<real>&,
+      const PipeMesh&,
+      const real,
+      const StiffnessMatrixType,
+      const size_t);
+  template std::pair<bool, real>
+  PipeCubicElement::updateStiffnessMatrixAndInnerForces(
+      tfel::math::BorderedBandedMatrix<real>&,
+      tfel::math::vector<real>&,
+      StructureCurrentState&,
+      const Behaviour&,
+      const tfel::math::vector<real>&,
+      const PipeMesh&,
+      const real,
+      const StiffnessMatrixType,
+      const size_t);
+  template void PipeCubicElement::addGaussPointContribution(
+      tfel::math::matrix<real>&,
+      tfel::math::vector<real>&,
+      const CurrentState&,
+      const tfel::math::matrix<real>&,
+      const PipeMesh&,
+      const StiffnessMatrixType,
+      const size_t,
+      const unsigned short);
+  template void PipeCubicElement::addGaussPointContribution(
+      tfel::math::BorderedBandedMatrix<real>&,
+      tfel::math::vector<real>&,
+      const CurrentState&,
+      const tfel::math::matrix<real>&,
+      const PipeMesh&,
+      const StiffnessMatrixType,
+      const size_t,
+      const unsigned short);
 
 }  // end of namespace mtest
@@ -138,8 +138,9 @@ namespace mtest {
     }
   }  // end of PipeLinearElement::computeStrain
 
+  template <typename MatrixType>
   std::pair<bool, real> PipeLinearElement::updateStiffnessMatrixAndInnerForces(
-      tfel::math::matrix<real>& k,
+      MatrixType& k,
       tfel::math::vector<real>& r,
       StructureCurrentState& scs,
       const Behaviour& b,
@@ -148,24 +149,6 @@ namespace mtest {
       const real dt,
       const StiffnessMatrixType mt,
       const size_t i) {
-    //! a simple alias
-    constexpr real pi = 3.14159265358979323846;
-    // number of elements
-    const auto ne = size_t(m.number_of_elements);
-    // number of nodes
-    const auto n = ne + 1;
-    // inner radius
-    const auto Ri = m.inner_radius;
-    // outer radius
-    const auto Re = m.outer_radius;
-    // radius increment
-    const auto dr = (Re - Ri) / ne;
-    // radial position of the first node
-    const auto r0 = Ri + dr * i;
-    // radial position of the second node
-    const auto r1 = Ri + dr * (i + 1);
-    // jacobian of the transformation
-    const auto J = dr / 2;
     /* inner forces */
     auto& bwk = scs.getBehaviourWorkSpace();
     // compute the strain
@@ -173,10 +156,6 @@ namespace mtest {
     auto r_dt = real{};
     // loop over Gauss point
     for (const auto g : {0, 1}) {
-      // Gauss point position in the reference element
-      const auto pg = pg_radii[g];
-      // radial position of the Gauss point
-      const auto rg = interpolate(r0, r1, pg);
       // current state
       auto& s = scs.istates[2 * i + g];
       setRoundingMode();
@@ -191,48 +170,123 @@ namespace mtest {
         }
         return {false, r_dt};
       }
-      // stress tensor
-      const auto pi_rr = s.s1[0];
-      const auto pi_zz = s.s1[1];
-      const auto pi_tt = s.s1[2];
-      const auto w = 2 * pi * wg * J;
-      // innner forces
-      r[i] += w * (pi_rr * (-rg / dr) + pi_tt * (1 - pg) / 2);
-      r[i + 1] += w * (pi_rr * (rg / dr) + pi_tt * (1 + pg) / 2);
-      // axial forces
-      r[n] += w * rg * pi_zz;
-      // jacobian matrix
-      if (mt != StiffnessMatrixType::NOSTIFFNESS) {
-        const auto& bk = bwk.k;
-        const real de10_dur0 = -1 / dr;
-        const real de12_dur0 = (1 - pg) / (2 * rg);
-        const real de10_dur1 = 1 / dr;
-        const real de12_dur1 = (1 + pg) / (2 * rg);
-        k(i, i) += w * (bk(0, 0) * de10_dur0 * (-rg / dr) +
-                        bk(0, 2) * de12_dur0 * (-rg / dr) +
-                        bk(2, 0) * de10_dur0 * (1 - pg) / 2 +
-                        bk(2, 2) * de12_dur0 * (1 - pg) / 2);
-        k(i, i + 1) += w * (bk(0, 0) * de10_dur1 * (-rg / dr) +
-                            bk(0, 2) * de12_dur1 * (-rg / dr) +
-                            bk(2, 0) * de10_dur1 * (1 - pg) / 2 +
-                            bk(2, 2) * de12_dur1 * (1 - pg) / 2);
-        k(i, n) += w * (bk(0, 1) * (-rg / dr) + bk(2, 1) * (1 - pg) / 2);
-        k(i + 1, i) += w * (bk(0, 0) * de10_dur0 * (rg / dr) +
-                            bk(0, 2) * de12_dur0 * (rg / dr) +
-                            bk(2, 0) * de10_dur0 * (1 + pg) / 2 +
-                            bk(2, 2) * de12_dur0 * (1 + pg) / 2);
-        k(i + 1, i + 1) += w * (bk(0, 0) * de10_dur1 * (rg / dr) +
-                                bk(0, 2) * de12_dur1 * (rg / dr) +
-                                bk(2, 0) * de10_dur1 * (1 + pg) / 2 +
-                                bk(2, 2) * de12_dur1 * (1 + pg) / 2);
-        k(i + 1, n) += w * (bk(0, 1) * (rg / dr) + bk(2, 1) * (1 + pg) / 2);
-        // axial forces
-        k(n, i) += w * rg * (bk(1, 0) * de10_dur0 + bk(1, 2) * de12_dur0);
-        k(n, i + 1) += w * rg * (bk(1, 0) * de10_dur1 + bk(1, 2) * de12_dur1);
-        k(n, n) += w * rg * bk(1, 1);
-      }
+      addGaussPointContribution(k, r, s, bwk.k, m, mt, i, g);
     }
     return {true, r_dt};
   }
 
+  template <typename MatrixType>
+  void PipeLinearElement::addGaussPointContribution(
+      MatrixType& k,
+      tfel::math::vector<real>& r,
+      const CurrentState& s,
+      const tfel::math::matrix<real>& bk,
+      const PipeMesh& m,
+      const StiffnessMatrixType mt,
+      const size_t i,
+      const unsigned short g) {
+    //! a simple alias
+    constexpr real pi = 3.14159265358979323846;
+    // number of elements
+    const auto ne = size_t(m.number_of_elements);
+    // number of nodes
+    const auto n = ne + 1;
+    // inner radius
+    const auto Ri = m.inner_radius;
+    // outer radius
+    const auto Re = m.outer_radius;
+    // radius increment
+    const auto dr = (Re - Ri) / ne;
+    // radial position of the first node
+    const auto r0 = Ri + dr * i;
+    // radial position of the second node
+    const auto r1 = Ri + dr * (i + 1);
+    // jacobian of the transformation
+    const auto J = dr / 2;
+    // Gauss point position in the reference element
+    const auto pg = pg_radii[g];
+    // radial position of the Gauss point
+    const auto rg = interpolate(r0, r1, pg);
+    // stress tensor
+    const auto pi_rr = s.s1[0];
+    const auto pi_zz = s.s1[1];
+    const auto pi_tt = s.s1[2];
+    const auto w = 2 * pi * wg * J;
+    // innner forces
+    r[i] += w * (pi_rr * (-rg / dr) + pi_tt * (1 - pg) / 2);
+    r[i + 1] += w * (pi_rr * (rg / dr) + pi_tt * (1 + pg) / 2);
+    // axial forces
+    r[n] += w * rg * pi_zz;
+    // jacobian matrix
+    if (mt != StiffnessMatrixType::NOSTIFFNESS) {
+      const real de10_dur0 = -1 / dr;
+      const real de12_dur0 = (1 - pg) / (2 * rg);
+      const real de10_dur1 = 1 / dr;
+      const real de12_dur1 = (1 + pg) / (2 * rg);
+      k(i, i) += w * (bk(0, 0) * de10_dur0 * (-rg / dr) +
+                      bk(0, 2) * de12_dur0 * (-rg / dr) +
+                      bk(2, 0) * de10_dur0 * (1 - pg) / 2 +
+                      bk(2, 2) * de12_dur0 * (1 - pg) / 2);
+      k(i, i + 1) += w * (bk(0, 0) * de10_dur1 * (-rg / dr) +
+                          bk(0, 2) * de12_dur1 * (-rg / dr) +
+                          bk(2, 0) * de10_dur1 * (1 - pg) / 2 +
+                          bk(2, 2) * de12_dur1 * (1 - pg) / 2);
+      k(i, n) += w * (bk(0, 1) * (-rg / dr) + bk(2, 1) * (1 - pg) / 2);
+      k(i + 1, i) += w * (bk(0, 0) * de10_dur0 * (rg / dr) +
+                          bk(0, 2) * de12_dur0 * (rg / dr) +
+                          bk(2, 0) * de10_dur0 * (1 + pg) / 2 +
+                          bk(2, 2) * de12_dur0 * (1 + pg) / 2);
+      k(i + 1, i + 1) += w * (bk(0, 0) * de10_dur1 * (rg / dr) +
+                              bk(0, 2) * de12_dur1 * (rg / dr) +
+                              bk(2, 0) * de10_dur1 * (1 + pg) / 2 +
+                              bk(2, 2) * de12_dur1 * (1 + pg) / 2);
+      k(i + 1, n) += w * (bk(0, 1) * (rg / dr) + bk(2, 1) * (1 + pg) / 2);
+      // axial forces
+      k(n, i) += w * rg * (bk(1, 0) * de10_dur0 + bk(1, 2) * de12_dur0);
+      k(n, i + 1) += w * rg * (bk(1, 0) * de10_dur1 + bk(1, 2) * de12_dur1);
+      k(n, n) += w * rg * bk(1, 1);
+    }
+  }  // end of addGaussPointContribution
+
+  template std::pair<bool, real>
+  PipeLinearElement::updateStiffnessMatrixAndInnerForces(
+      tfel::math::matrix<real>&,
+      tfel::math::vector<real>&,
+      StructureCurrentState&,
+      const Behaviour&,
+      const tfel::math::vector<real>&,
+      const PipeMesh&,
+      const real,
+      const StiffnessMatrixType,
+      const size_t);
+  template std::pair<bool, real>
+  PipeLinearElement::updateStiffnessMatrixAndInnerForces(
+      tfel::math::BorderedBandedMatrix<real>&,
+      tfel::math::vector<real>&,
+      StructureCurrentState&,
+      const Behaviour&,
+      const tfel::math::vector<real>&,
+      const PipeMesh&,
+      const real,
+      const StiffnessMatrixType,
+      const size_t);
+  template void PipeLinearElement::addGaussPointContribution(
+      tfel::math::matrix<real>&,
+      tfel::math::vector<real>&,
+      const CurrentState&,
+      const tfel::math::matrix<real>&,
+      const PipeMesh&,
+      const StiffnessMatrixType,
+      const size_t,
+      const unsigned short);
+  template void PipeLinearElement::addGaussPointContribution(
+      tfel::math::BorderedBandedMatrix<real>&,
+      tfel::math::vector<real>&,
+      const CurrentState&,
+      const tfel::math::matrix<real>&,
+      const PipeMesh&,
+      const StiffnessMatrixType,
+      const size_t,
+      const unsigned short);
+
 }  // end of namespace mtest
@@ -146,9 +146,10 @@ namespace mtest {
     }
   }  // end of PipeQuadraticElement::computeStrain
 
+  template <typename MatrixType>
   std::pair<bool, real>
   PipeQuadraticElement::updateStiffnessMatrixAndInnerForces(
-      tfel::math::matrix<real>& k,
+      MatrixType& k,
       tfel::math::vector<real>& r,
       StructureCurrentState& scs,
       const Behaviour& b,
@@ -157,24 +158,6 @@ namespace mtest {
       const real dt,
       const StiffnessMatrixType mt,
       const size_t i) {
-    //! a simple alias
-    constexpr real pi = std::numbers::pi_v<real>;
-    // number of elements
-    const auto ne = size_t(m.number_of_elements);
-    // number of nodes
-    const auto n = 2 * ne + 1;
-    // inner radius
-    const auto Ri = m.inner_radius;
-    // outer radius
-    const auto Re = m.outer_radius;
-    // radius increment
-    const auto dr = (Re - Ri) / ne;
-    // radial position of the first node
-    const auto r0 = Ri + dr * i;
-    // radial position of the second node
-    const auto r1 = r0 + dr / 2;
-    // radial position of the thrid node
-    const auto r2 = r0 + dr;
     /* inner forces */
     auto& bwk = scs.getBehaviourWorkSpace();
     // compute the strain
@@ -182,18 +165,6 @@ namespace mtest {
     auto r_dt = real{};
     // loop over Gauss point
     for (const auto g : {0, 1, 2}) {
-      setRoundingMode();
-      // Gauss point position in the reference element
-      const auto pg = pg_radii[g];
-      // radial position of the Gauss point
-      const auto rg = interpolate(r0, r1, r2, pg);
-      // jacobian of the transformation
-      const auto J = r0 * (pg - 0.5) + r2 * (pg + 0.5) - 2 * r1 * pg;
-      // shape function value
-      const real sf[3] = {-0.5 * (1. - pg) * pg, (1. + pg) * (1. - pg),
-                          0.5 * (1 + pg) * pg};
-      // shape function derivative
-      const real dsf[3] = {pg - 0.5, -2. * pg, pg + 0.5};
       // current state
       auto& s = scs.istates[3 * i + g];
       setRoundingMode();
@@ -208,40 +179,121 @@ namespace mtest {
         }
         return {false, r_dt};
       }
-      // stress tensor
-      const auto pi_rr = s.s1[0];
-      const auto pi_zz = s.s1[1];
-      const auto pi_tt = s.s1[2];
-      const auto w = 2 * pi * wg[g] * J;
-      // innner forces
-      for (const auto j : {0, 1, 2}) {
-        r[2 * i + j] += w * (rg * pi_rr * dsf[j] / J + pi_tt * sf[j]);
-      }
-      // axial forces
-      r[n] += w * rg * pi_zz;
-      // jacobian matrix
-      if (mt != StiffnessMatrixType::NOSTIFFNESS) {
-        const auto& bk = bwk.k;
-        for (const auto l : {0, 1, 2}) {
-          for (const auto j : {0, 1, 2}) {
-            const auto de0_du = dsf[j] / J;
-            const auto de2_du = sf[j] / rg;
-            k(2 * i + l, 2 * i + j) +=
-                w * (rg * dsf[l] / J * (bk(0, 0) * de0_du + bk(0, 2) * de2_du) +
-                     sf[l] * (bk(2, 0) * de0_du + bk(2, 2) * de2_du));
-          }
-          k(2 * i + l, n) +=
-              w * (rg * dsf[l] / J * bk(0, 1) + bk(2, 1) * sf[l]);
-        }  // loop over nodes
+      addGaussPointContribution(k, r, s, bwk.k, m, mt, i, g);
+    }  // loop over gauss point
+    return {true, r_dt};
+  }
+
+  template <typename MatrixType>
+  void PipeQuadraticElement::addGaussPointContribution(
+      MatrixType& k,
+      tfel::math::vector<real>& r,
+      const CurrentState& s,
+      const tfel::math::matrix<real>& bk,
+      const PipeMesh& m,
+      const StiffnessMatrixType mt,
+      const size_t i,
+      const unsigned short g) {
+    //! a simple alias
+    constexpr real pi = std::numbers::pi_v<real>;
+    // number of elements
+    const auto ne = size_t(m.number_of_elements);
+    // number of nodes
+    const auto n = 2 * ne + 1;
+    // inner radius
+    const auto Ri = m.inner_radius;
+    // outer radius
+    const auto Re = m.outer_radius;
+    // radius increment
+    const auto dr = (Re - Ri) / ne;
+    // radial position of the first node
+    const auto r0 = Ri + dr * i;
+    // radial position of the second node
+    const auto r1 = r0 + dr / 2;
+    // radial position of the thrid node
+    const auto r2 = r0 + dr;
+    // Gauss point position in the reference element
+    const auto pg = pg_radii[g];
+    // radial position of the Gauss point
+    const auto rg = interpolate(r0, r1, r2, pg);
+    // jacobian of the transformation
+    const auto J = r0 * (pg - 0.5) + r2 * (pg + 0.5) - 2 * r1 * pg;
+    // shape function value
+    const real sf[3] = {-0.5 * (1. - pg) * pg, (1. + pg) * (1. - pg),
+                        0.5 * (1 + pg) * pg};
+    // shape function derivative
+    const real dsf[3] = {pg - 0.5, -2. * pg, pg + 0.5};
+    // stress tensor
+    const auto pi_rr = s.s1[0];
+    const auto pi_zz = s.s1[1];
+    const auto pi_tt = s.s1[2];
+    const auto w = 2 * pi * wg[g] * J;
+    // innner forces
+    for (const auto j : {0, 1, 2}) {
+      r[2 * i + j] += w * (rg * pi_rr * dsf[j] / J + pi_tt * sf[j]);
+    }
+    // axial forces
+    r[n] += w * rg * pi_zz;
+    // jacobian matrix
+    if (mt != StiffnessMatrixType::NOSTIFFNESS) {
+      for (const auto l : {0, 1, 2}) {
         for (const auto j : {0, 1, 2}) {
           const auto de0_du = dsf[j] / J;
           const auto de2_du = sf[j] / rg;
-          k(n, 2 * i + j) += w * rg * (bk(1, 0) * de0_du + bk(1, 2) * de2_du);
+          k(2 * i + l, 2 * i + j) +=
+              w * (rg * dsf[l] / J * (bk(0, 0) * de0_du + bk(0, 2) * de2_du) +
+                   sf[l] * (bk(2, 0) * de0_du + bk(2, 2) * de2_du));
         }
-        k(n, n) += w * rg * bk(1, 1);
+        k(2 * i + l, n) += w * (rg * dsf[l] / J * bk(0, 1) + bk(2, 1) * sf[l]);
+      }  // loop over nodes
+      for (const auto j : {0, 1, 2}) {
+        const auto de0_du = dsf[j] / J;
+        const auto de2_du = sf[j] / rg;
+        k(n, 2 * i + j) += w * rg * (bk(1, 0) * de0_du + bk(1, 2) * de2_du);
       }
-    }  // loop over gauss point
-    return {true, r_dt};
-  }
+      k(n, n) += w * rg * bk(1, 1);
+    }
+  }  // end of addGaussPointContribution
+
+  template std::pair<bool, real>
+  PipeQuadraticElement::updateStiffnessMatrixAndInnerForces(
+      tfel::math::matrix<real>&,
+      tfel::math::vector<real>&,
+      StructureCurrentState&,
+      const Behaviour&,
+      const tfel::math::vector<real>&,
+      const PipeMesh&,
+      const real,
+      const StiffnessMatrixType,
+      const size_t);
+  template std::pair<bool, real>
+  PipeQuadraticElement::updateStiffnessMatrixAndInnerForces(
+      tfel::math::BorderedBandedMatrix<real>&,
+      tfel::math::vector<real>&,
+      StructureCurrentState&,
+      const Behaviour&,
+      const tfel::math::vector<real>&,
+      const PipeMesh&,
+      const real,
+      const StiffnessMatrixType,
+      const size_t);
+  template void PipeQuadraticElement::addGaussPointContribution(
+      tfel::math::matrix<real>&,
+      tfel::math::vector<real>&,
+      const CurrentState&,
+      const tfel::math::matrix<real>&,
+      const PipeMesh&,
+      const StiffnessMatrixType,
+      const size_t,
+      const unsigned short);
+  template void PipeQuadraticElement::addGaussPointContribution(
+      tfel::math::BorderedBandedMatrix<real>&,
+      tfel::math::vector<real>&,
+      const CurrentState&,
+      const tfel::math::matrix<real>&,
+      const PipeMesh&,
+      const StiffnessMatrixType,
+      const size_t,
+      const unsigned short);
 
 }  // end of namespace mtest
@@ -12,19 +12,24 @@
  */
 
 #include <memory>
+#include <vector>
+#include <future>
+#include <algorithm>
 #include <fstream>
 #include <sstream>
 #include <stdexcept>
 
 #include "TFEL/Raise.hxx"
 #include "TFEL/Math/General/IEEE754.hxx"
-#include "TFEL/Math/LUSolve.hxx"
+#include "TFEL/Math/BorderedBandedLUSolve.hxx"
+#include "TFEL/System/ThreadPool.hxx"
 #include "TFEL/Utilities/TextData.hxx"
 #include "MFront/MFrontLogStream.hxx"
 #include "MTest/RoundingMode.hxx"
 #include "MTest/Evolution.hxx"
 #include "MTest/SolverWorkSpace.hxx"
 #include "MTest/Behaviour.hxx"
+#include "MTest/BehaviourWorkSpace.hxx"
 #include "MTest/CurrentState.hxx"
 #include "MTest/StudyCurrentState.hxx"
 #include "MTest/StructureCurrentState.hxx"
@@ -331,6 +336,24 @@ namespace mtest {
     evm.insert({n, make_evolution(v)});
   }  // end of insert
 
+  /*!
+   * \return the ordinal suffix associated with the given number
+   * \param[in] n: number
+   */
+  [[nodiscard]] static const char* getOrdinalSuffix(const std::size_t n) {
+    if ((n % 100 >= 11) && (n % 100 <= 13)) {
+      return "th";
+    }
+    if (n % 10 == 1) {
+      return "st";
+    } else if (n % 10 == 2) {
+      return "nd";
+    } else if (n % 10 == 3) {
+      return "rd";
+    }
+    return "th";
+  }  // end of getOrdinalSuffix
+
   [[nodiscard]] static real getOxidationLength(
       const StudyCurrentState state, const PipeTest::OxidationModel& m) {
     if (m.model.get() == nullptr) {
@@ -584,49 +607,17 @@ namespace mtest {
                      "PipeTest::completeInitialisation: "
                      "filling temperature not set");
     }
-    if (this->out) {
-      auto c = 7u;
-      this->out << "# first  column : time\n"
-                   "# second column : inner radius\n"
-                   "# third  column : outer radius\n"
-                   "# fourth column : inner radius displacement\n"
-                   "# fifth  column : outer radius displacement\n"
-                   "# sixth  column : axial displacement\n";
-      if ((this->rl == IMPOSEDINNERRADIUS) ||
-          (this->rl == IMPOSEDOUTERRADIUS) || (this->rl == TIGHTPIPE)) {
-        this->out << "# " << c << "th column : inner pressure\n";
-        ++c;
-      }
-      if (this->mandrel_radius_evolution != nullptr) {
-        this->out << "# " << c << "th column : contact pressure\n";
-        ++c;
-      }
-      if ((this->al == IMPOSEDAXIALGROWTH) ||
-          (this->mandrel_axial_growth_evolution != nullptr)) {
-        this->out << "# " << c << "th column : axial force\n";
-        ++c;
-      }
-      if (this->mandrel_radius_evolution != nullptr) {
-        this->out << "# " << c << "th column : mandel contact indicator\n";
-        ++c;
-      }
-      for (const auto& ao : this->aoutputs) {
-        this->out << "# " << c << "th column : " << ao.d << '\n';
-        ++c;
-      }
-      if (this->inner_boundary_oxidation_model.model != nullptr) {
-        this->out << "# " << c
-                  << "th column : oxidation length at the inner boundary\n";
-        ++c;
-      }
-      if (this->outer_boundary_oxidation_model.model != nullptr) {
-        this->out << "# " << c
-                  << "th column : oxidation length at the outer boundary\n";
-        ++c;
-      }
-      for (const auto& fc : this->failure_criteria) {
-        this->out << "# " << c << "th column : status of the " << fc->getName()
-                  << " criterion\n";
+    if (this->useBinaryOutputFile()) {
+      auto c = std::vector<std::string>{};
+      for (const auto& column : this->getOutputColumns()) {
+        c.push_back(column.name);
+      }
+      this->setBinaryOutputFileColumns(c);
+    } else if (this->out) {
+      auto c = std::size_t{1};
+      for (const auto& column : this->getOutputColumns()) {
+        this->out << "# " << c << getOrdinalSuffix(c)
+                  << " column : " << column.description << '\n';
         ++c;
       }
     }
@@ -875,14 +866,15 @@ namespace mtest {
         ++pt2;
       }
     } catch (std::exception& e) {
-      this->out.flush();
+      this->flushOutputFile();
       report(e.what(), state, false);
       throw;
     } catch (...) {
-      this->out.flush();
+      this->flushOutputFile();
       report(nullptr, state, false);
       throw;
     }
+    this->flushOutputFile();
     report(nullptr, state, true);
     tfel::tests::TestResult tr;
     for (const auto& t : this->tests) {
@@ -928,6 +920,22 @@ namespace mtest {
     GenericSolver().execute(state, wk, *this, this->options, ti, te);
   }  // end of execute
 
+  /*!
+   * \return the number of sub-diagonals (or super-diagonals) of the
+   * stiffness matrix, without taking into account the axial strain.
+   * \param[in] m: mesh
+   */
+  static PipeTest::size_type getPipeTestHalfBandWidth(const PipeMesh& m) {
+    if (m.etype == PipeMesh::LINEAR) {
+      return 1;
+    } else if (m.etype == PipeMesh::QUADRATIC) {
+      return 2;
+    } else if (m.etype == PipeMesh::CUBIC) {
+      return 3;
+    }
+    tfel::raise("getPipeTestHalfBandWidth: unknown element type");
+  }  // end of getPipeTestHalfBandWidth
+
   void PipeTest::initializeWorkSpace(SolverWorkSpace& wk) const {
     const auto psz = this->getNumberOfUnknowns();
     // clear
@@ -937,13 +945,38 @@ namespace mtest {
     wk.r.clear();
     wk.du.clear();
     // resizing
-    wk.K.resize(psz, psz);
-    wk.p_lu.resize(psz);
-    wk.x.resize(psz);
     wk.r.resize(psz, 0.);
     wk.du.resize(psz, 0.);
+    if (this->linear_solver == BANDEDLINEARSOLVER) {
+      // the stiffness matrix is directly assembled in the banded matrix,
+      // the dense matrix is not used
+      const auto w = getPipeTestHalfBandWidth(this->mesh);
+      wk.Kb.resize(this->getNumberOfNodes(), w, w, 1);
+    } else {
+      wk.K.resize(psz, psz);
+      wk.p_lu.resize(psz);
+      wk.x.resize(psz);
+    }
   }  // end of initializeWorkSpace
 
+  void PipeTest::solveLinearSystem(SolverWorkSpace& wk,
+                                   tfel::math::vector<real>& x) const {
+    if (this->linear_solver == DENSELINEARSOLVER) {
+      Study::solveLinearSystem(wk, x);
+      return;
+    }
+    tfel::math::BorderedBandedLUSolve::exe(wk.Kb, x);
+  }  // end of solveLinearSystem
+
+  void PipeTest::backSubstitute(SolverWorkSpace& wk,
+                                tfel::math::vector<real>& x) const {
+    if (this->linear_solver == DENSELINEARSOLVER) {
+      Study::backSubstitute(wk, x);
+      return;
+    }
+    tfel::math::BorderedBandedLUSolve::back_substitute(wk.Kb, x);
+  }  // end of backSubstitute
+
   std::pair<bool, real> PipeTest::prepare(StudyCurrentState& state,
                                           const real t,
                                           const real dt) const {
@@ -1055,6 +1088,126 @@ namespace mtest {
     return {false, 1};
   }  // end of PipeTest
 
+  /*!
+   * \brief loop over the elements using a pool of threads.
+   *
+   * The behaviour is first integrated at every Gauss points, the elements
+   * being distributed among the threads, each thread using its own
+   * behaviour workspace. The contributions of the Gauss points are then
+   * assembled sequentially, in the same order as in the sequential loop,
+   * so that the results do not depend on the number of threads.
+   *
+   * \return a pair containing a boolean stating if the integration
+   * succeeded and a scaling factor for the time step.
+   * \param[in,out] p: pool of threads
+   * \param[out] k: stiffness matrix
+   * \param[out] r: residual
+   * \param[out] scs: structure current state
+   * \param[in] b: behaviour
+   * \param[in] u1: current displacement estimation
+   * \param[in] m: pipe mesh
+   * \param[in] dt: time increment
+   * \param[in] mt: stiffness matrix type
+   */
+  template <typename Element, typename MatrixType>
+  static std::pair<bool, real> updateStiffnessMatrixAndInnerForcesInParallel(
+      tfel::system::ThreadPool& p,
+      MatrixType& k,
+      tfel::math::vector<real>& r,
+      StructureCurrentState& scs,
+      const Behaviour& b,
+      const tfel::math::vector<real>& u1,
+      const PipeMesh& m,
+      const real dt,
+      const StiffnessMatrixType mt) {
+    constexpr auto ng = Element::number_of_gauss_points;
+    const auto ne = size_t(m.number_of_elements);
+    const auto nt = std::min(size_t(p.getNumberOfThreads()), ne);
+    // the workspaces are allocated before launching the threads
+    auto bwks = std::vector<BehaviourWorkSpace*>(nt);
+    for (size_t t = 0; t != nt; ++t) {
+      bwks[t] = &(scs.getBehaviourWorkSpace(t));
+    }
+    // tangent operators computed at each Gauss point
+    auto K = std::vector<tfel::math::matrix<real>>(ng * ne, bwks[0]->k);
+    // results of the behaviour integration for each element
+    auto results = std::vector<std::pair<bool, real>>(ne, {true, real{}});
+    auto integrate = [&](BehaviourWorkSpace& bwk, const size_t ib,
+                         const size_t ie) {
+      for (auto i = ib; i != ie; ++i) {
+        Element::computeStrain(scs, m, u1, i, true);
+        auto& ri = results[i];
+        for (unsigned short g = 0; g != ng; ++g) {
+          setRoundingMode();
+          const auto rb = b.integrate(scs.istates[ng * i + g], bwk, dt, mt);
+          setRoundingMode();
+          ri.second = (g == 0) ? rb.second : std::min(rb.second, ri.second);
+          if (!rb.first) {
+            ri.first = false;
+            break;
+          }
+          if (mt != StiffnessMatrixType::NOSTIFFNESS) {
+            K[ng * i + g] = bwk.k;
+          }
+        }
+      }
+    };
+    auto tasks = std::vector<
+        std::future<tfel::system::ThreadedTaskResult<void>>>{};
+    tasks.reserve(nt);
+    for (size_t t = 0; t != nt; ++t) {
+      const auto ib = (ne * t) / nt;
+      const auto ie = (ne * (t + 1)) / nt;
+      auto& bwk = *(bwks[t]);
+      tasks.push_back(
+          p.addTask([&integrate, &bwk, ib, ie] { integrate(bwk, ib, ie); }));
+    }
+    p.wait();
+    for (auto& task : tasks) {
+      auto tr = task.get();
+      if (!tr) {
+        tr.rethrow();
+      }
+    }
+    // assembly
+    auto r_dt = real{};
+    for (size_t i = 0; i != ne; ++i) {
+      const auto& ri = results[i];
+      r_dt = (i == 0) ? ri.second : std::min(r_dt, ri.second);
+      if (!ri.first) {
+        if (mfront::getVerboseMode() > mfront::VERBOSE_QUIET) {
+          auto& log = mfront::getLogStream();
+          log << "PipeTest::computeStiffnessMatrixAndResidual : "
+              << "behaviour intregration failed in element " << i
+              << std::endl;
+        }
+        return {false, r_dt};
+      }
+      for (unsigned short g = 0; g != ng; ++g) {
+        Element::addGaussPointContribution(k, r, scs.istates[ng * i + g],
+                                           K[ng * i + g], m, mt, i, g);
+      }
+    }
+    return {true, r_dt};
+  }  // end of updateStiffnessMatrixAndInnerForcesInParallel
+
+  /*!
+   * \brief set all the terms of a stiffness matrix to zero
+   * \param[out] k: stiffness matrix
+   */
+  static void resetStiffnessMatrix(tfel::math::matrix<real>& k) {
+    std::fill(k.begin(), k.end(), real(0));
+  }  // end of resetStiffnessMatrix
+
+  /*!
+   * \brief set all the terms of a stiffness matrix to zero, including the
+   * terms used to store the fill-in of a previous decomposition
+   * \param[out] k: stiffness matrix
+   */
+  static void resetStiffnessMatrix(tfel::math::BorderedBandedMatrix<real>& k) {
+    k.zero();
+  }  // end of resetStiffnessMatrix
+
   std::pair<bool, real> PipeTest::computeStiffnessMatrixAndResidual(
       StudyCurrentState& state,
       tfel::math::matrix<real>& k,
@@ -1062,6 +1215,31 @@ namespace mtest {
       const real t,
       const real dt,
       const StiffnessMatrixType mt) const {
+    return this->assembleStiffnessMatrixAndResidual(state, k, r, t, dt, mt);
+  }  // end of computeStiffnessMatrixAndResidual
+
+  std::pair<bool, real> PipeTest::computeStiffnessMatrixAndResidualInWorkSpace(
+      StudyCurrentState& state,
+      SolverWorkSpace& wk,
+      const real t,
+      const real dt,
+      const StiffnessMatrixType mt) const {
+    if (this->linear_solver == BANDEDLINEARSOLVER) {
+      return this->assembleStiffnessMatrixAndResidual(state, wk.Kb, wk.r, t,
+                                                      dt, mt);
+    }
+    return this->assembleStiffnessMatrixAndResidual(state, wk.K, wk.r, t, dt,
+                                                    mt);
+  }  // end of computeStiffnessMatrixAndResidualInWorkSpace
+
+  template <typename MatrixType>
+  std::pair<bool, real> PipeTest::assembleStiffnessMatrixAndResidual(
+      StudyCurrentState& state,
+      MatrixType& k,
+      tfel::math::vector<real>& r,
+      const real t,
+      const real dt,
+      const StiffnessMatrixType mt) const {
     using LE = PipeLinearElement;
     using QE = PipeQuadraticElement;
     using CE = PipeCubicElement;
@@ -1069,7 +1247,7 @@ namespace mtest {
     // reset r and k
     std::fill(r.begin(), r.end(), real(0));
     if (mt != StiffnessMatrixType::NOSTIFFNESS) {
-      std::fill(k.begin(), k.end(), real(0));
+      resetStiffnessMatrix(k);
     }
     // current pipe state
     auto& scs = state.getStructureCurrentState("");
@@ -1235,6 +1413,24 @@ namespace mtest {
       }
     }
     // loop over the elements
+    if (this->thread_pool != nullptr) {
+      if (this->mesh.etype == PipeMesh::LINEAR) {
+        return updateStiffnessMatrixAndInnerForcesInParallel<LE>(
+            *(this->thread_pool), k, r, scs, *(this->b), state.u1, this->mesh,
+            dt, mt);
+      } else if (this->mesh.etype == PipeMesh::QUADRATIC) {
+        return updateStiffnessMatrixAndInnerForcesInParallel<QE>(
+            *(this->thread_pool), k, r, scs, *(this->b), state.u1, this->mesh,
+            dt, mt);
+      } else if (this->mesh.etype == PipeMesh::CUBIC) {
+        return updateStiffnessMatrixAndInnerForcesInParallel<CE>(
+            *(this->thread_pool), k, r, scs, *(this->b), state.u1, this->mesh,
+            dt, mt);
+      }
+      tfel::raise(
+          "PipeTest::computeStiffnessMatrixAndResidual: "
+          "unknown element type");
+    }
     auto r_dt = real{};
     for (size_type i = 0; i != ne; ++i) {
       auto ri = std::pair<bool, real>{};
@@ -1261,7 +1457,7 @@ namespace mtest {
       }
     }
     return {true, r_dt};
-  }  // end of computeStiffnessMatrixAndResidual
+  }  // end of assembleStiffnessMatrixAndResidual
 
   void PipeTest::checkBehaviourConsistency(
       const std::shared_ptr<Behaviour>& bp) {
@@ -1531,7 +1727,7 @@ namespace mtest {
         du(n) += pi * Ri_ * Ri_;
       }
       setRoundingMode();
-      tfel::math::LUSolve::back_substitute(wk.K, du, wk.x, wk.p_lu);
+      this->backSubstitute(wk, du);
       setRoundingMode();
       const real due_dp = *(du.rbegin() + 1);
       auto& Pi = state.getEvolution("InnerPressure");
@@ -1554,7 +1750,7 @@ namespace mtest {
         du(n) += pi * Ri_ * Ri_;
       }
       setRoundingMode();
-      tfel::math::LUSolve::back_substitute(wk.K, du, wk.x, wk.p_lu);
+      this->backSubstitute(wk, du);
       setRoundingMode();
       const real du_dp = du[0];
       auto& Pi = state.getEvolution("InnerPressure");
@@ -1580,7 +1776,7 @@ namespace mtest {
       std::fill(du.begin(), du.end(), real(0));
       du(n) = 1;
       setRoundingMode();
-      tfel::math::LUSolve::back_substitute(wk.K, du, wk.x, wk.p_lu);
+      this->backSubstitute(wk, du);
       setRoundingMode();
       const real dezz_dF = du(n);
       auto& F = state.getEvolution("AxialForce");
@@ -1689,40 +1885,46 @@ namespace mtest {
     if (t == "minimum_value") {
       this->aoutputs.push_back(
           {"minimum value of '" + n + "'",
-           [this, n](std::ostream& os, const StudyCurrentState& s) {
-             os << this->computeMinimumValue(s, n);
+           t + "(" + n + ")",
+           [this, n](const StudyCurrentState& s) {
+             return this->computeMinimumValue(s, n);
            }});
     } else if (t == "maximum_value") {
       this->aoutputs.push_back(
           {"maximum value of '" + n + "'",
-           [this, n](std::ostream& os, const StudyCurrentState& s) {
-             os << this->computeMaximumValue(s, n);
+           t + "(" + n + ")",
+           [this, n](const StudyCurrentState& s) {
+             return this->computeMaximumValue(s, n);
            }});
     } else if (t == "integral_value_initial_configuration") {
       this->aoutputs.push_back(
           {"integral value of '" + n + "' in the initial configuration",
-           [this, n](std::ostream& os, const StudyCurrentState& s) {
-             os << this->computeIntegralValue(s, n);
+           t + "(" + n + ")",
+           [this, n](const StudyCurrentState& s) {
+             return this->computeIntegralValue(s, n);
            }});
     } else if (t == "integral_value_current_configuration") {
       this->aoutputs.push_back(
           {"integral value of '" + n + "' in the current configuration",
-           [this, n](std::ostream& os, const StudyCurrentState& s) {
-             os << this->computeIntegralValue(
+           t + "(" + n + ")",
+           [this, n](const StudyCurrentState& s) {
+             return this->computeIntegralValue(
                  s, n, Configuration::CURRENT_CONFIGURATION);
            }});
     } else if (t == "mean_value_initial_configuration") {
       this->aoutputs.push_back(
           {"mean value of '" + n + "' in the initial configuration",
-           [this, n](std::ostream& os, const StudyCurrentState& s) {
-             os << this->computeMeanValue(s, n);
+           t + "(" + n + ")",
+           [this, n](const StudyCurrentState& s) {
+             return this->computeMeanValue(s, n);
            }});
     } else if (t == "mean_value_current_configuration") {
       this->aoutputs.push_back(
           {"mean value of '" + n + "' in the current configuration",
-           [this, n](std::ostream& os, const StudyCurrentState& s) {
-             os << this->computeMeanValue(s, n,
-                                          Configuration::CURRENT_CONFIGURATION);
+           t + "(" + n + ")",
+           [this, n](const StudyCurrentState& s) {
+             return this->computeMeanValue(
+                 s, n, Configuration::CURRENT_CONFIGURATION);
            }});
     } else {
       tfel::raise(
@@ -1744,6 +1946,21 @@ namespace mtest {
     this->failure_policy = p;
   }  // end of setFailurePolicy
 
+  void PipeTest::setLinearSolver(const LinearSolver ls) {
+    this->linear_solver = ls;
+  }  // end of setLinearSolver
+
+  void PipeTest::setNumberOfThreads(const size_type n) {
+    tfel::raise_if(n == 0,
+                   "PipeTest::setNumberOfThreads: "
+                   "invalid number of threads");
+    if (n == 1) {
+      this->thread_pool.reset();
+      return;
+    }
+    this->thread_pool = std::make_unique<tfel::system::ThreadPool>(n);
+  }  // end of setNumberOfThreads
+
   void PipeTest::addFailureCriterion(const std::string& n,
                                      const tfel::utilities::DataMap& m) {
     tfel::raise_if(this->initialisationFinished,
@@ -2135,57 +2352,110 @@ namespace mtest {
     this->T0 = T;
   }  // end of setFillingTemperature
 
-  void PipeTest::printOutput(const real t,
-                             const StudyCurrentState& state,
-                             const bool o) const {
-    if ((!o) && (this->output_frequency == USERDEFINEDTIMES)) {
-      return;
+  std::vector<PipeTest::OutputColumn> PipeTest::getOutputColumns() const {
+    auto c = std::vector<OutputColumn>{
+        {"time", "time"},
+        {"InnerRadius", "inner radius"},
+        {"OuterRadius", "outer radius"},
+        {"InnerRadiusDisplacement", "inner radius displacement"},
+        {"OuterRadiusDisplacement", "outer radius displacement"},
+        {"AxialDisplacement", "axial displacement"}};
+    if ((this->rl == IMPOSEDINNERRADIUS) || (this->rl == IMPOSEDOUTERRADIUS) ||
+        (this->rl == TIGHTPIPE)) {
+      c.push_back({"InnerPressure", "inner pressure"});
+    } else if (this->mandrel_radius_evolution != nullptr) {
+      c.push_back({"ContactPressure", "contact pressure"});
     }
-    if (!this->out) {
-      return;
+    if ((this->al == IMPOSEDAXIALGROWTH) ||
+        (this->mandrel_axial_growth_evolution != nullptr)) {
+      c.push_back({"AxialForce", "axial force"});
+    }
+    if (this->mandrel_radius_evolution != nullptr) {
+      c.push_back({"MandrelContactIndicator", "mandrel contact indicator"});
     }
+    for (const auto& ao : this->aoutputs) {
+      c.push_back({ao.n, ao.d});
+    }
+    if (this->inner_boundary_oxidation_model.model != nullptr) {
+      c.push_back({"InnerBoundaryOxidationLength",
+                   "oxidation length at the inner boundary"});
+    }
+    if (this->outer_boundary_oxidation_model.model != nullptr) {
+      c.push_back({"OuterBoundaryOxidationLength",
+                   "oxidation length at the outer boundary"});
+    }
+    for (const auto& fc : this->failure_criteria) {
+      c.push_back({fc->getName() + "Status",
+                   "status of the " + fc->getName() + " criterion"});
+    }
+    return c;
+  }  // end of getOutputColumns
+
+  std::vector<real> PipeTest::getOutputValues(
+      const real t, const StudyCurrentState& state) const {
     const auto& u1 = state.u1;
     const auto n = this->getNumberOfNodes();
     // inner radius
     const auto Ri = this->mesh.inner_radius;
     // outer radius
     const auto Re = this->mesh.outer_radius;
-    this->out << t << " " << Ri + u1[0] << " " << Re + u1[n - 1] << " " << u1[0]
-              << " " << u1[n - 1] << " " << u1[n];
+    auto v = std::vector<real>{t,     Ri + u1[0],     Re + u1[n - 1],
+                               u1[0], u1[n - 1], u1[n]};
     if ((this->rl == IMPOSEDOUTERRADIUS) || (this->rl == IMPOSEDINNERRADIUS) ||
         (this->rl == TIGHTPIPE) ||
         (this->mandrel_radius_evolution != nullptr)) {
-      this->out << " " << state.getEvolution("InnerPressure")(t);
+      v.push_back(state.getEvolution("InnerPressure")(t));
     }
     if ((this->al == IMPOSEDAXIALGROWTH) ||
         (this->mandrel_axial_growth_evolution != nullptr)) {
-      this->out << " " << state.getEvolution("AxialForce")(t);
+      v.push_back(state.getEvolution("AxialForce")(t));
     }
     if (this->mandrel_radius_evolution != nullptr) {
-      if (state.containsParameter("MandrelContactStateAtEndOfTimeStep")) {
-        if (state.getParameter<bool>("MandrelContactStateAtEndOfTimeStep")) {
-          this->out << " " << 1;
-        } else {
-          this->out << " " << 0;
-        }
-      } else {
-        this->out << " " << 0;
-      }
+      const auto contact =
+          state.containsParameter("MandrelContactStateAtEndOfTimeStep") &&
+          state.getParameter<bool>("MandrelContactStateAtEndOfTimeStep");
+      v.push_back(contact ? 1 : 0);
     }
     for (const auto& ao : this->aoutputs) {
-      this->out << " ";
-      ao.f(out, state);
+      v.push_back(ao.f(state));
     }
     if (this->inner_boundary_oxidation_model.model != nullptr) {
-      this->out << getOxidationLength(state,
-                                      this->inner_boundary_oxidation_model);
+      v.push_back(
+          getOxidationLength(state, this->inner_boundary_oxidation_model));
     }
     if (this->outer_boundary_oxidation_model.model != nullptr) {
-      this->out << getOxidationLength(state,
-                                      this->outer_boundary_oxidation_model);
+      v.push_back(
+          getOxidationLength(state, this->outer_boundary_oxidation_model));
     }
     for (std::size_t i = 0; i != this->failure_criteria.size(); ++i) {
-      this->out << " " << (state.getFailureCriterionStatus(i) ? 1 : 0);
+      v.push_back(state.getFailureCriterionStatus(i) ? 1 : 0);
+    }
+    return v;
+  }  // end of getOutputValues
+
+  void PipeTest::printOutput(const real t,
+                             const StudyCurrentState& state,
+                             const bool o) const {
+    if ((!o) && (this->output_frequency == USERDEFINEDTIMES)) {
+      return;
+    }
+    if (this->bout != nullptr) {
+      auto& w = *(this->bout);
+      for (const auto v : this->getOutputValues(t, state)) {
+        w.write(v);
+      }
+      w.endLine();
+      return;
+    }
+    if (!this->out) {
+      return;
+    }
+    const auto values = this->getOutputValues(t, state);
+    for (auto p = values.begin(); p != values.end(); ++p) {
+      if (p != values.begin()) {
+        this->out << ' ';
+      }
+      this->out << *p;
     }
     this->out << '\n';
   }  // end of printOutput
@@ -274,6 +274,10 @@ namespace mtest {
                            &PipeTestParser::handleFailurePolicy);
     this->registerCallBack("@FailureCriterion",
                            &PipeTestParser::handleFailureCriterion);
+    this->registerCallBack("@LinearSolver",
+                           &PipeTestParser::handleLinearSolver);
+    this->registerCallBack("@NumberOfThreads",
+                           &PipeTestParser::handleNumberOfThreads);
     this->registerCallBack("@OxidationModel",
                            &PipeTestParser::handleOxidationModel);
   }
@@ -809,6 +813,38 @@ namespace mtest {
     }
   }  // end of handleFailurePolicy
 
+  void PipeTestParser::handleLinearSolver(PipeTest& t, tokens_iterator& p) {
+    this->checkNotEndOfLine("PipeTestParser::handleLinearSolver", p,
+                            this->tokens.end());
+    const auto s = this->readString(p, this->tokens.end());
+    this->readSpecifiedToken("PipeTestParser::handleLinearSolver", ";", p,
+                             this->tokens.end());
+    if (s == "Dense") {
+      t.setLinearSolver(PipeTest::DENSELINEARSOLVER);
+    } else if (s == "Banded") {
+      t.setLinearSolver(PipeTest::BANDEDLINEARSOLVER);
+    } else {
+      tfel::raise(
+          "PipeTestParser::handleLinearSolver: "
+          "invalid linear solver '" +
+          s + "'. Valid linear solvers are 'Dense' and 'Banded'");
+    }
+  }  // end of handleLinearSolver
+
+  void PipeTestParser::handleNumberOfThreads(PipeTest& t, tokens_iterator& p) {
+    this->checkNotEndOfLine("PipeTestParser::handleNumberOfThreads", p,
+                            this->tokens.end());
+    const auto n = this->readUnsignedInt(p, this->tokens.end());
+    if (n == 0) {
+      tfel::raise(
+          "PipeTestParser::handleNumberOfThreads: "
+          "invalid number of threads");
+    }
+    t.setNumberOfThreads(n);
+    this->readSpecifiedToken("PipeTestParser::handleNumberOfThreads", ";", p,
+                             this->tokens.end());
+  }  // end of handleNumberOfThreads
+
   void PipeTestParser::handleFailureCriterion(PipeTest& t, tokens_iterator& p) {
     this->checkNotEndOfLine("PipeTestParser::handleFailureCriterion", p,
                             this->tokens.end());
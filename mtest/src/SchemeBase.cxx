@@ -312,7 +312,14 @@ namespace mtest {
 
   void SchemeBase::resetOutputFile() {
     // output file
-    if (!this->output.empty()) {
+    if (this->useBinaryOutputFile()) {
+      this->out.close();
+      this->bout.reset();
+      if (!this->binary_output_columns.empty()) {
+        this->bout = std::make_unique<tfel::utilities::BinaryDataWriter>(
+            this->output, this->binary_output_columns);
+      }
+    } else if (!this->output.empty()) {
       this->out.close();
       this->out.open(this->output.c_str());
       tfel::raise_if(!this->out,
@@ -438,6 +445,13 @@ namespace mtest {
     return !this->output.empty();
   }
 
+  std::string SchemeBase::getOutputFileName() const {
+    tfel::raise_if(this->output.empty(),
+                   "SchemeBase::getOutputFileName: "
+                   "output file name not defined");
+    return this->output;
+  }
+
   void SchemeBase::setOutputFilePrecision(const unsigned int p) {
     tfel::raise_if(this->oprec != -1,
                    "SchemeBase::setOutputFileName: "
@@ -445,6 +459,48 @@ namespace mtest {
     this->oprec = static_cast<int>(p);
   }
 
+  void SchemeBase::setOutputFileFormat(const std::string& f) {
+    tfel::raise_if(this->output_format != UNSPECIFIEDOUTPUTFILEFORMAT,
+                   "SchemeBase::setOutputFileFormat: "
+                   "output file format already defined");
+    if (f == "text") {
+      this->output_format = TEXTOUTPUTFILEFORMAT;
+    } else if (f == "binary") {
+      this->output_format = BINARYOUTPUTFILEFORMAT;
+    } else {
+      tfel::raise(
+          "SchemeBase::setOutputFileFormat: "
+          "invalid output file format '" +
+          f + "' (expected 'text' or 'binary')");
+    }
+  }  // end of setOutputFileFormat
+
+  bool SchemeBase::isOutputFileFormatDefined() const {
+    return this->output_format != UNSPECIFIEDOUTPUTFILEFORMAT;
+  }  // end of isOutputFileFormatDefined
+
+  bool SchemeBase::useBinaryOutputFile() const {
+    return (!this->output.empty()) &&
+           (this->output_format == BINARYOUTPUTFILEFORMAT);
+  }  // end of useBinaryOutputFile
+
+  void SchemeBase::setBinaryOutputFileColumns(
+      const std::vector<std::string>& c) {
+    this->binary_output_columns = c;
+    if (this->useBinaryOutputFile()) {
+      this->bout = std::make_unique<tfel::utilities::BinaryDataWriter>(
+          this->output, this->binary_output_columns);
+    }
+  }  // end of setBinaryOutputFileColumns
+
+  void SchemeBase::flushOutputFile() const {
+    if (this->bout != nullptr) {
+      this->bout->flush();
+    } else {
+      this->out.flush();
+    }
+  }  // end of flushOutputFile
+
   void SchemeBase::setResidualFileName(const std::string& o) {
     tfel::raise_if(!this->residualFileName.empty(),
                    "SchemeBase::setResidualFileName : "
@@ -456,6 +512,31 @@ namespace mtest {
     return !this->residualFileName.empty();
   }
 
+  std::string SchemeBase::getResidualFileName() const {
+    tfel::raise_if(this->residualFileName.empty(),
+                   "SchemeBase::getResidualFileName: "
+                   "residual file name not defined");
+    return this->residualFileName;
+  }
+
+  void SchemeBase::appendSuffixToOutputFileNames(const std::string& s) {
+    auto append = [&s](std::string& f) {
+      if (f.empty()) {
+        return;
+      }
+      const auto pos = f.rfind('.');
+      const auto pos2 = f.find_last_of("/\\");
+      if ((pos == std::string::npos) ||
+          ((pos2 != std::string::npos) && (pos < pos2))) {
+        f += s;
+      } else {
+        f.insert(pos, s);
+      }
+    };
+    append(this->output);
+    append(this->residualFileName);
+  }  // end of appendSuffixToOutputFileNames
+
   void SchemeBase::setResidualFilePrecision(const unsigned int p) {
     tfel::raise_if(this->rprec != -1,
                    "SchemeBase::setResidualFileName: "
@@ -481,6 +562,10 @@ namespace mtest {
     return this->xmlFileName;
   }
 
+  bool SchemeBase::definesParameters() const { return false; }
+
+  void SchemeBase::applyParameters() const {}
+
   SchemeBase::~SchemeBase() = default;
 
 }  // end of namespace mtest
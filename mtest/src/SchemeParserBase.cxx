@@ -190,6 +190,13 @@ namespace mtest {
                              ";", p, this->tokens.end());
   }  // end of SchemeParserBase::handleOutputFilePrecision
 
+  void SchemeParserBase::handleOutputFileFormat(SchemeBase& t,
+                                                tokens_iterator& p) {
+    t.setOutputFileFormat(this->readString(p, this->tokens.end()));
+    this->readSpecifiedToken("SchemeParserBase::handleOutputFileFormat", ";",
+                             p, this->tokens.end());
+  }  // end of SchemeParserBase::handleOutputFileFormat
+
   void SchemeParserBase::handleResidualFile(SchemeBase& t, tokens_iterator& p) {
     t.setResidualFileName(this->readString(p, this->tokens.end()));
     this->readSpecifiedToken("SchemeParserBase::handleResidualFiles", ";", p,
@@ -747,6 +754,7 @@ namespace mtest {
     add("@XMLOutputFile", &SchemeParserBase::handleXMLOutputFile);
     add("@OutputFrequency", &SchemeParserBase::handleOutputFrequency);
     add("@OutputFilePrecision", &SchemeParserBase::handleOutputFilePrecision);
+    add("@OutputFileFormat", &SchemeParserBase::handleOutputFileFormat);
     add("@ResidualFile", &SchemeParserBase::handleResidualFile);
     add("@ResidualFilePrecision",
         &SchemeParserBase::handleResidualFilePrecision);
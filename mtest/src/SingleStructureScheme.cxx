@@ -166,6 +166,7 @@ namespace mtest {
                    "SingleStructureScheme::setParameter: "
                    "no behaviour defined");
     this->b->setParameter(n, v);
+    this->parameters[n] = v;
   }
 
   void SingleStructureScheme::setIntegerParameter(const std::string& n,
@@ -174,6 +175,7 @@ namespace mtest {
                    "SingleStructureScheme::setIntegerParameter: "
                    "no behaviour defined");
     this->b->setIntegerParameter(n, v);
+    this->integer_parameters[n] = v;
   }
 
   void SingleStructureScheme::setUnsignedIntegerParameter(
@@ -182,8 +184,32 @@ namespace mtest {
                    "SingleStructureScheme::setUnsignedIntegerParameter: "
                    "no behaviour defined");
     this->b->setUnsignedIntegerParameter(n, v);
+    this->unsigned_integer_parameters[n] = v;
   }
 
+  bool SingleStructureScheme::definesParameters() const {
+    return !(this->parameters.empty() && this->integer_parameters.empty() &&
+             this->unsigned_integer_parameters.empty());
+  }  // end of definesParameters
+
+  void SingleStructureScheme::applyParameters() const {
+    if (!this->definesParameters()) {
+      return;
+    }
+    tfel::raise_if(this->b == nullptr,
+                   "SingleStructureScheme::applyParameters: "
+                   "no behaviour defined");
+    for (const auto& [n, v] : this->parameters) {
+      this->b->setParameter(n, v);
+    }
+    for (const auto& [n, v] : this->integer_parameters) {
+      this->b->setIntegerParameter(n, v);
+    }
+    for (const auto& [n, v] : this->unsigned_integer_parameters) {
+      this->b->setUnsignedIntegerParameter(n, v);
+    }
+  }  // end of applyParameters
+
   tfel::material::MechanicalBehaviourBase::BehaviourType
   SingleStructureScheme::getBehaviourType() const {
     tfel::raise_if(this->b == nullptr,
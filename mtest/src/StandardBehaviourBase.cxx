@@ -53,7 +53,8 @@ namespace mtest {
   StandardBehaviourDescription::StandardBehaviourDescription(
       const std::string& l, const std::string& b, const std::string& h) {
     using namespace tfel::system;
-    ExternalBehaviourData::operator=(ExternalBehaviourDescription(l, b, h));
+    auto& elm = ExternalLibraryManager::getExternalLibraryManager();
+    ExternalBehaviourData::operator=(*(elm.describe(l, b, h)));
   }  // end of StandardBehaviourDescription
 
   void StandardBehaviourBase::allocateCurrentState(CurrentState& s) const {
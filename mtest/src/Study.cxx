@@ -11,10 +11,31 @@
  * project under specific licensing conditions.
  */
 
+#include "TFEL/Math/LUSolve.hxx"
+#include "MTest/SolverWorkSpace.hxx"
 #include "MTest/Study.hxx"
 
 namespace mtest {
 
+  std::pair<bool, real> Study::computeStiffnessMatrixAndResidualInWorkSpace(
+      StudyCurrentState& s,
+      SolverWorkSpace& wk,
+      const real t,
+      const real dt,
+      const StiffnessMatrixType mt) const {
+    return this->computeStiffnessMatrixAndResidual(s, wk.K, wk.r, t, dt, mt);
+  }  // end of computeStiffnessMatrixAndResidualInWorkSpace
+
+  void Study::solveLinearSystem(SolverWorkSpace& wk,
+                                tfel::math::vector<real>& x) const {
+    tfel::math::LUSolve::exe(wk.K, x, wk.x, wk.p_lu);
+  }  // end of solveLinearSystem
+
+  void Study::backSubstitute(SolverWorkSpace& wk,
+                             tfel::math::vector<real>& x) const {
+    tfel::math::LUSolve::back_substitute(wk.K, x, wk.x, wk.p_lu);
+  }  // end of backSubstitute
+
   Study::~Study() = default;
 
 }  // end of namespace mtest
@@ -0,0 +1,695 @@
+/*!
+ * \file   src/Math/Bytecode.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright Copyright (C) 2006-2025 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <bit>
+#include <span>
+#include <array>
+#include <cmath>
+#include <cerrno>
+#include <limits>
+#include <utility>
+#include <algorithm>
+#include "TFEL/Raise.hxx"
+#include "TFEL/Math/Parser/Expr.hxx"
+#include "TFEL/Math/Parser/LogicalExpr.hxx"
+#include "TFEL/Math/Parser/BinaryOperator.hxx"
+#include "TFEL/Math/Parser/Function.hxx"
+#include "TFEL/Math/Parser/BinaryFunction.hxx"
+#include "TFEL/Math/Parser/ExternalFunctionExpr.hxx"
+#include "TFEL/Math/Parser/Bytecode.hxx"
+
+namespace tfel::math::parser {
+
+  static double toDouble(const bool b) {
+    return b ? 1 : 0;
+  }  // end of toDouble
+
+  static bool toBool(const double v) {
+    // logical values are stored as 0 or 1
+    return v > 0.5;
+  }  // end of toBool
+
+  static bool isDivisorTooSmall(const double v) {
+    return std::abs(v) < std::numeric_limits<double>::min();
+  }  // end of isDivisorTooSmall
+
+  static double callUnaryFunction(const Bytecode::UnaryFunctionPtr f,
+                                  const double a) {
+    const auto old = errno;
+    errno = 0;
+    const auto res = f(a);
+    if (errno != 0) {
+      const auto e = errno;
+      errno = old;
+      FunctionBase::throwInvalidCallException(a, e);
+    }
+    errno = old;
+    return res;
+  }  // end of callUnaryFunction
+
+  static double callBinaryFunction(const Bytecode::BinaryFunctionPtr f,
+                                   const double a,
+                                   const double b) {
+    const auto old = errno;
+    errno = 0;
+    const auto res = f(a, b);
+    if (errno != 0) {
+      const auto e = errno;
+      errno = old;
+      StandardBinaryFunctionBase::throwInvalidCallException(e);
+    }
+    errno = old;
+    return res;
+  }  // end of callBinaryFunction
+
+  /*!
+   * \brief execute an instruction
+   * \return the index of the next instruction
+   * \param[in] i: instruction
+   * \param[in,out] r: registers
+   * \param[in] args: registers holding the arguments of the external
+   * functions
+   * \param[in] pc: index of the instruction
+   */
+  static inline Bytecode::size_type executeInstruction(
+      const Bytecode::Instruction& i,
+      double* const r,
+      const Bytecode::size_type* const args,
+      const Bytecode::size_type pc) {
+    switch (i.opcode) {
+      case Bytecode::COPY:
+        r[i.r] = r[i.a];
+        break;
+      case Bytecode::NEGATION:
+        r[i.r] = -r[i.a];
+        break;
+      case Bytecode::ADDITION:
+        r[i.r] = r[i.a] + r[i.b];
+        break;
+      case Bytecode::SUBTRACTION:
+        r[i.r] = r[i.a] - r[i.b];
+        break;
+      case Bytecode::MULTIPLICATION:
+        r[i.r] = r[i.a] * r[i.b];
+        break;
+      case Bytecode::DIVISION:
+        if (isDivisorTooSmall(r[i.b])) [[unlikely]] {
+          // throws the same exception than the tree walking evaluation
+          r[i.r] = OpDiv::apply(r[i.a], r[i.b]);
+        }
+        r[i.r] = r[i.a] / r[i.b];
+        break;
+      case Bytecode::POWER:
+        r[i.r] = std::pow(r[i.a], r[i.b]);
+        break;
+      case Bytecode::UNARYFUNCTION:
+        r[i.r] = callUnaryFunction(i.f1, r[i.a]);
+        break;
+      case Bytecode::UNARYOPERATION:
+        r[i.r] = i.f1(r[i.a]);
+        break;
+      case Bytecode::BINARYFUNCTION:
+        r[i.r] = callBinaryFunction(i.f2, r[i.a], r[i.b]);
+        break;
+      case Bytecode::COMPARISON:
+        r[i.r] = toDouble(i.c(r[i.a], r[i.b]));
+        break;
+      case Bytecode::LOGICALOPERATION:
+        r[i.r] = toDouble(i.l(toBool(r[i.a]), toBool(r[i.b])));
+        break;
+      case Bytecode::LOGICALNEGATION:
+        r[i.r] = toDouble(!toBool(r[i.a]));
+        break;
+      case Bytecode::EXPRESSION:
+        r[i.r] = i.e->getValue();
+        break;
+      case Bytecode::LOGICALEXPRESSION:
+        r[i.r] = toDouble(i.le->getValue());
+        break;
+      case Bytecode::EXTERNALFUNCTION: {
+        auto& f = i.ef->getExternalFunction();
+        for (Bytecode::size_type k = 0; k != i.b; ++k) {
+          f.setVariableValue(k, r[args[i.a + k]]);
+        }
+        r[i.r] = f.getValue();
+        break;
+      }
+      case Bytecode::JUMP:
+        return i.r;
+      case Bytecode::JUMPIFFALSE:
+        return toBool(r[i.a]) ? pc + 1 : i.r;
+    }
+    return pc + 1;
+  }  // end of executeInstruction
+
+  /*!
+   * \brief execute an instruction which is not a jump on many points
+   * \param[in] i: instruction
+   * \param[in,out] regs: registers
+   * \param[in] args: registers holding the arguments of the external
+   * functions
+   * \param[in] s: stride between two registers
+   * \param[in] n: number of points
+   */
+  static void executeVectorizedInstruction(
+      const Bytecode::Instruction& i,
+      double* const regs,
+      const Bytecode::size_type* const args,
+      const Bytecode::size_type s,
+      const Bytecode::size_type n) {
+    using size_type = Bytecode::size_type;
+    auto* const r = regs + i.r * s;
+    const auto* const a = regs + i.a * s;
+    const auto* const b = regs + i.b * s;
+    switch (i.opcode) {
+      case Bytecode::COPY:
+        std::copy(a, a + n, r);
+        break;
+      case Bytecode::NEGATION:
+        for (size_type k = 0; k != n; ++k) {
+          r[k] = -a[k];
+        }
+        break;
+      case Bytecode::ADDITION:
+        for (size_type k = 0; k != n; ++k) {
+          r[k] = a[k] + b[k];
+        }
+        break;
+      case Bytecode::SUBTRACTION:
+        for (size_type k = 0; k != n; ++k) {
+          r[k] = a[k] - b[k];
+        }
+        break;
+      case Bytecode::MULTIPLICATION:
+        for (size_type k = 0; k != n; ++k) {
+          r[k] = a[k] * b[k];
+        }
+        break;
+      case Bytecode::DIVISION:
+        for (size_type k = 0; k != n; ++k) {
+          if (isDivisorTooSmall(b[k])) {
+            r[k] = OpDiv::apply(a[k], b[k]);
+          }
+        }
+        for (size_type k = 0; k != n; ++k) {
+          r[k] = a[k] / b[k];
+        }
+        break;
+      case Bytecode::POWER:
+        for (size_type k = 0; k != n; ++k) {
+          r[k] = std::pow(a[k], b[k]);
+        }
+        break;
+      case Bytecode::UNARYFUNCTION: {
+        const auto old = errno;
+        errno = 0;
+        for (size_type k = 0; k != n; ++k) {
+          r[k] = i.f1(a[k]);
+        }
+        if (errno != 0) {
+          // find the faulty argument to report it
+          errno = old;
+          for (size_type k = 0; k != n; ++k) {
+            r[k] = callUnaryFunction(i.f1, a[k]);
+          }
+        }
+        errno = old;
+        break;
+      }
+      case Bytecode::UNARYOPERATION:
+        for (size_type k = 0; k != n; ++k) {
+          r[k] = i.f1(a[k]);
+        }
+        break;
+      case Bytecode::BINARYFUNCTION: {
+        const auto old = errno;
+        errno = 0;
+        for (size_type k = 0; k != n; ++k) {
+          r[k] = i.f2(a[k], b[k]);
+        }
+        if (errno != 0) {
+          const auto e = errno;
+          errno = old;
+          StandardBinaryFunctionBase::throwInvalidCallException(e);
+        }
+        errno = old;
+        break;
+      }
+      case Bytecode::COMPARISON:
+        for (size_type k = 0; k != n; ++k) {
+          r[k] = toDouble(i.c(a[k], b[k]));
+        }
+        break;
+      case Bytecode::LOGICALOPERATION:
+        for (size_type k = 0; k != n; ++k) {
+          r[k] = toDouble(i.l(toBool(a[k]), toBool(b[k])));
+        }
+        break;
+      case Bytecode::LOGICALNEGATION:
+        for (size_type k = 0; k != n; ++k) {
+          r[k] = toDouble(!toBool(a[k]));
+        }
+        break;
+      case Bytecode::EXTERNALFUNCTION: {
+        auto values = std::vector<std::span<const double>>{};
+        values.reserve(i.b);
+        for (size_type k = 0; k != i.b; ++k) {
+          values.emplace_back(regs + args[i.a + k] * s, n);
+        }
+        i.ef->getExternalFunction().getValues(std::span<double>(r, n),
+                                              values);
+        break;
+      }
+      case Bytecode::EXPRESSION:
+      case Bytecode::LOGICALEXPRESSION:
+      case Bytecode::JUMP:
+      case Bytecode::JUMPIFFALSE:
+        tfel::raise(
+            "executeVectorizedInstruction: "
+            "unsupported instruction");
+    }
+  }  // end of executeVectorizedInstruction
+
+  /*!
+   * \return the value hold by the output register
+   * \param[in] instructions: instructions
+   * \param[in] constants: values of the constants
+   * \param[in] args: registers holding the arguments of the external
+   * functions
+   * \param[in] nv: number of variables
+   * \param[in] o: output register
+   * \param[in] r: registers
+   * \param[in] v: values of the variables
+   */
+  static inline double interpret(
+      const std::vector<Bytecode::Instruction>& instructions,
+      const std::vector<double>& constants,
+      const std::vector<Bytecode::size_type>& args,
+      const Bytecode::size_type nv,
+      const Bytecode::size_type o,
+      double* const r,
+      const double* const v) {
+    using size_type = Bytecode::size_type;
+    const auto nc = constants.size();
+    for (size_type k = 0; k != nv; ++k) {
+      r[k] = v[k];
+    }
+    for (size_type k = 0; k != nc; ++k) {
+      r[nv + k] = constants[k];
+    }
+    const auto* const instructions_ptr = instructions.data();
+    const auto* const args_ptr = args.data();
+    const auto ni = instructions.size();
+    auto pc = size_type{};
+    while (pc != ni) {
+      pc = executeInstruction(instructions_ptr[pc], r, args_ptr, pc);
+    }
+    return r[o];
+  }  // end of interpret
+
+  double Bytecode::execute(const double* const v) const {
+    constexpr size_type n = 128;
+    // registers are not initialised on purpose
+    std::array<double, n> stack_registers;
+    auto heap_registers = std::vector<double>{};
+    auto* r = stack_registers.data();
+    if (this->number_of_registers > n) [[unlikely]] {
+      heap_registers.resize(this->number_of_registers);
+      r = heap_registers.data();
+    }
+    return interpret(this->instructions, this->constants, this->arguments,
+                     this->number_of_variables, this->output, r, v);
+  }  // end of execute
+
+  bool Bytecode::isVectorizable() const noexcept {
+    return this->vectorizable;
+  }  // end of isVectorizable
+
+  void Bytecode::execute(double* const results,
+                         const double* const* const v,
+                         const size_type n) const {
+    raise_if(!this->vectorizable,
+             "Bytecode::execute: "
+             "the bytecode can't be vectorized");
+    constexpr auto s = Bytecode::chunk_size;
+    auto regs = std::vector<double>(this->number_of_registers * s);
+    for (size_type c = 0; c != this->constants.size(); ++c) {
+      auto* const r = regs.data() + (this->number_of_variables + c) * s;
+      std::fill(r, r + s, this->constants[c]);
+    }
+    for (size_type o = 0; o < n; o += s) {
+      const auto m = std::min(s, n - o);
+      for (size_type k = 0; k != this->number_of_variables; ++k) {
+        std::copy(v[k] + o, v[k] + o + m, regs.data() + k * s);
+      }
+      for (const auto& i : this->instructions) {
+        executeVectorizedInstruction(i, regs.data(), this->arguments.data(),
+                                     s, m);
+      }
+      const auto* const r = regs.data() + this->output * s;
+      std::copy(r, r + m, results + o);
+    }
+  }  // end of execute
+
+  Bytecode::size_type Bytecode::getNumberOfInstructions() const noexcept {
+    return this->instructions.size();
+  }  // end of getNumberOfInstructions
+
+  Bytecode::size_type Bytecode::getNumberOfRegisters() const noexcept {
+    return this->number_of_registers;
+  }  // end of getNumberOfRegisters
+
+  BytecodeCompiler::BytecodeCompiler(const size_type n)
+      : number_of_variables(n),
+        number_of_registers(n) {}  // end of BytecodeCompiler
+
+  BytecodeCompiler::size_type BytecodeCompiler::getVariableRegister(
+      const size_type p) const {
+    raise_if(p >= this->number_of_variables,
+             "BytecodeCompiler::getVariableRegister: "
+             "invalid variable position");
+    return p;
+  }  // end of getVariableRegister
+
+  BytecodeCompiler::size_type BytecodeCompiler::addConstant(const double v) {
+    const auto key = std::bit_cast<std::uint64_t>(v);
+    const auto p = this->constants_registers.find(key);
+    if (p != this->constants_registers.end()) {
+      return p->second;
+    }
+    const auto r = this->number_of_registers;
+    ++(this->number_of_registers);
+    this->constants_registers.insert({key, r});
+    this->constants_values.insert({r, v});
+    return r;
+  }  // end of addConstant
+
+  bool BytecodeCompiler::isConstant(const size_type r) const {
+    return this->constants_values.count(r) != 0;
+  }  // end of isConstant
+
+  double BytecodeCompiler::getConstantValue(const size_type r) const {
+    const auto p = this->constants_values.find(r);
+    raise_if(p == this->constants_values.end(),
+             "BytecodeCompiler::getConstantValue: "
+             "register does not hold a constant");
+    return p->second;
+  }  // end of getConstantValue
+
+  BytecodeCompiler::size_type BytecodeCompiler::addNegation(const size_type a) {
+    auto i = Bytecode::Instruction{};
+    i.opcode = Bytecode::NEGATION;
+    i.a = i.b = a;
+    return this->addInstruction(i);
+  }  // end of addNegation
+
+  BytecodeCompiler::size_type BytecodeCompiler::addOperation(
+      const OpCode op, const size_type a, const size_type b) {
+    raise_if((op != Bytecode::ADDITION) && (op != Bytecode::SUBTRACTION) &&
+                 (op != Bytecode::MULTIPLICATION) &&
+                 (op != Bytecode::DIVISION) && (op != Bytecode::POWER),
+             "BytecodeCompiler::addOperation: invalid operation");
+    auto i = Bytecode::Instruction{};
+    i.opcode = op;
+    i.a = a;
+    i.b = b;
+    if ((op == Bytecode::ADDITION) || (op == Bytecode::MULTIPLICATION)) {
+      // those operations are commutative: ordering the operands allows
+      // to detect more common sub-expressions
+      if (i.b < i.a) {
+        std::swap(i.a, i.b);
+      }
+    }
+    return this->addInstruction(i);
+  }  // end of addOperation
+
+  BytecodeCompiler::size_type BytecodeCompiler::addUnaryFunction(
+      const Bytecode::UnaryFunctionPtr f, const size_type a) {
+    auto i = Bytecode::Instruction{};
+    i.opcode = Bytecode::UNARYFUNCTION;
+    i.a = i.b = a;
+    i.f1 = f;
+    return this->addInstruction(i);
+  }  // end of addUnaryFunction
+
+  BytecodeCompiler::size_type BytecodeCompiler::addUnaryOperation(
+      const Bytecode::UnaryFunctionPtr f, const size_type a) {
+    auto i = Bytecode::Instruction{};
+    i.opcode = Bytecode::UNARYOPERATION;
+    i.a = i.b = a;
+    i.f1 = f;
+    return this->addInstruction(i);
+  }  // end of addUnaryOperation
+
+  BytecodeCompiler::size_type BytecodeCompiler::addBinaryFunction(
+      const Bytecode::BinaryFunctionPtr f, const size_type a, const size_type b) {
+    auto i = Bytecode::Instruction{};
+    i.opcode = Bytecode::BINARYFUNCTION;
+    i.a = a;
+    i.b = b;
+    i.f2 = f;
+    return this->addInstruction(i);
+  }  // end of addBinaryFunction
+
+  BytecodeCompiler::size_type BytecodeCompiler::addComparison(
+      const Bytecode::ComparisonOperatorPtr c,
+      const size_type a,
+      const size_type b) {
+    auto i = Bytecode::Instruction{};
+    i.opcode = Bytecode::COMPARISON;
+    i.a = a;
+    i.b = b;
+    i.c = c;
+    return this->addInstruction(i);
+  }  // end of addComparison
+
+  BytecodeCompiler::size_type BytecodeCompiler::addLogicalOperation(
+      const Bytecode::LogicalOperatorPtr l, const size_type a, const size_type b) {
+    auto i = Bytecode::Instruction{};
+    i.opcode = Bytecode::LOGICALOPERATION;
+    i.a = a;
+    i.b = b;
+    i.l = l;
+    return this->addInstruction(i);
+  }  // end of addLogicalOperation
+
+  BytecodeCompiler::size_type BytecodeCompiler::addLogicalNegation(
+      const size_type a) {
+    auto i = Bytecode::Instruction{};
+    i.opcode = Bytecode::LOGICALNEGATION;
+    i.a = i.b = a;
+    return this->addInstruction(i);
+  }  // end of addLogicalNegation
+
+  BytecodeCompiler::size_type BytecodeCompiler::addConditionalExpression(
+      const size_type c, const Expr& a, const Expr& b) {
+    if (this->isConstant(c)) {
+      // only the selected branch is compiled
+      return toBool(this->getConstantValue(c)) ? a.compile(*this)
+                                               : b.compile(*this);
+    }
+    this->vectorizable = false;
+    const auto r = this->number_of_registers;
+    ++(this->number_of_registers);
+    // the results of the instructions of one branch can't be reused outside
+    // this branch
+    const auto ni = this->available_instructions.size();
+    auto compile_branch = [this, r, ni](const Expr& e) {
+      auto i = Bytecode::Instruction{};
+      i.opcode = Bytecode::COPY;
+      i.r = r;
+      i.a = i.b = e.compile(*this);
+      this->instructions.push_back(i);
+      this->available_instructions.resize(ni);
+    };
+    auto jump_if_false = Bytecode::Instruction{};
+    jump_if_false.opcode = Bytecode::JUMPIFFALSE;
+    jump_if_false.a = jump_if_false.b = c;
+    const auto pjf = this->instructions.size();
+    this->instructions.push_back(jump_if_false);
+    compile_branch(a);
+    auto jump = Bytecode::Instruction{};
+    jump.opcode = Bytecode::JUMP;
+    const auto pj = this->instructions.size();
+    this->instructions.push_back(jump);
+    this->instructions[pjf].r = this->instructions.size();
+    compile_branch(b);
+    this->instructions[pj].r = this->instructions.size();
+    return r;
+  }  // end of addConditionalExpression
+
+  BytecodeCompiler::size_type BytecodeCompiler::addExpression(const Expr& e) {
+    this->vectorizable = false;
+    auto i = Bytecode::Instruction{};
+    i.opcode = Bytecode::EXPRESSION;
+    i.e = &e;
+    return this->addInstruction(i);
+  }  // end of addExpression
+
+  BytecodeCompiler::size_type BytecodeCompiler::addLogicalExpression(
+      const LogicalExpr& e) {
+    this->vectorizable = false;
+    auto i = Bytecode::Instruction{};
+    i.opcode = Bytecode::LOGICALEXPRESSION;
+    i.le = &e;
+    return this->addInstruction(i);
+  }  // end of addLogicalExpression
+
+  BytecodeCompiler::size_type BytecodeCompiler::addExternalFunction(
+      const ExternalFunctionExpr& f, const std::vector<size_type>& args) {
+    auto i = Bytecode::Instruction{};
+    i.opcode = Bytecode::EXTERNALFUNCTION;
+    i.a = this->arguments.size();
+    i.b = args.size();
+    i.ef = &f;
+    this->arguments.insert(this->arguments.end(), args.begin(), args.end());
+    return this->addInstruction(i);
+  }  // end of addExternalFunction
+
+  static bool isEquivalent(const Bytecode::Instruction& i1,
+                           const Bytecode::Instruction& i2) {
+    if ((i1.opcode != i2.opcode) || (i1.a != i2.a) || (i1.b != i2.b)) {
+      return false;
+    }
+    switch (i1.opcode) {
+      case Bytecode::UNARYFUNCTION:
+      case Bytecode::UNARYOPERATION:
+        return i1.f1 == i2.f1;
+      case Bytecode::BINARYFUNCTION:
+        return i1.f2 == i2.f2;
+      case Bytecode::COMPARISON:
+        return i1.c == i2.c;
+      case Bytecode::LOGICALOPERATION:
+        return i1.l == i2.l;
+      case Bytecode::NEGATION:
+      case Bytecode::ADDITION:
+      case Bytecode::SUBTRACTION:
+      case Bytecode::MULTIPLICATION:
+      case Bytecode::DIVISION:
+      case Bytecode::POWER:
+      case Bytecode::LOGICALNEGATION:
+        return true;
+      default:
+        break;
+    }
+    return false;
+  }  // end of isEquivalent
+
+  BytecodeCompiler::size_type BytecodeCompiler::addInstruction(
+      Bytecode::Instruction i) {
+    const auto is_generic = (i.opcode == Bytecode::EXPRESSION) ||
+                            (i.opcode == Bytecode::LOGICALEXPRESSION) ||
+                            (i.opcode == Bytecode::EXTERNALFUNCTION);
+    // constant folding
+    if ((!is_generic) && (this->isConstant(i.a)) && (this->isConstant(i.b))) {
+      // bytecode made of the instruction only
+      auto b = Bytecode{};
+      b.constants = {this->getConstantValue(i.a), this->getConstantValue(i.b)};
+      b.instructions.push_back(i);
+      b.instructions[0].a = 0;
+      b.instructions[0].b = 1;
+      b.instructions[0].r = 2;
+      b.number_of_registers = 3;
+      b.output = 2;
+      try {
+        return this->addConstant(b.execute(nullptr));
+      } catch (...) {
+        // the error will be reported at runtime, if the instruction is
+        // ever executed
+      }
+    }
+    // common sub-expression elimination
+    if (!is_generic) {
+      for (const auto pi : this->available_instructions) {
+        const auto& i2 = this->instructions[pi];
+        if (isEquivalent(i, i2)) {
+          return i2.r;
+        }
+      }
+    }
+    i.r = this->number_of_registers;
+    ++(this->number_of_registers);
+    this->available_instructions.push_back(this->instructions.size());
+    this->instructions.push_back(i);
+    return i.r;
+  }  // end of addInstruction
+
+  static bool hasOperands(const Bytecode::Instruction& i) {
+    return (i.opcode != Bytecode::JUMP) && (i.opcode != Bytecode::EXPRESSION) &&
+           (i.opcode != Bytecode::LOGICALEXPRESSION) &&
+           (i.opcode != Bytecode::EXTERNALFUNCTION);
+  }  // end of hasOperands
+
+  Bytecode BytecodeCompiler::getBytecode(const size_type o) const {
+    auto b = Bytecode{};
+    // registers used by the instructions
+    auto used = std::vector<bool>(this->number_of_registers, false);
+    used[o] = true;
+    for (const auto& i : this->instructions) {
+      if (hasOperands(i)) {
+        used[i.a] = used[i.b] = true;
+      }
+    }
+    for (const auto a : this->arguments) {
+      used[a] = true;
+    }
+    // renumbering the registers: variables, constants, temporaries
+    auto map = std::vector<size_type>(this->number_of_registers);
+    auto r = size_type{};
+    for (; r != this->number_of_variables; ++r) {
+      map[r] = r;
+    }
+    for (const auto& [cr, cv] : this->constants_values) {
+      if (used[cr]) {
+        b.constants.push_back(cv);
+        map[cr] = r;
+        ++r;
+      }
+    }
+    for (size_type pr = this->number_of_variables;
+         pr != this->number_of_registers; ++pr) {
+      if (!this->isConstant(pr)) {
+        map[pr] = r;
+        ++r;
+      }
+    }
+    b.instructions = this->instructions;
+    for (auto& i : b.instructions) {
+      if (hasOperands(i)) {
+        i.a = map[i.a];
+        i.b = map[i.b];
+      }
+      if ((i.opcode != Bytecode::JUMP) && (i.opcode != Bytecode::JUMPIFFALSE)) {
+        i.r = map[i.r];
+      }
+    }
+    b.arguments.reserve(this->arguments.size());
+    for (const auto a : this->arguments) {
+      b.arguments.push_back(map[a]);
+    }
+    b.number_of_variables = this->number_of_variables;
+    b.number_of_registers = r;
+    b.output = map[o];
+    b.vectorizable = this->vectorizable;
+    return b;
+  }  // end of getBytecode
+
+  BytecodeCompiler::~BytecodeCompiler() = default;
+
+  Bytecode compile(const Expr& e, const Bytecode::size_type n) {
+    auto c = BytecodeCompiler{n};
+    const auto r = e.compile(c);
+    return c.getBytecode(r);
+  }  // end of compile
+
+}  // end of namespace tfel::math::parser
@@ -14,6 +14,7 @@
 #include <cmath>
 #include <limits>
 #include "TFEL/Raise.hxx"
+#include "TFEL/Math/Parser/Bytecode.hxx"
 #include "TFEL/Math/Parser/Number.hxx"
 #include "TFEL/Math/Parser/ConditionalExpr.hxx"
 
@@ -44,6 +45,12 @@ namespace tfel::math::parser {
     return this->b->getValue();
   }  // end of ConditionalExpr::getValue() const
 
+  std::vector<double>::size_type ConditionalExpr::compile(
+      BytecodeCompiler& bc) const {
+    return bc.addConditionalExpression(this->c->compile(bc), *(this->a),
+                                       *(this->b));
+  }  // end of compile
+
   std::string ConditionalExpr::getCxxFormula(
       const std::vector<std::string>& m) const {
     return "(" + this->c->getCxxFormula(m) + ") ? " + "(" +
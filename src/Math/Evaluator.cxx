@@ -1241,9 +1241,64 @@ namespace tfel::math {
     raise_if(this->expr == nullptr,
              "Evaluator::getValue: "
              "uninitialized expression.");
-    return this->expr->getValue();
+    return this->bytecode.execute(this->variables.data());
   }  // end of getValue
 
+  double Evaluator::getValueFromExpressionTree() const {
+    raise_if(this->expr == nullptr,
+             "Evaluator::getValueFromExpressionTree: "
+             "uninitialized expression.");
+    return this->expr->getValue();
+  }  // end of getValueFromExpressionTree
+
+  void Evaluator::getValues(std::span<double> r,
+                            const std::vector<std::span<const double>>& v) {
+    raise_if(this->expr == nullptr,
+             "Evaluator::getValues: "
+             "uninitialized expression.");
+    raise_if(v.size() != this->variables.size(),
+             "Evaluator::getValues: "
+             "invalid number of variables (" +
+                 std::to_string(v.size()) + " given, " +
+                 std::to_string(this->variables.size()) + " expected)");
+    for (const auto& values : v) {
+      raise_if(values.size() != r.size(),
+               "Evaluator::getValues: "
+               "the number of values of a variable does not match the size "
+               "of the results");
+    }
+    if (this->bytecode.isVectorizable()) {
+      auto ptrs = std::vector<const double*>{};
+      ptrs.reserve(v.size());
+      for (const auto& values : v) {
+        ptrs.push_back(values.data());
+      }
+      this->bytecode.execute(r.data(), ptrs.data(), r.size());
+      return;
+    }
+    for (decltype(r.size()) i = 0; i != r.size(); ++i) {
+      for (decltype(v.size()) j = 0; j != v.size(); ++j) {
+        this->variables[j] = v[j][i];
+      }
+      r[i] = this->bytecode.execute(this->variables.data());
+    }
+  }  // end of getValues
+
+  void Evaluator::getValues(
+      std::span<double> r,
+      const std::map<std::string, std::span<const double>>& v) {
+    raise_if(v.size() != this->variables.size(),
+             "Evaluator::getValues: "
+             "invalid number of variables (" +
+                 std::to_string(v.size()) + " given, " +
+                 std::to_string(this->variables.size()) + " expected)");
+    auto values = std::vector<std::span<const double>>(v.size());
+    for (const auto& [n, vv] : v) {
+      values[this->getVariablePosition(n)] = vv;
+    }
+    this->getValues(r, values);
+  }  // end of getValues
+
   double Evaluator::operator()() const {
     return this->getValue();
   }  // end of operator()
@@ -1271,6 +1326,7 @@ namespace tfel::math {
       auto g = this->treatGroup(p, pe, b, "");
       g->reduce();
       this->expr = g->analyse();
+      this->compile();
     } catch (std::exception& e) {
       tfel::raise(
           "Evaluator::analyse: "
@@ -1302,6 +1358,7 @@ namespace tfel::math {
     if (src.expr != nullptr) {
       this->expr = src.expr->clone(this->variables);
     }
+    this->compile();
   }  // end of Evaluator
 
   Evaluator& Evaluator::operator=(const Evaluator& src) {
@@ -1314,6 +1371,7 @@ namespace tfel::math {
       } else {
         this->expr.reset();
       }
+      this->compile();
     }
     return *this;
   }  // end of Evaluator
@@ -1345,6 +1403,7 @@ namespace tfel::math {
     str.precision(15);
     str << v;
     this->expr = std::make_shared<parser::Number>(str.str(), v);
+    this->compile();
   }  // end of Evaluator
 
   void Evaluator::clear() {
@@ -1352,7 +1411,17 @@ namespace tfel::math {
     this->positions.clear();
     this->expr.reset();
     this->manager.reset();
-  }
+    this->compile();
+  }  // end of clear
+
+  void Evaluator::compile() {
+    if (this->expr == nullptr) {
+      this->bytecode = tfel::math::parser::Bytecode{};
+      return;
+    }
+    this->bytecode =
+        tfel::math::parser::compile(*(this->expr), this->variables.size());
+  }  // end of compile
 
   void Evaluator::setFunction(const std::string& f) {
     this->clear();
@@ -1437,6 +1506,7 @@ namespace tfel::math {
       }
       pev->expr = this->expr->differentiate(pos, pev->variables);
     }
+    pev->compile();
     return pev;
   }  // end of differentiate
 
@@ -1450,12 +1520,14 @@ namespace tfel::math {
     this->checkCyclicDependency();
     auto f = std::make_shared<Evaluator>(*this);
     f->expr = f->expr->resolveDependencies(f->variables);
+    f->compile();
     return f;
   }  // end of resolveDependencies() const
 
   void Evaluator::removeDependencies() {
     this->checkCyclicDependency();
     this->expr = this->expr->resolveDependencies(this->variables);
+    this->compile();
   }  // end of removeDependencies() const
 
   std::shared_ptr<tfel::math::parser::ExternalFunctionManager>
@@ -1525,6 +1597,7 @@ namespace tfel::math {
     pev->manager = this->manager;
     pev->expr = this->expr->createFunctionByChangingParametersIntoVariables(
         pev->variables, params, pev->positions);
+    pev->compile();
     return pev;
   }  // end of createFunctionByChangingParametersIntoVariables
 
@@ -16,9 +16,14 @@
 #include "TFEL/Math/General/IEEE754.hxx"
 #include "TFEL/Math/Parser/BinaryOperator.hxx"
 #include "TFEL/Math/Parser/Expr.hxx"
+#include "TFEL/Math/Parser/Bytecode.hxx"
 
 namespace tfel::math::parser {
 
+  std::vector<double>::size_type Expr::compile(BytecodeCompiler& c) const {
+    return c.addExpression(*this);
+  }  // end of compile
+
   Expr::~Expr() = default;
 
   void mergeVariablesNames(std::vector<std::string>& v,
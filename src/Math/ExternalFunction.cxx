@@ -12,10 +12,34 @@
  * project under specific licensing conditions.
  */
 
+#include <string>
+#include "TFEL/Raise.hxx"
 #include "TFEL/Math/Parser/ExternalFunction.hxx"
 
 namespace tfel::math::parser {
 
+  void ExternalFunction::getValues(
+      std::span<double> r, const std::vector<std::span<const double>>& v) {
+    raise_if(v.size() != this->getNumberOfVariables(),
+             "ExternalFunction::getValues: "
+             "invalid number of variables (" +
+                 std::to_string(v.size()) + " given, " +
+                 std::to_string(this->getNumberOfVariables()) +
+                 " expected)");
+    for (const auto& values : v) {
+      raise_if(values.size() != r.size(),
+               "ExternalFunction::getValues: "
+               "the number of values of a variable does not match the size "
+               "of the results");
+    }
+    for (decltype(r.size()) i = 0; i != r.size(); ++i) {
+      for (decltype(v.size()) j = 0; j != v.size(); ++j) {
+        this->setVariableValue(j, v[j][i]);
+      }
+      r[i] = this->getValue();
+    }
+  }  // end of getValues
+
   ExternalFunction::~ExternalFunction() = default;
 
 }  // end of namespace tfel::math::parser
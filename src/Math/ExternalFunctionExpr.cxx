@@ -22,6 +22,7 @@
 #include "TFEL/Math/Parser/BinaryOperator.hxx"
 #include "TFEL/Math/Parser/ExternalFunctionExpr.hxx"
 #include "TFEL/Math/Parser/ExternalFunctionExpr2.hxx"
+#include "TFEL/Math/Parser/Bytecode.hxx"
 
 namespace tfel::math::parser {
 
@@ -50,31 +51,42 @@ namespace tfel::math::parser {
     return false;
   }  // end of dependsOnVariable
 
-  double ExternalFunctionExpr::getValue() const {
-    using namespace tfel::math::parser;
-    std::vector<std::shared_ptr<Expr>>::const_iterator p;
-    std::vector<std::shared_ptr<Expr>>::size_type i;
-    auto p2 = this->manager->find(this->name);
-    raise_if(p2 == this->manager->end(),
-             "ExternalFunctionExpr::getValue: "
+  ExternalFunction& ExternalFunctionExpr::getExternalFunction() const {
+    const auto p = this->manager->find(this->name);
+    raise_if(p == this->manager->end(),
+             "ExternalFunctionExpr::getExternalFunction: "
              "unknown function '" +
                  this->name + "'");
-    raise_if(p2->second->getNumberOfVariables() != this->args.size(),
-             "ExternalFunctionExpr::getValue: "
+    raise_if(p->second->getNumberOfVariables() != this->args.size(),
+             "ExternalFunctionExpr::getExternalFunction: "
              "invalid number of arguments for function '" +
                  this->name +
                  "' "
                  "(" +
                  std::to_string(this->args.size()) + " given, " +
-                 std::to_string(p2->second->getNumberOfVariables()) +
+                 std::to_string(p->second->getNumberOfVariables()) +
                  " required)");
-    for (p = this->args.begin(), i = 0u; p != this->args.end(); ++p, ++i) {
-      const auto val = (*p)->getValue();
-      p2->second->setVariableValue(i, val);
+    return *(p->second);
+  }  // end of getExternalFunction
+
+  double ExternalFunctionExpr::getValue() const {
+    auto& f = this->getExternalFunction();
+    for (decltype(this->args.size()) i = 0; i != this->args.size(); ++i) {
+      f.setVariableValue(i, this->args[i]->getValue());
     }
-    return p2->second->getValue();
+    return f.getValue();
   }  // end of getValue
 
+  std::vector<double>::size_type ExternalFunctionExpr::compile(
+      BytecodeCompiler& c) const {
+    auto r = std::vector<std::vector<double>::size_type>{};
+    r.reserve(this->args.size());
+    for (const auto& a : this->args) {
+      r.push_back(a->compile(c));
+    }
+    return c.addExternalFunction(*this, r);
+  }  // end of compile
+
   std::string ExternalFunctionExpr::getCxxFormula(
       const std::vector<std::string>&) const {
     tfel::raise(
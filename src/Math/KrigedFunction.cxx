@@ -45,6 +45,23 @@ namespace tfel::math::parser {
         std::to_string(i) + " > " + std::to_string(N) + ")");
   }  // end of KrigedFunctionBase::throwInvalidIndexException
 
+  void KrigedFunctionBase::checkValues(
+      std::span<double> r,
+      const std::vector<std::span<const double>>& values,
+      const unsigned short N) {
+    raise_if(values.size() != N,
+             "KrigedFunctionBase::checkValues: "
+             "invalid number of variables (" +
+                 std::to_string(values.size()) + " given, " +
+                 std::to_string(N) + " expected)");
+    for (const auto& v : values) {
+      raise_if(v.size() != r.size(),
+               "KrigedFunctionBase::checkValues: "
+               "the number of values of a variable does not match the size "
+               "of the results");
+    }
+  }  // end of KrigedFunctionBase::checkValues
+
   template <>
   void KrigedFunction<1u>::setVariableValue(
       const std::vector<double>::size_type i, const double v_) {
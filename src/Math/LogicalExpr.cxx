@@ -14,6 +14,7 @@
 #include <cmath>
 #include <limits>
 #include "TFEL/Math/General/IEEE754.hxx"
+#include "TFEL/Math/Parser/Bytecode.hxx"
 #include "TFEL/Math/Parser/LogicalExpr.hxx"
 
 namespace tfel::math::parser {
@@ -79,6 +80,11 @@ namespace tfel::math::parser {
     return '(' + a + ")||(" + b + ')';
   }  // end of OpOr::getCxxFormula
 
+  std::vector<double>::size_type LogicalExpr::compile(
+      BytecodeCompiler& c) const {
+    return c.addLogicalExpression(*this);
+  }  // end of compile
+
   LogicalExpr::~LogicalExpr() = default;
 
   NegLogicalExpression::NegLogicalExpression(
@@ -98,6 +104,11 @@ namespace tfel::math::parser {
     return !this->a->getValue();
   }  // end of getValue
 
+  std::vector<double>::size_type NegLogicalExpression::compile(
+      BytecodeCompiler& c) const {
+    return c.addLogicalNegation(this->a->compile(c));
+  }  // end of compile
+
   std::string NegLogicalExpression::getCxxFormula(
       const std::vector<std::string>& m) const {
     return "!(" + this->a->getCxxFormula(m) + ")";
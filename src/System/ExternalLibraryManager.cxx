@@ -30,6 +30,7 @@
 #include "TFEL/System/getFunction.h"
 #include "TFEL/System/LibraryInformation.hxx"
 #include "TFEL/System/ExternalLibraryManager.hxx"
+#include "TFEL/System/ExternalBehaviourDescription.hxx"
 
 namespace tfel::system {
 
@@ -257,6 +258,7 @@ namespace tfel::system {
   void*
 #endif /* (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__) */
   ExternalLibraryManager::loadLibrary(const std::string& name, const bool b) {
+    auto lock = std::lock_guard<std::mutex>{this->libraries_mutex};
     auto p = this->librairies.find(name);
     if (p == librairies.end()) {
       // this library has not been
@@ -278,6 +280,38 @@ namespace tfel::system {
     return p->second;
   }  // end of loadLibrary
 
+  bool ExternalLibraryManager::unloadLibrary(const std::string& name) {
+    auto lock = std::lock_guard<std::mutex>{this->libraries_mutex};
+    // removing the cached descriptions
+    auto erase_descriptions = [&name](auto& m) {
+      for (auto p = m.begin(); p != m.end();) {
+        if (std::get<0>(p->first) == name) {
+          p = m.erase(p);
+        } else {
+          ++p;
+        }
+      }
+    };
+    erase_descriptions(this->descriptions);
+    erase_descriptions(this->behaviours_descriptions);
+    const auto p = this->librairies.find(name);
+    if (p == this->librairies.end()) {
+      return false;
+    }
+#if (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__)
+    const auto s = ::FreeLibrary(p->second) != 0;
+#else
+    const auto s = ::dlclose(p->second) == 0;
+#endif /* (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__) */
+    this->librairies.erase(p);
+    raise_if(!s,
+             "ExternalLibraryManager::unloadLibrary: "
+             "library '" +
+                 name + "' could not be unloaded (" + getErrorMessage() +
+                 ")");
+    return true;
+  }  // end of unloadLibrary
+
   std::vector<std::string> ExternalLibraryManager::getEntryPoints(
       const std::string& l) {
     auto ends_with = [](const std::string& s1, const std::string& s2) {
@@ -302,6 +336,57 @@ namespace tfel::system {
     return r;
   }  // end of getEntryPoints
 
+  /*!
+   * \return the description associated with the given key, building it if
+   * it is not already in the cache.
+   * \param[in] mutex: mutex protecting the cache
+   * \param[in] descriptions: cache
+   * \param[in] k: key
+   * \param[in] build: function building the description
+   */
+  template <typename Description, typename Key, typename Builder>
+  static std::shared_ptr<const Description> getCachedDescription(
+      std::mutex& mutex,
+      std::map<Key, std::shared_ptr<const Description>>& descriptions,
+      const Key& k,
+      const Builder& build) {
+    {
+      auto lock = std::lock_guard<std::mutex>{mutex};
+      const auto p = descriptions.find(k);
+      if (p != descriptions.end()) {
+        return p->second;
+      }
+    }
+    // the description is built without holding the lock since its
+    // constructor calls the methods of the external library manager. If
+    // another thread built the same description in the meantime, its
+    // description is kept.
+    auto d = std::shared_ptr<const Description>(build());
+    auto lock = std::lock_guard<std::mutex>{mutex};
+    return descriptions.insert({k, std::move(d)}).first->second;
+  }  // end of getCachedDescription
+
+  std::shared_ptr<const ExternalMaterialKnowledgeDescription>
+  ExternalLibraryManager::describe(const std::string& l, const std::string& f) {
+    return getCachedDescription(
+        this->libraries_mutex, this->descriptions, std::make_tuple(l, f),
+        [&l, &f] {
+          return std::make_shared<ExternalMaterialKnowledgeDescription>(l, f);
+        });
+  }  // end of describe
+
+  std::shared_ptr<const ExternalBehaviourDescription>
+  ExternalLibraryManager::describe(const std::string& l,
+                                   const std::string& f,
+                                   const std::string& h) {
+    return getCachedDescription(
+        this->libraries_mutex, this->behaviours_descriptions,
+        std::make_tuple(l, f, h),
+        [&l, &f, &h] {
+          return std::make_shared<ExternalBehaviourDescription>(l, f, h);
+        });
+  }  // end of describe
+
   unsigned short ExternalLibraryManager::getMaterialKnowledgeType(
       const std::string& l, const std::string& f) {
     auto throw_if = [l, f](const bool c, const std::string& m) {
@@ -1081,6 +1166,18 @@ namespace tfel::system {
     return fct;
   }
 
+  GenericBehaviourBatchFctPtr
+  ExternalLibraryManager::getGenericBehaviourBatchFunction(
+      const std::string& l, const std::string& f) {
+    const auto lib = this->loadLibrary(l);
+    const auto fct = ::tfel_getGenericBehaviourBatchFunction(lib, f.c_str());
+    raise_if(fct == nullptr,
+             "ExternalLibraryManager::getGenericBehaviourBatchFunction: "
+             "could not load generic behaviour function '" +
+                 f + "' (" + getErrorMessage() + ")");
+    return fct;
+  }  // end of getGenericBehaviourBatchFunction
+
   std::vector<std::string>
   ExternalLibraryManager::getGenericBehaviourInitializeFunctions(
       const std::string& l, const std::string& f, const std::string& h) {
@@ -12,58 +12,199 @@
  */
 
 #include <memory>
+#include <algorithm>
 #include <stdexcept>
+#include "TFEL/Raise.hxx"
 #include "TFEL/System/ThreadPool.hxx"
 
 namespace tfel::system {
 
-  ThreadPool::ThreadPool(const size_t n) {
-    this->statuses.resize(n, ThreadPool::Status::IDLE);
-    for (size_t i = 0; i < n; ++i) {
-      auto f = [this, i] {
-        for (;;) {
-          std::function<void()> task;
-          {
-            std::unique_lock<std::mutex> lock(this->m);
-            while (!(this->stop || !this->tasks.empty())) {
-              this->c.wait(
-                  lock, [this] { return this->stop || !this->tasks.empty(); });
-            }
-            if (this->stop && this->tasks.empty()) {
-              return;
-            }
-            task = std::move(this->tasks.front());
-            this->tasks.pop();
-            this->statuses[i] = ThreadPool::Status::WORKING;
-            this->c.notify_all();
-          }
-          task();
-          {
-            std::unique_lock<std::mutex> lock(this->m);
-            this->statuses[i] = ThreadPool::Status::IDLE;
-            this->c.notify_all();
+  //! \brief pool owning the current thread, if any
+  static thread_local const ThreadPool* current_pool = nullptr;
+  //! \brief index of the current thread in the pool owning it, if any
+  static thread_local ThreadPool::size_type current_worker = 0;
+
+  ThreadPool::Task::Task() noexcept = default;
+
+  ThreadPool::Task::Task(Task&& src) noexcept : manager(src.manager) {
+    if (this->manager != nullptr) {
+      this->manager(MOVE, src.buffer, this->buffer);
+      src.manager = nullptr;
+    }
+  }  // end of Task
+
+  ThreadPool::Task& ThreadPool::Task::operator=(Task&& src) noexcept {
+    if (this != &src) {
+      if (this->manager != nullptr) {
+        this->manager(DESTROY, this->buffer, nullptr);
+      }
+      this->manager = src.manager;
+      if (this->manager != nullptr) {
+        this->manager(MOVE, src.buffer, this->buffer);
+        src.manager = nullptr;
+      }
+    }
+    return *this;
+  }  // end of operator=
+
+  void ThreadPool::Task::operator()() {
+    this->manager(CALL, this->buffer, nullptr);
+  }  // end of operator()
+
+  ThreadPool::Task::~Task() {
+    if (this->manager != nullptr) {
+      this->manager(DESTROY, this->buffer, nullptr);
+    }
+  }  // end of ~Task
+
+  void ThreadPool::ParallelForContext::run() {
+    for (;;) {
+      const auto i = this->next_chunk++;
+      if (i >= this->number_of_chunks) {
+        return;
+      }
+      if (!this->failed) {
+        const auto ib = this->begin + i * this->grain;
+        const auto ie = std::min(ib + this->grain, this->end);
+        try {
+          this->call(this->function, ib, ie);
+        } catch (...) {
+          std::lock_guard<std::mutex> lock(this->m);
+          if (!this->exception) {
+            this->exception = std::current_exception();
           }
+          this->failed = true;
         }
-      };
-      this->workers.emplace_back(f);
+      }
+      if (++(this->treated_chunks) == this->number_of_chunks) {
+        std::lock_guard<std::mutex> lock(this->m);
+        this->c.notify_all();
+      }
+    }
+  }  // end of run
+
+  ThreadPool::ThreadPool(const size_t n) {
+    for (size_t i = 0; i != std::max(n, size_t{1}); ++i) {
+      this->queues.push_back(std::make_unique<Queue>());
+    }
+    for (size_t i = 0; i != n; ++i) {
+      this->workers.emplace_back([this, i] { this->work(i); });
     }
   }  // end of ThreadPool::ThreadPool
 
+  void ThreadPool::work(const size_type i) {
+    current_pool = this;
+    current_worker = i;
+    for (;;) {
+      auto task = Task{};
+      if (this->pop(task, i)) {
+        task();
+        if (--(this->pending_tasks) == 0) {
+          std::lock_guard<std::mutex> lock(this->m);
+          this->done.notify_all();
+        }
+        continue;
+      }
+      std::unique_lock<std::mutex> lock(this->m);
+      ++(this->sleeping_workers);
+      this->c.wait(lock,
+                   [this] { return this->stop || this->queued_tasks != 0; });
+      --(this->sleeping_workers);
+      if (this->stop && this->queued_tasks == 0) {
+        return;
+      }
+    }
+  }  // end of work
+
+  bool ThreadPool::pop(Task& t, const size_type i) {
+    auto try_pop = [&t](Queue& q, const bool back) {
+      std::lock_guard<std::mutex> lock(q.m);
+      if (q.tasks.empty()) {
+        return false;
+      }
+      if (back) {
+        t = std::move(q.tasks.back());
+        q.tasks.pop_back();
+      } else {
+        t = std::move(q.tasks.front());
+        q.tasks.pop_front();
+      }
+      return true;
+    };
+    const auto n = this->queues.size();
+    // the last task added to the queue of the worker is treated first, as
+    // the data it uses are likely to be in cache
+    if (try_pop(*(this->queues[i]), true)) {
+      --(this->queued_tasks);
+      return true;
+    }
+    // the oldest tasks of other workers are stolen
+    for (size_type k = 1; k != n; ++k) {
+      if (try_pop(*(this->queues[(i + k) % n]), false)) {
+        --(this->queued_tasks);
+        return true;
+      }
+    }
+    return false;
+  }  // end of pop
+
+  void ThreadPool::push(Task&& t) {
+    raise_if(this->stop,
+             "ThreadPool::addTask: "
+             "enqueue on stopped ThreadPool");
+    const auto i = (current_pool == this)
+                       ? current_worker
+                       : (this->next_queue++) % this->queues.size();
+    ++(this->pending_tasks);
+    // the number of queued tasks is incremented before the task becomes
+    // visible to the other workers: otherwise, a worker could pop the task
+    // and decrement this counter before it is incremented.
+    ++(this->queued_tasks);
+    {
+      std::lock_guard<std::mutex> lock(this->queues[i]->m);
+      this->queues[i]->tasks.push_back(std::move(t));
+    }
+    // the mutex is only locked if a worker is sleeping. A worker about to
+    // sleep checks the number of queued tasks after having incremented the
+    // number of sleeping workers, so no wake-up can be lost.
+    if (this->sleeping_workers != 0) {
+      std::lock_guard<std::mutex> lock(this->m);
+      this->c.notify_one();
+    }
+  }  // end of push
+
+  void ThreadPool::execute(const std::shared_ptr<ParallelForContext>& ctx) {
+    const auto n = ctx->end - ctx->begin;
+    const auto nthreads = this->workers.size();
+    if (ctx->grain == 0) {
+      ctx->grain = std::max(n / (4 * (nthreads + 1)), size_type{1});
+    }
+    ctx->number_of_chunks = (n + ctx->grain - 1) / ctx->grain;
+    // the calling thread also treats chunks, so that this method can be
+    // called by a task without risking a dead-lock
+    const auto nhelpers = std::min(nthreads, ctx->number_of_chunks - 1);
+    for (size_type i = 0; i != nhelpers; ++i) {
+      this->push(Task([ctx] { ctx->run(); }));
+    }
+    ctx->run();
+    {
+      std::unique_lock<std::mutex> lock(ctx->m);
+      ctx->c.wait(lock, [&ctx] {
+        return ctx->treated_chunks == ctx->number_of_chunks;
+      });
+    }
+    if (ctx->exception) {
+      std::rethrow_exception(ctx->exception);
+    }
+  }  // end of execute
+
   ThreadPool::size_type ThreadPool::getNumberOfThreads() const {
     return this->workers.size();
   }  // end of ThreadPool::getNumberOfThreads
 
   void ThreadPool::wait() {
     std::unique_lock<std::mutex> lock(this->m);
-    while (!this->tasks.empty()) {
-      this->c.wait(lock, [this] { return this->tasks.empty(); });
-    }
-    for (size_t i = 0; i != this->statuses.size(); ++i) {
-      while (this->statuses[i] != Status::IDLE) {
-        this->c.wait(lock,
-                     [this, i] { return this->statuses[i] == Status::IDLE; });
-      }
-    }
+    this->done.wait(lock, [this] { return this->pending_tasks == 0; });
   }  // end of ThreadPool::wait()
 
   ThreadPool::~ThreadPool() {
@@ -16,6 +16,7 @@
 #include <iostream>
 #include <iterator>
 #include <utility>
+#include <thread>
 #include <cstdlib>
 #include "TFEL/Raise.hxx"
 #include "TFEL/Utilities/StringAlgorithms.hxx"
@@ -232,4 +233,22 @@ namespace tfel::utilities {
 
   ArgumentParser::~ArgumentParser() = default;
 
+  std::size_t parseNumberOfJobs(const std::string& m, const std::string& o) {
+    if (o.empty()) {
+      const auto n = std::thread::hardware_concurrency();
+      raise_if(n == 0, m + ": unable to determine the number of cores");
+      return n;
+    }
+    auto pos = std::size_t{};
+    auto n = std::size_t{};
+    try {
+      n = std::stoul(o, &pos);
+    } catch (std::exception&) {
+      pos = 0;
+    }
+    raise_if((pos != o.size()) || (n == 0),
+             m + ": invalid number of jobs '" + o + "'");
+    return n;
+  }  // end of parseNumberOfJobs
+
 }  // end of namespace tfel::utilities
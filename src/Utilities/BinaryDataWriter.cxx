@@ -0,0 +1,125 @@
+/*!
+ * \file   src/Utilities/BinaryDataWriter.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright Copyright (C) 2006-2025 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <bit>
+#include <limits>
+#include <cstdint>
+#include "TFEL/Raise.hxx"
+#include "TFEL/Utilities/BinaryDataWriter.hxx"
+
+namespace tfel::utilities {
+
+  /*!
+   * \brief append an unsigned integer to a buffer in little-endian order
+   * \param[out] b: buffer
+   * \param[in] v: value
+   */
+  template <typename IntegerType>
+  static void appendLittleEndian(std::vector<char>& b, const IntegerType v) {
+    for (std::size_t i = 0; i != sizeof(IntegerType); ++i) {
+      b.push_back(static_cast<char>((v >> (8 * i)) & 0xFF));
+    }
+  }  // end of appendLittleEndian
+
+  BinaryDataWriter::BinaryDataWriter(const std::string& f,
+                                     const std::vector<std::string>& c,
+                                     const size_type n)
+      : out(f, std::ios::binary), ncolumns(c.size()), chunk_size(n) {
+    raise_if(!this->out,
+             "BinaryDataWriter::BinaryDataWriter: "
+             "can't open file '" +
+                 f + "'");
+    raise_if(this->ncolumns == 0,
+             "BinaryDataWriter::BinaryDataWriter: no column specified");
+    raise_if(this->chunk_size == 0,
+             "BinaryDataWriter::BinaryDataWriter: invalid chunk size");
+    raise_if(this->ncolumns > std::numeric_limits<std::uint32_t>::max(),
+             "BinaryDataWriter::BinaryDataWriter: too many columns");
+    this->out.exceptions(std::ofstream::failbit | std::ofstream::badbit);
+    this->buffer.insert(this->buffer.end(), magic.begin(), magic.end());
+    appendLittleEndian(this->buffer, static_cast<std::uint32_t>(version));
+    appendLittleEndian(this->buffer,
+                       static_cast<std::uint32_t>(this->ncolumns));
+    for (const auto& name : c) {
+      raise_if(name.size() > std::numeric_limits<std::uint32_t>::max(),
+               "BinaryDataWriter::BinaryDataWriter: invalid column name");
+      appendLittleEndian(this->buffer, static_cast<std::uint32_t>(name.size()));
+      this->buffer.insert(this->buffer.end(), name.begin(), name.end());
+    }
+    this->out.write(this->buffer.data(),
+                    static_cast<std::streamsize>(this->buffer.size()));
+    this->out.flush();
+    this->values.reserve(this->chunk_size * this->ncolumns);
+  }  // end of BinaryDataWriter::BinaryDataWriter
+
+  void BinaryDataWriter::write(const double v) {
+    this->values.push_back(v);
+  }  // end of BinaryDataWriter::write
+
+  void BinaryDataWriter::write(std::span<const double> v) {
+    this->values.insert(this->values.end(), v.begin(), v.end());
+  }  // end of BinaryDataWriter::write
+
+  void BinaryDataWriter::endLine() {
+    if (this->values.size() != (this->nlines + 1) * this->ncolumns) {
+      this->values.resize(this->nlines * this->ncolumns);
+      raise("BinaryDataWriter::endLine: the number of values of the line "
+            "does not match the number of columns (" +
+            std::to_string(this->ncolumns) + ")");
+    }
+    ++(this->nlines);
+    if (this->nlines == this->chunk_size) {
+      this->flush();
+    }
+  }  // end of BinaryDataWriter::endLine
+
+  void BinaryDataWriter::flush() {
+    if (this->nlines == 0) {
+      this->out.flush();
+      return;
+    }
+    this->buffer.clear();
+    this->buffer.reserve(sizeof(std::uint64_t) +
+                         this->nlines * this->ncolumns * sizeof(std::uint64_t));
+    appendLittleEndian(this->buffer, static_cast<std::uint64_t>(this->nlines));
+    // transposition of the buffered lines
+    for (size_type j = 0; j != this->ncolumns; ++j) {
+      for (size_type i = 0; i != this->nlines; ++i) {
+        const auto v = this->values[i * this->ncolumns + j];
+        appendLittleEndian(this->buffer, std::bit_cast<std::uint64_t>(v));
+      }
+    }
+    this->out.write(this->buffer.data(),
+                    static_cast<std::streamsize>(this->buffer.size()));
+    this->out.flush();
+    // values of an incomplete line are kept
+    this->values.erase(
+        this->values.begin(),
+        this->values.begin() +
+            static_cast<std::ptrdiff_t>(this->nlines * this->ncolumns));
+    this->nlines = 0;
+  }  // end of BinaryDataWriter::flush
+
+  BinaryDataWriter::size_type BinaryDataWriter::getNumberOfColumns()
+      const noexcept {
+    return this->ncolumns;
+  }  // end of BinaryDataWriter::getNumberOfColumns
+
+  BinaryDataWriter::~BinaryDataWriter() noexcept {
+    try {
+      this->flush();
+    } catch (...) {
+    }
+  }  // end of BinaryDataWriter::~BinaryDataWriter
+
+}  // end of namespace tfel::utilities
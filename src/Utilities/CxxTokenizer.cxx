@@ -16,6 +16,7 @@
 #include <cctype>
 #include <fstream>
 #include <iterator>
+#include <memory>
 #include <sstream>
 #include <stdexcept>
 #include <string>
@@ -40,12 +41,23 @@ namespace std {
 
 namespace tfel::utilities {
 
-  static std::pair<std::string::const_iterator, std::string> findSeparator(
-      const std::string::const_iterator p,
-      const std::string::const_iterator pe,
-      const std::vector<std::string>& separators) {
-    const auto w = std::string{p, pe};
-    std::pair<std::string::const_iterator, std::string> r = {pe, ""};
+  /*!
+   * \return a view on the given range of characters
+   * \param[in] b: iterator to the first character
+   * \param[in] e: iterator past the last character
+   */
+  static std::string_view makeView(const std::string::const_iterator b,
+                                   const std::string::const_iterator e) {
+    return {std::to_address(b),
+            static_cast<std::string_view::size_type>(e - b)};
+  }  // end of makeView
+
+  static std::pair<std::string::const_iterator, std::string_view>
+  findSeparator(const std::string::const_iterator p,
+                const std::string::const_iterator pe,
+                const std::vector<std::string>& separators) {
+    const auto w = makeView(p, pe);
+    std::pair<std::string::const_iterator, std::string_view> r = {pe, ""};
     for (const auto& s : separators) {
       const auto pos = w.find(s);
       if (pos != std::string::npos) {
@@ -118,45 +130,168 @@ namespace tfel::utilities {
   }  // end of CxxTokenizer::addSeparator
 
   void CxxTokenizer::parseString(const std::string& s) {
-    std::istringstream iss(s);
     auto n = Token::size_type{};
-    this->parseStream(iss, n, " of string '" + s + "'");
+    this->parseSource(s, n, " of string '" + s + "'");
   }  // end of CxxTokenizer::parseOneString
 
   void CxxTokenizer::parseStream(std::istream& in,
                                  Token::size_type& n,
                                  const std::string& from) {
-    auto throw_if = [](const bool b, const std::string& m) {
-      raise_if(b, "CxxTokenizer::parseStream: " + m);
-    };
+    raise_if(!in.good(),
+             "CxxTokenizer::parseStream: error while parsing stream");
+    auto s = std::string{};
+    auto buffer = std::array<char, 4096>{};
+    while (in.read(buffer.data(), buffer.size()) || (in.gcount() > 0)) {
+      s.append(buffer.data(), static_cast<std::size_t>(in.gcount()));
+    }
+    raise_if(in.bad(),
+             "CxxTokenizer::parseStream: error while parsing stream");
+    this->parseSource(std::move(s), n, from);
+  }  // end of parseStream
+
+  void CxxTokenizer::parseSource(std::string s,
+                                 Token::size_type& n,
+                                 const std::string& from) {
+    const auto& src = this->store(std::move(s));
+    this->current_source = src;
     try {
-      while (!in.eof()) {
-        throw_if(!in.good(), "error while parsing stream");
-        throw_if(!in.good(), "error while parsing stream");
-        auto line = std::string{};
-        std::getline(in, line);
+      auto b = src.begin();
+      const auto pe = src.end();
+      while (true) {
+        const auto e = std::find(b, pe, '\n');
         ++n;
         try {
-          this->splitLine(line, n);
-        } catch (std::runtime_error& e) {
-          raise(std::string(e.what()) + ".\n" +
+          this->splitLine(b, e, n);
+        } catch (std::runtime_error& ex) {
+          raise(std::string(ex.what()) + ".\n" +
                 "Error at line: " + std::to_string(n) + from);
         }
+        if (e == pe) {
+          break;
+        }
+        b = std::next(e);
       }
     } catch (...) {
       this->clear();
       throw;
     }
+    this->current_source = std::string_view{};
+    this->flushTokenViews();
     if (this->addCurlyBraces) {
-      this->tokens.insert(this->tokens.begin(), Token("{", 0, 0));
-      if (!this->tokens.empty()) {
+      if (this->storeTokenViews) {
+        auto& views = this->token_views;
+        auto ob = TokenView{};
+        ob.value = "{";
+        views.insert(views.begin(), ob);
+        auto cb = TokenView{};
+        cb.value = "}";
+        cb.line = views.back().line + 1u;
+        views.push_back(cb);
+      } else {
+        this->tokens.insert(this->tokens.begin(), Token("{", 0, 0));
         const auto& b = this->tokens.back();
         this->tokens.insert(this->tokens.end(), Token("}", b.line + 1u, 0u));
-      } else {
-        this->tokens.insert(this->tokens.end(), Token("}", 0u, 0u));
       }
     }
-  }  // end of parseString
+  }  // end of parseSource
+
+  const std::string& CxxTokenizer::store(std::string s) {
+    if (!this->strings) {
+      this->strings = std::make_shared<std::deque<std::string>>();
+    }
+    this->strings->push_back(std::move(s));
+    return this->strings->back();
+  }  // end of store
+
+  void CxxTokenizer::addToken(std::string_view v,
+                              const Token::size_type n,
+                              const Token::size_type o,
+                              const Token::TokenFlag f) {
+    auto& t = this->token_views.emplace_back();
+    t.value = v;
+    t.line = n;
+    t.offset = o;
+    t.flag = f;
+  }  // end of addToken
+
+  bool CxxTokenizer::hasNoTokens() const noexcept {
+    return this->token_views.empty() && this->tokens.empty();
+  }  // end of hasNoTokens
+
+  Token::TokenFlag CxxTokenizer::getLastTokenFlag() const {
+    if (!this->token_views.empty()) {
+      return this->token_views.back().flag;
+    }
+    raise_if(this->tokens.empty(),
+             "CxxTokenizer::getLastTokenFlag: no token read");
+    return this->tokens.back().flag;
+  }  // end of getLastTokenFlag
+
+  TokenView& CxxTokenizer::getLastToken() {
+    if (this->token_views.empty()) {
+      raise_if(this->tokens.empty(),
+               "CxxTokenizer::getLastToken: no token read");
+      auto& t = this->tokens.back();
+      auto v = TokenView{};
+      v.value = this->store(std::move(t.value));
+      v.line = t.line;
+      v.offset = t.offset;
+      v.flag = t.flag;
+      v.comment = this->store(std::move(t.comment));
+      this->tokens.pop_back();
+      this->token_views.push_back(v);
+    }
+    return this->token_views.back();
+  }  // end of getLastToken
+
+  void CxxTokenizer::appendLine(TokenView& t,
+                                const std::string::const_iterator b,
+                                const std::string::const_iterator e) {
+    const auto l = makeView(b, e);
+    if (t.value.empty()) {
+      t.value = l;
+      return;
+    }
+    // if the token and the line are consecutive in the current source,
+    // the view is simply extended
+    const auto* const s = this->current_source.data();
+    const auto* const se = s + this->current_source.size();
+    const auto* const pv = t.value.data();
+    const auto* const pve = pv + t.value.size();
+    if ((s != nullptr) && (pv >= s) && (pve < se) && (*pve == '\n') &&
+        (pve + 1 == l.data())) {
+      t.value = std::string_view{pv, t.value.size() + 1 + l.size()};
+      return;
+    }
+    auto v = std::string{t.value};
+    v += '\n';
+    v += l;
+    t.value = this->store(std::move(v));
+  }  // end of appendLine
+
+  void CxxTokenizer::flushTokenViews() {
+    if (this->storeTokenViews) {
+      return;
+    }
+    this->tokens.reserve(this->tokens.size() + this->token_views.size());
+    for (const auto& t : this->token_views) {
+      this->tokens.emplace_back(t);
+    }
+    this->token_views.clear();
+    this->strings.reset();
+  }  // end of flushTokenViews
+
+  void CxxTokenizer::useTokenViews(const bool b) {
+    if (this->storeTokenViews == b) {
+      return;
+    }
+    this->storeTokenViews = b;
+    this->flushTokenViews();
+  }  // end of useTokenViews
+
+  const std::vector<TokenView>& CxxTokenizer::getTokenViews() const noexcept {
+    return this->token_views;
+  }  // end of getTokenViews
 
   struct is_separator {
     //! constructor
@@ -247,12 +382,12 @@ namespace tfel::utilities {
         throw_if((pn2 == pe) || (pn3 == pe), "unterminated char");
         throw_if(*pn3 != '\'',
                  "unexpected token '" + std::string(1u, *pn3) + "'");
-        this->tokens.emplace_back(std::string(p, pn4), n, o, Token::Char);
+        this->addToken(makeView(p, pn4), n, o, Token::Char);
         advance(o, p, pn4);
       } else {
         throw_if(*pn2 != '\'',
                  "unexpected token '" + std::string(1u, *pn2) + "'");
-        this->tokens.emplace_back(std::string(p, pn3), n, o, Token::Char);
+        this->addToken(makeView(p, pn3), n, o, Token::Char);
         advance(o, p, pn3);
       }
     }
@@ -281,14 +416,15 @@ namespace tfel::utilities {
     }
     throw_if(!found, "found no matching '" + std::string(1u, e) +
                          "' to close string\n");
-    if (((!this->tokens.empty()) &&
-         (this->tokens.back().flag == Token::String)) &&
+    if (((!this->hasNoTokens()) &&
+         (this->getLastTokenFlag() == Token::String)) &&
         (*p == '\"') && (this->shallMergeStrings)) {
-      auto& value = this->tokens.back().value;
-      this->tokens.back().value =
-          value.substr(0, value.size() - 1) + std::string(p + 1, ps);
+      auto& t = this->getLastToken();
+      auto value = std::string{t.value.substr(0, t.value.size() - 1)};
+      value.append(p + 1, ps);
+      t.value = this->store(std::move(value));
     } else {
-      this->tokens.emplace_back(std::string(p, ps), n, o, Token::String);
+      this->addToken(makeView(p, ps), n, o, Token::String);
     }
     advance(o, p, ps);
   }
@@ -301,14 +437,14 @@ namespace tfel::utilities {
     if (this->joinCxxTwoCharactersSeparators) {
       const auto pn = std::next(p, 1);
       if ((pn != pe) && (*pn == c)) {
-        this->tokens.emplace_back(std::string{*p, *pn}, n, o, Token::Standard);
+        this->addToken(makeView(p, std::next(pn)), n, o, Token::Standard);
         advance(o, p, 2u);
       } else {
-        this->tokens.emplace_back(std::string(1u, *p), n, o, Token::Standard);
+        this->addToken(makeView(p, std::next(p)), n, o, Token::Standard);
         advance(o, p, 1u);
       }
     } else {
-      this->tokens.emplace_back(std::string(1u, *p), n, o, Token::Standard);
+      this->addToken(makeView(p, std::next(p)), n, o, Token::Standard);
       advance(o, p, 1u);
     }
   }  // end of CxxTokenizer::try_join
@@ -322,14 +458,14 @@ namespace tfel::utilities {
     if (this->joinCxxTwoCharactersSeparators) {
       const auto pn = std::next(p, 1);
       if ((pn != pe) && ((*pn == c1) || (*pn == c2))) {
-        this->tokens.emplace_back(std::string{*p, *pn}, n, o, Token::Standard);
+        this->addToken(makeView(p, std::next(pn)), n, o, Token::Standard);
         advance(o, p, 2u);
       } else {
-        this->tokens.emplace_back(std::string(1u, *p), n, o, Token::Standard);
+        this->addToken(makeView(p, std::next(p)), n, o, Token::Standard);
         advance(o, p, 1u);
       }
     } else {
-      this->tokens.emplace_back(std::string(1u, *p), n, o, Token::Standard);
+      this->addToken(makeView(p, std::next(p)), n, o, Token::Standard);
       advance(o, p, 1u);
     }
   }  // end of CxxTokenizer::try_join
@@ -520,8 +656,13 @@ namespace tfel::utilities {
       }
     }
     throw_if((p != pe) && (*p == '.'), "invalid number");
-    this->tokens.emplace_back(replace_all(std::string{b, p}, "\'", ""), n, o,
-                              Token::Number);
+    const auto v = makeView(b, p);
+    if (v.find('\'') == std::string_view::npos) {
+      this->addToken(v, n, o, Token::Number);
+    } else {
+      this->addToken(this->store(replace_all(v, "\'", "")), n, o,
+                     Token::Number);
+    }
     const auto d = p - b;
     p = b;
     advance(o, p, d);
@@ -566,11 +707,11 @@ namespace tfel::utilities {
     if ((p != pe) && (*p == '!')) {
       next_token();
       if ((p != pe) && (*p == '<')) {
-        flag = this->tokens.empty() ? Token::Comment
-                                    : Token::DoxygenBackwardComment;
+        flag = this->hasNoTokens() ? Token::Comment
+                                   : Token::DoxygenBackwardComment;
         next_token();
       } else {
-        flag = this->tokens.empty() ? Token::Comment : Token::DoxygenComment;
+        flag = this->hasNoTokens() ? Token::Comment : Token::DoxygenComment;
       }
     }
     if (!this->bKeepCommentBoundaries) {
@@ -579,9 +720,9 @@ namespace tfel::utilities {
     auto e = get_end(p);
     if (this->bKeepCommentBoundaries) {
       if (e == pe) {
-        this->tokens.emplace_back(std::string{b, e}, n, o, flag);
+        this->addToken(makeView(b, e), n, o, flag);
       } else {
-        this->tokens.emplace_back(std::string{b, e + 2}, n, o, flag);
+        this->addToken(makeView(b, e + 2), n, o, flag);
       }
     } else {
       if (p != e) {
@@ -590,9 +731,9 @@ namespace tfel::utilities {
           --ps;
         }
         ++ps;
-        this->tokens.emplace_back(std::string{p, ps}, n, o, flag);
+        this->addToken(makeView(p, ps), n, o, flag);
       } else {
-        this->tokens.emplace_back(std::string{p, e}, n, o, flag);
+        this->addToken(makeView(p, e), n, o, flag);
       }
     }
     advance(o, p, e - p);
@@ -626,18 +767,18 @@ namespace tfel::utilities {
     if ((p != pe) && (*p == '!')) {
       next_token();
       if ((p != pe) && (*p == '<')) {
-        flag = this->tokens.empty() ? Token::Comment
-                                    : Token::DoxygenBackwardComment;
+        flag = this->hasNoTokens() ? Token::Comment
+                                   : Token::DoxygenBackwardComment;
         next_token();
       } else {
-        flag = this->tokens.empty() ? Token::Comment : Token::DoxygenComment;
+        flag = this->hasNoTokens() ? Token::Comment : Token::DoxygenComment;
       }
     }
     if (this->bKeepCommentBoundaries) {
-      this->tokens.emplace_back(std::string{b, pe}, n, o, flag);
+      this->addToken(makeView(b, pe), n, o, flag);
     } else {
       ignore_space(o, p, pe);
-      this->tokens.emplace_back(std::string{p, pe}, n, o, flag);
+      this->addToken(makeView(p, pe), n, o, flag);
     }
     advance(o, p, pe - p);
   }
@@ -666,19 +807,19 @@ namespace tfel::utilities {
       }
       return *c == '\"';
     };
-    this->tokens.emplace_back("", n, o, Token::String);
-    auto& value = this->tokens.back().value;
+    const auto b = p;
+    const auto ob = o;
     while (p != pe) {
       if (findDelimiter(p)) {
+        this->addToken(makeView(b, p), n, ob, Token::String);
         advance(o, p, this->currentRawStringDelimiter.size() + 2);
         this->rawStringOpened = false;
         this->currentRawStringDelimiter.clear();
         return;
-      } else {
-        value += *p;
-        advance(o, p, 1u);
       }
+      advance(o, p, 1u);
     }
+    this->addToken(makeView(b, p), n, ob, Token::String);
   }  // end of parseRawString
 
   void CxxTokenizer::parsePreprocessorDirective(
@@ -698,7 +839,7 @@ namespace tfel::utilities {
     };
     // preprocessor
     throw_if((p == pe) || (*p != '#'), "invalid call");
-    this->tokens.emplace_back(std::string(1u, '#'), n, o, Token::Preprocessor);
+    this->addToken("#", n, o, Token::Preprocessor);
     advance(o, p, 1);
     ignore_space(o, p, pe);
     throw_if(p == pe, "lonely ‘#’");
@@ -711,7 +852,7 @@ namespace tfel::utilities {
     const auto key = std::string{p, pn};
     throw_if(!is_preprocessor_keyword('#' + key),
              "invalid preprocessor keyword '" + key + "'");
-    this->tokens.emplace_back(std::string{p, pn}, n, o, Token::Preprocessor);
+    this->addToken(makeView(p, pn), n, o, Token::Preprocessor);
     advance(o, p, pn);
     this->parseStandardLine(o, p, p, pe, n);
   }  // end of CxxTokenizer::parsePreprocessorDirective
@@ -730,14 +871,13 @@ namespace tfel::utilities {
         if ((this->treatHashCharacterAsCommentDelimiter) &&
             (this->allowStrayHashCharacter)) {
           if (this->bKeepCommentBoundaries) {
-            this->tokens.emplace_back(std::string{p, pe}, n, o, Token::Comment);
+            this->addToken(makeView(p, pe), n, o, Token::Comment);
             p = pe;
           } else {
             ++p;
             ignore_space(o, p, pe);
             if (p != pe) {
-              this->tokens.emplace_back(std::string{p, pe}, n, o,
-                                        Token::Comment);
+              this->addToken(makeView(p, pe), n, o, Token::Comment);
               p = pe;
             }
           }
@@ -751,19 +891,19 @@ namespace tfel::utilities {
                 (!this->allowStrayHashCharacter) && (std::isalpha(*pn) == 0),
                 "stray ‘#’");
           }
-          this->tokens.emplace_back("#", n, o, Token::Standard);
+          this->addToken("#", n, o, Token::Standard);
           advance(o, p, 1u);
         }
       } else if (*p == '\\') {
         throw_if((!this->allowStrayBackSlash) && (p != std::prev(pe)),
                  "stray ‘\\’");
-        this->tokens.emplace_back("\\", n, o, Token::Standard);
+        this->addToken("\\", n, o, Token::Standard);
         advance(o, p, 1u);
       } else if (std::isdigit(*p)) {
         if (this->treatNumbers) {
           this->parseNumber(o, p, pe, n);
         } else {
-          this->tokens.emplace_back(std::string(1u, *p), n, o, Token::Standard);
+          this->addToken(makeView(p, std::next(p)), n, o, Token::Standard);
           advance(o, p, 1u);
         }
       } else if ((*p == 'R') &&
@@ -789,7 +929,7 @@ namespace tfel::utilities {
         if (this->treatStrings) {
           this->parseString(o, p, pe, n, '\"');
         } else {
-          this->tokens.emplace_back("\"", n, o, Token::Standard);
+          this->addToken("\"", n, o, Token::Standard);
           advance(o, p, 1u);
         }
       } else if (*p == '\'') {
@@ -797,7 +937,7 @@ namespace tfel::utilities {
         if (this->treatStrings) {
           this->parseChar(o, p, pe, n);
         } else {
-          this->tokens.emplace_back("\'", n, o, Token::Standard);
+          this->addToken("\'", n, o, Token::Standard);
           advance(o, p, 1u);
         }
       } else if (*p == '<') {
@@ -809,16 +949,15 @@ namespace tfel::utilities {
       } else if ((*p == '+') || (*p == '-')) {
         auto pn = std::next(p);
         if ((pn != pe) && (*pn == *p)) {
-          this->tokens.emplace_back(std::string{p, std::next(pn)}, n, o,
-                                    Token::Standard);
+          this->addToken(makeView(p, std::next(pn)), n, o, Token::Standard);
           advance(o, p, 2u);
         } else if ((*p == '-') && ((pn != pe) && (*pn == '>'))) {
           auto pn2 = std::next(p);
           if ((pn2 != pe) && (*pn == '*')) {
-            this->tokens.emplace_back("->*", n, o, Token::Standard);
+            this->addToken("->*", n, o, Token::Standard);
             advance(o, p, 3u);
           } else {
-            this->tokens.emplace_back("->", n, o, Token::Standard);
+            this->addToken("->", n, o, Token::Standard);
             advance(o, p, 2u);
           }
         } else if (((p == b) ||
@@ -830,8 +969,7 @@ namespace tfel::utilities {
           if (this->treatNumbers) {
             this->parseNumber(o, p, pe, n);
           } else {
-            this->tokens.emplace_back(std::string(1u, *p), n, o,
-                                      Token::Standard);
+            this->addToken(makeView(p, std::next(p)), n, o, Token::Standard);
             advance(o, p, 1u);
           }
         } else {
@@ -856,8 +994,7 @@ namespace tfel::utilities {
           if (this->treatNumbers) {
             this->parseNumber(o, p, pe, n);
           } else {
-            this->tokens.emplace_back(std::string(1u, *p), n, o,
-                                      Token::Standard);
+            this->addToken(makeView(p, std::next(p)), n, o, Token::Standard);
             advance(o, p, 1u);
           }
         } else {
@@ -874,21 +1011,19 @@ namespace tfel::utilities {
                                   this->graveAccentAsSeparator));
         if (as.first < pw) {
           if (as.first == p) {
-            this->tokens.emplace_back(as.second, n, o, Token::Standard);
+            this->addToken(makeView(p, p + as.second.size()), n, o,
+                           Token::Standard);
             advance(o, p, as.second.size());
           } else {
-            this->tokens.emplace_back(std::string{p, as.first}, n, o,
-                                      Token::Standard);
+            this->addToken(makeView(p, as.first), n, o, Token::Standard);
             advance(o, p, as.first);
           }
         } else {
           if (p == pw) {
-            this->tokens.emplace_back(std::string(1u, *p), n, o,
-                                      Token::Standard);
+            this->addToken(makeView(p, std::next(p)), n, o, Token::Standard);
             advance(o, p, 1u);
           } else {
-            this->tokens.emplace_back(std::string{p, pw}, n, o,
-                                      Token::Standard);
+            this->addToken(makeView(p, pw), n, o, Token::Standard);
             advance(o, p, pw);
           }
         }
@@ -897,37 +1032,35 @@ namespace tfel::utilities {
     }
   }
 
-  void CxxTokenizer::splitLine(const std::string& line,
+  void CxxTokenizer::splitLine(const std::string::const_iterator b,
+                               const std::string::const_iterator pe,
                                const Token::size_type n) {
-    auto throw_if = [](const bool b, const std::string& m) {
-      raise_if(b, "CxxTokenizer::splitLine: " + m);
+    auto throw_if = [](const bool c, const std::string& m) {
+      raise_if(c, "CxxTokenizer::splitLine: " + m);
     };
-    auto b = line.begin();
+    const auto line = makeView(b, pe);
     auto p = b;
-    const auto pe = line.end();
     // offset in line
     auto o = Token::size_type{};
     if (this->cStyleCommentOpened) {
       const auto pos3 = line.find("*/");
-      if (tokens.empty()) {
-        this->tokens.emplace_back("", n, o, Token::Comment);
+      if (this->hasNoTokens()) {
+        this->addToken("", n, o, Token::Comment);
       }
-      throw_if(((this->tokens.back().flag != Token::Comment) &&
-                (this->tokens.back().flag != Token::DoxygenComment) &&
-                (this->tokens.back().flag != Token::DoxygenBackwardComment)),
+      const auto f = this->getLastTokenFlag();
+      throw_if(((f != Token::Comment) && (f != Token::DoxygenComment) &&
+                (f != Token::DoxygenBackwardComment)),
                "internal error (previous token is not a comment)");
-      if (!this->tokens.back().value.empty()) {
-        this->tokens.back().value += '\n';
-      }
-      if (pos3 == std::string::npos) {
-        this->tokens.back().value += line;
+      auto& t = this->getLastToken();
+      if (pos3 == std::string_view::npos) {
+        this->appendLine(t, p, pe);
         advance(o, p, line.size());
         return;
       }
       if (this->bKeepCommentBoundaries) {
-        this->tokens.back().value += std::string{p, p + pos3 + 2};
+        this->appendLine(t, p, p + pos3 + 2);
       } else {
-        this->tokens.back().value += std::string{p, p + pos3};
+        this->appendLine(t, p, p + pos3);
       }
       advance(o, p, pos3 + 2);
       this->cStyleCommentOpened = false;
@@ -935,22 +1068,18 @@ namespace tfel::utilities {
     if (this->rawStringOpened) {
       const auto delimiter = ")" + this->currentRawStringDelimiter + '\"';
       const auto pos3 = line.find(delimiter);
-      if (pos3 == std::string::npos) {
-      }
-      if (tokens.empty()) {
-        this->tokens.emplace_back("", n, o, Token::String);
+      if (this->hasNoTokens()) {
+        this->addToken("", n, o, Token::String);
       }
-      throw_if((this->tokens.back().flag != Token::String),
+      throw_if((this->getLastTokenFlag() != Token::String),
                "internal error (previous token is not a string)");
-      if (!this->tokens.back().value.empty()) {
-        this->tokens.back().value += '\n';
-      }
-      if (pos3 == std::string::npos) {
-        this->tokens.back().value += line;
+      auto& t = this->getLastToken();
+      if (pos3 == std::string_view::npos) {
+        this->appendLine(t, p, pe);
         advance(o, p, line.size());
         return;
       }
-      this->tokens.back().value += std::string{p, p + pos3};
+      this->appendLine(t, p, p + pos3);
       advance(o, p, pos3 + delimiter.size());
       this->rawStringOpened = false;
       this->currentRawStringDelimiter.clear();
@@ -967,42 +1096,67 @@ namespace tfel::utilities {
     }
   }  // end of CxxTokenizer::splitLine
 
-  void CxxTokenizer::stripComments() {
-    for (auto p = this->tokens.begin(); p != this->tokens.end();) {
+  /*!
+   * \brief remove all comment tokens
+   * \param[in,out] tokens: tokens
+   * \param[out] comments: comments associated with each line
+   * \param[in] store: function returning a value that can be stored in a
+   * token from a string
+   */
+  template <typename TokenType, typename StoreFunction>
+  static void stripComments(std::vector<TokenType>& tokens,
+                            std::map<Token::size_type, std::string>& comments,
+                            const StoreFunction& store) {
+    // tokens are moved in place to avoid successive erasures
+    auto pw = tokens.begin();
+    for (auto p = tokens.begin(); p != tokens.end(); ++p) {
       if (p->flag == Token::Comment) {
-        if (this->comments.find(p->line) != this->comments.end()) {
-          this->comments[p->line] += ' ';
-        }
-        this->comments[p->line] = p->value;
-        p = this->tokens.erase(p);
+        comments[p->line] = std::string{p->value};
       } else if (p->flag == Token::DoxygenComment) {
-        auto p2 = p;
-        ++p2;
-        if (p2 != this->tokens.end()) {
+        const auto p2 = std::next(p);
+        if (p2 != tokens.end()) {
           if (p2->flag == Token::Standard) {
-            if (!p2->comment.empty()) {
-              p2->comment += '\n';
+            auto c = std::string{p2->comment};
+            if (!c.empty()) {
+              c += '\n';
             }
-            p2->comment += p->value;
+            c += p->value;
+            p2->comment = store(std::move(c));
           }
           if (p2->flag == Token::DoxygenComment) {
-            p2->value = p->value + "\n" + p2->value;
+            auto v = std::string{p->value};
+            v += '\n';
+            v += p2->value;
+            p2->value = store(std::move(v));
           }
         }
-        p = this->tokens.erase(p);
       } else if (p->flag == Token::DoxygenBackwardComment) {
-        auto p2 = p;
-        --p2;
-        if (p2 != this->tokens.begin()) {
-          if (p2->flag == Token::Standard) {
-            p2->comment += p->value;
+        if (std::distance(tokens.begin(), pw) > 1) {
+          auto& t = *(std::prev(pw));
+          if (t.flag == Token::Standard) {
+            auto c = std::string{t.comment};
+            c += p->value;
+            t.comment = store(std::move(c));
           }
         }
-        p = this->tokens.erase(p);
       } else {
-        ++p;
+        if (pw != p) {
+          *pw = std::move(*p);
+        }
+        ++pw;
       }
     }
+    tokens.erase(pw, tokens.end());
+  }  // end of stripComments
+
+  void CxxTokenizer::stripComments() {
+    tfel::utilities::stripComments(this->tokens, this->comments,
+                                   [](std::string s) { return s; });
+    tfel::utilities::stripComments(
+        this->token_views, this->comments,
+        [this](std::string s) -> std::string_view {
+          return this->store(std::move(s));
+        });
   }  // end of CxxTokenizer::stripComments
 
   void CxxTokenizer::printFileTokens(std::ostream& out) const {
@@ -1149,6 +1303,9 @@ namespace tfel::utilities {
     this->rawStringOpened = false;
     this->currentRawStringDelimiter.clear();
     this->tokens.clear();
+    this->token_views.clear();
+    this->strings.reset();
+    this->current_source = std::string_view{};
     this->comments.clear();
   }  // end of CxxTokenizer::clear
 
@@ -1389,6 +1546,14 @@ namespace tfel::utilities {
         token.value = tfel::utilities::replace_all(token.value, s1, s2);
       }
     }
+    for (auto& token : this->token_views) {
+      for (const auto& [s1, s2] : substitutions) {
+        if (token.value.find(s1) != std::string_view::npos) {
+          token.value =
+              this->store(tfel::utilities::replace_all(token.value, s1, s2));
+        }
+      }
+    }
   }  // end of substitute
 
   CxxTokenizer::~CxxTokenizer() = default;
@@ -11,20 +11,287 @@
  * project under specific licensing conditions.
  */
 
+#include <bit>
+#include <cmath>
+#include <tuple>
+#include <limits>
+#include <future>
 #include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <charconv>
 #include <stdexcept>
-#include <sstream>
-#include <fstream>
 #include <algorithm>
 #include <iterator>
+#include <string_view>
+#if (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__)
+#include <fstream>
+#include <sstream>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
 #include "TFEL/Raise.hxx"
 #include "TFEL/Utilities/CxxTokenizer.hxx"
 #include "TFEL/Utilities/TextData.hxx"
+#include "TFEL/Utilities/BinaryDataWriter.hxx"
 #include "TFEL/Utilities/StringAlgorithms.hxx"
 
 namespace tfel::utilities {
 
-  TextData::TextData(const std::string& file, const std::string& format) {
+  //! \brief read-only view on the content of a file
+  struct TextDataFileContent {
+    /*!
+     * \brief constructor
+     * \param[in] f: file name
+     */
+    explicit TextDataFileContent(const std::string& f) {
+#if (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__)
+      std::ifstream in(f, std::ios::binary);
+      raise_if(!in, "TextData::TextData: can't open '" + f + '\'');
+      std::ostringstream os;
+      os << in.rdbuf();
+      this->content = os.str();
+#else
+      const auto fd = ::open(f.c_str(), O_RDONLY);
+      raise_if(fd == -1, "TextData::TextData: can't open '" + f + '\'');
+      struct stat info;
+      if ((::fstat(fd, &info) == -1) || (!S_ISREG(info.st_mode))) {
+        ::close(fd);
+        raise("TextData::TextData: can't open '" + f + '\'');
+      }
+      this->size = static_cast<std::size_t>(info.st_size);
+      if (this->size != 0) {
+        this->data = ::mmap(nullptr, this->size, PROT_READ, MAP_PRIVATE, fd, 0);
+      }
+      ::close(fd);
+      if (this->data == MAP_FAILED) {
+        this->data = nullptr;
+        raise("TextData::TextData: can't map '" + f + "' in memory");
+      }
+#ifdef MADV_SEQUENTIAL
+      if (this->data != nullptr) {
+        ::madvise(this->data, this->size, MADV_SEQUENTIAL);
+      }
+#endif /* MADV_SEQUENTIAL */
+#endif
+    }  // end of TextDataFileContent
+    //! \return the content of the file
+    std::string_view view() const {
+#if (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__)
+      return this->content;
+#else
+      if (this->data == nullptr) {
+        return {};
+      }
+      return {static_cast<const char*>(this->data), this->size};
+#endif
+    }  // end of view
+    //! \brief destructor
+    ~TextDataFileContent() {
+#if !((defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__))
+      if (this->data != nullptr) {
+        ::munmap(this->data, this->size);
+      }
+#endif
+    }  // end of ~TextDataFileContent
+
+   private:
+#if (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__)
+    //! \brief content of the file
+    std::string content;
+#else
+    //! \brief mapped memory
+    void* data = nullptr;
+    //! \brief size of the file
+    std::size_t size = 0;
+#endif
+  };  // end of struct TextDataFileContent
+
+  //! \brief lines of data read by a thread
+  struct TextDataParsedLines {
+    //! \brief line numbers
+    std::vector<TextData::size_type> numbers;
+    //! \brief number of values per line
+    std::vector<TextData::size_type> sizes;
+    //! \brief values, stored line by line
+    std::vector<double> values;
+    //! \brief tokens which are not numbers (line, column, value)
+    std::vector<
+        std::tuple<TextData::size_type, TextData::size_type, std::string>>
+        words;
+  };  // end of struct TextDataParsedLines
+
+  static bool isTextDataBlank(const char c) {
+    return (c == ' ') || (c == '\t') || (c == '\r') || (c == '\v') ||
+           (c == '\f');
+  }  // end of isTextDataBlank
+
+  /*!
+   * \brief parse a line of data
+   * \param[out] r: parsed lines
+   * \param[in] l: line
+   * \param[in] n: line number
+   */
+  static void parseTextDataLine(TextDataParsedLines& r,
+                                std::string_view l,
+                                const TextData::size_type n) {
+    const auto first_value = r.values.size();
+    const auto index = r.sizes.size();
+    auto nvalues = TextData::size_type{};
+    // fast path: the line only contains numbers separated by blanks
+    auto p = l.data();
+    const auto pe = l.data() + l.size();
+    auto numbers_only = true;
+    while (p != pe) {
+      while ((p != pe) && (isTextDataBlank(*p))) {
+        ++p;
+      }
+      if (p == pe) {
+        break;
+      }
+      auto we = p;
+      while ((we != pe) && (!isTextDataBlank(*we))) {
+        ++we;
+      }
+      auto v = double{};
+      const auto [ptr, ec] = std::from_chars(p, we, v);
+      if ((ec != std::errc{}) || (ptr != we)) {
+        numbers_only = false;
+        break;
+      }
+      r.values.push_back(v);
+      ++nvalues;
+      p = we;
+    }
+    if (!numbers_only) {
+      // slow path
+      r.values.resize(first_value);
+      nvalues = 0;
+      CxxTokenizer t;
+      t.treatCharAsString(true);
+      t.useTokenViews(true);
+      t.parseString(std::string{l});
+      t.stripComments();
+      for (const auto& w : t.getTokenViews()) {
+        // numbers are parsed directly from the view, a string is only
+        // built for words
+        const auto wb = w.value.data();
+        const auto wend = wb + w.value.size();
+        auto v = double{};
+        const auto [ptr, ec] = std::from_chars(wb, wend, v);
+        if ((ec != std::errc{}) || (ptr != wend)) {
+          r.values.push_back(std::numeric_limits<double>::quiet_NaN());
+          r.words.emplace_back(index, nvalues, std::string{w.value});
+        } else {
+          r.values.push_back(v);
+        }
+        ++nvalues;
+      }
+    }
+    r.numbers.push_back(n);
+    r.sizes.push_back(nvalues);
+  }  // end of parseTextDataLine
+
+  /*!
+   * \brief parse the lines of data of the given text. Empty lines and
+   * comment lines are ignored.
+   * \param[in] s: text
+   * \param[in] n: number of the first line of data
+   */
+  static TextDataParsedLines parseTextDataLines(std::string_view s,
+                                                TextData::size_type n) {
+    auto r = TextDataParsedLines{};
+    auto pos = std::string_view::size_type{};
+    while (pos < s.size()) {
+      auto e = s.find('\n', pos);
+      if (e == std::string_view::npos) {
+        e = s.size();
+      }
+      const auto l = s.substr(pos, e - pos);
+      pos = e + 1;
+      if ((l.empty()) || (l[0] == '#')) {
+        continue;
+      }
+      parseTextDataLine(r, l, n);
+      ++n;
+    }
+    return r;
+  }  // end of parseTextDataLines
+
+  /*!
+   * \brief read an unsigned integer stored in little-endian order
+   * \param[in] p: pointer to the first byte
+   */
+  template <typename IntegerType>
+  static IntegerType readLittleEndian(const char* const p) {
+    auto v = IntegerType{};
+    for (std::size_t i = 0; i != sizeof(IntegerType); ++i) {
+      v |= static_cast<IntegerType>(static_cast<unsigned char>(p[i]))
+           << (8 * i);
+    }
+    return v;
+  }  // end of readLittleEndian
+
+  void TextData::readBinaryData(std::string_view s, const std::string& f) {
+    auto pos = std::string_view::size_type{};
+    auto read = [&s, &pos, &f](const std::string_view::size_type n) {
+      raise_if(s.size() - pos < n,
+               "TextData::TextData: unexpected end of file '" + f + "'");
+      const auto p = s.data() + pos;
+      pos += n;
+      return p;
+    };
+    const auto& magic = BinaryDataWriter::magic;
+    raise_if(!s.starts_with(magic),
+             "TextData::TextData: file '" + f + "' is not a binary data file");
+    pos = magic.size();
+    const auto fv = readLittleEndian<std::uint32_t>(read(4));
+    raise_if(fv != BinaryDataWriter::version,
+             "TextData::TextData: unsupported version of the binary format "
+             "in file '" +
+                 f + "'");
+    const auto nc = readLittleEndian<std::uint32_t>(read(4));
+    for (std::uint32_t i = 0; i != nc; ++i) {
+      const auto l = readLittleEndian<std::uint32_t>(read(4));
+      this->legends.emplace_back(read(l), l);
+    }
+    this->columns.resize(nc);
+    while (pos != s.size()) {
+      const auto nl = readLittleEndian<std::uint64_t>(read(8));
+      raise_if(nc == 0 ? nl != 0 : nl > (s.size() - pos) / (8 * nc),
+               "TextData::TextData: unexpected end of file '" + f + "'");
+      for (auto& c : this->columns) {
+        const auto p = read(8 * static_cast<std::size_t>(nl));
+        const auto offset = c.size();
+        c.resize(offset + nl);
+        if constexpr (std::endian::native == std::endian::little) {
+          std::memcpy(c.data() + offset, p, 8 * nl);
+        } else {
+          for (std::uint64_t i = 0; i != nl; ++i) {
+            const auto v = readLittleEndian<std::uint64_t>(p + 8 * i);
+            c[offset + i] = std::bit_cast<double>(v);
+          }
+        }
+      }
+    }
+    const auto nlines = this->columns.empty() ? size_type{}
+                                              : this->columns[0].size();
+    // the header is numbered as the first line, as the legends of a file
+    // in the gnuplot format
+    this->numbers.resize(nlines);
+    for (size_type i = 0; i != nlines; ++i) {
+      this->numbers[i] = i + 2;
+    }
+    this->sizes.resize(nlines, nc);
+    this->minimal_size = nlines == 0 ? 0 : nc;
+  }  // end of TextData::readBinaryData
+
+  TextData::TextData(const std::string& file,
+                     const std::string& format,
+                     const unsigned short nthreads) {
     auto get_legends = [](const std::string& l) {
       std::vector<std::string> r;
       CxxTokenizer t;
@@ -40,33 +307,32 @@ namespace tfel::utilities {
       });
       return r;
     };
-    auto add_line = [this](const std::string& l, const Token::size_type n) {
-      Line nl;
-      CxxTokenizer t;
-      t.treatCharAsString(true);
-      t.parseString(l);
-      t.stripComments();
-      std::for_each(t.begin(), t.end(), [&nl, &n](const Token& w) {
-        nl.tokens.push_back(w);
-        nl.tokens.back().line = n;
-      });
-      this->lines.push_back(std::move(nl));
-    };
+    const auto content = TextDataFileContent{file};
+    const auto s = content.view();
+    // binary files are detected whatever the format requested, so that
+    // tools imposing a text format (such as tfel-check) can read them
+    if ((format == "binary") || (s.starts_with(BinaryDataWriter::magic))) {
+      this->readBinaryData(s, file);
+      return;
+    }
+    auto pos = std::string_view::size_type{};
+    // treatment of the header, i.e. the lines before the first line of
+    // data which is not treated as a potential legend
+    auto header = TextDataParsedLines{};
     auto firstLine = true;
     auto firstComments = true;
     auto nbr = size_type{1};
-    std::ifstream f{file};
-    raise_if(!f, "TextData::TextData: can't open '" + file + '\'');
-    while (!f.eof()) {
-      auto line = std::string{};
-      getline(f, line);
+    while ((firstComments) && (pos < s.size())) {
+      auto e = s.find('\n', pos);
+      if (e == std::string_view::npos) {
+        e = s.size();
+      }
+      auto line = std::string{s.substr(pos, e - pos)};
+      pos = e + 1;
       if (line.empty()) {
         continue;
       }
       if (line[0] == '#') {
-        if (!firstComments) {
-          continue;
-        }
         if (format.empty()) {
           line.erase(line.begin());
           if (firstLine) {
@@ -90,16 +356,93 @@ namespace tfel::utilities {
           }
           if (all_numbers) {
             this->legends.clear();
-            add_line(line, nbr);
+            parseTextDataLine(header, line, nbr);
           }
         } else {
-          add_line(line, nbr);
+          parseTextDataLine(header, line, nbr);
           firstComments = false;
         }
       }
       firstLine = false;
       ++nbr;
     }
+    // lines of data, treated by chunks
+    auto chunks = std::vector<TextDataParsedLines>{};
+    chunks.push_back(std::move(header));
+    if (pos < s.size()) {
+      const auto data = s.substr(pos);
+      // minimal size of a chunk
+      constexpr auto chunk_size = std::string_view::size_type{1} << 22;
+      const auto nchunks = std::max(
+          std::string_view::size_type{1},
+          std::min(static_cast<std::string_view::size_type>(nthreads),
+                   data.size() / chunk_size));
+      if (nchunks == 1) {
+        chunks.push_back(parseTextDataLines(data, 0));
+      } else {
+        auto tasks = std::vector<std::future<TextDataParsedLines>>{};
+        auto b = std::string_view::size_type{};
+        for (std::string_view::size_type i = 0; i != nchunks; ++i) {
+          auto e = (i + 1 == nchunks) ? data.size()
+                                      : (data.size() * (i + 1)) / nchunks;
+          if (e < b) {
+            e = b;
+          }
+          e = std::min(data.find('\n', e), data.size());
+          const auto chunk = data.substr(b, e - b);
+          tasks.push_back(std::async(std::launch::async, [chunk] {
+            return parseTextDataLines(chunk, 0);
+          }));
+          b = std::min(e + 1, data.size());
+        }
+        for (auto& t : tasks) {
+          chunks.push_back(t.get());
+        }
+      }
+      // numbering of the lines of data
+      auto n = nbr;
+      for (auto pc = std::next(chunks.begin()); pc != chunks.end(); ++pc) {
+        for (auto& number : pc->numbers) {
+          number += n;
+        }
+        n += pc->numbers.size();
+      }
+    }
+    // storing the values by columns
+    auto nlines = size_type{};
+    auto ncolumns = size_type{};
+    for (const auto& c : chunks) {
+      nlines += c.sizes.size();
+      for (const auto& size : c.sizes) {
+        ncolumns = std::max(ncolumns, size);
+      }
+    }
+    this->numbers.reserve(nlines);
+    this->sizes.reserve(nlines);
+    this->columns.resize(ncolumns);
+    for (auto& c : this->columns) {
+      c.resize(nlines, std::numeric_limits<double>::quiet_NaN());
+    }
+    this->minimal_size = nlines == 0 ? 0 : ncolumns;
+    auto offset = size_type{};
+    for (auto& c : chunks) {
+      auto pv = c.values.begin();
+      for (size_type i = 0; i != c.sizes.size(); ++i) {
+        const auto size = c.sizes[i];
+        for (size_type j = 0; j != size; ++j, ++pv) {
+          this->columns[j][offset + i] = *pv;
+        }
+        this->minimal_size = std::min(this->minimal_size, size);
+      }
+      for (auto& [l, j, w] : c.words) {
+        this->words.insert({{j, offset + l}, std::move(w)});
+      }
+      this->numbers.insert(this->numbers.end(), c.numbers.begin(),
+                           c.numbers.end());
+      this->sizes.insert(this->sizes.end(), c.sizes.begin(), c.sizes.end());
+      offset += c.sizes.size();
+      c = TextDataParsedLines{};
+    }
   }  // end of TextData::TextData
 
   const std::vector<std::string>& TextData::getLegends() const {
@@ -139,42 +482,98 @@ namespace tfel::utilities {
       raise_if(b, "TextData::getColumn: " + msg);
     };
     tab.clear();
-    tab.reserve(this->lines.size());
     // sanity check
     throw_if(i == 0u,
              "column '0' requested "
              "(column numbers begins at '1').");
-    // treatment
-    for (const auto& l : this->lines) {
-      auto n = l.tokens.empty() ? 0 : l.tokens[0].line;
-      throw_if(l.tokens.size() < i, "line '" + std::to_string(n) +
-                                        "' "
-                                        "does not have '" +
-                                        std::to_string(i) + "' columns.");
-      tab.push_back(convert<double>(l.tokens.at(i - 1u).value));
+    // the first token of the column which is not a number, if any
+    const auto pw = this->words.lower_bound({i - 1, 0});
+    const auto has_words =
+        (pw != this->words.end()) && (pw->first.first == i - 1);
+    if ((i <= this->minimal_size) && (!has_words)) {
+      tab = this->columns[i - 1];
+      return;
+    }
+    // errors are reported in the order of the lines
+    tab.reserve(this->sizes.size());
+    for (size_type l = 0; l != this->sizes.size(); ++l) {
+      throw_if(this->sizes[l] < i, "line '" + std::to_string(this->numbers[l]) +
+                                       "' "
+                                       "does not have '" +
+                                       std::to_string(i) + "' columns.");
+      const auto p = this->words.find({i - 1, l});
+      if (p != this->words.end()) {
+        tab.push_back(convert<double>(p->second));
+      } else {
+        tab.push_back(this->columns[i - 1][l]);
+      }
     }
   }  // end of TextData::getColumn
 
+  TextData::size_type TextData::getNumberOfLines() const {
+    return this->sizes.size();
+  }  // end of TextData::getNumberOfLines
+
+  void TextData::buildLines() const {
+    this->lines.resize(this->sizes.size());
+    for (size_type l = 0; l != this->sizes.size(); ++l) {
+      auto& tokens = this->lines[l].tokens;
+      tokens.clear();
+      for (size_type j = 0; j != this->sizes[l]; ++j) {
+        const auto p = this->words.find({j, l});
+        if (p != this->words.end()) {
+          tokens.emplace_back(p->second, this->numbers[l], 0);
+          continue;
+        }
+        char buffer[64];
+        const auto r = std::to_chars(buffer, buffer + sizeof(buffer),
+                                     this->columns[j][l]);
+        tokens.emplace_back(std::string(buffer, r.ptr), this->numbers[l], 0,
+                            Token::Number);
+      }
+    }
+  }  // end of TextData::buildLines
+
   std::vector<TextData::Line>::const_iterator TextData::begin() const {
+    std::call_once(this->lines_flag, [this] { this->buildLines(); });
     return this->lines.begin();
   }  // end of TextData::begin()
 
   std::vector<TextData::Line>::const_iterator TextData::end() const {
+    std::call_once(this->lines_flag, [this] { this->buildLines(); });
     return this->lines.end();
   }  // end of TextData::end()
 
   void TextData::skipLines(const Token::size_type n) {
-    auto get_line = [](const Line& l) -> Token::size_type {
-      return l.tokens.empty() ? 0 : l.tokens[0].line;
-    };
-    if (this->lines.empty()) {
+    auto k = size_type{};
+    while ((k != this->numbers.size()) && (this->numbers[k] <= n + 1)) {
+      ++k;
+    }
+    if (k == 0) {
       return;
     }
-    auto p = this->lines.begin();
-    while ((get_line(*p) <= n + 1) && (p != this->lines.end())) {
-      ++p;
+    const auto d = static_cast<std::ptrdiff_t>(k);
+    this->numbers.erase(this->numbers.begin(), this->numbers.begin() + d);
+    this->sizes.erase(this->sizes.begin(), this->sizes.begin() + d);
+    for (auto& c : this->columns) {
+      c.erase(c.begin(), c.begin() + d);
+    }
+    auto nwords = decltype(this->words){};
+    for (auto& [key, w] : this->words) {
+      if (key.second >= k) {
+        nwords.insert({{key.first, key.second - k}, std::move(w)});
+      }
+    }
+    this->words = std::move(nwords);
+    if (this->sizes.empty()) {
+      this->minimal_size = 0;
+    } else {
+      this->minimal_size =
+          *(std::min_element(this->sizes.begin(), this->sizes.end()));
+    }
+    if (!this->lines.empty()) {
+      this->lines.erase(this->lines.begin(), this->lines.begin() + d);
     }
-    lines.erase(lines.begin(), p);
-  }
+  }  // end of TextData::skipLines
 
 }  // end of namespace tfel::utilities
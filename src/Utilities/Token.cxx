@@ -28,6 +28,13 @@ namespace tfel::utilities {
                const TokenFlag f)
       : value(v), line(l), offset(o), flag(f) {}
 
+  Token::Token(const TokenView& t)
+      : value(t.value),
+        line(t.line),
+        offset(t.offset),
+        comment(t.comment),
+        flag(t.flag) {}
+
   Token::~Token() noexcept = default;
 
   bool isComment(const Token& t) {
@@ -35,4 +42,9 @@ namespace tfel::utilities {
             (t.flag == Token::DoxygenBackwardComment));
   }  // end of isComment
 
+  bool isComment(const TokenView& t) {
+    return ((t.flag == Token::Comment) || (t.flag == Token::DoxygenComment) ||
+            (t.flag == Token::DoxygenBackwardComment));
+  }  // end of isComment
+
 }  // end of namespace tfel::utilities
@@ -48,6 +48,10 @@ struct AnisotropicEshelbyTensorTest final : public tfel::tests::TestCase {
     this->template test_Eshelby<double, false>();
     this->template test_Eshelby2D<double, false>();
     this->template test_localisator<double, false>();
+    this->template test_quadrature<double, true>();
+    this->template test_quadrature<double, false>();
+    this->template test_cache<double, true>();
+    this->template test_cache<double, false>();
     return this->result;
   }
 
@@ -194,6 +198,175 @@ struct AnisotropicEshelbyTensorTest final : public tfel::tests::TestCase {
 #endif /* _LIBCPP_VERSION */
   }    // end of test_localisator
 
+  //! \return a cubic stiffness tensor
+  template <typename stress>
+  static tfel::math::st2tost2<3u, stress> getCubicStiffnessTensor() {
+    auto C = tfel::math::st2tost2<3u, stress>(stress(0));
+    for (unsigned short i = 0; i != 3; ++i) {
+      for (unsigned short j = 0; j != 3; ++j) {
+        C(i, j) = (i == j) ? stress(200e9) : stress(130e9);
+      }
+      C(i + 3, i + 3) = 2 * stress(100e9);
+    }
+    return C;
+  }
+
+  /*!
+   * \brief compare the Eshelby tensors computed using a fixed-order
+   * quadrature to the analytical results and to the adaptive integration
+   */
+  template <typename NumericType, bool use_qt>
+  void test_quadrature() {
+#ifndef _LIBCPP_VERSION
+    using namespace tfel::material::homogenization::elasticity;
+    using real = NumericType;
+    using lg = typename tfel::config::Types<1u, real, use_qt>::length;
+    using stress = typename tfel::config::Types<1u, real, use_qt>::stress;
+    static constexpr auto eps =
+        tfel::math::constexpr_fct::sqrt(std::numeric_limits<real>::epsilon());
+    static constexpr auto eps2 = real(1e-10);
+    const auto q = AnisotropicHillTensorQuadrature<real>{};
+    const auto nu = real{0.3};
+    const auto young = stress{150e9};
+    const tfel::math::tvector<3u, real> n_a = {1., 0., 0.};
+    const tfel::math::tvector<3u, real> n_b = {0., 1., 0.};
+    tfel::math::st2tost2<3u, stress> C_0;
+    using namespace tfel::material;
+    static constexpr auto value =
+        StiffnessTensorAlterationCharacteristic::UNALTERED;
+    computeIsotropicStiffnessTensorII<3u, value, stress, real>(C_0, young, nu);
+    // isotropic matrix
+    for (const auto& L : {std::array<real, 3u>{3, 2, 1},
+                          std::array<real, 3u>{30, 3, 3},
+                          std::array<real, 3u>{30, 30, 1},
+                          std::array<real, 3u>{20, 2, 1},
+                          std::array<real, 3u>{3, 3, 3}}) {
+      const auto S1 = computeAnisotropicEshelbyTensor<stress>(
+          C_0, n_a, lg{L[0]}, n_b, lg{L[1]}, lg{L[2]}, q);
+      const auto S2 =
+          computeEshelbyTensor<stress>(nu, lg{L[0]}, lg{L[1]}, lg{L[2]});
+      for (int i : {0, 1, 2, 3, 4, 5}) {
+        for (int j : {0, 1, 2, 3, 4, 5}) {
+          TFEL_TESTS_ASSERT(std::abs(S1(i, j) - S2(i, j)) < eps2);
+        }
+      }
+    }
+    // cubic matrix and arbitrary orientation
+    const auto C_c = getCubicStiffnessTensor<stress>();
+    const tfel::math::tvector<3u, real> n_a2 = {1., 1., 0.};
+    const tfel::math::tvector<3u, real> n_b2 = {-1., 1., 1.};
+    const auto S3 = computeAnisotropicEshelbyTensor<stress>(
+        C_c, n_a2, lg{3}, n_b2, lg{2}, lg{1}, q);
+    const auto S4 = computeAnisotropicEshelbyTensor<stress>(
+        C_c, n_a2, lg{3}, n_b2, lg{2}, lg{1}, 14);
+    for (int i : {0, 1, 2, 3, 4, 5}) {
+      for (int j : {0, 1, 2, 3, 4, 5}) {
+        TFEL_TESTS_ASSERT(std::abs(S3(i, j) - S4(i, j)) < eps);
+      }
+    }
+    // localisation tensor
+    const auto young_i = stress{150e9};
+    const auto nu_i = real{0.1};
+    tfel::math::st2tost2<3u, stress> C_i;
+    computeIsotropicStiffnessTensorII<3u, value, stress, real>(C_i, young_i,
+                                                               nu_i);
+    const tfel::math::tvector<3u, real> n_a3 = {0., 0., 1.};
+    const tfel::math::tvector<3u, real> n_b3 = {1., 0., 0.};
+    const auto A1 = computeAnisotropicLocalisationTensor<stress>(
+        C_0, C_i, n_a3, lg{20}, n_b3, lg{2}, lg{1}, q);
+    const auto A2 = computeEllipsoidLocalisationTensor<stress>(
+        young, nu, young_i, nu_i, n_a3, lg{20}, n_b3, lg{2}, lg{1});
+    for (int i : {0, 1, 2, 3, 4, 5}) {
+      for (int j : {0, 1, 2, 3, 4, 5}) {
+        TFEL_TESTS_ASSERT(std::abs(A1(i, j) - A2(i, j)) < eps2);
+      }
+    }
+    // plane strain
+    const tfel::math::tvector<2u, real> n_a4 = {1., 0.};
+    tfel::math::st2tost2<2u, stress> C2D_0;
+    computeIsotropicStiffnessTensorII<2u, value, stress, real>(C2D_0, young,
+                                                               nu);
+    const auto S2D1 = computePlaneStrainAnisotropicEshelbyTensor<stress>(
+        C2D_0, n_a4, lg{3}, lg{2}, q);
+    const auto S2D2 = computePlaneStrainEshelbyTensor(nu, real{1.5});
+    const auto S2D3 = computePlaneStrainAnisotropicEshelbyTensor<stress>(
+        C2D_0, n_a4, lg{20}, lg{1}, q);
+    const auto S2D4 = computePlaneStrainEshelbyTensor(nu, real{20});
+    for (int i : {0, 1, 2, 3}) {
+      for (int j : {0, 1, 2, 3}) {
+        TFEL_TESTS_ASSERT(std::abs(S2D1(i, j) - S2D2(i, j)) < eps2);
+        TFEL_TESTS_ASSERT(std::abs(S2D3(i, j) - S2D4(i, j)) < eps2);
+      }
+    }
+#endif /* _LIBCPP_VERSION */
+  }  // end of test_quadrature
+
+  //! \brief check the cache of Hill tensors
+  template <typename NumericType, bool use_qt>
+  void test_cache() {
+#ifndef _LIBCPP_VERSION
+    using namespace tfel::material::homogenization::elasticity;
+    using real = NumericType;
+    using lg = typename tfel::config::Types<1u, real, use_qt>::length;
+    using stress = typename tfel::config::Types<1u, real, use_qt>::stress;
+    using compliance =
+        typename tfel::config::Types<1u, real, use_qt>::compliance;
+    static constexpr auto ceps = compliance(real(1e-10) / real(1e9));
+    const auto C = getCubicStiffnessTensor<stress>();
+    const tfel::math::tvector<3u, real> n_a = {1., 1., 0.};
+    const tfel::math::tvector<3u, real> n_b = {-1., 1., 1.};
+    const tfel::math::tvector<3u, real> n_a2 = {1., 0., 0.};
+    const tfel::math::tvector<3u, real> n_b2 = {0., 1., 0.};
+    auto cache = AnisotropicHillTensorCache<3u, stress>{};
+    const auto P1 = cache.getHillTensor(
+        C, n_a, n_b, std::array<lg, 3u>{lg{3}, lg{2}, lg{1}});
+    TFEL_TESTS_ASSERT(cache.size() == 1);
+    TFEL_TESTS_ASSERT(cache.getNumberOfHits() == 0);
+    // same shape, up to a scaling factor
+    const auto P2 = cache.getHillTensor(
+        C, n_a, n_b, std::array<lg, 3u>{lg{6}, lg{4}, lg{2}});
+    TFEL_TESTS_ASSERT(cache.size() == 1);
+    TFEL_TESTS_ASSERT(cache.getNumberOfHits() == 1);
+    // other orientation
+    const auto P3 = cache.getHillTensor(
+        C, n_a2, n_b2, std::array<lg, 3u>{lg{3}, lg{2}, lg{1}});
+    TFEL_TESTS_ASSERT(cache.size() == 2);
+    TFEL_TESTS_ASSERT(cache.getNumberOfHits() == 1);
+    // other stiffness
+    const auto P4 = cache.getHillTensor(
+        2 * C, n_a, n_b, std::array<lg, 3u>{lg{3}, lg{2}, lg{1}});
+    TFEL_TESTS_ASSERT(cache.size() == 3);
+    TFEL_TESTS_ASSERT(cache.getNumberOfHits() == 1);
+    const auto P5 = computeAnisotropicHillTensor<stress>(
+        C, n_a, lg{3}, n_b, lg{2}, lg{1}, cache.getQuadrature());
+    const auto P6 = computeAnisotropicHillTensor<stress>(
+        C, n_a2, lg{3}, n_b2, lg{2}, lg{1}, cache.getQuadrature());
+    for (int i : {0, 1, 2, 3, 4, 5}) {
+      for (int j : {0, 1, 2, 3, 4, 5}) {
+        TFEL_TESTS_ASSERT(my_abs(P1(i, j) - P5(i, j)) < ceps);
+        TFEL_TESTS_ASSERT(my_abs(P2(i, j) - P5(i, j)) < ceps);
+        TFEL_TESTS_ASSERT(my_abs(P3(i, j) - P6(i, j)) < ceps);
+        TFEL_TESTS_ASSERT(my_abs(2 * P4(i, j) - P5(i, j)) < ceps);
+      }
+    }
+    cache.clear();
+    TFEL_TESTS_ASSERT(cache.size() == 0);
+    // the oldest entries are replaced when the cache is full
+    auto cache2 = AnisotropicHillTensorCache<3u, stress>(16, 2);
+    for (const auto l : {real(1), real(2), real(3)}) {
+      static_cast<void>(cache2.getHillTensor(
+          C, n_a, n_b, std::array<lg, 3u>{lg{l}, lg{2}, lg{1}}));
+    }
+    TFEL_TESTS_ASSERT(cache2.size() == 2);
+    static_cast<void>(cache2.getHillTensor(
+        C, n_a, n_b, std::array<lg, 3u>{lg{3}, lg{2}, lg{1}}));
+    TFEL_TESTS_ASSERT(cache2.getNumberOfHits() == 1);
+    static_cast<void>(cache2.getHillTensor(
+        C, n_a, n_b, std::array<lg, 3u>{lg{1}, lg{2}, lg{1}}));
+    TFEL_TESTS_ASSERT(cache2.getNumberOfHits() == 1);
+#endif /* _LIBCPP_VERSION */
+  }  // end of test_cache
+
 };  // end of struct AnisotropicEshelbyTensorTest
 
 TFEL_TESTS_GENERATE_PROXY(AnisotropicEshelbyTensorTest,
@@ -52,6 +52,9 @@ struct MicrostructureLinearHomogenizationTest final
     this->template user_defined_distribution<real, stress, length>();
     this->template user_defined_distribution<real, real, real>();
 
+    this->template test_cache<real, stress, length>();
+    this->template test_cache<real, real, real>();
+
     return this->result;
   }
 
@@ -165,6 +168,47 @@ struct MicrostructureLinearHomogenizationTest final
                       1e-3);
   }
 
+  template <typename real, typename stress, typename length>
+  void test_cache() {
+    using namespace tfel::material::homogenization::elasticity;
+    tfel::math::tvector<3u, real> n_a = {1., 0., 0.};
+    tfel::math::tvector<3u, real> n_b = {0., 1., 0.};
+    tfel::math::st2tost2<3u, stress> C_0;
+    tfel::math::st2tost2<3u, stress> C_i;
+    static constexpr auto value =
+        tfel::material::StiffnessTensorAlterationCharacteristic::UNALTERED;
+    tfel::material::computeIsotropicStiffnessTensorII<3u, value, stress, real>(
+        C_0, stress{1e9}, real(0.2));
+    tfel::material::computeIsotropicStiffnessTensorII<3u, value, stress, real>(
+        C_i, stress{10e9}, real(0.3));
+    const auto KGi = tfel::material::computeKGModuli<stress>(C_i);
+    Ellipsoid<length> ellipsoid(length(10), length(2), length(1));
+    OrientedDistribution<stress> distrib1(ellipsoid, real(0.1), C_i, n_b, n_a);
+    Sphere<length> sphere;
+    SphereDistribution<stress> distrib2(sphere, real(0.1), KGi);
+    // the matrix is given by its stiffness tensor and is thus treated as
+    // anisotropic
+    ParticulateMicrostructure<3u, stress> micro(C_0);
+    micro.addInclusionPhase(distrib1);
+    micro.addInclusionPhase(distrib2);
+    AnisotropicHillTensorCache<3u, stress> cache;
+    const auto Chom_DS_1 = computeDilute<3u, stress>(micro).homogenized_stiffness;
+    const auto Chom_DS_2 =
+        computeDilute<3u, stress>(micro, cache).homogenized_stiffness;
+    TFEL_TESTS_ASSERT(cache.size() == 2);
+    TFEL_TESTS_ASSERT(cache.getNumberOfHits() == 0);
+    TFEL_TESTS_ASSERT(tfel::material::relative_error(Chom_DS_1, Chom_DS_2) <
+                      1e-5);
+    const auto Chom_MT_1 =
+        computeMoriTanaka<3u, stress>(micro).homogenized_stiffness;
+    const auto Chom_MT_2 =
+        computeMoriTanaka<3u, stress>(micro, cache).homogenized_stiffness;
+    TFEL_TESTS_ASSERT(cache.size() == 2);
+    TFEL_TESTS_ASSERT(cache.getNumberOfHits() == 2);
+    TFEL_TESTS_ASSERT(tfel::material::relative_error(Chom_MT_1, Chom_MT_2) <
+                      1e-5);
+  }
+
   template <typename real, typename stress, typename length>
   void user_defined_distribution() {
     static constexpr auto eps = std::numeric_limits<real>::epsilon();
@@ -0,0 +1,147 @@
+/*!
+ * \file   tests/Math/BorderedBandedLUSolveTest.cxx
+ * \brief  This test checks that the `BorderedBandedLUSolve` class gives the
+ * same results than the `LUSolve` class.
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright Copyright (C) 2006-2025 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+#include "TFEL/Math/vector.hxx"
+#include "TFEL/Math/matrix.hxx"
+#include "TFEL/Math/LUSolve.hxx"
+#include "TFEL/Math/BorderedBandedLUSolve.hxx"
+
+struct BorderedBandedLUSolveTest final : public tfel::tests::TestCase {
+  BorderedBandedLUSolveTest()
+      : tfel::tests::TestCase("TFEL/Math", "BorderedBandedLUSolveTest") {
+  }  // end of BorderedBandedLUSolveTest
+  tfel::tests::TestResult execute() override {
+    this->test1();
+    for (const auto b : {0u, 1u, 2u}) {
+      this->test2(1, 1, b);
+      this->test2(2, 2, b);
+      this->test2(3, 3, b);
+      this->test2(2, 1, b);
+      this->test2(1, 3, b);
+    }
+    this->test3();
+    return this->result;
+  }  // end of execute
+
+ private:
+  using size_type = tfel::math::matrix<double>::size_type;
+  //! \brief check the storage
+  void test1() {
+    auto m = tfel::math::BorderedBandedMatrix<double>(5, 1, 2, 1);
+    TFEL_TESTS_ASSERT(m.getNbRows() == 6);
+    TFEL_TESTS_ASSERT(m.getNbCols() == 6);
+    TFEL_TESTS_ASSERT(m.isStored(0, 0));
+    TFEL_TESTS_ASSERT(m.isStored(0, 2));
+    TFEL_TESTS_ASSERT(!m.isStored(0, 3));
+    TFEL_TESTS_ASSERT(m.isStored(1, 0));
+    TFEL_TESTS_ASSERT(!m.isStored(2, 0));
+    TFEL_TESTS_ASSERT(m.isStored(0, 5));
+    TFEL_TESTS_ASSERT(m.isStored(5, 0));
+    TFEL_TESTS_ASSERT(m.isStored(5, 5));
+    TFEL_TESTS_ASSERT(!m.isStored(6, 5));
+    for (size_type i = 0; i != m.getNbRows(); ++i) {
+      for (size_type j = 0; j != m.getNbCols(); ++j) {
+        if (m.isStored(i, j)) {
+          m(i, j) = static_cast<double>(10 * i + j);
+        }
+      }
+    }
+    for (size_type i = 0; i != m.getNbRows(); ++i) {
+      for (size_type j = 0; j != m.getNbCols(); ++j) {
+        if (m.isStored(i, j)) {
+          TFEL_TESTS_ASSERT(std::abs(m(i, j) - (10 * i + j)) < eps);
+        }
+      }
+    }
+  }
+  /*!
+   * \brief compare the solution of a linear system computed with the
+   * bordered banded solver to the solution computed by the dense solver.
+   * \param[in] kl: number of sub-diagonals
+   * \param[in] ku: number of super-diagonals
+   * \param[in] nb: size of the border
+   */
+  void test2(const size_type kl, const size_type ku, const size_type nb) {
+    constexpr size_type n = 12;
+    // a matrix whose diagonal is small, so that pivoting is required
+    auto value = [](const size_type i, const size_type j) {
+      const auto x = static_cast<double>(3 * i + 7 * j + 1);
+      return (i == j) ? 0.01 * std::cos(x) : std::sin(x);
+    };
+    auto m = tfel::math::BorderedBandedMatrix<double>(n, kl, ku, nb);
+    auto k = tfel::math::matrix<double>(n + nb, n + nb, 0.);
+    for (size_type i = 0; i != n + nb; ++i) {
+      for (size_type j = 0; j != n + nb; ++j) {
+        if (m.isStored(i, j)) {
+          k(i, j) = value(i, j);
+          if ((i >= n) && (i == j)) {
+            k(i, j) += 10;
+          }
+        }
+      }
+    }
+    m.import(k);
+    auto b = tfel::math::vector<double>(n + nb);
+    for (size_type i = 0; i != n + nb; ++i) {
+      b[i] = std::cos(static_cast<double>(i));
+    }
+    auto x = b;
+    tfel::math::BorderedBandedLUSolve::exe(m, x);
+    auto x_ref = b;
+    tfel::math::LUSolve::exe(k, x_ref);
+    for (size_type i = 0; i != n + nb; ++i) {
+      TFEL_TESTS_ASSERT(std::abs(x[i] - x_ref[i]) < 1e-10);
+    }
+    // reuse of the decomposition
+    auto x2 = b;
+    x2 *= 2;
+    tfel::math::BorderedBandedLUSolve::back_substitute(m, x2);
+    for (size_type i = 0; i != n + nb; ++i) {
+      TFEL_TESTS_ASSERT(std::abs(x2[i] - 2 * x_ref[i]) < 1e-10);
+    }
+  }
+  //! \brief check that a singular banded part is detected
+  void test3() {
+    auto m = tfel::math::BorderedBandedMatrix<double>(3, 1, 1, 1);
+    m(0, 0) = 1;
+    m(1, 1) = 1;
+    m(3, 3) = 1;
+    auto b = tfel::math::vector<double>(4, 1.);
+    TFEL_TESTS_CHECK_THROW(tfel::math::BorderedBandedLUSolve::exe(m, b),
+                           tfel::math::LUException);
+  }
+  //! \brief comparison criterion
+  static constexpr double eps = 1e-14;
+};
+
+TFEL_TESTS_GENERATE_PROXY(BorderedBandedLUSolveTest,
+                          "BorderedBandedLUSolveTest");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("BorderedBandedLUSolveTest.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,165 @@
+/*!
+ * \file   tests/Math/DualTest.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright Copyright (C) 2006-2025 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif /* NDEBUG */
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+
+#include "TFEL/Math/General/Dual.hxx"
+#include "TFEL/Math/tvector.hxx"
+#include "TFEL/Math/tmatrix.hxx"
+#include "TFEL/Math/stensor.hxx"
+#include "TFEL/Math/st2tost2.hxx"
+
+struct DualTest final : public tfel::tests::TestCase {
+  DualTest() : tfel::tests::TestCase("TFEL/Math", "DualTest") {
+  }  // end of DualTest
+  tfel::tests::TestResult execute() override {
+    this->test1();
+    this->test2();
+    this->test3();
+    this->test4();
+    return this->result;
+  }  // end of execute
+
+ private:
+  //! \brief basic operations
+  void test1() {
+    using namespace tfel::math;
+    using Dual2 = Dual<double, 2>;
+    static_assert(isScalar<Dual2>());
+    static_assert(std::is_same_v<result_type<Dual2, double, OpMult>, Dual2>);
+    static_assert(std::is_same_v<result_type<int, Dual2, OpDiv>, Dual2>);
+    constexpr auto eps = 1e-14;
+    const auto x = Dual2{2., 0};
+    const auto y = Dual2{3., 1};
+    // f(x, y) = x * y + x / y - 2 * x + 1
+    const auto f = x * y + x / y - 2 * x + 1;
+    TFEL_TESTS_ASSERT(std::abs(f.getValue() - (6 + 2. / 3 - 4 + 1)) < eps);
+    TFEL_TESTS_ASSERT(std::abs(f.getDerivative(0) - (3 + 1. / 3 - 2)) < eps);
+    TFEL_TESTS_ASSERT(std::abs(f.getDerivative(1) - (2 - 2. / 9)) < eps);
+    // g(x, y) = 1 / x - y
+    const auto g = 1 / x - y;
+    TFEL_TESTS_ASSERT(std::abs(g.getValue() + 2.5) < eps);
+    TFEL_TESTS_ASSERT(std::abs(g.getDerivative(0) + 0.25) < eps);
+    TFEL_TESTS_ASSERT(std::abs(g.getDerivative(1) + 1) < eps);
+    // comparisons only consider values
+    TFEL_TESTS_ASSERT(x < y);
+    TFEL_TESTS_ASSERT(x > 1);
+    TFEL_TESTS_ASSERT(0.5 < x);
+    TFEL_TESTS_ASSERT(x == 2);
+    TFEL_TESTS_ASSERT(std::abs(tfel::math::abs(-x).getDerivative(0) - 1) <
+                      eps);
+  }
+  //! \brief standard functions
+  void test2() {
+    using namespace tfel::math;
+    using Dual1 = Dual<double, 1>;
+    constexpr auto eps = 1e-12;
+    const auto x = Dual1{0.3, 0};
+    auto check = [this](const Dual1& v, const double f, const double df) {
+      TFEL_TESTS_ASSERT(std::abs(v.getValue() - f) < eps);
+      TFEL_TESTS_ASSERT(std::abs(v.getDerivative(0) - df) < eps);
+    };
+    using std::sqrt;
+    check(sqrt(x), std::sqrt(0.3), 0.5 / std::sqrt(0.3));
+    check(cbrt(x), std::cbrt(0.3), 1 / (3 * std::cbrt(0.3) * std::cbrt(0.3)));
+    check(exp(x), std::exp(0.3), std::exp(0.3));
+    check(log(x), std::log(0.3), 1 / 0.3);
+    check(sin(x), std::sin(0.3), std::cos(0.3));
+    check(cos(x), std::cos(0.3), -std::sin(0.3));
+    check(tan(x), std::tan(0.3), 1 + std::tan(0.3) * std::tan(0.3));
+    check(tanh(x), std::tanh(0.3), 1 - std::tanh(0.3) * std::tanh(0.3));
+    check(pow(x, 2.5), std::pow(0.3, 2.5), 2.5 * std::pow(0.3, 1.5));
+    check(pow(2., x), std::pow(2., 0.3), std::pow(2., 0.3) * std::log(2.));
+    check(pow(x, x), std::pow(0.3, 0.3),
+          std::pow(0.3, 0.3) * (std::log(0.3) + 1));
+    check(power<3>(x), 0.027, 0.27);
+    check(power<3, 2>(x), std::pow(0.3, 1.5), 1.5 * std::sqrt(0.3));
+    check(power<1, 2>(x), std::sqrt(0.3), 0.5 / std::sqrt(0.3));
+    // the derivatives of the square root at zero are taken null
+    check(sqrt(Dual1{0., 0}), 0, 0);
+    check(power<1, 2>(Dual1{0., 0}), 0, 0);
+    TFEL_TESTS_ASSERT(ieee754::isfinite(x));
+    TFEL_TESTS_ASSERT(!ieee754::isfinite(1 / Dual1{0., 0}));
+  }
+  //! \brief derivatives of the von Mises stress
+  void test3() {
+    using namespace tfel::math;
+    using Dual4 = Dual<double, 4>;
+    constexpr auto eps = 1e-12;
+    const auto s = stensor<2u, double>{150, -20, 30, 40};
+    auto sd = stensor<2u, Dual4>{};
+    for (unsigned short i = 0; i != 4; ++i) {
+      sd[i] = Dual4{s[i], i};
+    }
+    const auto seq = sigmaeq(sd);
+    const auto n = eval(3 * deviator(s) / (2 * sigmaeq(s)));
+    TFEL_TESTS_ASSERT(std::abs(seq.getValue() - sigmaeq(s)) < eps);
+    for (unsigned short i = 0; i != 4; ++i) {
+      TFEL_TESTS_ASSERT(std::abs(seq.getDerivative(i) - n[i]) < eps);
+    }
+    // derivative of the normal
+    const auto nd = eval(3 * deviator(sd) / (2 * seq));
+    const auto dn = eval((3 * st2tost2<2u, double>::K() / 2 - (n ^ n)) /
+                         sigmaeq(s));
+    for (unsigned short i = 0; i != 4; ++i) {
+      TFEL_TESTS_ASSERT(std::abs(nd[i].getValue() - n[i]) < eps);
+      for (unsigned short j = 0; j != 4; ++j) {
+        TFEL_TESTS_ASSERT(std::abs(nd[i].getDerivative(j) - dn(i, j)) < eps);
+      }
+    }
+  }
+  //! \brief matrix-vector product and linear solve
+  void test4() {
+    using namespace tfel::math;
+    using Dual2 = Dual<double, 2>;
+    constexpr auto eps = 1e-12;
+    auto m = tmatrix<2u, 2u, Dual2>{};
+    m(0, 0) = Dual2{4., 0};
+    m(0, 1) = 1;
+    m(1, 0) = 2;
+    m(1, 1) = Dual2{3., 1};
+    const auto v = tvector<2u, Dual2>{Dual2{1}, Dual2{2}};
+    const auto r = eval(m * v);
+    TFEL_TESTS_ASSERT(std::abs(r(0).getValue() - 6) < eps);
+    TFEL_TESTS_ASSERT(std::abs(r(0).getDerivative(0) - 1) < eps);
+    TFEL_TESTS_ASSERT(std::abs(r(1).getValue() - 8) < eps);
+    TFEL_TESTS_ASSERT(std::abs(r(1).getDerivative(1) - 2) < eps);
+    // solving m x = r gives back v, whose derivatives are null
+    auto x = r;
+    TinyMatrixSolve<2u, Dual2>::exe(m, x);
+    for (unsigned short i = 0; i != 2; ++i) {
+      TFEL_TESTS_ASSERT(std::abs(x(i).getValue() - v(i).getValue()) < eps);
+      TFEL_TESTS_ASSERT(std::abs(x(i).getDerivative(0)) < eps);
+      TFEL_TESTS_ASSERT(std::abs(x(i).getDerivative(1)) < eps);
+    }
+  }
+};
+
+TFEL_TESTS_GENERATE_PROXY(DualTest, "DualTest");
+
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("Dual.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}  // end of main
@@ -0,0 +1,170 @@
+/*!
+ * \file   tests/Math/KrigingTest.cxx
+ * \brief  This test checks the evaluation of kriging interpolations on many
+ * points, the `LocalKriging` class and the vectorised evaluation of kriged
+ * functions by the `Evaluator` class.
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright Copyright (C) 2006-2025 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+
+#include <cmath>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+#include "TFEL/Math/Kriging.hxx"
+#include "TFEL/Math/LocalKriging.hxx"
+#include "TFEL/Math/Evaluator.hxx"
+#include "TFEL/Math/Parser/KrigedFunction.hxx"
+
+struct KrigingTest final : public tfel::tests::TestCase {
+  KrigingTest() : tfel::tests::TestCase("TFEL/Math", "KrigingTest") {
+  }  // end of KrigingTest
+  tfel::tests::TestResult execute() override {
+    this->test1();
+    this->test2();
+    this->test3();
+    this->test4();
+    return this->result;
+  }  // end of execute
+
+ private:
+  using Point = tfel::math::tvector<2u, double>;
+  //! \brief interpolated function
+  static double f(const Point& p) {
+    return std::cos(p(0) + p(1)) * std::exp(p(0) / 2);
+  }
+  //! \return the samples, located on a regular grid of [0,2]x[0,2]
+  static std::vector<Point> getSamples(const unsigned short n) {
+    auto samples = std::vector<Point>{};
+    for (unsigned short i = 0; i != n; ++i) {
+      for (unsigned short j = 0; j != n; ++j) {
+        samples.push_back(Point{2. * i / (n - 1), 2. * j / (n - 1)});
+      }
+    }
+    return samples;
+  }
+  //! \return some points inside [0,2]x[0,2]
+  static std::vector<Point> getPoints() {
+    auto points = std::vector<Point>{};
+    for (unsigned short i = 0; i != 150; ++i) {
+      points.push_back(Point{1 + 0.9 * std::sin(1. + 3. * i),
+                             1 + 0.9 * std::cos(2. + 7. * i)});
+    }
+    return points;
+  }
+  //! \brief evaluation of a one-dimensional interpolation on many points
+  void test1() {
+    auto k = tfel::math::Kriging<1u>{};
+    for (unsigned short i = 0; i != 20; ++i) {
+      const auto x = 0.1 * i;
+      k.addValue(x, std::sin(x));
+    }
+    k.buildInterpolation();
+    for (unsigned short i = 0; i != 20; ++i) {
+      const auto x = 0.1 * i;
+      TFEL_TESTS_ASSERT(std::abs(k(x) - std::sin(x)) < 1e-10);
+    }
+    auto x = std::vector<double>(137);
+    for (std::size_t i = 0; i != x.size(); ++i) {
+      x[i] = -0.2 + 2.3 * static_cast<double>(i) / 136;
+    }
+    auto r = std::vector<double>(x.size());
+    k.getValues(r, x);
+    for (std::size_t i = 0; i != x.size(); ++i) {
+      TFEL_TESTS_ASSERT(std::abs(r[i] - k(x[i])) < 1e-12);
+    }
+    auto r2 = std::vector<double>(3);
+    TFEL_TESTS_CHECK_THROW(k.getValues(r2, x),
+                           tfel::math::KrigingErrorInvalidLength);
+  }
+  //! \brief evaluation of a two-dimensional interpolation on many points
+  void test2() {
+    auto k = tfel::math::Kriging<2u>{};
+    for (const auto& p : getSamples(8)) {
+      k.addValue(p, f(p));
+    }
+    k.buildInterpolation();
+    for (const auto& p : getSamples(8)) {
+      TFEL_TESTS_ASSERT(std::abs(k(p) - f(p)) < 1e-10);
+    }
+    const auto points = getPoints();
+    auto r = std::vector<double>(points.size());
+    k.getValues(r, points);
+    for (std::size_t i = 0; i != points.size(); ++i) {
+      TFEL_TESTS_ASSERT(std::abs(r[i] - k(points[i])) < 1e-12);
+      TFEL_TESTS_ASSERT(std::abs(r[i] - f(points[i])) < 5e-2);
+    }
+  }
+  //! \brief local interpolation
+  void test3() {
+    auto k = tfel::math::LocalKriging<2u>{};
+    const auto samples = getSamples(30);
+    for (const auto& p : samples) {
+      k.addValue(p, f(p));
+    }
+    k.setNumberOfNeighbours(40);
+    k.buildInterpolation();
+    TFEL_TESTS_ASSERT(k.getNumberOfCells() > 1);
+    for (const auto& p : samples) {
+      TFEL_TESTS_ASSERT(std::abs(k(p) - f(p)) < 1e-10);
+    }
+    const auto points = getPoints();
+    auto r = std::vector<double>(points.size());
+    k.getValues(r, points);
+    for (std::size_t i = 0; i != points.size(); ++i) {
+      TFEL_TESTS_ASSERT(std::abs(r[i] - k(points[i])) < 1e-12);
+      TFEL_TESTS_ASSERT(std::abs(r[i] - f(points[i])) < 1e-3);
+    }
+  }
+  //! \brief vectorised evaluation of a kriged function by an evaluator
+  void test4() {
+    using namespace tfel::math::parser;
+    auto data = std::vector<KrigedFunction<2u>::Point>{};
+    for (const auto& p : getSamples(8)) {
+      data.push_back({p, f(p)});
+    }
+    auto manager = std::make_shared<ExternalFunctionManager>();
+    manager->operator[]("k") = std::make_shared<KrigedFunction<2u>>(data);
+    auto e = tfel::math::Evaluator(std::vector<std::string>{"x", "y"},
+                                   "2*k(x,y)+k(y,x)", manager);
+    const auto points = getPoints();
+    auto x = std::vector<double>{};
+    auto y = std::vector<double>{};
+    for (const auto& p : points) {
+      x.push_back(p(0));
+      y.push_back(p(1));
+    }
+    auto r = std::vector<double>(points.size());
+    e.getValues(r, std::vector<std::span<const double>>{x, y});
+    for (std::size_t i = 0; i != points.size(); ++i) {
+      e.setVariableValue("x", x[i]);
+      e.setVariableValue("y", y[i]);
+      const auto v = e.getValueFromExpressionTree();
+      TFEL_TESTS_ASSERT(std::abs(e.getValue() - v) < 1e-12);
+      TFEL_TESTS_ASSERT(std::abs(r[i] - v) < 1e-12);
+    }
+  }
+};
+
+TFEL_TESTS_GENERATE_PROXY(KrigingTest, "KrigingTest");
+
+/* coverity[UNCAUGHT_EXCEPT] */
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("KrigingTest.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}  // end of main
@@ -0,0 +1,125 @@
+/*!
+ * \file   tests/Math/LDLTSolveTest.cxx
+ * \brief  This test checks that the `LDLTSolve` class gives the same results
+ * than the `LUSolve` class on symmetric indefinite matrices.
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright Copyright (C) 2006-2025 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+#include "TFEL/Math/vector.hxx"
+#include "TFEL/Math/matrix.hxx"
+#include "TFEL/Math/LUSolve.hxx"
+#include "TFEL/Math/LDLTSolve.hxx"
+
+struct LDLTSolveTest final : public tfel::tests::TestCase {
+  LDLTSolveTest()
+      : tfel::tests::TestCase("TFEL/Math", "LDLTSolveTest") {
+  }  // end of LDLTSolveTest
+  tfel::tests::TestResult execute() override {
+    this->test1();
+    for (const auto n : {2u, 5u, 12u}) {
+      for (const auto nb : {0u, 1u, 3u}) {
+        if (n > nb) {
+          this->test2(n, nb);
+        }
+      }
+    }
+    this->test3();
+    return this->result;
+  }  // end of execute
+
+ private:
+  using size_type = tfel::math::matrix<double>::size_type;
+  //! \brief a matrix with a null diagonal requires a 2x2 pivot
+  void test1() {
+    auto m = tfel::math::matrix<double>(2, 2, 0.);
+    m(0, 1) = m(1, 0) = 1;
+    auto b = tfel::math::vector<double>{1, 2};
+    tfel::math::LDLTSolve::exe(m, b);
+    TFEL_TESTS_ASSERT(std::abs(b(0) - 2) < eps);
+    TFEL_TESTS_ASSERT(std::abs(b(1) - 1) < eps);
+  }
+  /*!
+   * \brief compare the solution of a linear system computed with the
+   * `LDLTSolve` class to the solution computed by the `LUSolve` class. The
+   * matrix has the structure of the matrices built by the `Kriging` class:
+   * a symmetric block of size `n` with a null diagonal bordered by `nb`
+   * rows and columns.
+   * \param[in] n: size of the symmetric block
+   * \param[in] nb: size of the border
+   */
+  void test2(const size_type n, const size_type nb) {
+    const auto nt = n + nb;
+    auto m = tfel::math::matrix<double>(nt, nt, 0.);
+    auto b = tfel::math::vector<double>(nt);
+    for (size_type i = 0; i != n; ++i) {
+      for (size_type j = 0; j != i; ++j) {
+        const auto d = static_cast<double>(i) - static_cast<double>(j);
+        m(i, j) = m(j, i) = std::abs(d) * (1 + 0.1 * std::sin(d));
+      }
+    }
+    for (size_type i = 0; i != nb; ++i) {
+      for (size_type j = 0; j != n; ++j) {
+        m(n + i, j) = m(j, n + i) = std::pow(static_cast<double>(j), i);
+      }
+    }
+    for (size_type i = 0; i != nt; ++i) {
+      b(i) = std::cos(1. + 3. * static_cast<double>(i));
+    }
+    auto m1 = m;
+    auto x1 = b;
+    tfel::math::LUSolve::exe(m1, x1);
+    auto m2 = m;
+    auto x2 = b;
+    tfel::math::LDLTSolve::exe(m2, x2);
+    for (size_type i = 0; i != nt; ++i) {
+      TFEL_TESTS_ASSERT(std::abs(x1(i) - x2(i)) < 1e-8 * (1 + std::abs(x1(i))));
+    }
+    // residual
+    for (size_type i = 0; i != nt; ++i) {
+      auto r = -b(i);
+      for (size_type j = 0; j != nt; ++j) {
+        r += m(i, j) * x2(j);
+      }
+      TFEL_TESTS_ASSERT(std::abs(r) < 1e-10);
+    }
+  }
+  //! \brief invalid matrices
+  void test3() {
+    auto m = tfel::math::matrix<double>(3, 3, 0.);
+    auto b = tfel::math::vector<double>(3, 1.);
+    TFEL_TESTS_CHECK_THROW(tfel::math::LDLTSolve::exe(m, b),
+                           tfel::math::LUNullPivot);
+    auto m2 = tfel::math::matrix<double>(3, 2, 1.);
+    TFEL_TESTS_CHECK_THROW(tfel::math::LDLTSolve::exe(m2, b),
+                           tfel::math::LUMatrixNotSquare);
+  }
+  //! \brief a small numerical value
+  static constexpr double eps = 1e-14;
+};
+
+TFEL_TESTS_GENERATE_PROXY(LDLTSolveTest, "LDLTSolveTest");
+
+/* coverity[UNCAUGHT_EXCEPT] */
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("LDLTSolveTest.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}  // end of main
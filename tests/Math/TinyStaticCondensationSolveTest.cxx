@@ -0,0 +1,102 @@
+/*!
+ * \file   tests/Math/TinyStaticCondensationSolveTest.cxx
+ * \brief  This test checks that the `TinyStaticCondensationSolve` class gives
+ * the same results than the `TinyMatrixSolve` class.
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright Copyright (C) 2006-2025 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+#include "TFEL/Math/tvector.hxx"
+#include "TFEL/Math/tmatrix.hxx"
+#include "TFEL/Math/TinyMatrixSolve.hxx"
+#include "TFEL/Math/TinyStaticCondensationSolve.hxx"
+
+struct TinyStaticCondensationSolveTest final : public tfel::tests::TestCase {
+  TinyStaticCondensationSolveTest()
+      : tfel::tests::TestCase("TFEL/Math", "TinyStaticCondensationSolveTest") {
+  }  // end of TinyStaticCondensationSolveTest
+  tfel::tests::TestResult execute() override {
+    this->test<6, 1, false>();
+    this->test<6, 1, true>();
+    this->test<18, 6, false>();
+    this->test<18, 6, true>();
+    this->test<4, 3, true>();
+    this->test2();
+    return this->result;
+  }  // end of execute
+
+ private:
+  /*!
+   * \brief compare the solution with the one given by a dense LU
+   * decomposition
+   */
+  template <unsigned short N, unsigned short M, bool diagonal_block>
+  void test() {
+    using namespace tfel::math;
+    constexpr auto eps = 1e-12;
+    auto m = tmatrix<N, N, double>{};
+    auto b = tvector<N, double>{};
+    // a diagonally dominant matrix with a pseudo-random pattern
+    for (unsigned short i = 0; i != N; ++i) {
+      b(i) = std::cos(1. + i);
+      for (unsigned short j = 0; j != N; ++j) {
+        const auto in_D = (i >= M) && (j >= M);
+        if ((diagonal_block) && (in_D) && (i != j)) {
+          m(i, j) = 0;
+        } else {
+          m(i, j) = std::sin(1. + i + 2 * N * j);
+        }
+      }
+      m(i, i) += 2 * N;
+    }
+    auto m2 = m;
+    auto x = b;
+    TinyMatrixSolve<N, double>::exe(m2, x);
+    auto x2 = b;
+    const auto s =
+        TinyStaticCondensationSolve<N, M, double, diagonal_block>::exe(m, x2);
+    TFEL_TESTS_ASSERT(s);
+    for (unsigned short i = 0; i != N; ++i) {
+      TFEL_TESTS_ASSERT(std::abs(x(i) - x2(i)) < eps);
+    }
+  }
+  //! \brief null pivot in the condensed block
+  void test2() {
+    using namespace tfel::math;
+    auto m = tmatrix<3, 3, double>{1, 0, 1,  //
+                                   0, 1, 1,  //
+                                   1, 1, 0};
+    auto b = tvector<3, double>{1, 1, 1};
+    TFEL_TESTS_ASSERT(
+        (!TinyStaticCondensationSolve<3, 2, double, true, false>::exe(m, b)));
+    TFEL_TESTS_CHECK_THROW(
+        (TinyStaticCondensationSolve<3, 2, double, true>::exe(m, b)),
+        LUException);
+  }
+};
+
+TFEL_TESTS_GENERATE_PROXY(TinyStaticCondensationSolveTest,
+                          "TinyStaticCondensationSolveTest");
+
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("TinyStaticCondensationSolve.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}  // end of main
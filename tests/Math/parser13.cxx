@@ -0,0 +1,252 @@
+/*!
+ * \file   tests/Math/parser13.cxx
+ * \brief  This file tests the evaluation of formulae using the bytecode
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright Copyright (C) 2006-2025 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif /* NDEBUG */
+
+#include <cmath>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+
+#include "TFEL/Math/Evaluator.hxx"
+
+struct ParserTest13 final : public tfel::tests::TestCase {
+  ParserTest13()
+      : tfel::tests::TestCase("TFEL/Math", "ParserTest13") {
+  }  // end of ParserTest13
+  tfel::tests::TestResult execute() override {
+    this->test1();
+    this->test2();
+    this->test3();
+    this->test4();
+    this->test5();
+    return this->result;
+  }  // end of execute
+ private:
+  //! \brief values of the variables used for the tests
+  static std::vector<double> getValues(const std::size_t i) {
+    return {-2.3 + 0.37 * static_cast<double>(i),
+            1.7 - 0.21 * static_cast<double>(i),
+            0.3 + 0.05 * static_cast<double>(i)};
+  }  // end of getValues
+  //! \return a formula requiring more than 128 registers
+  static std::string getLongFormula() {
+    auto f = std::string{"x"};
+    for (int i = 1; i != 100; ++i) {
+      f += "+" + std::to_string(i) + "*sin(x+" + std::to_string(i) + "*y)";
+    }
+    return f;
+  }  // end of getLongFormula
+  //! \brief comparison of the bytecode and the expression tree
+  void test1() {
+    constexpr auto eps = double{1e-14};
+    const auto formulae = std::vector<std::string>{
+        "x+y*z",
+        "2*x-3*y+4",
+        "(x+y)*(x+y)-(y+x)*(x+y)",
+        "exp(x)*cos(y)+exp(x)*sin(z)",
+        "x**2+x**3+x**-2",
+        "power<3>(y)-power<-2>(z)",
+        "abs(x)**z+2**y",
+        "-x+(-y)*z",
+        "abs(x)*sqrt(abs(y))",
+        "atan2(x,y)+min(x,z)+max(y,z)",
+        "(2+3)*x+log(10)",
+        "x<0 ? exp(x) : cos(x)",
+        "(x>0) && (y>0) ? x*y : x+y",
+        "(x>0) || !(y<1) ? 1 : 2",
+        "(x>=y) ? (y<=z ? x : y) : z",
+        "(2>1) ? x : log(-1)",
+        "(x>0) ? x*y+z : x*y-z",
+        "x==x ? y : z",
+        "tanh(x)+sinh(y)+cosh(z)+atan(x)+H(x)+erf(y)",
+        "12", getLongFormula()};
+    for (const auto& f : formulae) {
+      auto e = tfel::math::Evaluator(std::vector<std::string>{"x", "y", "z"},
+                                     f);
+      for (std::size_t i = 0; i != 20; ++i) {
+        const auto v = getValues(i);
+        e.setVariableValue("x", v[0]);
+        e.setVariableValue("y", v[1]);
+        e.setVariableValue("z", v[2]);
+        const auto v1 = e.getValue();
+        const auto v2 = e.getValueFromExpressionTree();
+        TFEL_TESTS_ASSERT(std::abs(v1 - v2) <= eps * (1 + std::abs(v2)));
+      }
+    }
+  }  // end of test1
+  //! \brief evaluation on many points
+  void test2() {
+    constexpr auto eps = double{1e-14};
+    constexpr auto n = std::size_t{203};
+    const auto formulae = std::vector<std::string>{
+        "x+y*z", "exp(x)*cos(y)+exp(x)*sin(z)", "x**2+power<-2>(y)/z",
+        "x<0 ? exp(x) : cos(x)", "12"};
+    auto x = std::vector<double>(n);
+    auto y = std::vector<double>(n);
+    auto z = std::vector<double>(n);
+    for (std::size_t i = 0; i != n; ++i) {
+      const auto v = getValues(i);
+      x[i] = v[0];
+      y[i] = v[1];
+      z[i] = v[2];
+    }
+    for (const auto& f : formulae) {
+      auto e = tfel::math::Evaluator(std::vector<std::string>{"x", "y", "z"},
+                                     f);
+      auto r = std::vector<double>(n);
+      e.getValues(r, {x, y, z});
+      for (std::size_t i = 0; i != n; ++i) {
+        e.setVariableValue("x", x[i]);
+        e.setVariableValue("y", y[i]);
+        e.setVariableValue("z", z[i]);
+        const auto v = e.getValueFromExpressionTree();
+        TFEL_TESTS_ASSERT(std::abs(r[i] - v) <= eps * (1 + std::abs(v)));
+      }
+      auto r2 = std::vector<double>(n);
+      e.getValues(r2, {{"z", z}, {"y", y}, {"x", x}});
+      for (std::size_t i = 0; i != n; ++i) {
+        TFEL_TESTS_ASSERT(std::abs(r[i] - r2[i]) <=
+                          eps * (1 + std::abs(r[i])));
+      }
+    }
+    // invalid calls
+    auto e = tfel::math::Evaluator(std::vector<std::string>{"x", "y"}, "x+y");
+    auto r = std::vector<double>(n);
+    TFEL_TESTS_CHECK_THROW(e.getValues(r, {x}), std::runtime_error);
+    const auto y2 = std::span<const double>(y).first(2);
+    TFEL_TESTS_CHECK_THROW(e.getValues(r, {x, y2}), std::runtime_error);
+  }  // end of test2
+  //! \brief errors must be reported as by the expression tree
+  void test3() {
+    auto check = [this](const std::string& f, const double v) {
+      auto e = tfel::math::Evaluator(std::vector<std::string>{"x"}, f);
+      e.setVariableValue("x", v);
+      TFEL_TESTS_CHECK_THROW(e.getValueFromExpressionTree(),
+                             std::runtime_error);
+      TFEL_TESTS_CHECK_THROW(e.getValue(), std::runtime_error);
+      const auto x = std::vector<double>(10, v);
+      auto r = std::vector<double>(10);
+      TFEL_TESTS_CHECK_THROW(e.getValues(r, {x}), std::runtime_error);
+    };
+    check("1/x", 0);
+    check("2/(x-x)", 1);
+    check("log(x)", -1);
+    check("x**-2", 0);
+    check("power<-3>(x)", 0);
+    check("x<0 ? log(x) : x", -1);
+    check("x>0 ? x : 1/(x-x)", -1);
+  }  // end of test3
+  //! \brief copy, derivative and external functions
+  void test4() {
+    constexpr auto eps = double{1e-14};
+    auto e = tfel::math::Evaluator(std::vector<std::string>{"x", "y"},
+                                   "x*exp(x*y)+y");
+    const auto de =
+        std::dynamic_pointer_cast<tfel::math::Evaluator>(e.differentiate("x"));
+    e.setVariableValue("x", 0.3);
+    e.setVariableValue("y", 0.7);
+    de->setVariableValue("x", 0.3);
+    de->setVariableValue("y", 0.7);
+    TFEL_TESTS_ASSERT(std::abs(e.getValue() - (0.3 * std::exp(0.21) + 0.7)) <
+                      eps);
+    // the copy must not share its variables with the original evaluator
+    auto e2 = e;
+    e2.setVariableValue("y", 0);
+    TFEL_TESTS_ASSERT(std::abs(e2.getValue() - 0.3) < eps);
+    TFEL_TESTS_ASSERT(std::abs(e.getValue() - (0.3 * std::exp(0.21) + 0.7)) <
+                      eps);
+    TFEL_TESTS_ASSERT(std::abs(de->getValue() - (1 + 0.21) * std::exp(0.21)) <
+                      eps);
+    TFEL_TESTS_ASSERT(std::abs(de->getValue() -
+                               de->getValueFromExpressionTree()) < eps);
+    // external functions are evaluated by the expression tree
+    auto manager =
+        std::make_shared<tfel::math::parser::ExternalFunctionManager>();
+    manager->operator[]("a") =
+        std::make_shared<tfel::math::Evaluator>("12", manager);
+    auto f = tfel::math::Evaluator(std::vector<std::string>{"x"}, "a*x+2*a",
+                                   manager);
+    f.setVariableValue("x", 2);
+    TFEL_TESTS_ASSERT(std::abs(f.getValue() - 48) < eps);
+    manager->operator[]("a") =
+        std::make_shared<tfel::math::Evaluator>("24", manager);
+    TFEL_TESTS_ASSERT(std::abs(f.getValue() - 96) < eps);
+    const auto x = std::vector<double>{1, 2, 3};
+    auto r = std::vector<double>(3);
+    f.getValues(r, {x});
+    for (std::size_t i = 0; i != 3; ++i) {
+      TFEL_TESTS_ASSERT(std::abs(r[i] - 24 * (x[i] + 2)) < eps);
+    }
+  }  // end of test4
+  //! \brief constant folding and common sub-expression elimination
+  void test5() {
+    using tfel::math::parser::Bytecode;
+    using tfel::math::parser::BytecodeCompiler;
+    constexpr auto eps = double{1e-14};
+    const auto v = std::vector<double>{2, 3};
+    auto c = BytecodeCompiler{2};
+    const auto x = c.getVariableRegister(0);
+    const auto y = c.getVariableRegister(1);
+    // x*y and y*x are the same expression
+    const auto xy = c.addOperation(Bytecode::MULTIPLICATION, x, y);
+    const auto yx = c.addOperation(Bytecode::MULTIPLICATION, y, x);
+    TFEL_TESTS_ASSERT(xy == yx);
+    const auto e1 = c.addUnaryFunction(std::exp, xy);
+    const auto e2 = c.addUnaryFunction(std::exp, yx);
+    TFEL_TESTS_ASSERT(e1 == e2);
+    // x-y and y-x are not
+    const auto d1 = c.addOperation(Bytecode::SUBTRACTION, x, y);
+    const auto d2 = c.addOperation(Bytecode::SUBTRACTION, y, x);
+    TFEL_TESTS_ASSERT(d1 != d2);
+    // 2*3 is evaluated at compile time
+    const auto six = c.addOperation(Bytecode::MULTIPLICATION,  //
+                                    c.addConstant(2), c.addConstant(3));
+    TFEL_TESTS_ASSERT(c.isConstant(six));
+    TFEL_TESTS_ASSERT(std::abs(c.getConstantValue(six) - 6) < eps);
+    const auto r = c.addOperation(
+        Bytecode::ADDITION, c.addOperation(Bytecode::ADDITION, e1, d1),
+        c.addOperation(Bytecode::MULTIPLICATION, six, d2));
+    const auto b = c.getBytecode(r);
+    // x*y, exp(x*y), x-y, y-x, exp(x*y)+x-y, 6*(y-x) and the sum
+    TFEL_TESTS_ASSERT(b.getNumberOfInstructions() == 7);
+    TFEL_TESTS_ASSERT(b.isVectorizable());
+    TFEL_TESTS_ASSERT(std::abs(b.execute(v.data()) - (std::exp(6) - 1 + 6)) <
+                      eps * std::exp(6));
+    // 1/0 is not evaluated at compile time, the error being reported at
+    // runtime
+    auto c2 = BytecodeCompiler{0};
+    const auto inf = c2.addOperation(Bytecode::DIVISION,  //
+                                     c2.addConstant(1), c2.addConstant(0));
+    TFEL_TESTS_ASSERT(!c2.isConstant(inf));
+    const auto b2 = c2.getBytecode(inf);
+    TFEL_TESTS_CHECK_THROW(b2.execute(nullptr), std::runtime_error);
+  }  // end of test5
+};
+
+TFEL_TESTS_GENERATE_PROXY(ParserTest13, "ParserTest13");
+
+/* coverity[UNCAUGHT_EXCEPT] */
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("Parser13.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}  // end of main
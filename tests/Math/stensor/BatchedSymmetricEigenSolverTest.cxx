@@ -0,0 +1,222 @@
+/*!
+ * \file   tests/Math/stensor/BatchedSymmetricEigenSolverTest.cxx
+ * \brief  This test compares the results of the `BatchedSymmetricEigenSolver`
+ * class to the ones of the scalar eigen solvers.
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright Copyright (C) 2006-2025 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif /* NDEBUG */
+
+#include <cmath>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+#include <algorithm>
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+
+#include "TFEL/Math/tvector.hxx"
+#include "TFEL/Math/tmatrix.hxx"
+#include "TFEL/Math/stensor.hxx"
+#include "TFEL/Math/Array/StridedCoalescedViewsArray.hxx"
+#include "TFEL/Math/Stensor/BatchedSymmetricEigenSolver.hxx"
+
+struct BatchedSymmetricEigenSolverTest final : public tfel::tests::TestCase {
+  BatchedSymmetricEigenSolverTest()
+      : tfel::tests::TestCase("TFEL/Math", "BatchedSymmetricEigenSolverTest") {
+  }  // end of BatchedSymmetricEigenSolverTest
+  tfel::tests::TestResult execute() override {
+    this->test<1u>();
+    this->test<2u>();
+    this->test<3u>();
+    this->test2();
+    return this->result;
+  }  // end of execute
+
+ private:
+  //! \return a set of tensors, including tensors with multiple eigenvalues
+  template <unsigned short N>
+  static std::vector<tfel::math::stensor<N, double>> getTensors() {
+    using namespace tfel::math;
+    constexpr auto cste = Cste<double>::sqrt2;
+    auto r = std::vector<stensor<N, double>>{};
+    // pseudo-random tensors
+    for (unsigned short i = 0; i != 37; ++i) {
+      auto s = stensor<N, double>{};
+      for (unsigned short k = 0; k != s.size(); ++k) {
+        s[k] = 100 * std::sin(1. + 7 * i + 3 * k);
+      }
+      r.push_back(s);
+    }
+    // spherical and null tensors
+    r.push_back(stensor<N, double>::Id());
+    r.push_back(stensor<N, double>(0.));
+    // rotated tensors with multiple eigenvalues
+    const auto a = 0.3;
+    const auto b = 1.2;
+    const auto R = tmatrix<3u, 3u, double>{
+        std::cos(a) * std::cos(b), -std::sin(a), std::cos(a) * std::sin(b),
+        std::sin(a) * std::cos(b), std::cos(a),  std::sin(a) * std::sin(b),
+        -std::sin(b),              0,            std::cos(b)};
+    for (const auto& l : {tvector<3u, double>{2, 1, 1},  //
+                          tvector<3u, double>{1, 1, 3},  //
+                          tvector<3u, double>{1, 1 + 1e-10, 3},
+                          tvector<3u, double>{-1e150, 2e150, 2e150},
+                          tvector<3u, double>{1e-150, 1e-150, -3e-150}}) {
+      auto s = stensor<N, double>{};
+      if constexpr (N == 1) {
+        s = stensor<N, double>{l(0), l(1), l(2)};
+      } else {
+        auto m = tmatrix<3u, 3u, double>{};
+        for (unsigned short i = 0; i != 3; ++i) {
+          for (unsigned short j = 0; j != 3; ++j) {
+            m(i, j) = 0;
+            for (unsigned short k = 0; k != 3; ++k) {
+              m(i, j) += R(i, k) * l(k) * R(j, k);
+            }
+          }
+        }
+        s[0] = m(0, 0);
+        s[1] = m(1, 1);
+        s[2] = m(2, 2);
+        s[3] = cste * m(0, 1);
+        if constexpr (N == 2) {
+          // in 2D, only rotations around the third axis are allowed
+          s[2] = l(2);
+        } else {
+          s[4] = cste * m(0, 2);
+          s[5] = cste * m(1, 2);
+        }
+      }
+      r.push_back(s);
+    }
+    return r;
+  }  // end of getTensors
+  //! \brief compare to the scalar solvers
+  template <unsigned short N>
+  void test() {
+    using namespace tfel::math;
+    using Solver = BatchedSymmetricEigenSolver<N, double>;
+    constexpr auto ssize = StensorDimeToSize<N>::value;
+    const auto tensors = getTensors<N>();
+    const auto n = tensors.size();
+    // structure of arrays
+    auto s = std::vector<double>(ssize * n);
+    for (std::size_t i = 0; i != n; ++i) {
+      for (unsigned short k = 0; k != ssize; ++k) {
+        s[i + k * n] = tensors[i][k];
+      }
+    }
+    auto vp = std::vector<double>(3 * n);
+    auto vp2 = std::vector<double>(3 * n);
+    auto m = std::vector<double>(9 * n);
+    Solver::computeEigenValues(vp.data(), n, s.data(), n, n);
+    Solver::computeEigenVectors(vp2.data(), n, m.data(), n, s.data(), n, n);
+    for (std::size_t i = 0; i != n; ++i) {
+      const auto& si = tensors[i];
+      const auto scale = std::max(std::sqrt(si | si), 1e-300);
+      const auto eps = 1e-13 * scale;
+      // eigenvalues
+      auto ref = si.template computeEigenValues<
+          stensor_common::FSESJACOBIEIGENSOLVER>();
+      auto l = tvector<3u, double>{vp[i], vp[i + n], vp[i + 2 * n]};
+      auto l2 = tvector<3u, double>{vp2[i], vp2[i + n], vp2[i + 2 * n]};
+      std::sort(ref.begin(), ref.end());
+      std::sort(l.begin(), l.end());
+      std::sort(l2.begin(), l2.end());
+      for (unsigned short k = 0; k != 3; ++k) {
+        TFEL_TESTS_ASSERT(std::abs(l(k) - ref(k)) < eps);
+        TFEL_TESTS_ASSERT(std::abs(l2(k) - ref(k)) < eps);
+      }
+      // eigenvectors
+      auto r = tmatrix<3u, 3u, double>{};
+      for (unsigned short k = 0; k != 9; ++k) {
+        r(k / 3, k % 3) = m[i + k * n];
+      }
+      const auto a = [&si] {
+        constexpr auto icste = Cste<double>::isqrt2;
+        auto v = stensor<3u, double>{};
+        for (unsigned short k = 0; k != ssize; ++k) {
+          v[k] = si[k];
+        }
+        return tmatrix<3u, 3u, double>{v[0], v[3] * icste, v[4] * icste,
+                                       v[3] * icste, v[1], v[5] * icste,
+                                       v[4] * icste, v[5] * icste, v[2]};
+      }();
+      for (unsigned short j = 0; j != 3; ++j) {
+        for (unsigned short k = 0; k != 3; ++k) {
+          // orthonormality
+          auto d = double{};
+          // residual
+          auto e = -vp2[i + j * n] * r(k, j);
+          for (unsigned short q = 0; q != 3; ++q) {
+            d += r(q, j) * r(q, k);
+            e += a(k, q) * r(q, j);
+          }
+          TFEL_TESTS_ASSERT(std::abs(d - (j == k ? 1 : 0)) < 1e-13);
+          TFEL_TESTS_ASSERT(std::abs(e) < eps);
+        }
+      }
+    }
+  }  // end of test
+  //! \brief usage through arrays of strided coalesced views
+  void test2() {
+    using namespace tfel::math;
+    constexpr auto n = 3u;
+    auto s = std::array<double, 6 * n>{};
+    auto vp = std::array<double, 3 * n>{};
+    auto m = std::array<double, 9 * n>{};
+    auto sv =
+        StridedCoalescedViewsFixedSizeVector<stensor<3u, double>,
+                                             unsigned short, n>(s.data());
+    sv[0] = stensor<3u, double>{1, 2, 3, 0, 0, 0};
+    sv[1] = stensor<3u, double>::Id();
+    sv[2] = stensor<3u, double>{4, 4, 1, 0, 0, 0};
+    const auto csv =
+        StridedCoalescedViewsFixedSizeVector<const stensor<3u, double>,
+                                             unsigned short, n>(s.data());
+    auto vpv =
+        StridedCoalescedViewsFixedSizeVector<tvector<3u, double>,
+                                             unsigned short, n>(vp.data());
+    auto mv = StridedCoalescedViewsFixedSizeVector<tmatrix<3u, 3u, double>,
+                                                   unsigned short, n>(m.data());
+    computeEigenValues(vpv, csv);
+    auto l = tvector<3u, double>{vpv[0]};
+    std::sort(l.begin(), l.end());
+    TFEL_TESTS_ASSERT(std::abs(l(0) - 1) < 1e-14);
+    TFEL_TESTS_ASSERT(std::abs(l(1) - 2) < 1e-14);
+    TFEL_TESTS_ASSERT(std::abs(l(2) - 3) < 1e-14);
+    computeEigenVectors(vpv, mv, sv);
+    for (unsigned short i = 0; i != n; ++i) {
+      const auto si = stensor<3u, double>{sv[i]};
+      const auto li = tvector<3u, double>{vpv[i]};
+      const auto ri = tmatrix<3u, 3u, double>{mv[i]};
+      const auto s2 = stensor<3u, double>::buildFromEigenValuesAndVectors(
+          li(0), li(1), li(2), ri);
+      for (unsigned short k = 0; k != 6; ++k) {
+        TFEL_TESTS_ASSERT(std::abs(si[k] - s2[k]) < 1e-14);
+      }
+    }
+  }  // end of test2
+};
+
+TFEL_TESTS_GENERATE_PROXY(BatchedSymmetricEigenSolverTest,
+                          "BatchedSymmetricEigenSolverTest");
+
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("BatchedSymmetricEigenSolver.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}  // end of main
@@ -0,0 +1,141 @@
+/*!
+ * \file   ThreadPoolTest3.cxx
+ * \brief  This file tests the `parallel_for` method of the `ThreadPool`
+ * class and the execution of tasks added by other tasks.
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright Copyright (C) 2006-2025 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <array>
+#include <cmath>
+#include <atomic>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+#include "TFEL/System/ThreadPool.hxx"
+
+struct ThreadPoolTest3 final : public tfel::tests::TestCase {
+  ThreadPoolTest3()
+      : tfel::tests::TestCase("TFEL/System", "ThreadPoolTest3") {
+  }  // end of ThreadPoolTest3
+  tfel::tests::TestResult execute() override {
+    this->test1();
+    this->test2();
+    this->test3();
+    this->test4();
+    return this->result;
+  }  // end of execute
+
+ private:
+  //! \brief each index must be treated exactly once
+  void test1() {
+    using size_type = tfel::system::ThreadPool::size_type;
+    auto p = tfel::system::ThreadPool{3};
+    for (const auto g : {size_type{0}, size_type{1}, size_type{7}}) {
+      auto counts = std::vector<std::atomic<int>>(1001);
+      p.parallel_for(
+          10, 1001,
+          [&counts](const size_type b, const size_type e) {
+            for (auto i = b; i != e; ++i) {
+              ++(counts[i]);
+            }
+          },
+          g);
+      auto ok = true;
+      for (size_type i = 0; i != counts.size(); ++i) {
+        ok = ok && (counts[i] == (i < 10 ? 0 : 1));
+      }
+      TFEL_TESTS_ASSERT(ok);
+    }
+    // empty range
+    auto called = false;
+    p.parallel_for(5, 5, [&called](const size_type, const size_type) {
+      called = true;
+    });
+    TFEL_TESTS_ASSERT(!called);
+  }  // end of test1
+  //! \brief exceptions thrown by the function are rethrown
+  void test2() {
+    using size_type = tfel::system::ThreadPool::size_type;
+    auto p = tfel::system::ThreadPool{2};
+    TFEL_TESTS_CHECK_THROW(
+        p.parallel_for(0, 100,
+                       [](const size_type b, const size_type e) {
+                         if ((b <= 50) && (50 < e)) {
+                           throw(std::runtime_error("invalid index"));
+                         }
+                       }),
+        std::runtime_error);
+    // the pool is still usable
+    auto r = std::atomic<size_type>{0};
+    p.parallel_for(0, 100, [&r](const size_type b, const size_type e) {
+      r += e - b;
+    });
+    TFEL_TESTS_ASSERT(r == 100);
+  }  // end of test2
+  //! \brief nested calls and tasks added by tasks
+  void test3() {
+    using size_type = tfel::system::ThreadPool::size_type;
+    auto p = tfel::system::ThreadPool{2};
+    auto r = std::atomic<size_type>{0};
+    p.parallel_for(
+        0, 8,
+        [&p, &r](const size_type b, const size_type e) {
+          for (auto i = b; i != e; ++i) {
+            p.parallel_for(0, 100, [&r](const size_type b2,
+                                        const size_type e2) { r += e2 - b2; });
+          }
+        },
+        1);
+    TFEL_TESTS_ASSERT(r == 800);
+    auto r2 = std::atomic<int>{0};
+    for (int i = 0; i != 10; ++i) {
+      static_cast<void>(p.addTask([&p, &r2] {
+        for (int j = 0; j != 10; ++j) {
+          static_cast<void>(p.addTask([&r2] { ++r2; }));
+        }
+      }));
+    }
+    p.wait();
+    TFEL_TESTS_ASSERT(r2 == 100);
+  }  // end of test3
+  //! \brief tasks too large to be stored in the internal buffer of a task
+  void test4() {
+    auto p = tfel::system::ThreadPool{2};
+    auto values = std::array<double, 32>{};
+    for (std::size_t i = 0; i != values.size(); ++i) {
+      values[i] = static_cast<double>(i);
+    }
+    auto f = p.addTask([values] {
+      auto s = double{};
+      for (const auto v : values) {
+        s += v;
+      }
+      return s;
+    });
+    TFEL_TESTS_ASSERT(std::abs(*(f.get()) - 496) < 1e-14);
+    // exceptions are reported through the result
+    auto f2 = p.addTask([]() -> int { throw(std::runtime_error("error")); });
+    auto r = f2.get();
+    TFEL_TESTS_CHECK_THROW(*r, std::runtime_error);
+  }  // end of test4
+};
+
+TFEL_TESTS_GENERATE_PROXY(ThreadPoolTest3, "ThreadPoolTest3");
+
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("ThreadPoolTest3.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
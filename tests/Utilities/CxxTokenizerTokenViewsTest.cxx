@@ -0,0 +1,136 @@
+/*!
+ * \file   tests/Utilities/CxxTokenizerTokenViewsTest.cxx
+ * \brief
+ * \date   18/10/2026
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+
+#include <string>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+#include "TFEL/Utilities/CxxTokenizer.hxx"
+
+struct CxxTokenizerTokenViewsTest final : public tfel::tests::TestCase {
+  CxxTokenizerTokenViewsTest()
+      : tfel::tests::TestCase("TFEL/Utilities", "CxxTokenizerTokenViewsTest") {
+  }  // end of CxxTokenizerTokenViewsTest
+  tfel::tests::TestResult execute() override {
+    this->test1();
+    this->test2();
+    this->test3();
+    return this->result;
+  }  // end of execute()
+ private:
+  static std::string getSource() {
+    return "/* a comment\n"
+           " * spanning several lines */\n"
+           "//! doxygen comment\n"
+           "int a = 1'000; //!< backward comment\n"
+           "auto s = \"ab\" \"cd\";\n"
+           "auto r = R\"(line1\n"
+           "line2)\";\n";
+  }
+  //! \brief compare the tokens and the token views
+  void test1() {
+    using namespace tfel::utilities;
+    CxxTokenizer t;
+    t.mergeStrings(true);
+    t.parseString(getSource());
+    t.stripComments();
+    TFEL_TESTS_ASSERT(t.getTokenViews().empty());
+    CxxTokenizer t2;
+    t2.mergeStrings(true);
+    t2.useTokenViews(true);
+    t2.parseString(getSource());
+    t2.stripComments();
+    TFEL_TESTS_ASSERT(t2.empty());
+    const auto& views = t2.getTokenViews();
+    TFEL_TESTS_ASSERT(views.size() == t.size());
+    if (views.size() != t.size()) {
+      return;
+    }
+    for (decltype(t.size()) i = 0; i != t.size(); ++i) {
+      TFEL_TESTS_ASSERT(views[i].value == t[i].value);
+      TFEL_TESTS_ASSERT(views[i].comment == t[i].comment);
+      TFEL_TESTS_ASSERT(views[i].line == t[i].line);
+      TFEL_TESTS_ASSERT(views[i].offset == t[i].offset);
+      TFEL_TESTS_ASSERT(views[i].flag == t[i].flag);
+    }
+  }
+  //! \brief check the values of the token views
+  void test2() {
+    using namespace tfel::utilities;
+    CxxTokenizer t;
+    t.useTokenViews(true);
+    t.mergeStrings(true);
+    t.parseString(getSource());
+    const auto& views = t.getTokenViews();
+    TFEL_TESTS_ASSERT(views.size() == 18u);
+    if (views.size() != 18u) {
+      return;
+    }
+    TFEL_TESTS_ASSERT(views[0].flag == Token::Comment);
+    TFEL_TESTS_ASSERT(views[0].value ==
+                      "a comment\n * spanning several lines ");
+    TFEL_TESTS_ASSERT(views[1].flag == Token::DoxygenComment);
+    TFEL_TESTS_ASSERT(views[5].value == "1000");
+    TFEL_TESTS_ASSERT(views[5].flag == Token::Number);
+    TFEL_TESTS_ASSERT(views[7].flag == Token::DoxygenBackwardComment);
+    TFEL_TESTS_ASSERT(views[11].value == "\"abcd\"");
+    TFEL_TESTS_ASSERT(views[16].value == "line1\nline2");
+    TFEL_TESTS_ASSERT(views[16].flag == Token::String);
+    t.stripComments();
+    TFEL_TESTS_ASSERT(views.size() == 15u);
+    if (views.size() != 15u) {
+      return;
+    }
+    TFEL_TESTS_ASSERT(views[0].value == "int");
+    TFEL_TESTS_ASSERT(views[0].comment == "doxygen comment");
+    TFEL_TESTS_ASSERT(views[3].value == "1000");
+    TFEL_TESTS_ASSERT(views[4].value == ";");
+    TFEL_TESTS_ASSERT(views[4].comment == "backward comment");
+  }
+  //! \brief the token views of a copy must survive the original tokenizer
+  void test3() {
+    using namespace tfel::utilities;
+    auto t = [] {
+      CxxTokenizer t2;
+      t2.useTokenViews(true);
+      t2.parseString("auto a = b;");
+      return CxxTokenizer{t2};
+    }();
+    const auto& views = t.getTokenViews();
+    TFEL_TESTS_ASSERT(views.size() == 5u);
+    if (views.size() != 5u) {
+      return;
+    }
+    TFEL_TESTS_ASSERT(views[1].value == "a");
+    TFEL_TESTS_ASSERT(views[3].value == "b");
+    // switching back to owning tokens
+    t.useTokenViews(false);
+    TFEL_TESTS_ASSERT(t.getTokenViews().empty());
+    TFEL_TESTS_ASSERT(t.size() == 5u);
+    if (t.size() != 5u) {
+      return;
+    }
+    TFEL_TESTS_ASSERT(t[4].value == ";");
+  }
+};
+
+TFEL_TESTS_GENERATE_PROXY(CxxTokenizerTokenViewsTest, "CxxTokenizerTokenViews");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("CxxTokenizerTokenViews.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,204 @@
+/*!
+ * \file   TextDataTest.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright Copyright (C) 2006-2025 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+
+#include <cmath>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <fstream>
+#include <stdexcept>
+#include <iostream>
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+#include "TFEL/Utilities/TextData.hxx"
+#include "TFEL/Utilities/BinaryDataWriter.hxx"
+
+struct TextDataTest final : public tfel::tests::TestCase {
+  TextDataTest() : tfel::tests::TestCase("TFEL/Utilities", "TextDataTest") {}
+  tfel::tests::TestResult execute() override {
+    this->test1();
+    this->test2();
+    this->test3();
+    this->test4();
+    return this->result;
+  }
+
+ private:
+  static void write(const std::string& f, const std::string& c) {
+    std::ofstream file(f);
+    file << c;
+  }
+  //! \brief legends, preamble and values
+  void test1() {
+    using namespace tfel::utilities;
+    constexpr auto eps = double{1e-14};
+    write("TextDataTest1.txt",
+          "# time 'sig xx' eto\n"
+          "# a comment\n"
+          "\n"
+          "0 -1.5e-3 2.\n"
+          "1 +2 3 // comment\n"
+          "# a comment in the data\n"
+          "2\t3.25   4e400\r\n"
+          "3 abc 5 /* c */ 6\n");
+    const auto d = TextData("TextDataTest1.txt");
+    TFEL_TESTS_ASSERT(d.getLegends().size() == 3u);
+    TFEL_TESTS_ASSERT(d.getLegend(2) == "sig xx");
+    TFEL_TESTS_ASSERT(d.findColumn("eto") == 3u);
+    TFEL_TESTS_ASSERT(d.getPreamble().size() == 2u);
+    TFEL_TESTS_ASSERT(d.getNumberOfLines() == 4u);
+    const auto c1 = d.getColumn(1);
+    TFEL_TESTS_ASSERT(c1.size() == 4u);
+    for (std::size_t i = 0; i != c1.size(); ++i) {
+      TFEL_TESTS_ASSERT(std::abs(c1[i] - static_cast<double>(i)) < eps);
+    }
+    // 'abc' is not a number
+    TFEL_TESTS_CHECK_THROW(d.getColumn(2), std::invalid_argument);
+    // 4e400 can't be represented by a double
+    TFEL_TESTS_CHECK_THROW(d.getColumn(3), std::invalid_argument);
+    // the second line only has three columns
+    TFEL_TESTS_CHECK_THROW(d.getColumn(4), std::runtime_error);
+    TFEL_TESTS_CHECK_THROW(d.getColumn(0), std::runtime_error);
+    // lines of tokens
+    auto n = std::size_t{};
+    for (const auto& l : d) {
+      if (n == 1) {
+        TFEL_TESTS_ASSERT(l.tokens.size() == 3u);
+        TFEL_TESTS_ASSERT(l.tokens[0].line == 4u);
+      }
+      if (n == 3) {
+        TFEL_TESTS_ASSERT(l.tokens.size() == 4u);
+        TFEL_TESTS_ASSERT(l.tokens[1].value == "abc");
+      }
+      ++n;
+    }
+    TFEL_TESTS_ASSERT(n == 4u);
+  }  // end of test1
+  //! \brief gnuplot format and skipping lines
+  void test2() {
+    using namespace tfel::utilities;
+    constexpr auto eps = double{1e-14};
+    write("TextDataTest2.txt", "time sig\n0 1\n1 2\n2 4");
+    auto d = TextData("TextDataTest2.txt", "gnuplot");
+    TFEL_TESTS_ASSERT(d.getLegends().size() == 2u);
+    TFEL_TESTS_ASSERT(d.findColumn("sig") == 2u);
+    const auto c2 = d.getColumn(2);
+    TFEL_TESTS_ASSERT(c2.size() == 3u);
+    TFEL_TESTS_ASSERT(std::abs(c2[2] - 4) < eps);
+    d.skipLines(1);
+    TFEL_TESTS_ASSERT(d.getNumberOfLines() == 2u);
+    TFEL_TESTS_ASSERT(std::abs(d.getColumn(1)[0] - 1) < eps);
+    d.skipLines(10);
+    TFEL_TESTS_ASSERT(d.getNumberOfLines() == 0u);
+    TFEL_TESTS_ASSERT(d.getColumn(1).empty());
+    write("TextDataTest3.txt", "1 2\n3 4\n");
+    const auto d2 = TextData("TextDataTest3.txt", "gnuplot");
+    TFEL_TESTS_ASSERT(d2.getLegends().empty());
+    TFEL_TESTS_ASSERT(d2.getNumberOfLines() == 2u);
+    TFEL_TESTS_CHECK_THROW(TextData("TextDataTest-missing.txt"),
+                           std::runtime_error);
+  }  // end of test2
+  //! \brief parallel reading of a large file
+  void test3() {
+    using namespace tfel::utilities;
+    constexpr auto n = std::size_t{200000};
+    {
+      std::ofstream file("TextDataTest4.txt");
+      file << "# i x\n";
+      for (std::size_t i = 0; i != n; ++i) {
+        file << i << ' ' << 0.5 * static_cast<double>(i) << " 1.25e-3\n";
+      }
+    }
+    const auto d1 = TextData("TextDataTest4.txt");
+    const auto d2 = TextData("TextDataTest4.txt", "", 4);
+    TFEL_TESTS_ASSERT(d1.getNumberOfLines() == n);
+    TFEL_TESTS_ASSERT(d2.getNumberOfLines() == n);
+    for (std::size_t c = 1; c != 4; ++c) {
+      TFEL_TESTS_ASSERT(d1.getColumn(c) == d2.getColumn(c));
+    }
+    const auto x = d2.getColumn(d2.findColumn("x"));
+    auto ok = true;
+    for (std::size_t i = 0; i != n; ++i) {
+      ok = ok && (std::abs(x[i] - 0.5 * static_cast<double>(i)) < 1e-10);
+    }
+    TFEL_TESTS_ASSERT(ok);
+  }  // end of test3
+  //! \brief binary files
+  void test4() {
+    using namespace tfel::utilities;
+    constexpr auto n = std::size_t{1000};
+    {
+      auto w = BinaryDataWriter("TextDataTest5.bin", {"time", "SXX"}, 64);
+      TFEL_TESTS_ASSERT(w.getNumberOfColumns() == 2u);
+      for (std::size_t i = 0; i != n; ++i) {
+        const auto t = 0.1 * static_cast<double>(i);
+        w.write(t);
+        w.write(std::sin(t));
+        w.endLine();
+      }
+      w.write(1.);
+      TFEL_TESTS_CHECK_THROW(w.endLine(), std::runtime_error);
+      const auto v = std::vector<double>{2., 3., 4.};
+      w.write(v);
+      TFEL_TESTS_CHECK_THROW(w.endLine(), std::runtime_error);
+    }
+    auto d = TextData("TextDataTest5.bin");
+    TFEL_TESTS_ASSERT(d.getLegends().size() == 2u);
+    TFEL_TESTS_ASSERT(d.getLegend(2) == "SXX");
+    TFEL_TESTS_ASSERT(d.getPreamble().empty());
+    TFEL_TESTS_ASSERT(d.getNumberOfLines() == n);
+    const auto t = d.getColumn(d.findColumn("time"));
+    const auto s = d.getColumn(2);
+    TFEL_TESTS_ASSERT(t.size() == n);
+    TFEL_TESTS_ASSERT(s.size() == n);
+    auto ok = true;
+    for (std::size_t i = 0; i != n; ++i) {
+      // values are stored exactly
+      ok = ok && (!(t[i] < 0.1 * static_cast<double>(i))) &&
+           (!(t[i] > 0.1 * static_cast<double>(i))) &&
+           (!(s[i] < std::sin(t[i]))) && (!(s[i] > std::sin(t[i])));
+    }
+    TFEL_TESTS_ASSERT(ok);
+    TFEL_TESTS_CHECK_THROW(d.getColumn(3), std::runtime_error);
+    auto nlines = std::size_t{};
+    for (const auto& l : d) {
+      TFEL_TESTS_ASSERT(l.tokens.size() == 2u);
+      ++nlines;
+    }
+    TFEL_TESTS_ASSERT(nlines == n);
+    d.skipLines(n - 1);
+    TFEL_TESTS_ASSERT(d.getNumberOfLines() == 1u);
+    // a text file can't be read as a binary file
+    TFEL_TESTS_CHECK_THROW(TextData("TextDataTest2.txt", "binary"),
+                           std::runtime_error);
+    // truncated file
+    write("TextDataTest6.bin", "TFELBDAT\x01\x00\x00\x00\x02");
+    TFEL_TESTS_CHECK_THROW(TextData("TextDataTest6.bin"), std::runtime_error);
+  }  // end of test4
+};
+
+TFEL_TESTS_GENERATE_PROXY(TextDataTest, "TextDataTest");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("TextData.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
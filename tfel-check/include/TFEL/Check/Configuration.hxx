@@ -17,11 +17,15 @@
 #include <map>
 #include <vector>
 #include <string>
+#include <memory>
 #include "TFEL/Check/TFELCheckConfig.hxx"
 #include "TFEL/Check/PCLogger.hxx"
 
 namespace tfel::check {
 
+  // forward declaration
+  struct ResultsCache;
+
   /*!
    * \brief a data structure used to define a test environment.
    */
@@ -56,6 +60,11 @@ namespace tfel::check {
     std::string directory;
     //! \brief global logger
     PCLogger log;
+    /*!
+     * \brief cache of the results of the previous runs. If null, all the
+     * tests are executed.
+     */
+    std::shared_ptr<ResultsCache> cache;
   };  // end of struct Configuration
 
 }  // end of namespace tfel::check
@@ -0,0 +1,107 @@
+/*!
+ * \file   ResultsCache.hxx
+ * \brief  This file declares the ResultsCache class
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright Copyright (C) 2006-2025 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFELCHECK_RESULTSCACHE_HXX
+#define LIB_TFELCHECK_RESULTSCACHE_HXX
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include "TFEL/Check/TFELCheckConfig.hxx"
+
+namespace tfel::check {
+
+  /*!
+   * \brief a structure storing, for each test which succeeded, a hash of
+   * its inputs. A test whose inputs have the same hash than the one
+   * stored in the cache does not need to be executed again.
+   *
+   * The hashes of the files are computed once per run, unless the size or
+   * the modification time of the file changes.
+   *
+   * \note all the methods of this class are thread-safe.
+   */
+  struct TFELCHECK_VISIBILITY_EXPORT ResultsCache {
+    /*!
+     * \brief constructor
+     * \param[in] f: file in which the cache is stored. If this file
+     * exists, the cache is initialized with its content.
+     */
+    explicit ResultsCache(const std::string&);
+    /*!
+     * \brief update the hash of a test
+     * \param[in] h: current hash
+     * \param[in] s: string
+     */
+    static std::uint64_t hash(const std::uint64_t, std::string_view);
+    //! \return the initial value of a hash
+    static std::uint64_t hash();
+    /*!
+     * \return the hash of the given file or an empty value if the file
+     * does not exist.
+     * \param[in] f: file name
+     */
+    std::optional<std::uint64_t> getFileHash(const std::string&);
+    /*!
+     * \return the hash associated with the given test, if any
+     * \param[in] t: test identifier
+     */
+    std::optional<std::uint64_t> getTestHash(const std::string&) const;
+    /*!
+     * \return if the given hash matches the one stored for the given test
+     * \param[in] t: test identifier
+     * \param[in] h: hash of the inputs of the test
+     */
+    bool isUpToDate(const std::string&, const std::uint64_t) const;
+    /*!
+     * \brief store the hash of the inputs of a test which succeeded
+     * \param[in] t: test identifier
+     * \param[in] h: hash of the inputs of the test
+     */
+    void update(const std::string&, const std::uint64_t);
+    /*!
+     * \brief remove a test from the cache
+     * \param[in] t: test identifier
+     */
+    void remove(const std::string&);
+    //! \brief write the cache in the file given to the constructor
+    void save() const;
+    //! \brief destructor
+    ~ResultsCache();
+
+   private:
+    //! \brief description of a file whose hash has already been computed
+    struct FileHash {
+      //! \brief size of the file
+      std::uintmax_t size;
+      //! \brief last modification time
+      std::int64_t modification_time;
+      //! \brief hash
+      std::uint64_t hash;
+    };
+    //! \brief file in which the cache is stored
+    const std::string file;
+    //! \brief hashes of the tests
+    std::map<std::string, std::uint64_t> tests;
+    //! \brief hashes of the files
+    std::map<std::string, FileHash> files;
+    //! \brief mutex protecting the members
+    mutable std::mutex m;
+  };  // end of struct ResultsCache
+
+}  // end of namespace tfel::check
+
+#endif /* LIB_TFELCHECK_RESULTSCACHE_HXX */
@@ -21,6 +21,7 @@
 #include <vector>
 #include <string>
 #include <memory>
+#include <cstdint>
 #include <fstream>
 #include <fstream>
 #include <optional>
@@ -41,6 +42,15 @@ namespace tfel::check {
   //! \brief a simple alias
   struct Configuration;
 
+  /*!
+   * \return a unique identifier of a test, built from the absolute path of
+   * the input file.
+   * \param[in] d: directory
+   * \param[in] f: input file
+   */
+  TFELCHECK_VISIBILITY_EXPORT std::string getTestIdentifier(
+      const std::string&, const std::string&);
+
   /*!
    * \brief structure in charge of lauching the tests described in an
    * input file.
@@ -55,8 +65,26 @@ namespace tfel::check {
      * \param[in] f: input file
      */
     TestLauncher(const Configuration&, const std::string&);
+    /*!
+     * \return the input files of the tests on which the test described in
+     * the given input file depends (see the `@DependsOn` keyword). Those
+     * files are relative to the directory of the test.
+     *
+     * \note this method only looks for the `@DependsOn` keyword and does
+     * not check the validity of the input file.
+     *
+     * \param[in] c: global configuration
+     * \param[in] f: input file
+     */
+    static std::vector<std::string> getDependencies(const Configuration&,
+                                                    const std::string&);
     /*!
      * \brief execute the registred tests
+     *
+     * If a cache is associated with the configuration, the tests are not
+     * executed if their inputs did not change since the last successful
+     * run.
+     *
      * \param[in] configuration: global configuration
      */
     bool execute(const Configuration&);
@@ -125,6 +153,24 @@ namespace tfel::check {
     void treatCleanFiles();
     //! \brief treat the `@CleanDirectories` keyword
     void treatCleanDirectories();
+    //! \brief treat the `@DependsOn` keyword
+    void treatDependsOn();
+    //! \brief treat the `@Inputs` keyword
+    void treatInputs();
+    /*!
+     * \return the list of files on which the results of the test depends:
+     * the files explicitly declared by the `@Inputs` keyword, the files
+     * appearing in the commands and the compared files.
+     */
+    std::vector<std::string> getInputFiles() const;
+    /*!
+     * \return the hash of the inputs of the test. Besides the input files,
+     * the hash covers the version of `TFEL` and the executables called by
+     * the commands, so that the results are invalidated when the tools
+     * under test are rebuilt.
+     * \param[in] configuration: global configuration
+     */
+    std::uint64_t getInputsHash(const Configuration&) const;
     /*!
      * \brief register the error and throw an runtime_error
      * \param[in] m:   calling method
@@ -171,6 +217,12 @@ namespace tfel::check {
     std::map<std::string, std::string> environments;
     //! \brief list of requirements
     std::vector<std::string> requirements;
+    //! \brief identifiers of the tests on which this test depends
+    std::vector<std::string> dependencies;
+    //! \brief list of input files declared by the `@Inputs` keyword
+    std::vector<std::string> inputs;
+    //! \brief hash of the input file, after substitutions
+    std::uint64_t signature = 0;
     //! \brief iterator to the current file token
     const_iterator current;
     //! \brief list of files comparison to be made
@@ -0,0 +1,155 @@
+/*!
+ * \file   tfel-check/src/ResultsCache.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright Copyright (C) 2006-2025 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <filesystem>
+#include "TFEL/Raise.hxx"
+#include "TFEL/Utilities/FNV1aHash.hxx"
+#include "TFEL/Check/ResultsCache.hxx"
+
+namespace tfel::check {
+
+  ResultsCache::ResultsCache(const std::string& f) : file(f) {
+    std::ifstream in(f);
+    if (!in) {
+      return;
+    }
+    auto line = std::string{};
+    while (std::getline(in, line)) {
+      if (line.empty()) {
+        continue;
+      }
+      std::istringstream is(line);
+      auto h = std::uint64_t{};
+      auto t = std::string{};
+      is >> std::hex >> h;
+      if ((!is) || (is.get() != ' ') || (!std::getline(is, t)) ||
+          (t.empty())) {
+        tfel::raise("ResultsCache::ResultsCache: invalid line '" + line +
+                    "' in file '" + f + "'");
+      }
+      this->tests[t] = h;
+    }
+  }  // end of ResultsCache
+
+  std::uint64_t ResultsCache::hash() {
+    return tfel::utilities::fnv1a_offset_basis;
+  }  // end of hash
+
+  std::uint64_t ResultsCache::hash(const std::uint64_t h0,
+                                   std::string_view s) {
+    // the size is also hashed so that the concatenation of two strings
+    // does not give the same result than the concatenation of two
+    // other strings with the same content
+    const auto n = static_cast<std::uint64_t>(s.size());
+    char size[8];
+    for (int i = 0; i != 8; ++i) {
+      size[i] = static_cast<char>((n >> (8 * i)) & 0xFF);
+    }
+    return tfel::utilities::fnv1a(tfel::utilities::fnv1a(h0, s),
+                                  std::string_view(size, 8));
+  }  // end of hash
+
+  std::optional<std::uint64_t> ResultsCache::getFileHash(
+      const std::string& f) {
+    namespace fs = std::filesystem;
+    auto ec = std::error_code{};
+    if (!fs::is_regular_file(f, ec)) {
+      return {};
+    }
+    const auto s = fs::file_size(f, ec);
+    if (ec) {
+      return {};
+    }
+    const auto t = fs::last_write_time(f, ec);
+    if (ec) {
+      return {};
+    }
+    const auto mt = static_cast<std::int64_t>(t.time_since_epoch().count());
+    {
+      auto lock = std::lock_guard<std::mutex>{this->m};
+      const auto p = this->files.find(f);
+      if ((p != this->files.end()) && (p->second.size == s) &&
+          (p->second.modification_time == mt)) {
+        return p->second.hash;
+      }
+    }
+    // the hash is computed outside the lock
+    std::ifstream in(f, std::ios::binary);
+    if (!in) {
+      return {};
+    }
+    auto h = hash();
+    char buffer[65536];
+    while (in) {
+      in.read(buffer, sizeof(buffer));
+      const auto n = static_cast<std::size_t>(in.gcount());
+      if (n != 0) {
+        h = hash(h, std::string_view(buffer, n));
+      }
+    }
+    auto lock = std::lock_guard<std::mutex>{this->m};
+    this->files[f] = FileHash{s, mt, h};
+    return h;
+  }  // end of getFileHash
+
+  std::optional<std::uint64_t> ResultsCache::getTestHash(
+      const std::string& t) const {
+    auto lock = std::lock_guard<std::mutex>{this->m};
+    const auto p = this->tests.find(t);
+    if (p == this->tests.end()) {
+      return {};
+    }
+    return p->second;
+  }  // end of getTestHash
+
+  bool ResultsCache::isUpToDate(const std::string& t,
+                                const std::uint64_t h) const {
+    const auto oh = this->getTestHash(t);
+    return oh.has_value() && (*oh == h);
+  }  // end of isUpToDate
+
+  void ResultsCache::update(const std::string& t, const std::uint64_t h) {
+    auto lock = std::lock_guard<std::mutex>{this->m};
+    this->tests[t] = h;
+  }  // end of update
+
+  void ResultsCache::remove(const std::string& t) {
+    auto lock = std::lock_guard<std::mutex>{this->m};
+    this->tests.erase(t);
+  }  // end of remove
+
+  void ResultsCache::save() const {
+    auto lock = std::lock_guard<std::mutex>{this->m};
+    // the cache is first written in a temporary file so that an
+    // interrupted run does not corrupt the cache
+    const auto tmp = this->file + ".tmp";
+    {
+      std::ofstream out(tmp);
+      raise_if(!out, "ResultsCache::save: can't open file '" + tmp + "'");
+      out << std::hex;
+      for (const auto& [t, h] : this->tests) {
+        out << h << ' ' << t << '\n';
+      }
+      raise_if(!out, "ResultsCache::save: error while writing '" + tmp + "'");
+    }
+    raise_if(std::rename(tmp.c_str(), this->file.c_str()) != 0,
+             "ResultsCache::save: can't rename '" + tmp + "' to '" +
+                 this->file + "'");
+  }  // end of save
+
+  ResultsCache::~ResultsCache() = default;
+
+}  // end of namespace tfel::check
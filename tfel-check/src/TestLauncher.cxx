@@ -21,9 +21,12 @@
 #include <limits>
 #include <ctime>
 #include <regex>
+#include <cstdlib>
+#include <filesystem>
 #include <unistd.h>  // sysconf
 
 #include "TFEL/Raise.hxx"
+#include "TFEL/Config/GetTFELVersion.h"
 #include "TFEL/System/System.hxx"
 #include "TFEL/System/ProcessManager.hxx"
 #include "TFEL/Utilities/Data.hxx"
@@ -31,6 +34,7 @@
 #include "TFEL/Utilities/StringAlgorithms.hxx"
 
 #include "TFEL/Check/Configuration.hxx"
+#include "TFEL/Check/ResultsCache.hxx"
 #include "TFEL/Check/PCLogger.hxx"
 #include "TFEL/Check/PCTextDriver.hxx"
 #include "TFEL/Check/PCJUnitDriver.hxx"
@@ -47,6 +51,14 @@
 
 namespace tfel::check {
 
+  std::string getTestIdentifier(const std::string& d, const std::string& f) {
+    using tfel::system::systemCall;
+    if (d.empty()) {
+      return systemCall::getAbsolutePath(f);
+    }
+    return systemCall::getAbsolutePath(d + '/' + f);
+  }  // end of getTestIdentifier
+
   TestLauncher::Command::Command() = default;
   TestLauncher::Command::Command(Command&&) noexcept = default;
   TestLauncher::Command::Command(const Command&) = default;
@@ -91,9 +103,39 @@ namespace tfel::check {
     this->registerCallBack("@CleanFiles", &TestLauncher::treatCleanFiles);
     this->registerCallBack("@CleanDirectories",
                            &TestLauncher::treatCleanDirectories);
+    this->registerCallBack("@DependsOn", &TestLauncher::treatDependsOn);
+    this->registerCallBack("@Inputs", &TestLauncher::treatInputs);
     this->analyseInputFile(c);
   }  // end of TestLauncher
 
+  std::vector<std::string> TestLauncher::getDependencies(
+      const Configuration& c, const std::string& f) {
+    auto tokenizer = CxxTokenizer{};
+    tokenizer.treatCharAsString(true);
+    tokenizer.mergeStrings(false);
+    if (!c.directory.empty()) {
+      tokenizer.openFile(c.directory + '/' + f);
+    } else {
+      tokenizer.openFile(f);
+    }
+    tokenizer.stripComments();
+    tokenizer.substitute(c.substitutions);
+    auto dependencies = std::vector<std::string>{};
+    auto p = tokenizer.begin();
+    const auto pe = tokenizer.end();
+    while (p != pe) {
+      if ((p->value != "@DependsOn") ||
+          ((p != tokenizer.begin()) && (std::prev(p)->value != ";"))) {
+        ++p;
+        continue;
+      }
+      ++p;
+      const auto d = CxxTokenizer::readStringArray(p, pe);
+      dependencies.insert(dependencies.end(), d.begin(), d.end());
+    }
+    return dependencies;
+  }  // end of getDependencies
+
   void TestLauncher::registerCallBack(const std::string& name,
                                       const CallBack& f) {
     raise_if(!this->callBacks.insert({name, f}).second,
@@ -227,6 +269,41 @@ namespace tfel::check {
     this->readSpecifiedToken("TestLauncher::treatCleanDirectories", ";");
   }  // end of treatCleanDirectories
 
+  void TestLauncher::treatDependsOn() {
+    const auto tests =
+        CxxTokenizer::readStringArray(this->current, this->end());
+    for (const auto& t : tests) {
+      const auto id = [this, &t] {
+        try {
+          return getTestIdentifier(this->directory, t);
+        } catch (std::exception&) {
+          this->throwRuntimeError("TestLauncher::treatDependsOn",
+                                  "test '" + t + "' does not exist");
+        }
+      }();
+      if (std::find(this->dependencies.begin(), this->dependencies.end(),
+                    id) != this->dependencies.end()) {
+        this->throwRuntimeError("TestLauncher::treatDependsOn",
+                                "test '" + t + "' multiply declared");
+      }
+      this->dependencies.push_back(id);
+    }
+    this->readSpecifiedToken("TestLauncher::treatDependsOn", ";");
+  }  // end of treatDependsOn
+
+  void TestLauncher::treatInputs() {
+    const auto files =
+        CxxTokenizer::readStringArray(this->current, this->end());
+    for (const auto& f : files) {
+      if (!this->directory.empty()) {
+        this->inputs.push_back(this->directory + '/' + f);
+      } else {
+        this->inputs.push_back(f);
+      }
+    }
+    this->readSpecifiedToken("TestLauncher::treatInputs", ";");
+  }  // end of treatInputs
+
   static std::function<
       std::tuple<bool, std::string>(const std::vector<std::string>&)>
   generateEmptyOutputCheck(const tfel::utilities::Data& option) {
@@ -666,6 +743,11 @@ namespace tfel::check {
         t.value = tfel::utilities::replace_all(t.value, s.first, s.second);
       }
     }
+    // the signature is used to detect modifications of the input file
+    this->signature = ResultsCache::hash();
+    for (const auto& t : this->tokens) {
+      this->signature = ResultsCache::hash(this->signature, t.value);
+    }
     // starts parsing the file
     this->current = this->begin();
     while (this->current != this->end()) {
@@ -687,6 +769,134 @@ namespace tfel::check {
     this->clear();
   }  // end of analyseInputFile
 
+  std::vector<std::string> TestLauncher::getInputFiles() const {
+    auto files = this->inputs;
+    // words appearing in the commands which are existing files, including
+    // the values of options such as `--library=libBehaviour.so`
+    auto add_file = [this, &files](std::string w) {
+      if ((w.size() >= 2) && ((w.front() == '"') || (w.front() == '\'')) &&
+          (w.back() == w.front())) {
+        w = w.substr(1, w.size() - 2);
+      }
+      if (w.empty()) {
+        return;
+      }
+      const auto f = ((w[0] == '/') || (this->directory.empty()))
+                         ? w
+                         : this->directory + '/' + w;
+      auto ec = std::error_code{};
+      if (std::filesystem::is_regular_file(f, ec)) {
+        files.push_back(f);
+      }
+    };
+    for (const auto& c : this->commands) {
+      for (const auto& w : tfel::utilities::tokenize(c.command, ' ')) {
+        add_file(w);
+        const auto p = w.find('=');
+        if (p != std::string::npos) {
+          add_file(w.substr(p + 1));
+        }
+      }
+    }
+    for (const auto& c : this->comparisons) {
+      files.push_back(c.getFileA());
+      files.push_back(c.getFileB());
+    }
+    std::sort(files.begin(), files.end());
+    files.erase(std::unique(files.begin(), files.end()), files.end());
+    return files;
+  }  // end of getInputFiles
+
+  /*!
+   * \return the path to the executable called by a command, or an empty
+   * string if this executable can't be found.
+   * \param[in] c: command
+   * \param[in] d: directory in which the command is executed
+   * \param[in] path: list of directories in which executables are searched
+   */
+  static std::string getCommandExecutable(const std::string& c,
+                                          const std::string& d,
+                                          const std::string& path) {
+    namespace fs = std::filesystem;
+    const auto words = tfel::utilities::tokenize(c, ' ');
+    if (words.empty()) {
+      return "";
+    }
+    const auto& e = words[0];
+    auto ec = std::error_code{};
+    if (e.find('/') != std::string::npos) {
+      const auto f = ((e[0] == '/') || (d.empty())) ? e : d + '/' + e;
+      return fs::is_regular_file(f, ec) ? f : "";
+    }
+#if (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__)
+    const auto separator = ';';
+#else
+    const auto separator = ':';
+#endif
+    for (const auto& p : tfel::utilities::tokenize(path, separator)) {
+      const auto f = p + '/' + e;
+      if (fs::is_regular_file(f, ec)) {
+        return f;
+      }
+    }
+    return "";
+  }  // end of getCommandExecutable
+
+  std::uint64_t TestLauncher::getInputsHash(
+      const Configuration& configuration) const {
+    auto& cache = *(configuration.cache);
+    auto h = ResultsCache::hash(this->signature,
+                                configuration.discard_commands_failure
+                                    ? "discard_commands_failure"
+                                    : "");
+    auto envs = this->environments;
+    envs.insert(configuration.environments.begin(),
+                configuration.environments.end());
+    for (const auto& [k, v] : envs) {
+      h = ResultsCache::hash(ResultsCache::hash(h, k), v);
+    }
+    // version of the tools under test
+    h = ResultsCache::hash(h, getTFELVersion());
+#ifdef TFEL_GIT_HASH
+    h = ResultsCache::hash(h, TFEL_GIT_HASH);
+#endif /* TFEL_GIT_HASH */
+    const auto path = [&envs]() -> std::string {
+      const auto p = envs.find("PATH");
+      if (p != envs.end()) {
+        return p->second;
+      }
+      const auto* const e = std::getenv("PATH");
+      return e != nullptr ? e : "";
+    }();
+    for (const auto& c : this->commands) {
+      const auto e = getCommandExecutable(c.command, this->directory, path);
+      if (!e.empty()) {
+        const auto eh = cache.getFileHash(e);
+        h = ResultsCache::hash(h, e);
+        h = ResultsCache::hash(h, eh.has_value() ? std::to_string(*eh) : "");
+      }
+    }
+    for (const auto& d : this->dependencies) {
+      const auto dh = cache.getTestHash(d);
+      h = ResultsCache::hash(h, d);
+      h = ResultsCache::hash(h, dh.has_value() ? std::to_string(*dh) : "");
+    }
+    // the names of the files are taken relative to the directory of the
+    // test, so that the hash does not depend on the way the test is called
+    const auto prefix = this->directory + '/';
+    for (const auto& f : this->getInputFiles()) {
+      const auto fh = cache.getFileHash(f);
+      if ((!this->directory.empty()) &&
+          (tfel::utilities::starts_with(f, prefix))) {
+        h = ResultsCache::hash(h, f.substr(prefix.size()));
+      } else {
+        h = ResultsCache::hash(h, f);
+      }
+      h = ResultsCache::hash(h, fh.has_value() ? std::to_string(*fh) : "");
+    }
+    return h;
+  }  // end of getInputsHash
+
   static std::vector<std::string> getFileContent(const std::string& f) {
     auto rtrim = [](const std::string& s) {
       auto end = s.find_last_not_of(" \n\r\t\f\v");
@@ -788,6 +998,15 @@ namespace tfel::check {
         return gsuccess;
       }
     }
+    const auto id = getTestIdentifier(this->directory, this->file);
+    if ((configuration.cache) &&
+        (configuration.cache->isUpToDate(id,
+                                         this->getInputsHash(configuration)))) {
+      this->log.addMessage("inputs unchanged since the last successful run");
+      this->glog.reportSkippedTest(
+          "** inputs unchanged since the last successful run");
+      return gsuccess;
+    }
     // Execute
     unsigned short i = 1;
     for (const auto& c : this->commands) {
@@ -861,6 +1080,15 @@ namespace tfel::check {
         this->glog.addMessage("cleaning directory '" + d + "' failed");
       }
     }
+    // the hash is computed after the execution to take into account the
+    // files generated by the test
+    if (configuration.cache) {
+      if (gsuccess) {
+        configuration.cache->update(id, this->getInputsHash(configuration));
+      } else {
+        configuration.cache->remove(id);
+      }
+    }
     return gsuccess;
   }  // end of execute
 
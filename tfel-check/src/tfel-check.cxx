@@ -14,6 +14,9 @@
 #include <map>
 #include <mutex>
 #include <thread>
+#include <atomic>
+#include <future>
+#include <functional>
 #include <vector>
 #include <string>
 #include <cerrno>
@@ -25,6 +28,7 @@
 #include <iterator>
 #include <algorithm>
 #include <iostream>
+#include <filesystem>
 #include <unistd.h>
 #include <libgen.h>
 #include <sys/stat.h>
@@ -46,6 +50,7 @@
 #include "MFront/ModelInterfaceFactory.hxx"
 #include "TFEL/Check/ConfigurationManager.hxx"
 #include "TFEL/Check/TestLauncher.hxx"
+#include "TFEL/Check/ResultsCache.hxx"
 #include "TFEL/Check/PCLogger.hxx"
 #include "TFEL/Check/PCTextDriver.hxx"
 #include "TFEL/Check/PCJUnitDriver.hxx"
@@ -157,6 +162,21 @@ namespace tfel::check {
     bool treatSubstitution();
     //! \brief register call backs associated to command line arguments
     void registerArgumentCallBacks();
+    /*!
+     * \brief execute the given tests, taking into account their
+     * dependencies
+     * \param[in] pool: thread pool
+     * \param[in] tests: list of tests given by their directory and their
+     * input file
+     * \param[in] exe: function executing a test. The last argument of
+     * this function is an error message which, if not empty, states that
+     * the test shall not be executed and shall be reported as a failure.
+     */
+    int schedule(tfel::system::ThreadPool&,
+                 const std::vector<std::pair<std::string, std::string>>&,
+                 const std::function<bool(const std::string&,
+                                          const std::string&,
+                                          const std::string&)>&);
     //! \brief configuration manager
     ConfigurationManager configurations;
     //! \brief list of configuration files
@@ -180,6 +200,10 @@ namespace tfel::check {
      * synchronized
      */
     bool synchronize_terminal_output = false;
+    //! \brief boolean stating if the results of the previous runs are used
+    bool use_cache = false;
+    //! \brief file in which the results of the previous runs are stored
+    std::string cache_file = "tfel-check.cache";
   };  // end of struct TFELCheck
 
   bool TFELCheck::treatSubstitution() {
@@ -316,7 +340,33 @@ namespace tfel::check {
             "disable test on the number of jobs allowed to run simultaneously.",
             [this, read_boolean_value] {
               this->discard_jobs_limit =
-                  read_boolean_value("--discard-commands-failure");
+                  read_boolean_value("--discard-jobs-limit");
+            },
+            true));
+    this->registerCallBack(
+        "--use-cache",
+        CallBack(
+            "skip the tests whose inputs (input file, files appearing in the "
+            "commands, compared files, files declared by the `@Inputs` "
+            "keyword and dependencies) did not change since their last "
+            "successful execution (false by default).",
+            [this, read_boolean_value] {
+              this->use_cache = read_boolean_value("--use-cache");
+            },
+            true));
+    this->registerCallBack(
+        "--cache-file",
+        CallBack(
+            "specify the file in which the results of the previous runs are "
+            "stored (`tfel-check.cache` by default). This option implies "
+            "`--use-cache=true`.",
+            [this] {
+              this->cache_file = this->currentArgument->getOption();
+              if (this->cache_file.empty()) {
+                std::cerr << "no file name given to '--cache-file'\n";
+                std::exit(EXIT_FAILURE);
+              }
+              this->use_cache = true;
             },
             true));
     this->registerCallBack(
@@ -378,6 +428,180 @@ namespace tfel::check {
     declareTFELExecutables(this->configurations);
   }  // end of TFELCheck::TFELCheck
 
+  int TFELCheck::schedule(
+      tfel::system::ThreadPool& pool,
+      const std::vector<std::pair<std::string, std::string>>& tests,
+      const std::function<bool(const std::string&,
+                               const std::string&,
+                               const std::string&)>& exe) {
+    using size_type = tfel::system::ThreadPool::size_type;
+    // description of a test in the dependency graph
+    struct Node {
+      //! \brief directory
+      std::string directory;
+      //! \brief input file
+      std::string file;
+      //! \brief tests on which this test depends, as declared
+      std::vector<std::string> dependencies;
+      //! \brief indices of the tests depending on this test
+      std::vector<size_type> dependents;
+      //! \brief error detected while building the graph
+      std::string error;
+    };
+    auto nodes = std::vector<Node>{};
+    auto ids = std::map<std::string, size_type>{};
+    auto add_node = [&nodes, &ids](const std::string& d,
+                                   const std::string& f) -> size_type {
+      auto id = d + '/' + f;
+      try {
+        id = getTestIdentifier(d, f);
+      } catch (std::exception&) {
+        // the error will be reported while executing the test
+      }
+      const auto [p, b] = ids.insert({id, nodes.size()});
+      if (b) {
+        nodes.push_back(Node{d, f, {}, {}, {}});
+      }
+      return p->second;
+    };
+    for (const auto& [d, f] : tests) {
+      add_node(d, f);
+    }
+    // Dependencies are extracted in parallel. The tests on which a test
+    // depends are added to the graph if they were not given by the user.
+    auto b = size_type{};
+    while (b != nodes.size()) {
+      const auto e = nodes.size();
+      pool.parallel_for(b, e, [this, &nodes](const size_type i0,
+                                             const size_type i1) {
+        for (auto i = i0; i != i1; ++i) {
+          auto& n = nodes[i];
+          try {
+            auto c = this->configurations.getConfiguration(n.directory);
+            c.directory = n.directory;
+            n.dependencies = TestLauncher::getDependencies(c, n.file);
+          } catch (std::exception&) {
+            // the error will be reported while executing the test
+          }
+        }
+      });
+      for (auto i = b; i != e; ++i) {
+        const auto dependencies = nodes[i].dependencies;
+        const auto d = nodes[i].directory;
+        for (const auto& dependency : dependencies) {
+          try {
+            getTestIdentifier(d, dependency);
+          } catch (std::exception&) {
+            nodes[i].error = "test '" + dependency + "' does not exist";
+            continue;
+          }
+          const auto path =
+              std::filesystem::path(d + '/' + dependency).lexically_normal();
+          const auto pd = path.parent_path().string();
+          const auto j = add_node(pd.empty() ? "." : pd,
+                                  path.filename().string());
+          if (j == i) {
+            nodes[i].error = "test depends on itself";
+            continue;
+          }
+          nodes[j].dependents.push_back(i);
+        }
+      }
+      b = e;
+    }
+    // number of dependencies not treated yet
+    const auto n = nodes.size();
+    auto remaining = std::vector<std::atomic<size_type>>(n);
+    auto failed_dependencies = std::vector<std::atomic<bool>>(n);
+    for (size_type i = 0; i != n; ++i) {
+      remaining[i] = 0;
+      failed_dependencies[i] = false;
+    }
+    for (const auto& node : nodes) {
+      for (const auto j : node.dependents) {
+        ++(remaining[j]);
+      }
+    }
+    // detection of circular dependencies (Kahn's algorithm)
+    auto in_cycle = std::vector<bool>(n, true);
+    {
+      auto counts = std::vector<size_type>(n);
+      auto ready = std::vector<size_type>{};
+      for (size_type i = 0; i != n; ++i) {
+        counts[i] = remaining[i];
+        if (counts[i] == 0) {
+          ready.push_back(i);
+        }
+      }
+      while (!ready.empty()) {
+        const auto i = ready.back();
+        ready.pop_back();
+        in_cycle[i] = false;
+        for (const auto j : nodes[i].dependents) {
+          if (--(counts[j]) == 0) {
+            ready.push_back(j);
+          }
+        }
+      }
+    }
+    // execution of the tests. A test is executed as soon as all the tests
+    // on which it depends have been executed.
+    auto results =
+        std::vector<std::future<tfel::system::ThreadedTaskResult<bool>>>(n);
+    std::function<void(const size_type)> submit;
+    submit = [&pool, &nodes, &remaining, &failed_dependencies, &results, &exe,
+              &submit](const size_type i) {
+      results[i] = pool.addTask([&nodes, &remaining, &failed_dependencies,
+                                 &exe, &submit, i] {
+        const auto& node = nodes[i];
+        auto success = false;
+        try {
+          const auto error = failed_dependencies[i]
+                                 ? std::string{"a dependency failed"}
+                                 : node.error;
+          success = exe(node.directory, node.file, error);
+        } catch (...) {
+          success = false;
+        }
+        for (const auto j : node.dependents) {
+          if (!success) {
+            failed_dependencies[j] = true;
+          }
+          if (--(remaining[j]) == 0) {
+            submit(j);
+          }
+        }
+        return success;
+      });
+    };
+    for (size_type i = 0; i != n; ++i) {
+      if (in_cycle[i]) {
+        const auto& node = nodes[i];
+        results[i] = pool.addTask([&exe, &node] {
+          return exe(node.directory, node.file,
+                     "circular dependency detected");
+        });
+      } else if (remaining[i] == 0) {
+        submit(i);
+      }
+    }
+    // waiting for all jobs to terminate
+    pool.wait();
+    // checking the output values of all jobs
+    int status = EXIT_SUCCESS;
+    for (auto& f : results) {
+      auto r = f.get();
+      if (!r) {
+        status = EXIT_FAILURE;
+      } else {
+        if (!(*r)) {
+          status = EXIT_FAILURE;
+        }
+      }
+    }
+    return status;
+  }  // end of schedule
+
   int TFELCheck::execute() {
     using namespace std;
     auto pool = tfel::system::ThreadPool{this->njobs};
@@ -386,10 +610,26 @@ namespace tfel::check {
       std::cerr << "can't open file 'tfel-check.log'\n";
       std::exit(EXIT_FAILURE);
     }
-    auto exe = [this, &log_file](const std::string& d, const std::string& f) {
+    auto cache = std::shared_ptr<ResultsCache>{};
+    if (this->use_cache) {
+      try {
+        cache = std::make_shared<ResultsCache>(this->cache_file);
+      } catch (std::exception& e) {
+        std::cerr << e.what() << '\n';
+        std::exit(EXIT_FAILURE);
+      }
+    }
+    auto exe = [this, &log_file, &cache](const std::string& d,
+                                         const std::string& f,
+                                         const std::string& error) {
       using namespace tfel::system;
-      const auto cpath = systemCall::getCurrentWorkingDirectory();
-      const auto path = systemCall::getAbsolutePath(d);
+      const auto path = [&d] {
+        try {
+          return systemCall::getAbsolutePath(d);
+        } catch (std::exception&) {
+          return d;
+        }
+      }();
       // store the output of the given process that will be saved in
       // tfel-check.log
       std::ostringstream output;
@@ -400,17 +640,22 @@ namespace tfel::check {
       }
       log.addMessage("entering directory '" + path + "'");
       log.addMessage("* beginning of test '" + d + '/' + f + "'");
-      const auto name = d + '/' + f;
       auto success = true;
-      try {
-        auto c = this->configurations.getConfiguration(d);
-        c.log = log;
-        c.directory = d;
-        TestLauncher t(c, f);
-        success = t.execute(c);
-      } catch (std::exception& e) {
-        log.addMessage("test failed : '" + f + "', reason:\n" + e.what());
+      if (!error.empty()) {
+        log.addMessage("test failed : '" + f + "', reason:\n" + error);
         success = false;
+      } else {
+        try {
+          auto c = this->configurations.getConfiguration(d);
+          c.log = log;
+          c.directory = d;
+          c.cache = cache;
+          TestLauncher t(c, f);
+          success = t.execute(c);
+        } catch (std::exception& e) {
+          log.addMessage("test failed : '" + f + "', reason:\n" + e.what());
+          success = false;
+        }
       }
       log.addSimpleTestResult("* end of test '" + d + '/' + f + "'", success);
       log.addMessage("======");
@@ -424,15 +669,13 @@ namespace tfel::check {
       }
       return success;
     };
-    auto future_results =
-        std::vector<std::future<tfel::system::ThreadedTaskResult<bool>>>{};
+    auto tests = std::vector<std::pair<std::string, std::string>>{};
     if (this->inputs.empty()) {
       std::regex re(".+\\.check", std::regex_constants::extended);
       const auto& files = tfel::system::recursiveFind(re, ".", false);
       for (const auto& d : files) {
         for (const auto& f : d.second) {
-          future_results.push_back(
-              pool.addTask([exe, d, f] { return exe(d.first, f); }));
+          tests.push_back({d.first, f});
         }
       }
     } else {
@@ -450,7 +693,6 @@ namespace tfel::check {
           std::exit(EXIT_FAILURE);
         }
       }
-      // executing each input files
       for (const auto& i : this->inputs) {
         //
         const auto path = strdup(i.c_str());
@@ -459,23 +701,16 @@ namespace tfel::check {
         const auto f = std::string(::basename(path2));
         ::free(path);
         ::free(path2);
-        // shall a new thread which starts a fork
-        future_results.push_back(
-            pool.addTask([exe, d, f] { return exe(d, f); }));
+        tests.push_back({d, f});
       }
     }
-    // waiting for all jobs to terminate
-    pool.wait();
-    // checking the output values of all jobs
-    int status = EXIT_SUCCESS;
-    for (auto& f : future_results) {
-      auto r = f.get();
-      if (!r) {
+    auto status = this->schedule(pool, tests, exe);
+    if (cache) {
+      try {
+        cache->save();
+      } catch (std::exception& e) {
+        std::cerr << e.what() << '\n';
         status = EXIT_FAILURE;
-      } else {
-        if (!(*r)) {
-          status = EXIT_FAILURE;
-        }
       }
     }
     return status;
@@ -0,0 +1,85 @@
+/*!
+ * \file   tfel-check/tests/unitTest/test_ResultsCache.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright Copyright (C) 2006-2025 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <cstdio>
+#include <string>
+#include <fstream>
+#include <stdexcept>
+
+#include "TFEL/Raise.hxx"
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Check/ResultsCache.hxx"
+
+struct test_ResultsCache final : public tfel::tests::TestCase {
+  test_ResultsCache() : tfel::tests::TestCase("TFEL/Check", "ResultsCache") {}
+
+  tfel::tests::TestResult execute() override {
+    using tfel::check::ResultsCache;
+    const std::string cf = "test_ResultsCache.cache";
+    const std::string f = "test_ResultsCache.txt";
+    std::remove(cf.c_str());
+    auto write = [&f](const char* const c) {
+      std::ofstream file{f};
+      tfel::raise_if(!file,
+                     "test_ResultsCache::execute: "
+                     "could not open file '" +
+                         f + "'");
+      file << c;
+    };
+    // hashes of strings
+    const auto h0 = ResultsCache::hash();
+    TFEL_TESTS_ASSERT(ResultsCache::hash(h0, "ab") ==
+                      ResultsCache::hash(h0, "ab"));
+    TFEL_TESTS_ASSERT(ResultsCache::hash(h0, "ab") !=
+                      ResultsCache::hash(h0, "ba"));
+    TFEL_TESTS_ASSERT(ResultsCache::hash(ResultsCache::hash(h0, "a"), "bc") !=
+                      ResultsCache::hash(ResultsCache::hash(h0, "ab"), "c"));
+    // hashes of files
+    write("1 2 3\n");
+    {
+      auto c = ResultsCache{cf};
+      const auto fh = c.getFileHash(f);
+      TFEL_TESTS_ASSERT(fh.has_value());
+      TFEL_TESTS_ASSERT(c.getFileHash(f) == fh);
+      TFEL_TESTS_ASSERT(!c.getFileHash("test_ResultsCache.missing"));
+      write("1 2 4 5\n");
+      TFEL_TESTS_ASSERT(c.getFileHash(f) != fh);
+      // tests
+      TFEL_TESTS_ASSERT(!c.getTestHash("a"));
+      c.update("a", 12);
+      c.update("/path with spaces/b.check", 0xFFFFFFFFFFFFFFFFull);
+      c.update("c", 24);
+      c.remove("c");
+      TFEL_TESTS_ASSERT(c.isUpToDate("a", 12));
+      TFEL_TESTS_ASSERT(!c.isUpToDate("a", 13));
+      TFEL_TESTS_ASSERT(!c.isUpToDate("c", 24));
+      c.save();
+    }
+    // the cache is read back
+    auto c = ResultsCache{cf};
+    TFEL_TESTS_ASSERT(c.isUpToDate("a", 12));
+    TFEL_TESTS_ASSERT(
+        c.isUpToDate("/path with spaces/b.check", 0xFFFFFFFFFFFFFFFFull));
+    TFEL_TESTS_ASSERT(!c.getTestHash("c"));
+    // invalid cache file
+    {
+      std::ofstream file{cf};
+      file << "not a hash\n";
+    }
+    TFEL_TESTS_CHECK_THROW(ResultsCache{cf}, std::runtime_error);
+    return this->result;
+  }
+};
+
+TFEL_TESTS_GENERATE_PROXY(test_ResultsCache, "ResultsCache");
@@ -0,0 +1,101 @@
+/*!
+ * \file   tfel-check/tests/unitTest/test_TestLauncher.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright Copyright (C) 2006-2025 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <string>
+#include <memory>
+#include <cstdlib>
+#include <fstream>
+#include <filesystem>
+
+#include "TFEL/Raise.hxx"
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Check/Configuration.hxx"
+#include "TFEL/Check/ResultsCache.hxx"
+#include "TFEL/Check/TestLauncher.hxx"
+
+/*!
+ * \brief check that a test is skipped by the results cache only if neither
+ * its inputs nor the executables called by its commands have changed.
+ */
+struct test_TestLauncher final : public tfel::tests::TestCase {
+  test_TestLauncher() : tfel::tests::TestCase("TFEL/Check", "TestLauncher") {}
+
+  tfel::tests::TestResult execute() override {
+#if !((defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__))
+    namespace fs = std::filesystem;
+    using namespace tfel::check;
+    const std::string d = "test_TestLauncher";
+    fs::remove_all(d);
+    fs::create_directory(d);
+    auto write = [](const std::string& f, const std::string& c) {
+      std::ofstream file{f};
+      tfel::raise_if(!file,
+                     "test_TestLauncher::execute: "
+                     "could not open file '" +
+                         f + "'");
+      file << c;
+    };
+    // the tool under test appends a line to `runs.txt` at each call. It
+    // is looked for in the `PATH`, so that it does not appear in the
+    // arguments of the command.
+    const auto bin = fs::absolute(d + "/bin").string();
+    fs::create_directory(bin);
+    const auto tool = bin + "/tfel-check-tool";
+    write(tool, "#!/bin/sh\necho run >> runs.txt\n");
+    fs::permissions(tool, fs::perms::owner_all, fs::perm_options::add);
+    write(d + "/test.check", "@Command \"tfel-check-tool\";\n");
+    const auto* const path = std::getenv("PATH");
+    auto c = Configuration{};
+    c.directory = d;
+    c.environments["PATH"] =
+        path != nullptr ? bin + ':' + std::string{path} : bin;
+    c.cache = std::make_shared<ResultsCache>(d + "/tfel-check.cache");
+    auto run = [&c] {
+      auto t = TestLauncher{c, "test.check"};
+      return t.execute(c);
+    };
+    auto number_of_runs = [&d] {
+      auto n = std::size_t{};
+      std::ifstream file{d + "/runs.txt"};
+      auto l = std::string{};
+      while (std::getline(file, l)) {
+        ++n;
+      }
+      return n;
+    };
+    TFEL_TESTS_ASSERT(run());
+    TFEL_TESTS_ASSERT(number_of_runs() == 1u);
+    // nothing changed, the test is skipped
+    TFEL_TESTS_ASSERT(run());
+    TFEL_TESTS_ASSERT(number_of_runs() == 1u);
+    // the tool under test changed, the test must be executed again
+    write(tool, "#!/bin/sh\n# new version\necho run >> runs.txt\n");
+    TFEL_TESTS_ASSERT(run());
+    TFEL_TESTS_ASSERT(number_of_runs() == 2u);
+    TFEL_TESTS_ASSERT(run());
+    TFEL_TESTS_ASSERT(number_of_runs() == 2u);
+    // the input file changed
+    write(d + "/test.check",
+          "@Command \"tfel-check-tool\";\n"
+          "@Command \"tfel-check-tool\";\n");
+    TFEL_TESTS_ASSERT(run());
+    TFEL_TESTS_ASSERT(number_of_runs() == 4u);
+    TFEL_TESTS_ASSERT(run());
+    TFEL_TESTS_ASSERT(number_of_runs() == 4u);
+#endif
+    return this->result;
+  }  // end of execute
+};
+
+TFEL_TESTS_GENERATE_PROXY(test_TestLauncher, "TestLauncher");